@@ -0,0 +1,185 @@
+﻿#include <charconv>
+#include <cstdio>
+#include <fstream>
+#include <iostream>
+#include <sstream>
+
+#include "Benchmark.h"
+
+namespace ByteEngine::Benchmarks
+{
+    namespace
+    {
+        // Finds "key": after position and returns the position right after the colon
+        size_t FindKey(const std::string& text, std::string_view key, size_t position)
+        {
+            std::string quoted = "\"" + std::string(key) + "\"";
+            size_t found = text.find(quoted, position);
+
+            if (found == std::string::npos)
+                return std::string::npos;
+
+            size_t colon = text.find(':', found + quoted.size());
+            return colon == std::string::npos ? std::string::npos : colon + 1;
+        }
+
+        size_t SkipSpaces(const std::string& text, size_t position)
+        {
+            while (position < text.size() && (text[position] == ' ' || text[position] == '\t' || text[position] == '\n' || text[position] == '\r'))
+                position++;
+
+            return position;
+        }
+    }
+
+    void Detail::UseCharPointer(const volatile char*)
+    { }
+
+    bool RegisterBenchmark(std::string_view group, BenchmarkFunction function)
+    {
+        GetRegisteredBenchmarks().push_back(RegisteredBenchmark { group, function });
+        return true;
+    }
+
+    std::vector<RegisteredBenchmark>& GetRegisteredBenchmarks()
+    {
+        // Function local so registration from static initializers in other files is safe
+        static std::vector<RegisteredBenchmark> benchmarks;
+        return benchmarks;
+    }
+
+    std::string_view GetMathBackendName()
+    {
+#if defined(BYTEENGINE_MATH_SIMD_DIRECTXMATH)
+        return "DirectXMath";
+#elif defined(BYTEENGINE_MATH_SIMD_AVX2)
+        return "AVX2";
+#elif defined(BYTEENGINE_MATH_SIMD_SSE4)
+        return "SSE4";
+#elif defined(BYTEENGINE_MATH_SIMD_SCALAR)
+        return "Scalar";
+#else
+        return "Default";
+#endif
+    }
+
+    std::vector<float> MakeRandomFloats(size_t count, float min, float max, uint32 seed)
+    {
+        std::mt19937 rng(seed);
+        std::uniform_real_distribution<float> distribution(min, max);
+        std::vector<float> values(count);
+
+        for (float& value : values)
+            value = distribution(rng);
+
+        return values;
+    }
+
+    void PrintResults(const std::vector<BenchmarkResult>& results)
+    {
+        std::printf("%-44s %12s %12s %12s %14s\n", "Benchmark", "ns/item", "min", "max", "items/s");
+
+        for (const BenchmarkResult& result : results)
+        {
+            double itemsPerSecond = result.nsPerItem > 0.0 ? 1e9 / result.nsPerItem : 0.0;
+            std::printf("%-44s %12.3f %12.3f %12.3f %14.4g\n", result.name.c_str(), result.nsPerItem, result.minNsPerItem, result.maxNsPerItem, itemsPerSecond);
+        }
+    }
+
+    bool WriteJson(const std::vector<BenchmarkResult>& results, const std::string& path)
+    {
+        std::ofstream file(path);
+
+        if (!file)
+            return false;
+
+        file << "{\n  \"backend\": \"" << GetMathBackendName() << "\",\n  \"benchmarks\": [\n";
+
+        for (size_t i = 0; i < results.size(); i++)
+        {
+            const BenchmarkResult& result = results[i];
+            file << "    { \"name\": \"" << result.name << "\", \"ns_per_item\": " << result.nsPerItem
+                << ", \"min_ns_per_item\": " << result.minNsPerItem << ", \"max_ns_per_item\": " << result.maxNsPerItem
+                << ", \"items_per_call\": " << result.itemsPerCall << ", \"calls_per_repetition\": " << result.callsPerRepetition << " }"
+                << (i + 1 < results.size() ? ",\n" : "\n");
+        }
+
+        file << "  ]\n}\n";
+        return static_cast<bool>(file);
+    }
+
+    // Reads the files written by WriteJson, not a general JSON parser
+    bool ReadJson(const std::string& path, std::vector<BenchmarkResult>& results)
+    {
+        std::ifstream file(path);
+
+        if (!file)
+            return false;
+
+        std::stringstream stream;
+        stream << file.rdbuf();
+        std::string text = stream.str();
+
+        size_t position = 0;
+
+        while ((position = FindKey(text, "name", position)) != std::string::npos)
+        {
+            size_t nameStart = text.find('"', position);
+            size_t nameEnd = nameStart == std::string::npos ? std::string::npos : text.find('"', nameStart + 1);
+            size_t valueStart = nameEnd == std::string::npos ? std::string::npos : FindKey(text, "ns_per_item", nameEnd);
+
+            if (valueStart == std::string::npos)
+                return false;
+
+            valueStart = SkipSpaces(text, valueStart);
+
+            BenchmarkResult result;
+            result.name = text.substr(nameStart + 1, nameEnd - nameStart - 1);
+            auto [end, error] = std::from_chars(text.data() + valueStart, text.data() + text.size(), result.nsPerItem);
+
+            if (error != std::errc())
+                return false;
+
+            results.push_back(std::move(result));
+            position = static_cast<size_t>(end - text.data());
+        }
+
+        return true;
+    }
+
+    int32 Compare(const std::vector<BenchmarkResult>& baseline, const std::vector<BenchmarkResult>& current, double thresholdPercent)
+    {
+        int32 regressions = 0;
+
+        std::printf("%-44s %12s %12s %9s\n", "Benchmark", "baseline", "current", "change");
+
+        for (const BenchmarkResult& result : current)
+        {
+            auto match = std::find_if(baseline.begin(), baseline.end(), [&](const BenchmarkResult& other) { return other.name == result.name; });
+
+            if (match == baseline.end() || match->nsPerItem <= 0.0)
+            {
+                std::printf("%-44s %12s %12.3f %9s\n", result.name.c_str(), "-", result.nsPerItem, "new");
+                continue;
+            }
+
+            double change = (result.nsPerItem / match->nsPerItem - 1.0) * 100.0;
+            const char* verdict = "";
+
+            if (change > thresholdPercent)
+            {
+                verdict = "  REGRESSION";
+                regressions++;
+            }
+            else if (change < -thresholdPercent)
+            {
+                verdict = "  faster";
+            }
+
+            std::printf("%-44s %12.3f %12.3f %+8.1f%%%s\n", result.name.c_str(), match->nsPerItem, result.nsPerItem, change, verdict);
+        }
+
+        std::printf("%d regression(s) above %.1f%%\n", regressions, thresholdPercent);
+        return regressions;
+    }
+}
\ No newline at end of file
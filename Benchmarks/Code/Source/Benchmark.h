@@ -0,0 +1,152 @@
+﻿#pragma once
+
+#include <algorithm>
+#include <chrono>
+#include <random>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include "ByteEngine/Primitives.h"
+
+namespace ByteEngine::Benchmarks
+{
+    struct RunSettings
+    {
+        // Minimum duration of one repetition, the iteration count is raised until it is reached
+        double minTimeMs = 50.0;
+        int32 repetitions = 5;
+
+        // Only benchmarks whose full name contains this are run
+        std::string_view filter;
+    };
+
+    struct BenchmarkResult
+    {
+        // "Group/Label", stable between runs so results can be compared
+        std::string name;
+
+        // Median, fastest and slowest repetition
+        double nsPerItem = 0.0;
+        double minNsPerItem = 0.0;
+        double maxNsPerItem = 0.0;
+
+        size_t itemsPerCall = 0;
+        size_t callsPerRepetition = 0;
+    };
+
+    namespace Detail
+    {
+        // Defined in Benchmark.cpp so the compiler cannot see that the pointer is never read
+        void UseCharPointer(const volatile char* pointer);
+    }
+
+    // Keeps the compiler from removing a computation whose result is otherwise unused
+    template<typename T>
+    inline void DoNotOptimize(const T& value)
+    {
+#if defined(_MSC_VER) && !defined(__clang__)
+        Detail::UseCharPointer(&reinterpret_cast<const volatile char&>(value));
+        _ReadWriteBarrier();
+#else
+        asm volatile("" : : "r,m"(value) : "memory");
+#endif
+    }
+
+    class BenchmarkState
+    {
+    private:
+        const RunSettings& settings;
+        std::vector<BenchmarkResult>& results;
+        std::string_view group;
+
+    public:
+        BenchmarkState(const RunSettings& settings, std::vector<BenchmarkResult>& results, std::string_view group)
+            : settings(settings), results(results), group(group)
+        { }
+
+        // Times body() and records the median of the repetitions under "group/label".
+        // items is the amount of work one call does, results are reported per item.
+        // Setup belongs outside the body, it runs once per benchmark group
+        template<typename Body>
+        void Measure(std::string_view label, size_t items, Body&& body)
+        {
+            std::string name = std::string(group) + "/" + std::string(label);
+
+            if (!settings.filter.empty() && name.find(settings.filter) == std::string::npos)
+                return;
+
+            using Clock = std::chrono::steady_clock;
+
+            auto run = [&](size_t calls)
+                {
+                    Clock::time_point start = Clock::now();
+
+                    for (size_t i = 0; i < calls; i++)
+                        body();
+
+                    return std::chrono::duration<double, std::nano>(Clock::now() - start).count();
+                };
+
+            // Grow the call count until one repetition takes minTimeMs, this also warms up caches
+            double targetNs = settings.minTimeMs * 1e6;
+            size_t calls = 1;
+            double elapsedNs = run(calls);
+
+            while (elapsedNs < targetNs && calls < (size_t(1) << 40))
+            {
+                double scale = elapsedNs > 0.0 ? targetNs / elapsedNs * 1.2 : 10.0;
+                calls = std::max(calls + 1, static_cast<size_t>(static_cast<double>(calls) * std::min(scale, 10.0)));
+                elapsedNs = run(calls);
+            }
+
+            std::vector<double> samples;
+
+            for (int32 i = 0; i < settings.repetitions; i++)
+                samples.push_back(run(calls) / static_cast<double>(calls * items));
+
+            std::sort(samples.begin(), samples.end());
+
+            BenchmarkResult result;
+            result.name = std::move(name);
+            result.nsPerItem = samples[samples.size() / 2];
+            result.minNsPerItem = samples.front();
+            result.maxNsPerItem = samples.back();
+            result.itemsPerCall = items;
+            result.callsPerRepetition = calls;
+            results.push_back(std::move(result));
+        }
+    };
+
+    using BenchmarkFunction = void(*)(BenchmarkState&);
+
+    struct RegisteredBenchmark
+    {
+        std::string_view group;
+        BenchmarkFunction function;
+    };
+
+    bool RegisterBenchmark(std::string_view group, BenchmarkFunction function);
+    std::vector<RegisteredBenchmark>& GetRegisteredBenchmarks();
+
+    // Name of the math backend the benchmarks were built with
+    std::string_view GetMathBackendName();
+
+    // Deterministic inputs, so runs on different commits see the same data
+    std::vector<float> MakeRandomFloats(size_t count, float min, float max, uint32 seed = 1);
+
+    void PrintResults(const std::vector<BenchmarkResult>& results);
+    bool WriteJson(const std::vector<BenchmarkResult>& results, const std::string& path);
+    bool ReadJson(const std::string& path, std::vector<BenchmarkResult>& results);
+
+    // Prints the change against the baseline for every benchmark present in both.
+    // Returns the number of benchmarks that got slower by more than thresholdPercent
+    int32 Compare(const std::vector<BenchmarkResult>& baseline, const std::vector<BenchmarkResult>& current, double thresholdPercent);
+}
+
+// Defines a benchmark group. The body receives a BenchmarkState& named state, does its setup
+// and calls state.Measure for each operation
+#define BYTEENGINE_BENCHMARK(group) \
+    static void group##Benchmark(::ByteEngine::Benchmarks::BenchmarkState& state); \
+    [[maybe_unused]] static const bool group##Registered = ::ByteEngine::Benchmarks::RegisterBenchmark(#group, group##Benchmark); \
+    static void group##Benchmark(::ByteEngine::Benchmarks::BenchmarkState& state)
@@ -0,0 +1,183 @@
+﻿#include <algorithm>
+#include <atomic>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <thread>
+
+#include "Benchmark.h"
+#include "ByteEngine/Core/EventSystem/ConcurrentMulticastDelegate.h"
+#include "ByteEngine/Core/EventSystem/MulticastDelegate.h"
+
+using namespace ByteEngine;
+using namespace ByteEngine::EventSystem;
+using namespace ByteEngine::Benchmarks;
+
+static constexpr size_t SubscriberCount = 100;
+static constexpr size_t InvokesPerThread = 256;
+
+namespace
+{
+    // The straightforward alternative: the single threaded delegate behind one mutex
+    template<typename... Args>
+    class MutexMulticastDelegate
+    {
+    private:
+        MulticastDelegate<Args...> delegate;
+        std::mutex mutex;
+
+    public:
+        template<typename LambdaT>
+        SubscriptionHandle SubscribeLambda(LambdaT&& lambda)
+        {
+            std::lock_guard lock(mutex);
+            return delegate.SubscribeLambda(std::forward<LambdaT>(lambda));
+        }
+
+        void Unsubscribe(SubscriptionHandle handle)
+        {
+            std::lock_guard lock(mutex);
+            delegate.Unsubscribe(handle);
+        }
+
+        void Invoke(Args... args)
+        {
+            std::lock_guard lock(mutex);
+            delegate.Invoke(args...);
+        }
+    };
+
+    // Reference counted snapshots behind std::atomic<std::shared_ptr>. Every Invoke bumps the count of the same control
+    // block, and the standard library guards the pointer with a lock, so invokers on different cores contend
+    template<typename... Args>
+    class SharedSnapshotDelegate
+    {
+    private:
+        using Snapshot = std::vector<std::pair<SubscriptionHandle, std::function<void(Args...)>>>;
+
+        std::atomic<std::shared_ptr<const Snapshot>> snapshot { std::make_shared<const Snapshot>() };
+        std::mutex writeMutex;
+        SubscriptionHandle nextHandle = 1;
+
+    public:
+        template<typename LambdaT>
+        SubscriptionHandle SubscribeLambda(LambdaT&& lambda)
+        {
+            std::lock_guard lock(writeMutex);
+            auto next = std::make_shared<Snapshot>(*snapshot.load());
+            next->emplace_back(nextHandle, std::forward<LambdaT>(lambda));
+            snapshot.store(std::move(next));
+
+            return nextHandle++;
+        }
+
+        void Unsubscribe(SubscriptionHandle handle)
+        {
+            std::lock_guard lock(writeMutex);
+            auto next = std::make_shared<Snapshot>(*snapshot.load());
+            std::erase_if(*next, [=](const auto& subscriber) { return subscriber.first == handle; });
+            snapshot.store(std::move(next));
+        }
+
+        void Invoke(Args... args) const
+        {
+            std::shared_ptr<const Snapshot> current = snapshot.load(std::memory_order_acquire);
+
+            for (const auto& subscriber : *current)
+                subscriber.second(args...);
+        }
+    };
+
+    // Subscribes and unsubscribes in a loop on its own thread while it is alive, like a streaming loader
+    template<typename DelegateT>
+    class BackgroundChurn
+    {
+    private:
+        std::atomic<bool> running = true;
+        std::thread thread;
+
+    public:
+        explicit BackgroundChurn(DelegateT& delegate)
+            : thread([this, &delegate]
+                {
+                    while (running.load(std::memory_order_relaxed))
+                    {
+                        SubscriptionHandle handle = delegate.SubscribeLambda([](int32) { });
+                        delegate.Unsubscribe(handle);
+                    }
+                })
+        { }
+
+        ~BackgroundChurn()
+        {
+            running = false;
+            thread.join();
+        }
+    };
+
+    template<typename DelegateT>
+    void InvokeOnThreads(DelegateT& delegate, uint32 threadCount)
+    {
+        std::vector<std::thread> threads;
+        threads.reserve(threadCount);
+
+        for (uint32 i = 0; i < threadCount; i++)
+        {
+            threads.emplace_back([&]
+                {
+                    for (size_t invoke = 0; invoke < InvokesPerThread; invoke++)
+                        delegate.Invoke(1);
+                });
+        }
+
+        for (std::thread& thread : threads)
+            thread.join();
+    }
+}
+
+BYTEENGINE_BENCHMARK(ConcurrentMulticastDelegate)
+{
+    MulticastDelegate<int32> singleThreaded;
+    MutexMulticastDelegate<int32> mutexDelegate;
+    SharedSnapshotDelegate<int32> sharedDelegate;
+    ConcurrentMulticastDelegate<int32> snapshotDelegate;
+
+    // Touches no shared state, so the threads only contend on the delegate
+    auto listener = [](int32 value) { DoNotOptimize(value); };
+
+    for (size_t i = 0; i < SubscriberCount; i++)
+    {
+        singleThreaded.SubscribeLambda(listener);
+        mutexDelegate.SubscribeLambda(listener);
+        sharedDelegate.SubscribeLambda(listener);
+        snapshotDelegate.SubscribeLambda(listener);
+    }
+
+    state.Measure("SingleThreadedInvoke", SubscriberCount, [&] { singleThreaded.Invoke(1); });
+    state.Measure("MutexInvoke", SubscriberCount, [&] { mutexDelegate.Invoke(1); });
+    state.Measure("SharedSnapshotInvoke", SubscriberCount, [&] { sharedDelegate.Invoke(1); });
+    state.Measure("SnapshotInvoke", SubscriberCount, [&] { snapshotDelegate.Invoke(1); });
+
+    {
+        BackgroundChurn churn(mutexDelegate);
+        state.Measure("MutexInvokeWhileSubscribing", SubscriberCount, [&] { mutexDelegate.Invoke(1); });
+    }
+
+    {
+        BackgroundChurn churn(sharedDelegate);
+        state.Measure("SharedSnapshotInvokeWhileSubscribing", SubscriberCount, [&] { sharedDelegate.Invoke(1); });
+    }
+
+    {
+        BackgroundChurn churn(snapshotDelegate);
+        state.Measure("SnapshotInvokeWhileSubscribing", SubscriberCount, [&] { snapshotDelegate.Invoke(1); });
+    }
+
+    // Every hardware thread invokes at once, at least 4 so there is contention even on small machines
+    uint32 threadCount = std::max(4u, std::thread::hardware_concurrency());
+    size_t items = threadCount * InvokesPerThread * SubscriberCount;
+
+    state.Measure("MutexInvokeAllThreads", items, [&] { InvokeOnThreads(mutexDelegate, threadCount); });
+    state.Measure("SharedSnapshotInvokeAllThreads", items, [&] { InvokeOnThreads(sharedDelegate, threadCount); });
+    state.Measure("SnapshotInvokeAllThreads", items, [&] { InvokeOnThreads(snapshotDelegate, threadCount); });
+}
\ No newline at end of file
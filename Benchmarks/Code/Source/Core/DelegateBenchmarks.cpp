@@ -0,0 +1,109 @@
+﻿#include <memory>
+
+#include "Benchmark.h"
+#include "ByteEngine/Core/EventSystem/Delegate.h"
+#include "ByteEngine/Detail/Core/EventSystem/Subscriptions.h"
+
+using namespace ByteEngine;
+using namespace ByteEngine::EventSystem;
+using namespace ByteEngine::Benchmarks;
+
+// Roughly the input delegates of a few hundred widgets and gameplay objects
+static constexpr size_t DelegateCount = 256;
+
+namespace
+{
+    // The previous Delegate: one heap allocated subscription per target, invoked through a virtual call
+    template<typename Ret, typename... Args>
+    class VirtualDelegate
+    {
+    private:
+        std::unique_ptr<Subcription<Ret, Args...>> subscription;
+
+    public:
+        template<typename InstanceT>
+        void SubscribeRawPointer(InstanceT* instance, Ret(InstanceT::* method)(Args...))
+        {
+            subscription = std::make_unique<RawPtrSubcription<InstanceT, Ret, Args...>>(instance, method);
+        }
+
+        template<typename LambdaT>
+        void SubscribeLambda(LambdaT&& lambda)
+        {
+            subscription = std::make_unique<LambdaSubcription<std::decay_t<LambdaT>, Ret, Args...>>(std::forward<LambdaT>(lambda));
+        }
+
+        Ret Invoke(Args... args)
+        {
+            if (subscription)
+                subscription->Invoke(std::forward<Args>(args)...);
+        }
+    };
+
+    struct Receiver
+    {
+        int32 keyPresses = 0;
+
+        void OnKeyStateChanged(int32 key, bool pressed)
+        {
+            keyPresses += pressed ? key : 0;
+        }
+    };
+}
+
+BYTEENGINE_BENCHMARK(Delegate)
+{
+    std::vector<Receiver> receivers(DelegateCount);
+    std::vector<VirtualDelegate<void, int32, bool>> virtualDelegates(DelegateCount);
+    std::vector<Delegate<void, int32, bool>> inlineDelegates(DelegateCount);
+
+    auto invokeAll = [&](auto& delegates)
+        {
+            for (auto& delegate : delegates)
+                delegate.Invoke(1, true);
+
+            DoNotOptimize(receivers.front().keyPresses);
+        };
+
+    for (size_t i = 0; i < DelegateCount; i++)
+    {
+        virtualDelegates[i].SubscribeRawPointer(&receivers[i], &Receiver::OnKeyStateChanged);
+        inlineDelegates[i].SubscribeRawPointer(&receivers[i], &Receiver::OnKeyStateChanged);
+    }
+
+    state.Measure("VirtualInvokeRawPointer", DelegateCount, [&] { invokeAll(virtualDelegates); });
+    state.Measure("InlineInvokeRawPointer", DelegateCount, [&] { invokeAll(inlineDelegates); });
+
+    for (size_t i = 0; i < DelegateCount; i++)
+    {
+        Receiver* receiver = &receivers[i];
+        virtualDelegates[i].SubscribeLambda([receiver](int32 key, bool pressed) { receiver->OnKeyStateChanged(key, pressed); });
+        inlineDelegates[i].SubscribeLambda([receiver](int32 key, bool pressed) { receiver->OnKeyStateChanged(key, pressed); });
+    }
+
+    state.Measure("VirtualInvokeLambda", DelegateCount, [&] { invokeAll(virtualDelegates); });
+    state.Measure("InlineInvokeLambda", DelegateCount, [&] { invokeAll(inlineDelegates); });
+
+    // Resubscribing, e.g. when input focus moves between widgets. The virtual version allocates every time
+    state.Measure("VirtualSubscribeLambda", DelegateCount, [&]
+        {
+            for (size_t i = 0; i < DelegateCount; i++)
+            {
+                Receiver* receiver = &receivers[i];
+                virtualDelegates[i].SubscribeLambda([receiver](int32 key, bool pressed) { receiver->OnKeyStateChanged(key, pressed); });
+            }
+
+            DoNotOptimize(virtualDelegates.front());
+        });
+
+    state.Measure("InlineSubscribeLambda", DelegateCount, [&]
+        {
+            for (size_t i = 0; i < DelegateCount; i++)
+            {
+                Receiver* receiver = &receivers[i];
+                inlineDelegates[i].SubscribeLambda([receiver](int32 key, bool pressed) { receiver->OnKeyStateChanged(key, pressed); });
+            }
+
+            DoNotOptimize(inlineDelegates.front());
+        });
+}
\ No newline at end of file
@@ -0,0 +1,111 @@
+﻿#include <numeric>
+#include <string>
+#include <vector>
+
+#include "Benchmark.h"
+#include "ByteEngine/Core/EventSystem/EventQueue.h"
+#include "ByteEngine/Core/EventSystem/MulticastDelegate.h"
+
+using namespace ByteEngine;
+using namespace ByteEngine::EventSystem;
+using namespace ByteEngine::Benchmarks;
+
+namespace
+{
+    struct ResizeEvent
+    {
+        static constexpr EventCoalescing Coalescing = EventCoalescing::KeepLast;
+
+        int32 width = 0;
+        int32 height = 0;
+    };
+
+    struct KeyEvent
+    {
+        int32 key = 0;
+        bool pressed = false;
+    };
+
+    // Stands in for the work a resize listener does, e.g. recreating swap chain buffers
+    struct ResizeTarget
+    {
+        std::vector<float> buffer = std::vector<float>(4096, 1.0f);
+        float total = 0.0f;
+
+        void OnResize(int32 width, int32 height)
+        {
+            buffer[0] = static_cast<float>(width * height);
+            total += std::accumulate(buffer.begin(), buffer.end(), 0.0f);
+        }
+    };
+
+    struct KeyTarget
+    {
+        int32 pressedCount = 0;
+
+        void OnKey(int32, bool pressed) { pressedCount += pressed ? 1 : 0; }
+    };
+}
+
+BYTEENGINE_BENCHMARK(EventQueue)
+{
+    // Resizes arriving in one frame while a window border is dragged
+    for (int32 eventCount : { 1, 16, 64 })
+    {
+        std::string suffix = std::to_string(eventCount);
+        ResizeTarget target;
+
+        MulticastDelegate<int32, int32> immediate;
+        immediate.SubscribeLambda([&](int32 width, int32 height) { target.OnResize(width, height); });
+
+        EventQueue queue;
+        queue.Listeners<ResizeEvent>().SubscribeLambda([&](const ResizeEvent& event) { target.OnResize(event.width, event.height); });
+
+        state.Measure("ImmediateResize" + suffix, eventCount, [&]
+            {
+                for (int32 i = 0; i < eventCount; i++)
+                    immediate.Invoke(800 + i, 600 + i);
+
+                DoNotOptimize(target.total);
+            });
+
+        state.Measure("QueuedResize" + suffix, eventCount, [&]
+            {
+                for (int32 i = 0; i < eventCount; i++)
+                    queue.Post(ResizeEvent { 800 + i, 600 + i });
+
+                queue.Dispatch();
+                DoNotOptimize(target.total);
+            });
+    }
+
+    // Key events are not coalesced, this measures what buffering costs over an immediate Invoke
+    for (int32 eventCount : { 16, 256 })
+    {
+        std::string suffix = std::to_string(eventCount);
+        KeyTarget target;
+
+        MulticastDelegate<int32, bool> immediate;
+        immediate.SubscribeLambda([&](int32 key, bool pressed) { target.OnKey(key, pressed); });
+
+        EventQueue queue;
+        queue.Listeners<KeyEvent>().SubscribeLambda([&](const KeyEvent& event) { target.OnKey(event.key, event.pressed); });
+
+        state.Measure("ImmediateKeys" + suffix, eventCount, [&]
+            {
+                for (int32 i = 0; i < eventCount; i++)
+                    immediate.Invoke(i, (i & 1) != 0);
+
+                DoNotOptimize(target.pressedCount);
+            });
+
+        state.Measure("QueuedKeys" + suffix, eventCount, [&]
+            {
+                for (int32 i = 0; i < eventCount; i++)
+                    queue.Post(KeyEvent { i, (i & 1) != 0 });
+
+                queue.Dispatch();
+                DoNotOptimize(target.pressedCount);
+            });
+    }
+}
\ No newline at end of file
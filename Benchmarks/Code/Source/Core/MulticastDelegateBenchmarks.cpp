@@ -0,0 +1,163 @@
+﻿#include <algorithm>
+#include <iterator>
+#include <memory>
+#include <string>
+#include <utility>
+
+#include "Benchmark.h"
+#include "ByteEngine/Core/EventSystem/MulticastDelegate.h"
+
+using namespace ByteEngine;
+using namespace ByteEngine::EventSystem;
+using namespace ByteEngine::Benchmarks;
+
+namespace
+{
+    // The previous MulticastDelegate: heap allocated virtual subscriptions in a vector of pairs,
+    // linear scans per removed handle and shrink_to_fit every 50 invokes
+    template<typename... Args>
+    class VectorMulticastDelegate
+    {
+    private:
+        using SubscriptionItem = std::pair<SubscriptionHandle, std::unique_ptr<Subcription<void, Args...>>>;
+
+        std::vector<SubscriptionItem> subscriptions;
+        std::vector<SubscriptionItem> pendingSubscriptions;
+        std::vector<SubscriptionHandle> pendingRemovals;
+        SubscriptionHandle nextHandle = 1;
+        bool invoked = false;
+        int32 invokesCount = 0;
+
+    public:
+        template<typename LambdaT>
+        SubscriptionHandle SubscribeLambda(LambdaT&& lambda)
+        {
+            auto& target = invoked ? pendingSubscriptions : subscriptions;
+            target.emplace_back(nextHandle, std::make_unique<LambdaSubcription<std::decay_t<LambdaT>, void, Args...>>(std::forward<LambdaT>(lambda)));
+            return nextHandle++;
+        }
+
+        void Unsubscribe(SubscriptionHandle handle)
+        {
+            if (invoked)
+                pendingRemovals.emplace_back(handle);
+            else
+                std::erase_if(subscriptions, [=](const SubscriptionItem& item) { return item.first == handle; });
+        }
+
+        void Invoke(Args... args)
+        {
+            invokesCount++;
+            invoked = true;
+            std::erase_if(subscriptions, [](const SubscriptionItem& item) { return item.second->IsExpired(); });
+
+            for (const auto& [handle, subscription] : subscriptions)
+                subscription->Invoke(args...);
+
+            invoked = false;
+
+            for (SubscriptionHandle handle : pendingRemovals)
+                std::erase_if(subscriptions, [=](const SubscriptionItem& item) { return item.first == handle; });
+            pendingRemovals.clear();
+
+            subscriptions.insert(subscriptions.end(), std::make_move_iterator(pendingSubscriptions.begin()), std::make_move_iterator(pendingSubscriptions.end()));
+            pendingSubscriptions.clear();
+
+            if (invokesCount > 50)
+            {
+                invokesCount = 0;
+                subscriptions.shrink_to_fit();
+            }
+        }
+    };
+
+    struct Listener
+    {
+        int32 total = 0;
+
+        void OnEvent(int32 value) { total += value; }
+    };
+
+    // count subscribers, one of which replaces churnCount random others on every Invoke
+    template<typename DelegateT>
+    struct ChurnScenario
+    {
+        DelegateT delegate;
+        std::vector<Listener> listeners;
+        std::vector<SubscriptionHandle> handles;
+        std::minstd_rand rng { 5 };
+        size_t churnCount;
+
+        ChurnScenario(size_t count, size_t churnCount)
+            : listeners(count), churnCount(churnCount)
+        {
+            for (size_t i = 0; i < count; i++)
+                handles.push_back(Subscribe(i));
+
+            delegate.SubscribeLambda([this](int32) { Churn(); });
+        }
+
+        SubscriptionHandle Subscribe(size_t listener)
+        {
+            Listener* target = &listeners[listener];
+            return delegate.SubscribeLambda([target](int32 value) { target->OnEvent(value); });
+        }
+
+        void Churn()
+        {
+            for (size_t i = 0; i < churnCount; i++)
+            {
+                size_t victim = rng() % handles.size();
+                delegate.Unsubscribe(handles[victim]);
+                handles[victim] = Subscribe(victim);
+            }
+        }
+    };
+}
+
+BYTEENGINE_BENCHMARK(MulticastDelegate)
+{
+    for (size_t count : { 10, 100, 1000, 10000 })
+    {
+        std::string suffix = std::to_string(count);
+        std::vector<Listener> listeners(count);
+        VectorMulticastDelegate<int32> vectorDelegate;
+        MulticastDelegate<int32> slotDelegate;
+
+        for (Listener& listener : listeners)
+        {
+            Listener* target = &listener;
+            vectorDelegate.SubscribeLambda([target](int32 value) { target->OnEvent(value); });
+            slotDelegate.SubscribeLambda([target](int32 value) { target->OnEvent(value); });
+        }
+
+        state.Measure("VectorInvoke" + suffix, count, [&]
+            {
+                vectorDelegate.Invoke(1);
+                DoNotOptimize(listeners.front().total);
+            });
+
+        state.Measure("SlotMapInvoke" + suffix, count, [&]
+            {
+                slotDelegate.Invoke(1);
+                DoNotOptimize(listeners.front().total);
+            });
+
+        // A tenth of the subscribers is replaced from inside every Invoke
+        size_t churnCount = std::max<size_t>(1, count / 10);
+        ChurnScenario<VectorMulticastDelegate<int32>> vectorChurn(count, churnCount);
+        ChurnScenario<MulticastDelegate<int32>> slotChurn(count, churnCount);
+
+        state.Measure("VectorChurn" + suffix, count, [&]
+            {
+                vectorChurn.delegate.Invoke(1);
+                DoNotOptimize(vectorChurn.listeners.front().total);
+            });
+
+        state.Measure("SlotMapChurn" + suffix, count, [&]
+            {
+                slotChurn.delegate.Invoke(1);
+                DoNotOptimize(slotChurn.listeners.front().total);
+            });
+    }
+}
\ No newline at end of file
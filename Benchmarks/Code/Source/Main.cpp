@@ -0,0 +1,123 @@
+﻿#include <charconv>
+#include <cstdio>
+#include <string>
+#include <string_view>
+
+#include "Benchmark.h"
+#include "ByteEngine/Math/Math.h"
+#include "Math/TrigonometryAccuracy.h"
+
+using namespace ByteEngine;
+using namespace ByteEngine::Benchmarks;
+
+namespace
+{
+    void PrintUsage()
+    {
+        std::printf(
+            "Usage: Benchmarks [options]\n"
+            "  --filter <text>        Run only benchmarks whose name contains text\n"
+            "  --min-time-ms <ms>     Minimum duration of one repetition (default 50)\n"
+            "  --repetitions <n>      Repetitions per benchmark, the median is reported (default 5)\n"
+            "  --json <path>          Write results as JSON\n"
+            "  --compare <path>       Compare against a JSON baseline, exit code 1 on regressions\n"
+            "  --threshold <percent>  Slowdown treated as a regression by --compare (default 10)\n"
+            "  --accuracy             Report the error of the fast and precise trigonometry before benchmarking\n"
+            "  --accuracy-stride <n>  Test every n-th float in --accuracy, 1 is exhaustive (default 16)\n");
+    }
+
+    template<typename T>
+    bool ParseNumber(std::string_view text, T& value)
+    {
+        auto [end, error] = std::from_chars(text.data(), text.data() + text.size(), value);
+        return error == std::errc() && end == text.data() + text.size();
+    }
+}
+
+int main(int argc, char** argv)
+{
+    RunSettings settings;
+    std::string jsonPath;
+    std::string comparePath;
+    double threshold = 10.0;
+    bool accuracy = false;
+    uint32 accuracyStride = 16;
+
+    for (int i = 1; i < argc; i++)
+    {
+        std::string_view argument = argv[i];
+        std::string_view value = i + 1 < argc ? std::string_view(argv[i + 1]) : std::string_view();
+        bool valid = true;
+
+        if (argument == "--help" || argument == "-h")
+        {
+            PrintUsage();
+            return 0;
+        }
+        else if (argument == "--accuracy")
+        {
+            accuracy = true;
+            continue;
+        }
+        else if (argument == "--filter" && !value.empty())
+            settings.filter = value;
+        else if (argument == "--min-time-ms")
+            valid = ParseNumber(value, settings.minTimeMs);
+        else if (argument == "--repetitions")
+            valid = ParseNumber(value, settings.repetitions) && settings.repetitions > 0;
+        else if (argument == "--json" && !value.empty())
+            jsonPath = value;
+        else if (argument == "--compare" && !value.empty())
+            comparePath = value;
+        else if (argument == "--threshold")
+            valid = ParseNumber(value, threshold);
+        else if (argument == "--accuracy-stride")
+            valid = ParseNumber(value, accuracyStride) && accuracyStride > 0;
+        else
+            valid = false;
+
+        if (!valid)
+        {
+            std::printf("Invalid argument: %s\n", argv[i]);
+            PrintUsage();
+            return 2;
+        }
+
+        i++;
+    }
+
+    std::vector<BenchmarkResult> baseline;
+
+    if (!comparePath.empty() && !ReadJson(comparePath, baseline))
+    {
+        std::printf("Could not read baseline %s\n", comparePath.c_str());
+        return 2;
+    }
+
+    std::printf("Math backend: %.*s\n", static_cast<int>(GetMathBackendName().size()), GetMathBackendName().data());
+    std::printf("Trigonometry: %s\n", Math::Math::IsPreciseTrigonometry ? "Precise" : "Fast");
+
+    if (accuracy)
+        RunTrigonometryAccuracy(accuracyStride);
+
+    std::vector<BenchmarkResult> results;
+
+    for (const RegisteredBenchmark& benchmark : GetRegisteredBenchmarks())
+    {
+        BenchmarkState state(settings, results, benchmark.group);
+        benchmark.function(state);
+    }
+
+    PrintResults(results);
+
+    if (!jsonPath.empty() && !WriteJson(results, jsonPath))
+    {
+        std::printf("Could not write %s\n", jsonPath.c_str());
+        return 2;
+    }
+
+    if (!comparePath.empty())
+        return Compare(baseline, results, threshold) > 0 ? 1 : 0;
+
+    return 0;
+}
\ No newline at end of file
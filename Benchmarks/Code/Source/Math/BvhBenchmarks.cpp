@@ -0,0 +1,138 @@
+﻿#include <algorithm>
+#include <cmath>
+
+#include "Benchmark.h"
+#include "ByteEngine/Math/Bounds.h"
+#include "ByteEngine/Math/Bvh.h"
+#include "ByteEngine/Math/Frustum.h"
+#include "ByteEngine/Math/Matrix4x4F.h"
+#include "ByteEngine/Math/Ray.h"
+#include "ByteEngine/Math/Vector3Stream.h"
+
+using namespace ByteEngine;
+using namespace ByteEngine::Math;
+using namespace ByteEngine::Benchmarks;
+
+// Small boxes scattered in a 200^3 volume, a streaming open world cell rather than a cache sized scene
+static constexpr size_t ItemCount = 100000;
+static constexpr size_t RayCount = 1024;
+
+static std::vector<Bounds> MakeItems(uint32 seed)
+{
+    std::vector<float> values = MakeRandomFloats(ItemCount * 6, 0.0f, 1.0f, seed);
+    std::vector<Bounds> items(ItemCount);
+
+    for (size_t i = 0; i < ItemCount; i++)
+    {
+        const float* v = &values[i * 6];
+        Vector3F center(v[0] * 200.0f - 100.0f, v[1] * 200.0f - 100.0f, v[2] * 200.0f - 100.0f);
+        items[i] = Bounds::FromCenterExtents(center, Vector3F(0.05f + v[3] * 2.0f, 0.05f + v[4] * 2.0f, 0.05f + v[5] * 2.0f));
+    }
+
+    return items;
+}
+
+BYTEENGINE_BENCHMARK(Bvh)
+{
+    std::vector<Bounds> items = MakeItems(1);
+    Bvh bvh;
+
+    state.Measure("Build", ItemCount, [&] { bvh.Build(items); });
+
+    // Every item moves a little, as animated content does between frames
+    std::vector<Bounds> moved = items;
+
+    for (size_t i = 0; i < ItemCount; i++)
+    {
+        Vector3F offset(std::sin(i * 0.1f) * 5.0f, std::cos(i * 0.7f) * 5.0f, 0.0f);
+        moved[i] = Bounds(items[i].min + offset, items[i].max + offset);
+    }
+
+    state.Measure("Refit", ItemCount, [&] { bvh.Refit(moved); });
+    state.Measure("Optimize", ItemCount, [&] { bvh.Optimize(); });
+
+    bvh.Build(items);
+
+    std::vector<float> rayValues = MakeRandomFloats(RayCount * 6, -1.0f, 1.0f, 2);
+    std::vector<Ray> rays;
+
+    for (size_t i = 0; i < RayCount; i++)
+    {
+        const float* v = &rayValues[i * 6];
+        rays.emplace_back(Vector3F(v[0], v[1], v[2]) * 120.0f, Vector3F(v[3], v[4], v[5] + 0.01f).Normalized());
+    }
+
+    state.Measure("QueryRayClosestHit", RayCount, [&]
+        {
+            size_t hits = 0;
+
+            for (const Ray& ray : rays)
+            {
+                bool hit = false;
+
+                bvh.QueryRay(ray, ByteEngine::Math::Math::Infinity, [&](uint32 item, float& maxDistance)
+                    {
+                        float distance = ray.IntersectBounds(items[item], maxDistance);
+
+                        if (distance < maxDistance)
+                        {
+                            maxDistance = distance;
+                            hit = true;
+                        }
+                    });
+
+                hits += hit ? 1 : 0;
+            }
+
+            DoNotOptimize(hits);
+        });
+
+    // Testing every item, what the tree saves a closest hit query
+    state.Measure("RayClosestHitBruteForce", 16, [&]
+        {
+            size_t hits = 0;
+
+            for (size_t r = 0; r < 16; r++)
+            {
+                float closest = ByteEngine::Math::Math::Infinity;
+
+                for (const Bounds& item : items)
+                    closest = std::min(closest, rays[r].IntersectBounds(item, closest));
+
+                hits += closest != ByteEngine::Math::Math::Infinity ? 1 : 0;
+            }
+
+            DoNotOptimize(hits);
+        });
+
+    Matrix4x4F view = Matrix4x4F::CreateLookAt(Vector3F(0.0f, 10.0f, -120.0f), Vector3F(0.0f, 0.0f, 0.0f));
+    Frustum frustum = Frustum::FromViewProjection(view * Matrix4x4F::CreatePerspectiveProjection(1.0f, 16.0f / 9.0f, 0.5f, 150.0f));
+
+    state.Measure("QueryFrustum", ItemCount, [&]
+        {
+            size_t visible = 0;
+            bvh.QueryFrustum(frustum, [&](uint32) { visible++; });
+            DoNotOptimize(visible);
+        });
+
+    // The linear SIMD cull over all items, the alternative to a tree for frustum queries
+    std::vector<float> cx(ItemCount), cy(ItemCount), cz(ItemCount), ex(ItemCount), ey(ItemCount), ez(ItemCount);
+    std::vector<uint32> visibleIndices(ItemCount);
+
+    for (size_t i = 0; i < ItemCount; i++)
+    {
+        Vector3F center = items[i].Center();
+        Vector3F extents = items[i].Extents();
+        cx[i] = center.x;
+        cy[i] = center.y;
+        cz[i] = center.z;
+        ex[i] = extents.x;
+        ey[i] = extents.y;
+        ez[i] = extents.z;
+    }
+
+    state.Measure("CullBoxesLinear", ItemCount, [&]
+        {
+            DoNotOptimize(frustum.CullBoxes(ConstVector3FStream(cx, cy, cz), ConstVector3FStream(ex, ey, ez), visibleIndices));
+        });
+}
\ No newline at end of file
@@ -0,0 +1,217 @@
+﻿#include <cmath>
+#include <span>
+#include <string>
+#include <string_view>
+
+#include "Benchmark.h"
+#include "ByteEngine/Math/Color.h"
+#include "ByteEngine/Math/ColorConversion.h"
+
+using namespace ByteEngine;
+using namespace ByteEngine::Math;
+using namespace ByteEngine::Benchmarks;
+
+static constexpr size_t ColorCount = 1024;
+
+BYTEENGINE_BENCHMARK(ColorF)
+{
+    std::vector<float> channels = MakeRandomFloats(ColorCount * 8, 0.0f, 1.0f);
+    std::vector<ColorF> a(ColorCount, ColorF(0.0f)), b(ColorCount, ColorF(0.0f)), results(ColorCount, ColorF(0.0f));
+    std::vector<ColorRGBA8> pixels(ColorCount);
+
+    for (size_t i = 0; i < ColorCount; i++)
+    {
+        const float* c = &channels[i * 8];
+        a[i] = ColorF(c[0], c[1], c[2], c[3]);
+        b[i] = ColorF(c[4], c[5], c[6], c[7]);
+    }
+
+    state.Measure("Lerp", ColorCount, [&]
+        {
+            for (size_t i = 0; i < ColorCount; i++)
+                results[i] = ColorF::Lerp(a[i], b[i], 0.25f);
+
+            DoNotOptimize(results.front());
+        });
+
+    state.Measure("HsvToRgb", ColorCount, [&]
+        {
+            for (size_t i = 0; i < ColorCount; i++)
+                results[i] = ColorF::HsvToRgb(a[i].r, a[i].g, a[i].b);
+
+            DoNotOptimize(results.front());
+        });
+
+    state.Measure("AsLinear", ColorCount, [&]
+        {
+            for (size_t i = 0; i < ColorCount; i++)
+                results[i] = a[i].AsLinear();
+
+            DoNotOptimize(results.front());
+        });
+
+    state.Measure("GammaToLinearBatch", ColorCount, [&]
+        {
+            ByteEngine::Math::Math::GammaToLinearSpace(a, results);
+            DoNotOptimize(results.front());
+        });
+
+    state.Measure("LinearToGammaRGBA8Batch", ColorCount, [&]
+        {
+            ByteEngine::Math::Math::LinearToGammaSpace(a, pixels);
+            DoNotOptimize(pixels.front());
+        });
+
+    std::string text;
+    char buffer[64];
+
+    for (size_t i = 0; i < ColorCount; i++)
+    {
+        std::optional<size_t> length = a[i].FormatTo(buffer, "HA");
+        text.append(buffer, *length);
+        text.push_back(' ');
+    }
+
+    state.Measure("FormatTo", ColorCount, [&]
+        {
+            size_t total = 0;
+
+            for (size_t i = 0; i < ColorCount; i++)
+                total += a[i].FormatTo(buffer, "F3").value_or(0);
+
+            DoNotOptimize(total);
+        });
+
+    state.Measure("Parse", ColorCount, [&]
+        {
+            ColorParseResult result = ColorF::Parse(text, results);
+            DoNotOptimize(result);
+        });
+}
+
+// sRGB encode and decode of a whole 1080p frame, against converting every pixel with the scalar functions
+static constexpr size_t FramePixelCount = 1920 * 1080;
+
+BYTEENGINE_BENCHMARK(ColorFrame)
+{
+    std::vector<float> channels = MakeRandomFloats(FramePixelCount * 4, 0.0f, 1.0f, 2);
+    std::vector<ColorF> colors(FramePixelCount, ColorF(0.0f)), linear(FramePixelCount, ColorF(0.0f));
+    std::vector<ColorRGBA8> pixels(FramePixelCount);
+
+    for (size_t i = 0; i < FramePixelCount; i++)
+    {
+        const float* c = &channels[i * 4];
+        colors[i] = ColorF(c[0], c[1], c[2], c[3]);
+    }
+
+    state.Measure("Encode", FramePixelCount, [&]
+        {
+            for (size_t i = 0; i < FramePixelCount; i++)
+            {
+                ColorF gamma = colors[i].Clamped().AsGamma();
+                pixels[i] = ColorRGBA8(
+                    static_cast<uint8>(std::round(gamma.r * 255.0f)),
+                    static_cast<uint8>(std::round(gamma.g * 255.0f)),
+                    static_cast<uint8>(std::round(gamma.b * 255.0f)),
+                    static_cast<uint8>(std::round(gamma.a * 255.0f)));
+            }
+
+            DoNotOptimize(pixels.front());
+        });
+
+    state.Measure("EncodeBatch", FramePixelCount, [&]
+        {
+            ByteEngine::Math::Math::LinearToGammaSpace(colors, pixels);
+            DoNotOptimize(pixels.front());
+        });
+
+    state.Measure("Decode", FramePixelCount, [&]
+        {
+            for (size_t i = 0; i < FramePixelCount; i++)
+                linear[i] = ColorF(pixels[i].r, pixels[i].g, pixels[i].b, pixels[i].a).AsLinear();
+
+            DoNotOptimize(linear.front());
+        });
+
+    state.Measure("DecodeBatch", FramePixelCount, [&]
+        {
+            ByteEngine::Math::Math::GammaToLinearSpace(pixels, linear);
+            DoNotOptimize(linear.front());
+        });
+}
+
+// A theme-file sized block: one string per color against formatting into and parsing one buffer
+static constexpr size_t TextColorCount = 50000;
+
+BYTEENGINE_BENCHMARK(ColorText)
+{
+    std::vector<float> channels = MakeRandomFloats(TextColorCount * 4, 0.0f, 1.0f, 3);
+    std::vector<ColorF> colors(TextColorCount, ColorF(0.0f)), parsed(TextColorCount, ColorF(0.0f));
+
+    for (size_t i = 0; i < TextColorCount; i++)
+    {
+        const float* c = &channels[i * 4];
+        colors[i] = ColorF(c[0], c[1], c[2], c[3]);
+    }
+
+    std::vector<char> block(TextColorCount * 48);
+
+    for (std::string_view format : { "HA", "F5A" })
+    {
+        std::string suffix(format);
+
+        state.Measure("ToString" + suffix, TextColorCount, [&]
+            {
+                std::string text;
+
+                for (const ColorF& color : colors)
+                {
+                    text += *color.ToString(format);
+                    text += '\n';
+                }
+
+                DoNotOptimize(text.data());
+            });
+
+        auto formatBlock = [&]
+            {
+                size_t blockSize = 0;
+
+                for (const ColorF& color : colors)
+                {
+                    blockSize += *color.FormatTo(std::span(block).subspan(blockSize), format);
+                    block[blockSize++] = '\n';
+                }
+
+                return blockSize;
+            };
+
+        state.Measure("FormatTo" + suffix, TextColorCount, [&] { DoNotOptimize(formatBlock()); });
+
+        // Formatted outside of the measurement, so parsing has input even when FormatTo is filtered out
+        std::string_view text(block.data(), formatBlock());
+
+        if (format[0] == 'H')
+        {
+            state.Measure("HtmlToRgb" + suffix, TextColorCount, [&]
+                {
+                    std::string_view remaining = text;
+
+                    for (size_t i = 0; i < TextColorCount; i++)
+                    {
+                        size_t end = remaining.find('\n');
+                        parsed[i] = *ColorF::HtmlToRgb(remaining.substr(0, end));
+                        remaining.remove_prefix(end + 1);
+                    }
+
+                    DoNotOptimize(parsed.front());
+                });
+        }
+
+        state.Measure("Parse" + suffix, TextColorCount, [&]
+            {
+                ColorParseResult result = ColorF::Parse(text, parsed);
+                DoNotOptimize(result);
+            });
+    }
+}
\ No newline at end of file
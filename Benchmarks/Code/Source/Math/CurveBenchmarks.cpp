@@ -0,0 +1,135 @@
+﻿#include "Benchmark.h"
+#include "ByteEngine/Math/Curve.h"
+
+using namespace ByteEngine;
+using namespace ByteEngine::Math;
+using namespace ByteEngine::Benchmarks;
+
+static constexpr size_t CurveCount = 1024;
+
+struct VectorArrays
+{
+    std::vector<float> x, y, z;
+
+    explicit VectorArrays(uint32 seed)
+        : x(MakeRandomFloats(CurveCount, -10.0f, 10.0f, seed)),
+        y(MakeRandomFloats(CurveCount, -10.0f, 10.0f, seed + 1)),
+        z(MakeRandomFloats(CurveCount, -10.0f, 10.0f, seed + 2))
+    { }
+
+    Vector3FStream Stream() { return Vector3FStream(x, y, z); }
+    Vector3F Get(size_t index) const { return Vector3F(x[index], y[index], z[index]); }
+};
+
+struct QuaternionArrays
+{
+    std::vector<float> x, y, z, w;
+
+    explicit QuaternionArrays(uint32 seed)
+        : x(MakeRandomFloats(CurveCount, -1.0f, 1.0f, seed)),
+        y(MakeRandomFloats(CurveCount, -1.0f, 1.0f, seed + 1)),
+        z(MakeRandomFloats(CurveCount, -1.0f, 1.0f, seed + 2)),
+        w(MakeRandomFloats(CurveCount, -1.0f, 1.0f, seed + 3))
+    {
+        Quaternion::Normalize(Stream());
+    }
+
+    QuaternionStream Stream() { return QuaternionStream(x, y, z, w); }
+    Quaternion Get(size_t index) const { return Quaternion(x[index], y[index], z[index], w[index]); }
+};
+
+BYTEENGINE_BENCHMARK(Curve)
+{
+    std::vector<float> t = MakeRandomFloats(CurveCount, 0.0f, 1.0f, 1);
+
+    // One curve, many parameters, e.g. sampling a camera path
+    CatmullRomCurve<Vector3F> path(Vector3F(0.0f), Vector3F(1.0f, 2.0f, 0.0f), Vector3F(3.0f, 2.0f, 1.0f), Vector3F(4.0f, 0.0f, 1.0f));
+    std::vector<Vector3F> positions(CurveCount, Vector3F(0.0f));
+
+    state.Measure("CatmullRomVector3", CurveCount, [&]
+        {
+            for (size_t i = 0; i < CurveCount; i++)
+                positions[i] = path.Evaluate(t[i]);
+
+            DoNotOptimize(positions.front());
+        });
+
+    state.Measure("CatmullRomVector3Batch", CurveCount, [&]
+        {
+            path.Evaluate(t, positions);
+            DoNotOptimize(positions.front());
+        });
+
+    // Many curves, one parameter each, e.g. animation tracks of many bones
+    VectorArrays p0(10), p1(20), p2(30), p3(40), vectorResults(50);
+    std::array<ConstVector3FStream, 4> vectorPoints = { p0.Stream(), p1.Stream(), p2.Stream(), p3.Stream() };
+    Vector3FStream vectorStream = vectorResults.Stream();
+
+    state.Measure("BezierVector3", CurveCount, [&]
+        {
+            for (size_t i = 0; i < CurveCount; i++)
+                vectorStream.Set(i, BezierCurve<Vector3F>(p0.Get(i), p1.Get(i), p2.Get(i), p3.Get(i)).Evaluate(t[i]));
+
+            DoNotOptimize(vectorResults.x.front());
+        });
+
+    state.Measure("BezierVector3Batch", CurveCount, [&]
+        {
+            BezierCurve<Vector3F>::Evaluate(vectorPoints, t, vectorStream);
+            DoNotOptimize(vectorResults.x.front());
+        });
+
+    QuaternionArrays q0(60), q1(70), q2(80), q3(90), rotationResults(100);
+    std::array<ConstQuaternionStream, 4> rotationPoints = { q0.Stream(), q1.Stream(), q2.Stream(), q3.Stream() };
+    QuaternionStream rotationStream = rotationResults.Stream();
+
+    state.Measure("CatmullRomQuaternion", CurveCount, [&]
+        {
+            for (size_t i = 0; i < CurveCount; i++)
+                rotationStream.Set(i, CatmullRomCurve<Quaternion>(q0.Get(i), q1.Get(i), q2.Get(i), q3.Get(i)).Evaluate(t[i]));
+
+            DoNotOptimize(rotationResults.x.front());
+        });
+
+    state.Measure("CatmullRomQuaternionBatch", CurveCount, [&]
+        {
+            CatmullRomCurve<Quaternion>::Evaluate(rotationPoints, t, rotationStream);
+            DoNotOptimize(rotationResults.x.front());
+        });
+
+    std::array<std::span<const float>, 4> floatPoints = { p0.x, p1.x, p2.x, p3.x };
+
+    state.Measure("HermiteFloatBatch", CurveCount, [&]
+        {
+            HermiteCurve<float>::Evaluate(floatPoints, t, vectorResults.x);
+            DoNotOptimize(vectorResults.x.front());
+        });
+
+    // Constant speed sampling along the path
+    ArcLengthTable table(path);
+    std::vector<float> distances(CurveCount);
+    std::vector<float> parameters(CurveCount);
+
+    for (size_t i = 0; i < CurveCount; i++)
+        distances[i] = table.GetLength() * static_cast<float>(i) / static_cast<float>(CurveCount);
+
+    state.Measure("ArcLengthBuild", ArcLengthTable::DefaultSampleCount, [&]
+        {
+            table.Build(path);
+            DoNotOptimize(table);
+        });
+
+    state.Measure("ArcLengthParameterSorted", CurveCount, [&]
+        {
+            table.GetParameters(distances, parameters);
+            DoNotOptimize(parameters.front());
+        });
+
+    state.Measure("ArcLengthParameterRandom", CurveCount, [&]
+        {
+            for (size_t i = 0; i < CurveCount; i++)
+                parameters[i] = table.GetParameter(t[i] * table.GetLength());
+
+            DoNotOptimize(parameters.front());
+        });
+}
\ No newline at end of file
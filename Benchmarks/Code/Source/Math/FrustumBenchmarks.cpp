@@ -0,0 +1,65 @@
+﻿#include <cstdint>
+
+#include "Benchmark.h"
+#include "ByteEngine/Math/Frustum.h"
+#include "ByteEngine/Math/Matrix4x4F.h"
+#include "ByteEngine/Math/Vector3Stream.h"
+
+using namespace ByteEngine;
+using namespace ByteEngine::Math;
+using namespace ByteEngine::Benchmarks;
+
+// Objects scattered around the camera, roughly a third of them visible. Too many for the caches, like a large scene
+static constexpr size_t ObjectCount = 100000;
+
+BYTEENGINE_BENCHMARK(Frustum)
+{
+    Matrix4x4F view = Matrix4x4F::CreateLookAt(Vector3F(0.0f, 0.0f, -10.0f), Vector3F(0.0f, 0.0f, 0.0f));
+    Matrix4x4F projection = Matrix4x4F::CreatePerspectiveProjection(ByteEngine::Math::Math::PI / 2.0f, 1.0f, 1.0f, 100.0f);
+    Frustum frustum = Frustum::FromViewProjection(view * projection);
+
+    std::vector<float> x = MakeRandomFloats(ObjectCount, -150.0f, 150.0f, 1);
+    std::vector<float> y = MakeRandomFloats(ObjectCount, -45.0f, 45.0f, 2);
+    std::vector<float> z = MakeRandomFloats(ObjectCount, -25.0f, 125.0f, 3);
+    std::vector<float> ex = MakeRandomFloats(ObjectCount, 0.1f, 5.0f, 4);
+    std::vector<float> ey = MakeRandomFloats(ObjectCount, 0.1f, 5.0f, 5);
+    std::vector<float> ez = MakeRandomFloats(ObjectCount, 0.1f, 5.0f, 6);
+    std::vector<float> radii = MakeRandomFloats(ObjectCount, 0.1f, 5.0f, 7);
+    std::vector<uint32> visible(ObjectCount);
+
+    state.Measure("IntersectsSphere", ObjectCount, [&]
+        {
+            size_t count = 0;
+
+            for (size_t i = 0; i < ObjectCount; i++)
+            {
+                if (frustum.IntersectsSphere(Vector3F(x[i], y[i], z[i]), radii[i]))
+                    visible[count++] = static_cast<uint32>(i);
+            }
+
+            DoNotOptimize(count);
+        });
+
+    state.Measure("CullSpheres", ObjectCount, [&]
+        {
+            DoNotOptimize(frustum.CullSpheres(ConstVector3FStream(x, y, z), radii, visible));
+        });
+
+    state.Measure("IntersectsBox", ObjectCount, [&]
+        {
+            size_t count = 0;
+
+            for (size_t i = 0; i < ObjectCount; i++)
+            {
+                if (frustum.IntersectsBox(Vector3F(x[i], y[i], z[i]), Vector3F(ex[i], ey[i], ez[i])))
+                    visible[count++] = static_cast<uint32>(i);
+            }
+
+            DoNotOptimize(count);
+        });
+
+    state.Measure("CullBoxes", ObjectCount, [&]
+        {
+            DoNotOptimize(frustum.CullBoxes(ConstVector3FStream(x, y, z), ConstVector3FStream(ex, ey, ez), visible));
+        });
+}
\ No newline at end of file
@@ -0,0 +1,236 @@
+﻿#include "Benchmark.h"
+#include "ByteEngine/Math/Matrix4x4F.h"
+#include "ByteEngine/Math/Quaternion.h"
+#include "ByteEngine/Math/QuaternionStream.h"
+
+using namespace ByteEngine;
+using namespace ByteEngine::Math;
+using namespace ByteEngine::Benchmarks;
+
+static constexpr size_t MatrixCount = 256;
+static constexpr size_t PointCount = 4096;
+
+// Affine TRS matrices, so every inverse variant is valid
+static std::vector<Matrix4x4F> MakeMatrices(uint32 seed)
+{
+    std::vector<float> values = MakeRandomFloats(MatrixCount * 10, -1.0f, 1.0f, seed);
+    std::vector<Matrix4x4F> matrices(MatrixCount);
+
+    for (size_t i = 0; i < MatrixCount; i++)
+    {
+        const float* v = &values[i * 10];
+        Quaternion rotation = Quaternion(v[0], v[1], v[2], v[3]).Normalized();
+        Vector3F scale(1.5f + v[7], 1.5f + v[8], 1.5f + v[9]);
+        matrices[i] = Matrix4x4F::CreateTRS(Vector3F(v[4], v[5], v[6]) * 100.0f, rotation, scale);
+    }
+
+    return matrices;
+}
+
+BYTEENGINE_BENCHMARK(Matrix4x4F)
+{
+    std::vector<Matrix4x4F> a = MakeMatrices(1);
+    std::vector<Matrix4x4F> b = MakeMatrices(2);
+    std::vector<Matrix4x4F> results(MatrixCount);
+
+    state.Measure("Multiply", MatrixCount, [&]
+        {
+            for (size_t i = 0; i < MatrixCount; i++)
+                results[i] = a[i] * b[i];
+
+            DoNotOptimize(results.front());
+        });
+
+    state.Measure("MultiplyAffine", MatrixCount, [&]
+        {
+            for (size_t i = 0; i < MatrixCount; i++)
+                results[i] = a[i].MultiplyAffine(b[i]);
+
+            DoNotOptimize(results.front());
+        });
+
+    state.Measure("Inversed", MatrixCount, [&]
+        {
+            for (size_t i = 0; i < MatrixCount; i++)
+                results[i] = a[i].Inversed();
+
+            DoNotOptimize(results.front());
+        });
+
+    state.Measure("AffineInversed", MatrixCount, [&]
+        {
+            for (size_t i = 0; i < MatrixCount; i++)
+                results[i] = a[i].AffineInversed();
+
+            DoNotOptimize(results.front());
+        });
+
+    state.Measure("MultiplyAffineBatch", MatrixCount, [&]
+        {
+            Matrix4x4F::MultiplyAffine(a, b, results);
+            DoNotOptimize(results.front());
+        });
+
+    state.Measure("AffineInverseBatch", MatrixCount, [&]
+        {
+            Matrix4x4F::AffineInverse(a, results);
+            DoNotOptimize(results.front());
+        });
+
+    state.Measure("MultiplyAffineBatchOneParent", MatrixCount, [&]
+        {
+            Matrix4x4F::MultiplyAffine(a, b.front(), results);
+            DoNotOptimize(results.front());
+        });
+
+    // Rotation and translation only, as RigidInverse expects
+    std::vector<Matrix4x4F> rigid(MatrixCount);
+
+    for (size_t i = 0; i < MatrixCount; i++)
+        rigid[i] = Matrix4x4F::CreateTRS(a[i].GetTranslation(), a[i].GetRotation(), Vector3F::One());
+
+    state.Measure("RigidInversed", MatrixCount, [&]
+        {
+            for (size_t i = 0; i < MatrixCount; i++)
+                results[i] = rigid[i].RigidInversed();
+
+            DoNotOptimize(results.front());
+        });
+
+    state.Measure("RigidInverseBatch", MatrixCount, [&]
+        {
+            Matrix4x4F::RigidInverse(rigid, results);
+            DoNotOptimize(results.front());
+        });
+
+    std::vector<float> values = MakeRandomFloats(MatrixCount * 8, -1.0f, 1.0f, 3);
+
+    state.Measure("CreateTRS", MatrixCount, [&]
+        {
+            for (size_t i = 0; i < MatrixCount; i++)
+            {
+                const float* v = &values[i * 8];
+                results[i] = Matrix4x4F::CreateTRS(Vector3F(v[0], v[1], v[2]), Quaternion(v[3], v[4], v[5], v[6]), Vector3F(v[7]));
+            }
+
+            DoNotOptimize(results.front());
+        });
+
+    std::vector<float> coordinates = MakeRandomFloats(PointCount * 3, -100.0f, 100.0f, 4);
+    std::vector<Vector3F> points(PointCount), transformed(PointCount);
+    std::vector<float> x(PointCount), y(PointCount), z(PointCount);
+    std::vector<float> rx(PointCount), ry(PointCount), rz(PointCount);
+
+    for (size_t i = 0; i < PointCount; i++)
+    {
+        points[i] = Vector3F(coordinates[i * 3], coordinates[i * 3 + 1], coordinates[i * 3 + 2]);
+        x[i] = points[i].x;
+        y[i] = points[i].y;
+        z[i] = points[i].z;
+    }
+
+    const Matrix4x4F& matrix = a.front();
+
+    state.Measure("MultiplyPoint", PointCount, [&]
+        {
+            for (size_t i = 0; i < PointCount; i++)
+                transformed[i] = matrix.MultiplyPoint(points[i]);
+
+            DoNotOptimize(transformed.front());
+        });
+
+    state.Measure("MultiplyPointsBatch", PointCount, [&]
+        {
+            matrix.MultiplyPoints(points, transformed);
+            DoNotOptimize(transformed.front());
+        });
+
+    state.Measure("MultiplyPointsStream", PointCount, [&]
+        {
+            matrix.MultiplyPoints(ConstVector3FStream(x, y, z), Vector3FStream(rx, ry, rz));
+            DoNotOptimize(rx.front());
+        });
+
+    state.Measure("MultiplyPointFast", PointCount, [&]
+        {
+            for (size_t i = 0; i < PointCount; i++)
+                transformed[i] = matrix.MultiplyPointFast(points[i]);
+
+            DoNotOptimize(transformed.front());
+        });
+
+    state.Measure("MultiplyPointsFastBatch", PointCount, [&]
+        {
+            matrix.MultiplyPointsFast(points, transformed);
+            DoNotOptimize(transformed.front());
+        });
+
+    state.Measure("MultiplyVector", PointCount, [&]
+        {
+            for (size_t i = 0; i < PointCount; i++)
+                transformed[i] = matrix.MultiplyVector(points[i]);
+
+            DoNotOptimize(transformed.front());
+        });
+
+    state.Measure("MultiplyVectorsStream", PointCount, [&]
+        {
+            matrix.MultiplyVectors(ConstVector3FStream(x, y, z), Vector3FStream(rx, ry, rz));
+            DoNotOptimize(rx.front());
+        });
+
+    // Decomposition
+    std::vector<float> tx(MatrixCount), ty(MatrixCount), tz(MatrixCount);
+    std::vector<float> qx(MatrixCount), qy(MatrixCount), qz(MatrixCount), qw(MatrixCount);
+    std::vector<float> sx(MatrixCount), sy(MatrixCount), sz(MatrixCount);
+    Vector3FStream translations(tx, ty, tz);
+    QuaternionStream rotations(qx, qy, qz, qw);
+    Vector3FStream scales(sx, sy, sz);
+
+    state.Measure("GetTranslationRotationScale", MatrixCount, [&]
+        {
+            for (size_t i = 0; i < MatrixCount; i++)
+            {
+                translations.Set(i, a[i].GetTranslation());
+                rotations.Set(i, a[i].GetRotation());
+                scales.Set(i, a[i].GetScale());
+            }
+
+            DoNotOptimize(qx.front());
+        });
+
+    state.Measure("Decompose", MatrixCount, [&]
+        {
+            for (size_t i = 0; i < MatrixCount; i++)
+            {
+                Vector3F translation, scale;
+                Quaternion rotation;
+                a[i].Decompose(translation, rotation, scale);
+                translations.Set(i, translation);
+                rotations.Set(i, rotation);
+                scales.Set(i, scale);
+            }
+
+            DoNotOptimize(qx.front());
+        });
+
+    state.Measure("DecomposeTRSBatch", MatrixCount, [&]
+        {
+            Matrix4x4F::DecomposeTRS(a, translations, rotations, scales);
+            DoNotOptimize(qx.front());
+        });
+
+    state.Measure("CreateTRSFromStreams", MatrixCount, [&]
+        {
+            for (size_t i = 0; i < MatrixCount; i++)
+                results[i] = Matrix4x4F::CreateTRS(translations.Get(i), rotations.Get(i), scales.Get(i));
+
+            DoNotOptimize(results.front());
+        });
+
+    state.Measure("ComposeTRSBatch", MatrixCount, [&]
+        {
+            Matrix4x4F::ComposeTRS(translations, rotations, scales, results);
+            DoNotOptimize(results.front());
+        });
+}
\ No newline at end of file
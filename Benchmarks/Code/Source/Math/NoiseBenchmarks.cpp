@@ -0,0 +1,80 @@
+﻿#include "Benchmark.h"
+#include "ByteEngine/Math/Noise.h"
+
+using namespace ByteEngine;
+using namespace ByteEngine::Math;
+using namespace ByteEngine::Benchmarks;
+
+// One heightmap tile and one density volume
+static constexpr int32 TileSize = 256;
+static constexpr int32 VolumeSize = 32;
+static constexpr size_t TileSampleCount = static_cast<size_t>(TileSize) * TileSize;
+static constexpr size_t VolumeSampleCount = static_cast<size_t>(VolumeSize) * VolumeSize * VolumeSize;
+
+BYTEENGINE_BENCHMARK(Noise)
+{
+    std::vector<float> tile(TileSampleCount);
+    std::vector<float> volume(VolumeSampleCount);
+
+    Vector2F tileOrigin(12.5f, -3.25f);
+    Vector2F tileSpacing(1.0f / 64.0f);
+    Vector3F volumeOrigin(1.5f, 2.5f, -0.75f);
+    Vector3F volumeSpacing(1.0f / 16.0f);
+
+    NoiseSettings settings;
+    settings.type = NoiseType::Perlin;
+
+    state.Measure("Perlin2DSample", TileSampleCount, [&]
+        {
+            for (int32 y = 0; y < TileSize; y++)
+            {
+                for (int32 x = 0; x < TileSize; x++)
+                {
+                    Vector2F position(tileOrigin.x + x * tileSpacing.x, tileOrigin.y + y * tileSpacing.y);
+                    tile[static_cast<size_t>(y) * TileSize + x] = Noise::Sample(settings, position);
+                }
+            }
+
+            DoNotOptimize(tile.front());
+        });
+
+    for (NoiseType type : { NoiseType::Value, NoiseType::Perlin, NoiseType::Simplex })
+    {
+        settings.type = type;
+        const char* name = type == NoiseType::Value ? "Value" : type == NoiseType::Perlin ? "Perlin" : "Simplex";
+
+        state.Measure(std::string(name) + "2DGrid", TileSampleCount, [&]
+            {
+                Noise::FillGrid2D(settings, tile, tileOrigin, tileSpacing, TileSize, TileSize);
+                DoNotOptimize(tile.front());
+            });
+
+        state.Measure(std::string(name) + "3DGrid", VolumeSampleCount, [&]
+            {
+                Noise::FillGrid3D(settings, volume, volumeOrigin, volumeSpacing, VolumeSize, VolumeSize, VolumeSize);
+                DoNotOptimize(volume.front());
+            });
+
+        state.Measure(std::string(name) + "4DGrid", VolumeSampleCount, [&]
+            {
+                Noise::FillGrid4D(settings, volume, Vector4F(volumeOrigin.x, volumeOrigin.y, volumeOrigin.z, 0.5f), volumeSpacing, VolumeSize, VolumeSize, VolumeSize);
+                DoNotOptimize(volume.front());
+            });
+    }
+
+    // Typical terrain setup, one sample is 6 octaves
+    settings.type = NoiseType::Simplex;
+    settings.octaves = 6;
+
+    state.Measure("Simplex2DFractalGrid", TileSampleCount, [&]
+        {
+            Noise::FillGrid2D(settings, tile, tileOrigin, tileSpacing, TileSize, TileSize);
+            DoNotOptimize(tile.front());
+        });
+
+    state.Measure("Simplex2DFractalGridAllThreads", TileSampleCount, [&]
+        {
+            Noise::FillGrid2D(settings, tile, tileOrigin, tileSpacing, TileSize, TileSize, 0);
+            DoNotOptimize(tile.front());
+        });
+}
\ No newline at end of file
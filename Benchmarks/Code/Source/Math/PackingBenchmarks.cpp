@@ -0,0 +1,89 @@
+﻿#include "Benchmark.h"
+#include "ByteEngine/Math/Packing.h"
+#include "ByteEngine/Math/QuaternionStream.h"
+
+using namespace ByteEngine;
+using namespace ByteEngine::Math;
+using namespace ByteEngine::Benchmarks;
+
+// Vertex and animation data sized, larger than the first level caches
+static constexpr size_t ValueCount = 65536;
+
+BYTEENGINE_BENCHMARK(Packing)
+{
+    std::vector<float> values = MakeRandomFloats(ValueCount, -1000.0f, 1000.0f, 1);
+    std::vector<Half> halves(ValueCount);
+    std::vector<float> decoded(ValueCount);
+
+    state.Measure("FloatToHalf", ValueCount, [&]
+        {
+            for (size_t i = 0; i < ValueCount; i++)
+                halves[i] = Half(values[i]);
+
+            DoNotOptimize(halves.front());
+        });
+
+    state.Measure("FloatToHalfBatch", ValueCount, [&]
+        {
+            ByteEngine::Math::Math::FloatToHalf(values, halves);
+            DoNotOptimize(halves.front());
+        });
+
+    state.Measure("HalfToFloat", ValueCount, [&]
+        {
+            for (size_t i = 0; i < ValueCount; i++)
+                decoded[i] = halves[i].ToFloat();
+
+            DoNotOptimize(decoded.front());
+        });
+
+    state.Measure("HalfToFloatBatch", ValueCount, [&]
+        {
+            ByteEngine::Math::Math::HalfToFloat(halves, decoded);
+            DoNotOptimize(decoded.front());
+        });
+
+    std::vector<float> components = MakeRandomFloats(ValueCount * 4, -1.0f, 1.0f, 2);
+    std::vector<Quaternion> quaternions(ValueCount);
+    std::vector<float> x(ValueCount), y(ValueCount), z(ValueCount), w(ValueCount);
+
+    for (size_t i = 0; i < ValueCount; i++)
+    {
+        const float* c = &components[i * 4];
+        quaternions[i] = Quaternion(c[0], c[1], c[2], c[3]).Normalized();
+        x[i] = quaternions[i].x;
+        y[i] = quaternions[i].y;
+        z[i] = quaternions[i].z;
+        w[i] = quaternions[i].w;
+    }
+
+    std::vector<PackedQuaternion> packed(ValueCount);
+
+    state.Measure("PackQuaternion", ValueCount, [&]
+        {
+            for (size_t i = 0; i < ValueCount; i++)
+                packed[i] = PackedQuaternion(quaternions[i]);
+
+            DoNotOptimize(packed.front());
+        });
+
+    state.Measure("PackQuaternionBatch", ValueCount, [&]
+        {
+            ByteEngine::Math::Math::Pack(ConstQuaternionStream(x, y, z, w), packed);
+            DoNotOptimize(packed.front());
+        });
+
+    state.Measure("UnpackQuaternion", ValueCount, [&]
+        {
+            for (size_t i = 0; i < ValueCount; i++)
+                quaternions[i] = packed[i].Unpack();
+
+            DoNotOptimize(quaternions.front());
+        });
+
+    state.Measure("UnpackQuaternionBatch", ValueCount, [&]
+        {
+            ByteEngine::Math::Math::Unpack(packed, QuaternionStream(x, y, z, w));
+            DoNotOptimize(x.front());
+        });
+}
\ No newline at end of file
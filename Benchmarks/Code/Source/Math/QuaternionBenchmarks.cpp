@@ -0,0 +1,177 @@
+﻿#include "Benchmark.h"
+#include "ByteEngine/Math/Quaternion.h"
+#include "ByteEngine/Math/QuaternionStream.h"
+
+using namespace ByteEngine;
+using namespace ByteEngine::Math;
+using namespace ByteEngine::Benchmarks;
+
+static constexpr size_t QuaternionCount = 1024;
+
+static std::vector<Quaternion> MakeQuaternions(uint32 seed)
+{
+    std::vector<float> values = MakeRandomFloats(QuaternionCount * 4, -1.0f, 1.0f, seed);
+    std::vector<Quaternion> quaternions(QuaternionCount);
+
+    for (size_t i = 0; i < QuaternionCount; i++)
+        quaternions[i] = Quaternion(values[i * 4], values[i * 4 + 1], values[i * 4 + 2], values[i * 4 + 3]).Normalized();
+
+    return quaternions;
+}
+
+struct QuaternionArrays
+{
+    std::vector<float> x, y, z, w;
+
+    explicit QuaternionArrays(const std::vector<Quaternion>& quaternions)
+    {
+        for (const Quaternion& q : quaternions)
+        {
+            x.push_back(q.x);
+            y.push_back(q.y);
+            z.push_back(q.z);
+            w.push_back(q.w);
+        }
+    }
+
+    QuaternionStream Stream() { return QuaternionStream(x, y, z, w); }
+};
+
+BYTEENGINE_BENCHMARK(Quaternion)
+{
+    std::vector<Quaternion> a = MakeQuaternions(1);
+    std::vector<Quaternion> b = MakeQuaternions(2);
+    std::vector<Quaternion> results(QuaternionCount);
+
+    std::vector<float> values = MakeRandomFloats(QuaternionCount * 3, -10.0f, 10.0f, 3);
+    std::vector<Vector3F> vectors(QuaternionCount), rotated(QuaternionCount);
+
+    for (size_t i = 0; i < QuaternionCount; i++)
+        vectors[i] = Vector3F(values[i * 3], values[i * 3 + 1], values[i * 3 + 2]);
+
+    state.Measure("Multiply", QuaternionCount, [&]
+        {
+            for (size_t i = 0; i < QuaternionCount; i++)
+                results[i] = a[i] * b[i];
+
+            DoNotOptimize(results.front());
+        });
+
+    state.Measure("RotateVector", QuaternionCount, [&]
+        {
+            for (size_t i = 0; i < QuaternionCount; i++)
+                rotated[i] = a[i] * vectors[i];
+
+            DoNotOptimize(rotated.front());
+        });
+
+    state.Measure("Slerp", QuaternionCount, [&]
+        {
+            for (size_t i = 0; i < QuaternionCount; i++)
+                results[i] = Quaternion::Slerp(a[i], b[i], 0.3f);
+
+            DoNotOptimize(results.front());
+        });
+
+    state.Measure("Nlerp", QuaternionCount, [&]
+        {
+            for (size_t i = 0; i < QuaternionCount; i++)
+                results[i] = Quaternion::Nlerp(a[i], b[i], 0.3f);
+
+            DoNotOptimize(results.front());
+        });
+
+    state.Measure("Normalized", QuaternionCount, [&]
+        {
+            for (size_t i = 0; i < QuaternionCount; i++)
+                results[i] = b[i].Normalized();
+
+            DoNotOptimize(results.front());
+        });
+
+    QuaternionArrays streamA(a);
+    QuaternionArrays streamB(b);
+    QuaternionArrays streamResults(results);
+
+    std::vector<float> vx(QuaternionCount), vy(QuaternionCount), vz(QuaternionCount);
+    std::vector<float> rx(QuaternionCount), ry(QuaternionCount), rz(QuaternionCount);
+
+    for (size_t i = 0; i < QuaternionCount; i++)
+    {
+        vx[i] = vectors[i].x;
+        vy[i] = vectors[i].y;
+        vz[i] = vectors[i].z;
+    }
+
+    state.Measure("MultiplyBatch", QuaternionCount, [&]
+        {
+            Quaternion::Multiply(streamA.Stream(), streamB.Stream(), streamResults.Stream());
+            DoNotOptimize(streamResults.x.front());
+        });
+
+    state.Measure("RotateBatch", QuaternionCount, [&]
+        {
+            Quaternion::Rotate(streamA.Stream(), ConstVector3FStream(vx, vy, vz), Vector3FStream(rx, ry, rz));
+            DoNotOptimize(rx.front());
+        });
+
+    state.Measure("SlerpBatch", QuaternionCount, [&]
+        {
+            Quaternion::Slerp(streamA.Stream(), streamB.Stream(), 0.3f, streamResults.Stream());
+            DoNotOptimize(streamResults.x.front());
+        });
+
+    state.Measure("NlerpBatch", QuaternionCount, [&]
+        {
+            Quaternion::Nlerp(streamA.Stream(), streamB.Stream(), 0.3f, streamResults.Stream());
+            DoNotOptimize(streamResults.x.front());
+        });
+}
+
+// A 100 bone pose for 2000 characters, too large for the caches
+static constexpr size_t PoseBoneCount = 100 * 2000;
+
+BYTEENGINE_BENCHMARK(QuaternionPoseBlend)
+{
+    std::vector<float> values = MakeRandomFloats(PoseBoneCount * 8, -1.0f, 1.0f, 4);
+    std::vector<Quaternion> poseA(PoseBoneCount), poseB(PoseBoneCount), blended(PoseBoneCount);
+
+    for (size_t i = 0; i < PoseBoneCount; i++)
+    {
+        const float* v = &values[i * 8];
+        poseA[i] = Quaternion(v[0], v[1], v[2], v[3]).Normalized();
+        poseB[i] = Quaternion(v[4], v[5], v[6], v[7]).Normalized();
+    }
+
+    QuaternionArrays streamA(poseA);
+    QuaternionArrays streamB(poseB);
+    QuaternionArrays streamResults(blended);
+
+    state.Measure("Slerp", PoseBoneCount, [&]
+        {
+            for (size_t i = 0; i < PoseBoneCount; i++)
+                blended[i] = Quaternion::Slerp(poseA[i], poseB[i], 0.35f);
+
+            DoNotOptimize(blended.front());
+        });
+
+    state.Measure("SlerpBatch", PoseBoneCount, [&]
+        {
+            Quaternion::Slerp(streamA.Stream(), streamB.Stream(), 0.35f, streamResults.Stream());
+            DoNotOptimize(streamResults.x.front());
+        });
+
+    state.Measure("Nlerp", PoseBoneCount, [&]
+        {
+            for (size_t i = 0; i < PoseBoneCount; i++)
+                blended[i] = Quaternion::Nlerp(poseA[i], poseB[i], 0.35f);
+
+            DoNotOptimize(blended.front());
+        });
+
+    state.Measure("NlerpBatch", PoseBoneCount, [&]
+        {
+            Quaternion::Nlerp(streamA.Stream(), streamB.Stream(), 0.35f, streamResults.Stream());
+            DoNotOptimize(streamResults.x.front());
+        });
+}
\ No newline at end of file
@@ -0,0 +1,97 @@
+﻿#include <random>
+
+#include "Benchmark.h"
+#include "ByteEngine/Math/QuaternionStream.h"
+#include "ByteEngine/Math/Random.h"
+
+using namespace ByteEngine;
+using namespace ByteEngine::Math;
+using namespace ByteEngine::Benchmarks;
+
+static constexpr size_t ValueCount = 4096;
+
+BYTEENGINE_BENCHMARK(Random)
+{
+    std::vector<float> values(ValueCount);
+    std::vector<uint32> integers(ValueCount);
+    std::vector<float> x(ValueCount), y(ValueCount), z(ValueCount), w(ValueCount);
+
+    // What gameplay code does without a math library generator
+    std::mt19937 engine(1);
+    std::uniform_real_distribution<float> distribution(0.0f, 1.0f);
+    Random random(1);
+
+    state.Measure("MersenneTwisterFloat", ValueCount, [&]
+        {
+            for (size_t i = 0; i < ValueCount; i++)
+                values[i] = distribution(engine);
+
+            DoNotOptimize(values.front());
+        });
+
+    state.Measure("NextFloat", ValueCount, [&]
+        {
+            for (size_t i = 0; i < ValueCount; i++)
+                values[i] = random.NextFloat();
+
+            DoNotOptimize(values.front());
+        });
+
+    state.Measure("FillFloats", ValueCount, [&]
+        {
+            random.Fill(values);
+            DoNotOptimize(values.front());
+        });
+
+    state.Measure("MersenneTwisterUInt", ValueCount, [&]
+        {
+            for (size_t i = 0; i < ValueCount; i++)
+                integers[i] = engine();
+
+            DoNotOptimize(integers.front());
+        });
+
+    state.Measure("FillUInts", ValueCount, [&]
+        {
+            random.Fill(integers);
+            DoNotOptimize(integers.front());
+        });
+
+    Vector3FStream vectors(x, y, z);
+
+    state.Measure("NextUnitVector", ValueCount, [&]
+        {
+            for (size_t i = 0; i < ValueCount; i++)
+                vectors.Set(i, random.NextUnitVector());
+
+            DoNotOptimize(x.front());
+        });
+
+    state.Measure("FillUnitVectors", ValueCount, [&]
+        {
+            random.FillUnitVectors(vectors);
+            DoNotOptimize(x.front());
+        });
+
+    state.Measure("FillPointsInSphere", ValueCount, [&]
+        {
+            random.FillPointsInSphere(vectors, Vector3F(0.0f), 10.0f);
+            DoNotOptimize(x.front());
+        });
+
+    QuaternionStream rotations(x, y, z, w);
+
+    state.Measure("NextRotation", ValueCount, [&]
+        {
+            for (size_t i = 0; i < ValueCount; i++)
+                rotations.Set(i, random.NextRotation());
+
+            DoNotOptimize(x.front());
+        });
+
+    state.Measure("FillRotations", ValueCount, [&]
+        {
+            random.FillRotations(rotations);
+            DoNotOptimize(x.front());
+        });
+}
\ No newline at end of file
@@ -0,0 +1,125 @@
+﻿#include <bit>
+#include <cmath>
+
+#include "Benchmark.h"
+#include "ByteEngine/Math/Ray.h"
+
+using namespace ByteEngine;
+using namespace ByteEngine::Math;
+using namespace ByteEngine::Benchmarks;
+
+// Brute force over a soup, the per triangle cost a BVH leaf or a baker's inner loop pays
+static constexpr size_t TriangleCount = 16384;
+static constexpr size_t RayCount = 64;
+
+BYTEENGINE_BENCHMARK(Ray)
+{
+    std::vector<float> values = MakeRandomFloats(TriangleCount * 6, -1.0f, 1.0f, 1);
+    std::vector<Vector3F> vertices;
+    vertices.reserve(TriangleCount * 3);
+
+    for (size_t i = 0; i < TriangleCount; i++)
+    {
+        const float* v = &values[i * 6];
+        Vector3F center(v[0] * 50.0f, v[1] * 50.0f, v[2] * 50.0f);
+
+        vertices.push_back(center);
+        vertices.push_back(center + Vector3F(v[3] + 1.5f, v[4], v[5]));
+        vertices.push_back(center + Vector3F(v[4], v[5] + 1.5f, v[3]));
+    }
+
+    std::vector<TriangleBlock> blocks = TriangleBlock::FromTriangles(vertices);
+
+    // Coherent rays from one eye point through a small screen region, as in picking or a lightmap texel
+    std::vector<Ray> rays;
+
+    for (size_t i = 0; i < RayCount; i++)
+    {
+        Vector3F target(static_cast<float>(i % 8) * 2.0f - 8.0f, static_cast<float>(i / 8) * 2.0f - 8.0f, 0.0f);
+        Vector3F origin(0.0f, 0.0f, -100.0f);
+        rays.push_back(Ray(origin, (target - origin).Normalized()));
+    }
+
+    std::vector<RayPacket> packets;
+
+    for (size_t i = 0; i < RayCount; i += RayPacket::Width)
+        packets.push_back(RayPacket(std::span<const Ray>(rays).subspan(i, RayPacket::Width)));
+
+    std::vector<RayHit> hits(RayCount);
+
+    state.Measure("TriangleScalar", RayCount, [&]
+        {
+            for (size_t r = 0; r < RayCount; r++)
+            {
+                RayHit hit;
+
+                for (size_t i = 0; i < TriangleCount; i++)
+                    (void)rays[r].IntersectTriangle(vertices[i * 3], vertices[i * 3 + 1], vertices[i * 3 + 2], static_cast<uint32>(i), hit);
+
+                hits[r] = hit;
+            }
+
+            DoNotOptimize(hits.front());
+        });
+
+    state.Measure("TriangleBlocks", RayCount, [&]
+        {
+            for (size_t r = 0; r < RayCount; r++)
+            {
+                RayHit hit;
+                (void)rays[r].IntersectTriangles(blocks, hit);
+                hits[r] = hit;
+            }
+
+            DoNotOptimize(hits.front());
+        });
+
+    std::vector<RayPacketHit> packetHits(packets.size());
+
+    state.Measure("TrianglePackets", RayCount, [&]
+        {
+            for (size_t p = 0; p < packets.size(); p++)
+            {
+                packetHits[p] = RayPacketHit();
+                packets[p].IntersectTriangles(vertices, packetHits[p]);
+            }
+
+            DoNotOptimize(packetHits.front());
+        });
+
+    // Slab tests against the triangle bounds
+    std::vector<Bounds> boxes(TriangleCount);
+
+    for (size_t i = 0; i < TriangleCount; i++)
+    {
+        boxes[i].Encapsulate(vertices[i * 3]);
+        boxes[i].Encapsulate(vertices[i * 3 + 1]);
+        boxes[i].Encapsulate(vertices[i * 3 + 2]);
+    }
+
+    uint32 boxHits = 0;
+
+    state.Measure("BoundsScalar", RayCount, [&]
+        {
+            for (size_t r = 0; r < RayCount; r++)
+            {
+                for (const Bounds& box : boxes)
+                    boxHits += std::isfinite(rays[r].IntersectBounds(box)) ? 1 : 0;
+            }
+
+            DoNotOptimize(boxHits);
+        });
+
+    RayPacketHit unlimited;
+
+    state.Measure("BoundsPackets", RayCount, [&]
+        {
+            for (const RayPacket& packet : packets)
+            {
+                for (const Bounds& box : boxes)
+                    boxHits += static_cast<uint32>(std::popcount(packet.IntersectBounds(box, unlimited)));
+            }
+
+            DoNotOptimize(boxHits);
+        });
+}
\ No newline at end of file
@@ -0,0 +1,65 @@
+﻿#include "Benchmark.h"
+#include "ByteEngine/Math/Rotation.h"
+
+using namespace ByteEngine;
+using namespace ByteEngine::Math;
+using namespace ByteEngine::Benchmarks;
+
+static constexpr size_t RotationCount = 1024;
+
+BYTEENGINE_BENCHMARK(Rotation)
+{
+    std::vector<float> angles = MakeRandomFloats(RotationCount * 6, -180.0f, 180.0f);
+    std::vector<Rotation> a(RotationCount), b(RotationCount), results(RotationCount);
+    std::vector<Quaternion> quaternions(RotationCount);
+    std::vector<Vector3F> vectors(RotationCount), rotated(RotationCount);
+
+    for (size_t i = 0; i < RotationCount; i++)
+    {
+        const float* v = &angles[i * 6];
+        a[i] = Rotation(DegreeF(v[0] * 0.5f), DegreeF(v[1]), DegreeF(v[2]));
+        b[i] = Rotation(DegreeF(v[3] * 0.5f), DegreeF(v[4]), DegreeF(v[5]));
+        quaternions[i] = b[i].ToQuaternion();
+        vectors[i] = Vector3F(v[0], v[2], v[4]);
+    }
+
+    state.Measure("ToQuaternion", RotationCount, [&]
+        {
+            for (size_t i = 0; i < RotationCount; i++)
+                quaternions[i] = a[i].ToQuaternion();
+
+            DoNotOptimize(quaternions.front());
+        });
+
+    state.Measure("FromQuaternion", RotationCount, [&]
+        {
+            for (size_t i = 0; i < RotationCount; i++)
+                results[i] = Rotation::FromQuaternion(quaternions[i]);
+
+            DoNotOptimize(results.front());
+        });
+
+    state.Measure("RotateVector", RotationCount, [&]
+        {
+            for (size_t i = 0; i < RotationCount; i++)
+                rotated[i] = a[i].RotateVector(vectors[i]);
+
+            DoNotOptimize(rotated.front());
+        });
+
+    state.Measure("Slerp", RotationCount, [&]
+        {
+            for (size_t i = 0; i < RotationCount; i++)
+                results[i] = Rotation::Slerp(a[i], b[i], 0.3f);
+
+            DoNotOptimize(results.front());
+        });
+
+    state.Measure("Normalized", RotationCount, [&]
+        {
+            for (size_t i = 0; i < RotationCount; i++)
+                results[i] = a[i].Normalized();
+
+            DoNotOptimize(results.front());
+        });
+}
\ No newline at end of file
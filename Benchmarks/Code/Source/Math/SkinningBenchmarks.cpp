@@ -0,0 +1,129 @@
+﻿#include <random>
+
+#include "Benchmark.h"
+#include "ByteEngine/Math/Skinning.h"
+
+using namespace ByteEngine;
+using namespace ByteEngine::Math;
+using namespace ByteEngine::Benchmarks;
+
+// A dense character mesh with a typical humanoid palette
+static constexpr size_t VertexCount = 1 << 20;
+static constexpr size_t BoneCount = 64;
+
+BYTEENGINE_BENCHMARK(Skinning)
+{
+    std::mt19937 rng(21);
+    std::uniform_real_distribution<float> value(-1.0f, 1.0f);
+    std::uniform_real_distribution<float> weight(0.05f, 1.0f);
+    std::uniform_int_distribution<int32> bone(0, BoneCount - 1);
+
+    std::vector<float> px(VertexCount), py(VertexCount), pz(VertexCount);
+    std::vector<float> nx(VertexCount), ny(VertexCount), nz(VertexCount);
+    std::vector<uint16> boneIndices[SkinInfluences::MaxInfluences];
+    std::vector<float> weights[SkinInfluences::MaxInfluences];
+
+    for (int32 k = 0; k < SkinInfluences::MaxInfluences; k++)
+    {
+        boneIndices[k].resize(VertexCount);
+        weights[k].resize(VertexCount);
+    }
+
+    for (size_t i = 0; i < VertexCount; i++)
+    {
+        px[i] = value(rng);
+        py[i] = value(rng);
+        pz[i] = value(rng);
+
+        Vector3F normal = Vector3F(value(rng), value(rng), value(rng) + 2.0f).Normalized();
+        nx[i] = normal.x;
+        ny[i] = normal.y;
+        nz[i] = normal.z;
+
+        float sum = 0.0f;
+
+        for (int32 k = 0; k < SkinInfluences::MaxInfluences; k++)
+        {
+            boneIndices[k][i] = static_cast<uint16>(bone(rng));
+            weights[k][i] = weight(rng);
+            sum += weights[k][i];
+        }
+
+        for (int32 k = 0; k < SkinInfluences::MaxInfluences; k++)
+            weights[k][i] /= sum;
+    }
+
+    SkinInfluences influences;
+
+    for (int32 k = 0; k < SkinInfluences::MaxInfluences; k++)
+    {
+        influences.boneIndices[k] = boneIndices[k];
+        influences.weights[k] = weights[k];
+    }
+
+    std::vector<Matrix4x4F> matrices;
+
+    for (size_t i = 0; i < BoneCount; i++)
+    {
+        Quaternion rotation = Quaternion(value(rng), value(rng), value(rng), value(rng)).Normalized();
+        matrices.push_back(Matrix4x4F::CreateTRS(Vector3F(value(rng), value(rng), value(rng)), rotation, Vector3F(1.0f)));
+    }
+
+    std::vector<DualQuaternion> dualQuaternions(BoneCount);
+    Skinning::ToDualQuaternions(matrices, dualQuaternions);
+
+    ConstVector3FStream positions(px, py, pz);
+    ConstVector3FStream normals(nx, ny, nz);
+
+    std::vector<float> sx(VertexCount), sy(VertexCount), sz(VertexCount);
+    std::vector<float> tx(VertexCount), ty(VertexCount), tz(VertexCount);
+    Vector3FStream skinnedPositions(sx, sy, sz);
+    Vector3FStream skinnedNormals(tx, ty, tz);
+
+    // Per vertex matrix blend, how skinning is written without batch kernels
+    state.Measure("LinearBlendScalar", VertexCount, [&]
+        {
+            for (size_t i = 0; i < VertexCount; i++)
+            {
+                Matrix4x4F blended = matrices[boneIndices[0][i]] * weights[0][i];
+
+                for (int32 k = 1; k < SkinInfluences::MaxInfluences; k++)
+                    blended += matrices[boneIndices[k][i]] * weights[k][i];
+
+                skinnedPositions.Set(i, blended.MultiplyPointFast(positions.Get(i)));
+                skinnedNormals.Set(i, blended.MultiplyVector(normals.Get(i)).Normalized());
+            }
+
+            DoNotOptimize(sx.front());
+        });
+
+    state.Measure("LinearBlend", VertexCount, [&]
+        {
+            Skinning::LinearBlend(matrices, influences, positions, normals, skinnedPositions, skinnedNormals);
+            DoNotOptimize(sx.front());
+        });
+
+    state.Measure("LinearBlendPositionsOnly", VertexCount, [&]
+        {
+            Skinning::LinearBlend(matrices, influences, positions, { }, skinnedPositions, { });
+            DoNotOptimize(sx.front());
+        });
+
+    state.Measure("LinearBlendAllThreads", VertexCount, [&]
+        {
+            Skinning::LinearBlend(matrices, influences, positions, normals, skinnedPositions, skinnedNormals, 0);
+            DoNotOptimize(sx.front());
+        });
+
+    state.Measure("DualQuaternionBlend", VertexCount, [&]
+        {
+            Skinning::DualQuaternionBlend(dualQuaternions, influences, positions, normals, skinnedPositions, skinnedNormals);
+            DoNotOptimize(sx.front());
+        });
+
+    state.Measure("DualQuaternionBlendAllThreads", VertexCount, [&]
+        {
+            Skinning::DualQuaternionBlend(dualQuaternions, influences, positions, normals, skinnedPositions, skinnedNormals, 0);
+            DoNotOptimize(sx.front());
+        });
+}
\ No newline at end of file
@@ -0,0 +1,97 @@
+﻿#include <random>
+
+#include "Benchmark.h"
+#include "ByteEngine/Math/TransformHierarchy.h"
+
+using namespace ByteEngine;
+using namespace ByteEngine::Math;
+using namespace ByteEngine::Benchmarks;
+
+static constexpr uint32 NodeCount = 1000000;
+static constexpr uint32 NodesPerObject = 100;
+
+// 10000 objects of 100 nodes each, every node hangs off a random earlier node of the same object
+static std::vector<TransformHierarchy::NodeId> BuildScene(TransformHierarchy& hierarchy)
+{
+    std::mt19937 rng(7);
+    std::vector<TransformHierarchy::NodeId> nodes;
+    nodes.reserve(NodeCount);
+
+    for (uint32 i = 0; i < NodeCount; i++)
+    {
+        uint32 indexInObject = i % NodesPerObject;
+        TransformHierarchy::NodeId parent = indexInObject == 0 ? TransformHierarchy::InvalidNode : nodes[i - 1 - rng() % indexInObject];
+        nodes.push_back(hierarchy.Create(parent, Vector3F(0.0f, 0.1f, 0.0f)));
+    }
+
+    hierarchy.Update();
+    return nodes;
+}
+
+BYTEENGINE_BENCHMARK(TransformHierarchy)
+{
+    TransformHierarchy hierarchy;
+    std::vector<TransformHierarchy::NodeId> nodes = BuildScene(hierarchy);
+
+    std::mt19937 rng(11);
+    std::vector<TransformHierarchy::NodeId> moving(NodeCount / 100);
+
+    for (TransformHierarchy::NodeId& node : moving)
+        node = nodes[rng() % NodeCount];
+
+    float offset = 0.0f;
+
+    // Items are all nodes of the hierarchy, so the numbers show the cost per node in the scene
+    state.Measure("Update1PercentMoved", NodeCount, [&]
+        {
+            offset += 0.01f;
+
+            for (TransformHierarchy::NodeId node : moving)
+                hierarchy.SetLocalPosition(node, Vector3F(offset, 0.1f, 0.0f));
+
+            size_t updated = hierarchy.Update();
+            DoNotOptimize(updated);
+        });
+
+    state.Measure("UpdateAllMoved", NodeCount, [&]
+        {
+            offset += 0.01f;
+
+            for (TransformHierarchy::NodeId node : nodes)
+                hierarchy.SetLocalPosition(node, Vector3F(offset, 0.1f, 0.0f));
+
+            size_t updated = hierarchy.Update();
+            DoNotOptimize(updated);
+        });
+
+    // One object root moves per frame, items are the nodes of that object
+    uint32 movedObject = 0;
+
+    state.Measure("UpdateOneObjectMoved", NodesPerObject, [&]
+        {
+            offset += 0.01f;
+            movedObject = (movedObject + 1) % (NodeCount / NodesPerObject);
+            hierarchy.SetLocalPosition(nodes[movedObject * NodesPerObject], Vector3F(offset, 0.1f, 0.0f));
+
+            size_t updated = hierarchy.Update();
+            DoNotOptimize(updated);
+        });
+
+    // What users did without the hierarchy: multiply the full parent chain for every node every frame
+    std::vector<Matrix4x4F> worlds(NodeCount);
+
+    state.Measure("ChainMultiplyAll", NodeCount, [&]
+        {
+            for (uint32 i = 0; i < NodeCount; i++)
+            {
+                Matrix4x4F world = Matrix4x4F::CreateTRS(hierarchy.GetLocalPosition(nodes[i]), hierarchy.GetLocalRotation(nodes[i]), hierarchy.GetLocalScale(nodes[i]));
+
+                for (TransformHierarchy::NodeId parent = hierarchy.GetParent(nodes[i]); parent != TransformHierarchy::InvalidNode; parent = hierarchy.GetParent(parent))
+                    world = world.MultiplyAffine(Matrix4x4F::CreateTRS(hierarchy.GetLocalPosition(parent), hierarchy.GetLocalRotation(parent), hierarchy.GetLocalScale(parent)));
+
+                worlds[i] = world;
+            }
+
+            DoNotOptimize(worlds.front());
+        });
+}
\ No newline at end of file
@@ -0,0 +1,221 @@
+﻿#include <algorithm>
+#include <bit>
+#include <cmath>
+#include <cstdio>
+#include <string_view>
+#include <thread>
+#include <vector>
+
+#include "ByteEngine/Math/Math.h"
+#include "Math/TrigonometryAccuracy.h"
+
+using namespace ByteEngine::Math;
+
+namespace ByteEngine::Benchmarks
+{
+    namespace
+    {
+        // Inputs are evaluated in chunks so the batch functions run on full blocks
+        constexpr size_t ChunkSize = 4096;
+
+        struct ErrorStats
+        {
+            int64 maxUlp = 0;
+            float maxUlpInput = 0.0f;
+            double maxAbsError = 0.0;
+
+            void Add(float input, float result, double reference)
+            {
+                int64 ulp = UlpDistance(result, static_cast<float>(reference));
+
+                if (ulp > maxUlp)
+                {
+                    maxUlp = ulp;
+                    maxUlpInput = input;
+                }
+
+                maxAbsError = std::max(maxAbsError, std::abs(static_cast<double>(result) - reference));
+            }
+
+            void Merge(const ErrorStats& other)
+            {
+                if (other.maxUlp > maxUlp)
+                {
+                    maxUlp = other.maxUlp;
+                    maxUlpInput = other.maxUlpInput;
+                }
+
+                maxAbsError = std::max(maxAbsError, other.maxAbsError);
+            }
+
+            // Distance between two floats in units in the last place, NaN counts as maximal
+            static int64 UlpDistance(float a, float b)
+            {
+                if (std::isnan(a) != std::isnan(b))
+                    return INT32_MAX;
+
+                auto ordered = [](float value)
+                    {
+                        int32 bits = std::bit_cast<int32>(value);
+                        return bits < 0 ? static_cast<int64>(INT32_MIN) - bits : static_cast<int64>(bits);
+                    };
+
+                return std::abs(ordered(a) - ordered(b));
+            }
+        };
+
+        // A function under test turns a chunk of inputs into one or two result arrays
+        struct Case
+        {
+            std::string_view function;
+            std::string_view variant;
+            void (*evaluate)(std::span<const float> inputs, std::span<float> first, std::span<float> second);
+            double (*reference)(double input);
+
+            // SinCos checks second against cos
+            double (*secondReference)(double input) = nullptr;
+        };
+
+        std::span<const RadianF> AsAngles(std::span<const float> inputs) { return { reinterpret_cast<const RadianF*>(inputs.data()), inputs.size() }; }
+        std::span<RadianF> AsAngles(std::span<float> results) { return { reinterpret_cast<RadianF*>(results.data()), results.size() }; }
+
+        template<typename Function>
+        void EvaluateScalar(std::span<const float> inputs, std::span<float> results, Function function)
+        {
+            for (size_t i = 0; i < inputs.size(); i++)
+                results[i] = function(inputs[i]);
+        }
+
+        double ReferenceSin(double x) { return std::sin(x); }
+        double ReferenceCos(double x) { return std::cos(x); }
+        double ReferenceAsin(double x) { return std::asin(x); }
+        double ReferenceAcos(double x) { return std::acos(x); }
+
+        const Case AngleCases[] =
+        {
+            { "Sin", "Fast", [](auto in, auto out, auto) { EvaluateScalar(in, out, [](float x) { return Math::Math::Fast::Sin(RadianF(x)); }); }, ReferenceSin },
+            { "Sin", "Fast batch", [](auto in, auto out, auto) { Math::Math::Fast::Sin(AsAngles(in), out); }, ReferenceSin },
+            { "Sin", "Precise", [](auto in, auto out, auto) { EvaluateScalar(in, out, [](float x) { return Math::Math::Precise::Sin(RadianF(x)); }); }, ReferenceSin },
+            { "Sin", "Precise batch", [](auto in, auto out, auto) { Math::Math::Precise::Sin(AsAngles(in), out); }, ReferenceSin },
+            { "Cos", "Fast", [](auto in, auto out, auto) { EvaluateScalar(in, out, [](float x) { return Math::Math::Fast::Cos(RadianF(x)); }); }, ReferenceCos },
+            { "Cos", "Fast batch", [](auto in, auto out, auto) { Math::Math::Fast::Cos(AsAngles(in), out); }, ReferenceCos },
+            { "Cos", "Precise", [](auto in, auto out, auto) { EvaluateScalar(in, out, [](float x) { return Math::Math::Precise::Cos(RadianF(x)); }); }, ReferenceCos },
+            { "Cos", "Precise batch", [](auto in, auto out, auto) { Math::Math::Precise::Cos(AsAngles(in), out); }, ReferenceCos },
+            {
+                "SinCos", "Fast", [](auto in, auto sin, auto cos)
+                {
+                    for (size_t i = 0; i < in.size(); i++)
+                        Math::Math::Fast::SinCos(sin[i], cos[i], RadianF(in[i]));
+                },
+                ReferenceSin, ReferenceCos
+            },
+            { "SinCos", "Fast batch", [](auto in, auto sin, auto cos) { Math::Math::Fast::SinCos(sin, cos, AsAngles(in)); }, ReferenceSin, ReferenceCos },
+            {
+                "SinCos", "Precise", [](auto in, auto sin, auto cos)
+                {
+                    for (size_t i = 0; i < in.size(); i++)
+                        Math::Math::Precise::SinCos(sin[i], cos[i], RadianF(in[i]));
+                },
+                ReferenceSin, ReferenceCos
+            },
+            { "SinCos", "Precise batch", [](auto in, auto sin, auto cos) { Math::Math::Precise::SinCos(sin, cos, AsAngles(in)); }, ReferenceSin, ReferenceCos },
+        };
+
+        const Case InverseCases[] =
+        {
+            { "Asin", "Fast", [](auto in, auto out, auto) { EvaluateScalar(in, out, [](float x) { return Math::Math::Fast::Asin(x).value; }); }, ReferenceAsin },
+            { "Asin", "Fast batch", [](auto in, auto out, auto) { Math::Math::Fast::Asin(in, AsAngles(out)); }, ReferenceAsin },
+            { "Asin", "Precise", [](auto in, auto out, auto) { EvaluateScalar(in, out, [](float x) { return Math::Math::Precise::Asin(x).value; }); }, ReferenceAsin },
+            { "Asin", "Precise batch", [](auto in, auto out, auto) { Math::Math::Precise::Asin(in, AsAngles(out)); }, ReferenceAsin },
+            { "Acos", "Fast", [](auto in, auto out, auto) { EvaluateScalar(in, out, [](float x) { return Math::Math::Fast::Acos(x).value; }); }, ReferenceAcos },
+            { "Acos", "Fast batch", [](auto in, auto out, auto) { Math::Math::Fast::Acos(in, AsAngles(out)); }, ReferenceAcos },
+            { "Acos", "Precise", [](auto in, auto out, auto) { EvaluateScalar(in, out, [](float x) { return Math::Math::Precise::Acos(x).value; }); }, ReferenceAcos },
+            { "Acos", "Precise batch", [](auto in, auto out, auto) { Math::Math::Precise::Acos(in, AsAngles(out)); }, ReferenceAcos },
+        };
+
+        // Every stride-th non-negative float up to limit, and their negations
+        ErrorStats SweepRange(const Case& testCase, float limit, uint32 stride, uint32 threadIndex, uint32 threadCount)
+        {
+            uint32 end = std::bit_cast<uint32>(limit) / stride + 1;
+            uint32 chunkCount = (end + ChunkSize - 1) / ChunkSize;
+
+            std::vector<float> inputs(ChunkSize), first(ChunkSize), second(ChunkSize);
+            ErrorStats stats;
+
+            for (uint32 chunk = threadIndex; chunk < chunkCount; chunk += threadCount)
+            {
+                for (float sign : { 1.0f, -1.0f })
+                {
+                    uint32 begin = chunk * static_cast<uint32>(ChunkSize);
+                    size_t count = std::min<size_t>(ChunkSize, end - begin);
+
+                    for (size_t i = 0; i < count; i++)
+                        inputs[i] = sign * std::bit_cast<float>((begin + static_cast<uint32>(i)) * stride);
+
+                    std::span<const float> chunkInputs(inputs.data(), count);
+                    testCase.evaluate(chunkInputs, std::span(first.data(), count), std::span(second.data(), count));
+
+                    for (size_t i = 0; i < count; i++)
+                    {
+                        stats.Add(inputs[i], first[i], testCase.reference(inputs[i]));
+
+                        if (testCase.secondReference)
+                            stats.Add(inputs[i], second[i], testCase.secondReference(inputs[i]));
+                    }
+                }
+            }
+
+            return stats;
+        }
+
+        ErrorStats Sweep(const Case& testCase, float limit, uint32 stride)
+        {
+            uint32 threadCount = std::max(1u, std::thread::hardware_concurrency());
+            std::vector<ErrorStats> threadStats(threadCount);
+            std::vector<std::thread> threads;
+
+            for (uint32 i = 0; i < threadCount; i++)
+                threads.emplace_back([&, i] { threadStats[i] = SweepRange(testCase, limit, stride, i, threadCount); });
+
+            ErrorStats stats;
+
+            for (uint32 i = 0; i < threadCount; i++)
+            {
+                threads[i].join();
+                stats.Merge(threadStats[i]);
+            }
+
+            return stats;
+        }
+
+        void PrintRow(const Case& testCase, std::string_view range, const ErrorStats& stats)
+        {
+            std::printf("%-8.*s %-15.*s %-16.*s %12lld %16.9g %14.3e\n",
+                static_cast<int>(testCase.function.size()), testCase.function.data(),
+                static_cast<int>(testCase.variant.size()), testCase.variant.data(),
+                static_cast<int>(range.size()), range.data(),
+                static_cast<long long>(stats.maxUlp), stats.maxUlpInput, stats.maxAbsError);
+        }
+    }
+
+    void RunTrigonometryAccuracy(uint32 stride)
+    {
+        stride = std::max(stride, 1u);
+
+        std::printf("Trigonometry accuracy against double precision std, every %u. float of the domain\n", stride);
+        std::printf("ULP error near the zeros of sin and cos reflects the absolute error of the range reduction\n");
+        std::printf("%-8s %-15s %-16s %12s %16s %14s\n", "Function", "Variant", "Domain", "max ULP", "at", "max abs error");
+
+        for (const Case& testCase : AngleCases)
+        {
+            PrintRow(testCase, "|x| <= pi", Sweep(testCase, Math::Math::PI, stride));
+            PrintRow(testCase, "|x| <= 100", Sweep(testCase, 100.0f, stride));
+            PrintRow(testCase, "|x| <= 8192", Sweep(testCase, 8192.0f, stride));
+        }
+
+        for (const Case& testCase : InverseCases)
+            PrintRow(testCase, "|x| <= 1", Sweep(testCase, 1.0f, stride));
+
+        std::printf("\n");
+    }
+}
\ No newline at end of file
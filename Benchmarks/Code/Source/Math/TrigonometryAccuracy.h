@@ -0,0 +1,11 @@
+﻿#pragma once
+
+#include "ByteEngine/Primitives.h"
+
+namespace ByteEngine::Benchmarks
+{
+    // Sweeps every stride-th float of the domain of Sin, Cos, SinCos, Asin and Acos, for the fast and precise variants,
+    // scalar and batch, and prints the max ULP and absolute error against the double precision standard library.
+    // Stride 1 is exhaustive and takes a few minutes, the sweep is split over all hardware threads
+    void RunTrigonometryAccuracy(uint32 stride);
+}
\ No newline at end of file
@@ -0,0 +1,88 @@
+﻿#include "Benchmark.h"
+#include "ByteEngine/Math/Math.h"
+
+using namespace ByteEngine::Math;
+using namespace ByteEngine::Benchmarks;
+
+static constexpr size_t ValueCount = 4096;
+
+// Both variants are measured regardless of BYTEENGINE_MATH_TRIG, next to the standard library
+BYTEENGINE_BENCHMARK(Trigonometry)
+{
+    std::vector<float> angleValues = MakeRandomFloats(ValueCount, -4.0f * Math::PI, 4.0f * Math::PI);
+    std::vector<float> values = MakeRandomFloats(ValueCount, -1.0f, 1.0f);
+    std::vector<RadianF> angles(ValueCount), radians(ValueCount);
+    std::vector<float> sin(ValueCount), cos(ValueCount);
+
+    for (size_t i = 0; i < ValueCount; i++)
+        angles[i] = RadianF(angleValues[i]);
+
+    auto measureScalar = [&](std::string_view label, auto function)
+        {
+            state.Measure(label, ValueCount, [&]
+                {
+                    for (size_t i = 0; i < ValueCount; i++)
+                        sin[i] = function(i);
+
+                    DoNotOptimize(sin.front());
+                });
+        };
+
+    measureScalar("SinStd", [&](size_t i) { return std::sin(angleValues[i]); });
+    measureScalar("SinFast", [&](size_t i) { return Math::Fast::Sin(angles[i]); });
+    measureScalar("SinPrecise", [&](size_t i) { return Math::Precise::Sin(angles[i]); });
+
+    state.Measure("SinFastBatch", ValueCount, [&] { Math::Fast::Sin(angles, sin); DoNotOptimize(sin.front()); });
+    state.Measure("SinPreciseBatch", ValueCount, [&] { Math::Precise::Sin(angles, sin); DoNotOptimize(sin.front()); });
+
+    measureScalar("CosStd", [&](size_t i) { return std::cos(angleValues[i]); });
+    measureScalar("CosFast", [&](size_t i) { return Math::Fast::Cos(angles[i]); });
+    measureScalar("CosPrecise", [&](size_t i) { return Math::Precise::Cos(angles[i]); });
+
+    state.Measure("CosFastBatch", ValueCount, [&] { Math::Fast::Cos(angles, cos); DoNotOptimize(cos.front()); });
+    state.Measure("CosPreciseBatch", ValueCount, [&] { Math::Precise::Cos(angles, cos); DoNotOptimize(cos.front()); });
+
+    state.Measure("SinCosStd", ValueCount, [&]
+        {
+            for (size_t i = 0; i < ValueCount; i++)
+            {
+                sin[i] = std::sin(angleValues[i]);
+                cos[i] = std::cos(angleValues[i]);
+            }
+
+            DoNotOptimize(cos.front());
+        });
+
+    state.Measure("SinCosFast", ValueCount, [&]
+        {
+            for (size_t i = 0; i < ValueCount; i++)
+                Math::Fast::SinCos(sin[i], cos[i], angles[i]);
+
+            DoNotOptimize(cos.front());
+        });
+
+    state.Measure("SinCosPrecise", ValueCount, [&]
+        {
+            for (size_t i = 0; i < ValueCount; i++)
+                Math::Precise::SinCos(sin[i], cos[i], angles[i]);
+
+            DoNotOptimize(cos.front());
+        });
+
+    state.Measure("SinCosFastBatch", ValueCount, [&] { Math::Fast::SinCos(sin, cos, angles); DoNotOptimize(cos.front()); });
+    state.Measure("SinCosPreciseBatch", ValueCount, [&] { Math::Precise::SinCos(sin, cos, angles); DoNotOptimize(cos.front()); });
+
+    measureScalar("AsinStd", [&](size_t i) { return std::asin(values[i]); });
+    measureScalar("AsinFast", [&](size_t i) { return Math::Fast::Asin(values[i]).value; });
+    measureScalar("AsinPrecise", [&](size_t i) { return Math::Precise::Asin(values[i]).value; });
+
+    state.Measure("AsinFastBatch", ValueCount, [&] { Math::Fast::Asin(values, radians); DoNotOptimize(radians.front()); });
+    state.Measure("AsinPreciseBatch", ValueCount, [&] { Math::Precise::Asin(values, radians); DoNotOptimize(radians.front()); });
+
+    measureScalar("AcosStd", [&](size_t i) { return std::acos(values[i]); });
+    measureScalar("AcosFast", [&](size_t i) { return Math::Fast::Acos(values[i]).value; });
+    measureScalar("AcosPrecise", [&](size_t i) { return Math::Precise::Acos(values[i]).value; });
+
+    state.Measure("AcosFastBatch", ValueCount, [&] { Math::Fast::Acos(values, radians); DoNotOptimize(radians.front()); });
+    state.Measure("AcosPreciseBatch", ValueCount, [&] { Math::Precise::Acos(values, radians); DoNotOptimize(radians.front()); });
+}
\ No newline at end of file
@@ -0,0 +1,256 @@
+﻿#include "Benchmark.h"
+#include "ByteEngine/Math/Vector2.h"
+#include "ByteEngine/Math/Vector3.h"
+#include "ByteEngine/Math/Vector4.h"
+#include "Math/Simd/SimdMath.h"
+
+using namespace ByteEngine;
+using namespace ByteEngine::Math;
+using namespace ByteEngine::Benchmarks;
+
+// Every operation runs over arrays of this many inputs, so results are per vector
+static constexpr size_t VectorCount = 1024;
+
+BYTEENGINE_BENCHMARK(Vector2F)
+{
+    std::vector<float> values = MakeRandomFloats(VectorCount * 4, -10.0f, 10.0f);
+    std::vector<Vector2F> a(VectorCount), b(VectorCount), results(VectorCount);
+
+    for (size_t i = 0; i < VectorCount; i++)
+    {
+        a[i] = Vector2F(values[i * 4], values[i * 4 + 1]);
+        b[i] = Vector2F(values[i * 4 + 2], values[i * 4 + 3]);
+    }
+
+    state.Measure("Add", VectorCount, [&]
+        {
+            for (size_t i = 0; i < VectorCount; i++)
+                results[i] = a[i] + b[i];
+
+            DoNotOptimize(results.front());
+        });
+
+    state.Measure("Dot", VectorCount, [&]
+        {
+            float sum = 0.0f;
+
+            for (size_t i = 0; i < VectorCount; i++)
+                sum += Vector2F::Dot(a[i], b[i]);
+
+            DoNotOptimize(sum);
+        });
+
+    state.Measure("Normalized", VectorCount, [&]
+        {
+            for (size_t i = 0; i < VectorCount; i++)
+                results[i] = a[i].Normalized();
+
+            DoNotOptimize(results.front());
+        });
+
+    state.Measure("Lerp", VectorCount, [&]
+        {
+            for (size_t i = 0; i < VectorCount; i++)
+                results[i] = Vector2F::Lerp(a[i], b[i], 0.25f);
+
+            DoNotOptimize(results.front());
+        });
+}
+
+BYTEENGINE_BENCHMARK(Vector3F)
+{
+    std::vector<float> values = MakeRandomFloats(VectorCount * 6, -10.0f, 10.0f);
+    std::vector<Vector3F> a(VectorCount), b(VectorCount), results(VectorCount);
+
+    for (size_t i = 0; i < VectorCount; i++)
+    {
+        a[i] = Vector3F(values[i * 6], values[i * 6 + 1], values[i * 6 + 2]);
+        b[i] = Vector3F(values[i * 6 + 3], values[i * 6 + 4], values[i * 6 + 5]);
+    }
+
+    state.Measure("Add", VectorCount, [&]
+        {
+            for (size_t i = 0; i < VectorCount; i++)
+                results[i] = a[i] + b[i];
+
+            DoNotOptimize(results.front());
+        });
+
+    state.Measure("Dot", VectorCount, [&]
+        {
+            float sum = 0.0f;
+
+            for (size_t i = 0; i < VectorCount; i++)
+                sum += Vector3F::Dot(a[i], b[i]);
+
+            DoNotOptimize(sum);
+        });
+
+    state.Measure("Cross", VectorCount, [&]
+        {
+            for (size_t i = 0; i < VectorCount; i++)
+                results[i] = Vector3F::Cross(a[i], b[i]);
+
+            DoNotOptimize(results.front());
+        });
+
+    state.Measure("Normalized", VectorCount, [&]
+        {
+            for (size_t i = 0; i < VectorCount; i++)
+                results[i] = a[i].Normalized();
+
+            DoNotOptimize(results.front());
+        });
+
+    state.Measure("Lerp", VectorCount, [&]
+        {
+            for (size_t i = 0; i < VectorCount; i++)
+                results[i] = Vector3F::Lerp(a[i], b[i], 0.25f);
+
+            DoNotOptimize(results.front());
+        });
+}
+
+BYTEENGINE_BENCHMARK(Vector3D)
+{
+    std::vector<float> values = MakeRandomFloats(VectorCount * 6, -10.0f, 10.0f);
+    std::vector<Vector3D> a(VectorCount), b(VectorCount), results(VectorCount);
+
+    for (size_t i = 0; i < VectorCount; i++)
+    {
+        a[i] = Vector3D(values[i * 6], values[i * 6 + 1], values[i * 6 + 2]);
+        b[i] = Vector3D(values[i * 6 + 3], values[i * 6 + 4], values[i * 6 + 5]);
+    }
+
+    state.Measure("Add", VectorCount, [&]
+        {
+            for (size_t i = 0; i < VectorCount; i++)
+                results[i] = a[i] + b[i];
+
+            DoNotOptimize(results.front());
+        });
+
+    state.Measure("Dot", VectorCount, [&]
+        {
+            double sum = 0.0;
+
+            for (size_t i = 0; i < VectorCount; i++)
+                sum += Vector3D::Dot(a[i], b[i]);
+
+            DoNotOptimize(sum);
+        });
+
+    state.Measure("Normalized", VectorCount, [&]
+        {
+            for (size_t i = 0; i < VectorCount; i++)
+                results[i] = a[i].Normalized();
+
+            DoNotOptimize(results.front());
+        });
+}
+
+BYTEENGINE_BENCHMARK(Vector4F)
+{
+    std::vector<float> values = MakeRandomFloats(VectorCount * 8, -10.0f, 10.0f);
+    std::vector<Vector4F> a(VectorCount), b(VectorCount), results(VectorCount);
+
+    for (size_t i = 0; i < VectorCount; i++)
+    {
+        a[i] = Vector4F(values[i * 8], values[i * 8 + 1], values[i * 8 + 2], values[i * 8 + 3]);
+        b[i] = Vector4F(values[i * 8 + 4], values[i * 8 + 5], values[i * 8 + 6], values[i * 8 + 7]);
+    }
+
+    state.Measure("Add", VectorCount, [&]
+        {
+            for (size_t i = 0; i < VectorCount; i++)
+                results[i] = a[i] + b[i];
+
+            DoNotOptimize(results.front());
+        });
+
+    state.Measure("Dot", VectorCount, [&]
+        {
+            float sum = 0.0f;
+
+            for (size_t i = 0; i < VectorCount; i++)
+                sum += Vector4F::Dot(a[i], b[i]);
+
+            DoNotOptimize(sum);
+        });
+
+    state.Measure("Normalized", VectorCount, [&]
+        {
+            for (size_t i = 0; i < VectorCount; i++)
+                results[i] = a[i].Normalized();
+
+            DoNotOptimize(results.front());
+        });
+
+    state.Measure("Lerp", VectorCount, [&]
+        {
+            for (size_t i = 0; i < VectorCount; i++)
+                results[i] = Vector4F::Lerp(a[i], b[i], 0.25f);
+
+            DoNotOptimize(results.front());
+        });
+}
+
+// The Vector4F operations above written against the private backend of Matrix4x4F and Quaternion, kept to check
+// whether routing Vector4F through it would pay off
+BYTEENGINE_BENCHMARK(Vector4FSimd)
+{
+    using namespace Simd;
+
+    std::vector<float> values = MakeRandomFloats(VectorCount * 8, -10.0f, 10.0f);
+    std::vector<Vector4F> a(VectorCount), b(VectorCount), results(VectorCount);
+
+    for (size_t i = 0; i < VectorCount; i++)
+    {
+        a[i] = Vector4F(values[i * 8], values[i * 8 + 1], values[i * 8 + 2], values[i * 8 + 3]);
+        b[i] = Vector4F(values[i * 8 + 4], values[i * 8 + 5], values[i * 8 + 6], values[i * 8 + 7]);
+    }
+
+    state.Measure("Add", VectorCount, [&]
+        {
+            for (size_t i = 0; i < VectorCount; i++)
+                Store4(results[i].data, Add(Load4(a[i].data), Load4(b[i].data)));
+
+            DoNotOptimize(results.front());
+        });
+
+    state.Measure("Dot", VectorCount, [&]
+        {
+            float sum = 0.0f;
+
+            for (size_t i = 0; i < VectorCount; i++)
+                sum += GetX(Dot4(Load4(a[i].data), Load4(b[i].data)));
+
+            DoNotOptimize(sum);
+        });
+
+    state.Measure("Normalized", VectorCount, [&]
+        {
+            for (size_t i = 0; i < VectorCount; i++)
+            {
+                Float4 v = Load4(a[i].data);
+                Float4 lengthSquared = Dot4(v, v);
+                Float4 normalized = Div(v, Sqrt(lengthSquared));
+                Store4(results[i].data, Select(CompareGreater(lengthSquared, Splat(ByteEngine::Math::Math::Epsilon)), normalized, Zero4()));
+            }
+
+            DoNotOptimize(results.front());
+        });
+
+    state.Measure("Lerp", VectorCount, [&]
+        {
+            Float4 t = Splat(0.25f);
+
+            for (size_t i = 0; i < VectorCount; i++)
+            {
+                Float4 from = Load4(a[i].data);
+                Store4(results[i].data, MulAdd(Sub(Load4(b[i].data), from), t, from));
+            }
+
+            DoNotOptimize(results.front());
+        });
+}
\ No newline at end of file
@@ -0,0 +1,49 @@
+﻿#include "Benchmark.h"
+#include "ByteEngine/Math/Matrix4x4F.h"
+#include "ByteEngine/Math/WorldTransform.h"
+
+using namespace ByteEngine;
+using namespace ByteEngine::Math;
+using namespace ByteEngine::Benchmarks;
+
+// Objects converted to camera-relative matrices every frame, scattered 50 km around a camera far from the origin
+static constexpr size_t ObjectCount = 100000;
+
+BYTEENGINE_BENCHMARK(WorldTransform)
+{
+    Vector3D camera(4.1e6, 35.0, -2.7e6);
+    std::vector<float> values = MakeRandomFloats(ObjectCount * 10, -1.0f, 1.0f, 1);
+    std::vector<WorldTransform> transforms(ObjectCount);
+    std::vector<Matrix4x4F> results(ObjectCount);
+
+    for (size_t i = 0; i < ObjectCount; i++)
+    {
+        const float* v = &values[i * 10];
+        Vector3D offset(v[0] * 50000.0, v[1] * 500.0, v[2] * 50000.0);
+        Quaternion rotation = Quaternion(v[3], v[4], v[5], v[6]).Normalized();
+        transforms[i] = WorldTransform(camera + offset, rotation, Vector3F(1.25f + v[7] * 0.75f, 1.25f + v[8] * 0.75f, 1.25f + v[9] * 0.75f));
+    }
+
+    // The float-only path without the double subtraction, what the conversion costs on top of it
+    state.Measure("CreateTRSFloat", ObjectCount, [&]
+        {
+            for (size_t i = 0; i < ObjectCount; i++)
+                results[i] = Matrix4x4F::CreateTRS(static_cast<Vector3F>(transforms[i].position), transforms[i].rotation, transforms[i].scale);
+
+            DoNotOptimize(results.front());
+        });
+
+    state.Measure("ToCameraRelativeMatrix", ObjectCount, [&]
+        {
+            for (size_t i = 0; i < ObjectCount; i++)
+                results[i] = transforms[i].ToCameraRelativeMatrix(camera);
+
+            DoNotOptimize(results.front());
+        });
+
+    state.Measure("ToCameraRelativeMatricesBatch", ObjectCount, [&]
+        {
+            WorldTransform::ToCameraRelativeMatrices(transforms, camera, results);
+            DoNotOptimize(results.front());
+        });
+}
\ No newline at end of file
@@ -2,6 +2,7 @@
 
 #include "ByteEngine/Core/Base/Singleton.h"
 #include "ByteEngine/Core/EventSystem/Delegate.h"
+#include "ByteEngine/Core/EventSystem/EventQueue.h"
 #include "ByteEngine/Primitives.h"
 
 #ifdef _WINDOWS
@@ -27,9 +28,13 @@ namespace ByteEngine
 
         Delegate<bool> quitRequest;
 
+        // Dispatched once per frame after the window events are polled
+        EventQueue events;
+
     public:
         void Quit(int32 exitCode);
         Delegate<bool>& QuitRequest() { return quitRequest; }
+        EventQueue& Events() { return events; }
 
     private:
         int32 Run(MainWindow& mainWindow);
@@ -4,6 +4,7 @@
 
 #include "ByteEngine/Core/Base/Singleton.h"
 #include "ByteEngine/Core/EventSystem/Delegate.h"
+#include "ByteEngine/Core/EventSystem/EventQueue.h"
 #include "ByteEngine/Core/EventSystem/MulticastDelegate.h"
 #include "ByteEngine/Core/Input/KeyCode.h"
 #include "ByteEngine/Math/Vector2.h"
@@ -22,6 +23,37 @@ namespace ByteEngine
         ExclusiveFullscreen
     };
 
+    // Frame events posted to Application::Events() alongside the immediate delegates of MainWindow,
+    // only the last change of each kind within a frame is delivered
+
+    struct WindowResizedEvent
+    {
+        static constexpr EventCoalescing Coalescing = EventCoalescing::KeepLast;
+
+        ByteEngine::Math::Vector2I size;
+    };
+
+    struct WindowFocusChangedEvent
+    {
+        static constexpr EventCoalescing Coalescing = EventCoalescing::KeepLast;
+
+        bool hasFocus = false;
+    };
+
+    struct WindowModeChangedEvent
+    {
+        static constexpr EventCoalescing Coalescing = EventCoalescing::KeepLast;
+
+        WindowMode mode = WindowMode::Windowed;
+    };
+
+    struct WindowTitleChangedEvent
+    {
+        static constexpr EventCoalescing Coalescing = EventCoalescing::KeepLast;
+
+        std::string title;
+    };
+
     class MainWindow : public Singleton<MainWindow>
     {
         friend class Application;
@@ -45,6 +77,9 @@ namespace ByteEngine
 
         std::string title;
 
+        // Set by Application::Run
+        EventQueue* eventQueue = nullptr;
+
         DelegateVoid<KeyCode, bool> keyStateChanged;
         DelegateVoid<ByteEngine::Math::Vector2I> mouseMoved;
         DelegateVoid<float, float> mouseWheelStateChanged;
@@ -62,6 +97,14 @@ namespace ByteEngine
         MulticastDelegate<WindowMode>& ModeChanged() { return modeChanged; }
         MulticastDelegate<std::string_view>& TitleChanged() { return titleChanged; }
 
+        MainWindow()
+        {
+            resized.SetProfileName("MainWindow::Resized");
+            focusStateChanged.SetProfileName("MainWindow::FocusStateChanged");
+            modeChanged.SetProfileName("MainWindow::ModeChanged");
+            titleChanged.SetProfileName("MainWindow::TitleChanged");
+        }
+
         virtual ~MainWindow() = default;
 
         virtual void SetWindowMode(WindowMode modeToSet) = 0;
@@ -89,6 +132,13 @@ namespace ByteEngine
         virtual void Close() = 0;
         virtual void PollEvents() = 0;
 
+        template<typename EventT>
+        void PostEvent(EventT event)
+        {
+            if (eventQueue)
+                eventQueue->Post(std::move(event));
+        }
+
     private:
         DelegateVoid<KeyCode, bool>& KeyStateChanged() { return keyStateChanged; }
         DelegateVoid<ByteEngine::Math::Vector2I>& MouseMoved() { return mouseMoved; }
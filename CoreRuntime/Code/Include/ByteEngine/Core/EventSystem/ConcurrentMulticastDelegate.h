@@ -0,0 +1,242 @@
+﻿#pragma once
+
+#include <algorithm>
+#include <atomic>
+#include <cassert>
+#include <memory>
+#include <mutex>
+#include <type_traits>
+#include <vector>
+
+#include "ByteEngine/Detail/Core/EventSystem/HazardPointers.h"
+#include "ByteEngine/Detail/Core/EventSystem/InlineCallable.h"
+#include "ByteEngine/Detail/Core/EventSystem/Subscriptions.h"
+#include "ByteEngine/Primitives.h"
+
+namespace ByteEngine::EventSystem
+{
+    // MulticastDelegate that may be used from any thread. Invoke reads an immutable snapshot of the subscriber list
+    // protected by a hazard pointer: it takes no lock, never waits for writers and writes only to a slot of its own thread,
+    // so invokers on different cores do not contend. Subscribe and Unsubscribe copy the list, apply the change
+    // and publish the copy, writers are serialized with each other only. A replaced snapshot is freed by the first write
+    // that finds no Invoke still using it, or by the destructor.
+    // An Invoke that started before Unsubscribe returned may still call the removed subscriber, later ones do not.
+    // A subscriber stays alive until every Invoke using it has finished.
+    // Targets may be called from several threads at once and must be safe for that. Invokes of concurrent delegates
+    // may nest up to HazardSlot::MaxDepth deep on one thread, deeper nesting aborts. The delegate must not be destroyed
+    // while it is invoked.
+    // Publishing copies the list, so this suits events that are invoked far more often than they change
+    template<typename... Args>
+    class ConcurrentMulticastDelegate
+    {
+    public:
+        using FunctionType = void(*)(Args...);
+
+    private:
+        struct Subscriber
+        {
+            SubscriptionHandle handle;
+            const void* owner;
+            std::weak_ptr<const void> lifetime;
+            bool tracksLifetime;
+
+            // Snapshots are shared between threads, the callable itself is what the caller guarantees to be thread-safe
+            mutable InlineCallable<void, Args...> callable;
+
+            [[nodiscard]] bool IsExpired() const { return tracksLifetime && lifetime.expired(); }
+        };
+
+        using Snapshot = std::vector<std::shared_ptr<const Subscriber>>;
+
+        std::atomic<const Snapshot*> snapshot = new Snapshot();
+
+        // Replaced snapshots that an Invoke may still be using, guarded by writeMutex
+        std::vector<const Snapshot*> retired;
+        std::vector<const void*> hazards;
+
+        std::mutex writeMutex;
+        std::atomic<SubscriptionHandle> nextHandle = 1;
+
+    public:
+        ConcurrentMulticastDelegate() = default;
+
+        ConcurrentMulticastDelegate(const ConcurrentMulticastDelegate&) = delete;
+        ConcurrentMulticastDelegate& operator=(const ConcurrentMulticastDelegate&) = delete;
+
+        ~ConcurrentMulticastDelegate()
+        {
+            delete snapshot.load(std::memory_order_acquire);
+
+            for (const Snapshot* old : retired)
+                delete old;
+        }
+
+        SubscriptionHandle SubscribeStatic(FunctionType func)
+        {
+            assert(func != nullptr && "Function pointer cannot be null.");
+            return Add<FunctionType>(nullptr, { }, false, func);
+        }
+
+        template<typename InstanceT>
+        SubscriptionHandle SubscribeRawPointer(InstanceT* instance, void(InstanceT::* method)(Args...))
+        {
+            return Add<RawPtrTarget<InstanceT, void, Args...>>(instance, { }, false, instance, method);
+        }
+
+        template<typename InstanceT>
+        SubscriptionHandle SubscribeSmartPointer(const std::shared_ptr<InstanceT>& instance, void(InstanceT::* method)(Args...))
+        {
+            return Add<SmartPtrTarget<InstanceT, void, Args...>>(instance.get(), instance, true, instance, method);
+        }
+
+        template<typename LambdaT>
+        SubscriptionHandle SubscribeLambda(LambdaT&& lambda)
+        {
+            return Add<std::decay_t<LambdaT>>(nullptr, { }, false, std::forward<LambdaT>(lambda));
+        }
+
+        void Unsubscribe(SubscriptionHandle handle)
+        {
+            assert(handle != 0 && "Subscription handle must not be equal to 0.");
+            RemoveIf([=](const Subscriber& subscriber) { return subscriber.handle == handle; });
+        }
+
+        void UnsubscribeObject(const void* objectToUnsubscribe)
+        {
+            assert(objectToUnsubscribe != nullptr && "Object pointer cannot be null.");
+            RemoveIf([=](const Subscriber& subscriber) { return subscriber.owner == objectToUnsubscribe; });
+        }
+
+        void Clear()
+        {
+            std::vector<const Snapshot*> unused;
+
+            {
+                std::lock_guard lock(writeMutex);
+                Publish(new Snapshot(), unused);
+            }
+
+            Free(unused);
+        }
+
+        void Invoke(Args... args) const
+        {
+            Detail::HazardGuard<Snapshot> current(snapshot);
+
+            // Arguments are passed as lvalues, every subscriber gets the same values
+            for (const std::shared_ptr<const Subscriber>& subscriber : *current)
+                subscriber->callable(args...);
+        }
+
+        bool HasSubscribers() const
+        {
+            Detail::HazardGuard<Snapshot> current(snapshot);
+            return !current->empty();
+        }
+
+        // Expired smart pointer subscriptions count until the next Subscribe or Unsubscribe drops them
+        [[nodiscard]] uint32 GetSubscriberCount() const
+        {
+            Detail::HazardGuard<Snapshot> current(snapshot);
+            return static_cast<uint32>(current->size());
+        }
+
+        bool IsObjectSubscribed(const void* object) const
+        {
+            Detail::HazardGuard<Snapshot> current(snapshot);
+
+            return std::any_of(current->begin(), current->end(), [=](const std::shared_ptr<const Subscriber>& subscriber)
+                {
+                    return subscriber->owner == object && !subscriber->IsExpired();
+                });
+        }
+
+    private:
+        template<typename TargetT, typename... ConstructArgs>
+        SubscriptionHandle Add(const void* owner, std::weak_ptr<const void> lifetime, bool tracksLifetime, ConstructArgs&&... constructArgs)
+        {
+            SubscriptionHandle handle = nextHandle.fetch_add(1, std::memory_order_relaxed);
+
+            // Built outside the lock, only the list copy is serialized
+            auto subscriber = std::make_shared<Subscriber>(handle, owner, std::move(lifetime), tracksLifetime);
+            subscriber->callable.template Emplace<TargetT>(std::forward<ConstructArgs>(constructArgs)...);
+
+            std::vector<const Snapshot*> unused;
+
+            {
+                std::lock_guard lock(writeMutex);
+                const Snapshot* current = snapshot.load(std::memory_order_relaxed);
+
+                auto* next = new Snapshot();
+                next->reserve(current->size() + 1);
+
+                for (const std::shared_ptr<const Subscriber>& existing : *current)
+                {
+                    if (!existing->IsExpired())
+                        next->push_back(existing);
+                }
+
+                next->push_back(std::move(subscriber));
+                Publish(next, unused);
+            }
+
+            Free(unused);
+            return handle;
+        }
+
+        template<typename Predicate>
+        void RemoveIf(Predicate&& shouldRemove)
+        {
+            std::vector<const Snapshot*> unused;
+
+            {
+                std::lock_guard lock(writeMutex);
+                const Snapshot* current = snapshot.load(std::memory_order_relaxed);
+
+                auto* next = new Snapshot();
+                next->reserve(current->size());
+
+                for (const std::shared_ptr<const Subscriber>& existing : *current)
+                {
+                    if (!shouldRemove(*existing) && !existing->IsExpired())
+                        next->push_back(existing);
+                }
+
+                // Nothing to publish, invokers keep the current list
+                if (next->size() != current->size())
+                    Publish(next, unused);
+                else
+                    delete next;
+            }
+
+            Free(unused);
+        }
+
+        // Called with writeMutex held. Retired snapshots no Invoke uses anymore are moved to unused,
+        // the caller frees them once the lock is released
+        void Publish(const Snapshot* next, std::vector<const Snapshot*>& unused)
+        {
+            retired.push_back(snapshot.exchange(next, std::memory_order_seq_cst));
+
+            // The old snapshot is unpublished, so an Invoke that does not hold it yet can no longer get it
+            Detail::CollectHazards(hazards);
+
+            std::erase_if(retired, [&](const Snapshot* old)
+                {
+                    if (std::find(hazards.begin(), hazards.end(), old) != hazards.end())
+                        return false;
+
+                    unused.push_back(old);
+                    return true;
+                });
+        }
+
+        // Outside writeMutex: releasing the last reference to a subscriber runs the destructor of its callable,
+        // which may subscribe to or unsubscribe from this delegate
+        static void Free(const std::vector<const Snapshot*>& unused)
+        {
+            for (const Snapshot* old : unused)
+                delete old;
+        }
+    };
+}
\ No newline at end of file
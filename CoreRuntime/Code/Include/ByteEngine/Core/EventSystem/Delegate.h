@@ -1,9 +1,11 @@
 ﻿#pragma once
 
-#include "ByteEngine/Detail/Core/EventSystem/Subscriptions.h"
+#include "ByteEngine/Detail/Core/EventSystem/InlineCallable.h"
 
 namespace ByteEngine::EventSystem
 {
+    // Single subscriber delegate. Subscribing stores the target inline, see InlineCallable,
+    // so only lambdas with large captures allocate
     template<typename Ret, typename... Args>
     class Delegate
     {
@@ -11,7 +13,7 @@ namespace ByteEngine::EventSystem
         using FunctionType = Ret(*)(Args...);
 
     private:
-        std::unique_ptr<Subcription<Ret, Args...>> subscription;
+        InlineCallable<Ret, Args...> subscription;
 
     public:
         Delegate() = default;
@@ -24,30 +26,31 @@ namespace ByteEngine::EventSystem
 
         void SubscribeStatic(FunctionType func)
         {
-            subscription = std::make_unique<StaticSubcription<Ret, Args...>>(func);
+            assert(func != nullptr && "Function pointer cannot be null.");
+            subscription.template Emplace<FunctionType>(func);
         }
 
         template<typename InstanceT>
         void SubscribeRawPointer(InstanceT* instance, Ret(InstanceT::* method)(Args...))
         {
-            subscription = std::make_unique<RawPtrSubcription<InstanceT, Ret, Args...>>(instance, method);
+            subscription.template Emplace<RawPtrTarget<InstanceT, Ret, Args...>>(instance, method);
         }
 
         template<typename InstanceT>
         void SubscribeSmartPointer(const std::shared_ptr<InstanceT>& instance, Ret(InstanceT::* method)(Args...))
         {
-            subscription = std::make_unique<SmartPtrSubcription<InstanceT, Ret, Args...>>(instance, method);
+            subscription.template Emplace<SmartPtrTarget<InstanceT, Ret, Args...>>(instance, method);
         }
 
         template<typename LambdaT>
         void SubscribeLambda(LambdaT&& lambda)
         {
-            subscription = std::make_unique<LambdaSubcription<std::decay_t<LambdaT>, Ret, Args...>>(std::forward<LambdaT>(lambda));
+            subscription.template Emplace<std::decay_t<LambdaT>>(std::forward<LambdaT>(lambda));
         }
 
         void Unsubscribe()
         {
-            subscription.reset();
+            subscription.Reset();
         }
 
         Ret Invoke(Args... args)
@@ -55,9 +58,9 @@ namespace ByteEngine::EventSystem
             if (subscription)
             {
                 if constexpr (std::is_void_v<Ret>)
-                    subscription->Invoke(std::forward<Args>(args)...);
+                    subscription(std::forward<Args>(args)...);
                 else
-                    return subscription->Invoke(std::forward<Args>(args)...);
+                    return subscription(std::forward<Args>(args)...);
             }
             else
             {
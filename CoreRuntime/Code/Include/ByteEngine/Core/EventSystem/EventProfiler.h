@@ -0,0 +1,155 @@
+﻿#pragma once
+
+#include <atomic>
+#include <bit>
+#include <deque>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include "ByteEngine/Detail/Core/EventSystem/Subscriptions.h"
+#include "ByteEngine/Primitives.h"
+
+namespace ByteEngine::EventSystem
+{
+    // Execution times in power of two buckets: bucket i counts times in [2^(i-1), 2^i) nanoseconds, bucket 0 counts zero
+    struct LatencyHistogram
+    {
+        static constexpr int32 BucketCount = 32;
+
+        uint64 buckets[BucketCount] = { };
+        uint64 count = 0;
+        uint64 totalNanoseconds = 0;
+        uint64 maxNanoseconds = 0;
+
+        void Record(uint64 nanoseconds)
+        {
+            int32 bucket = static_cast<int32>(std::bit_width(nanoseconds));
+            buckets[bucket < BucketCount ? bucket : BucketCount - 1]++;
+            count++;
+            totalNanoseconds += nanoseconds;
+            maxNanoseconds = nanoseconds > maxNanoseconds ? nanoseconds : maxNanoseconds;
+        }
+
+        void Merge(const LatencyHistogram& other)
+        {
+            for (int32 i = 0; i < BucketCount; i++)
+                buckets[i] += other.buckets[i];
+
+            count += other.count;
+            totalNanoseconds += other.totalNanoseconds;
+            maxNanoseconds = other.maxNanoseconds > maxNanoseconds ? other.maxNanoseconds : maxNanoseconds;
+        }
+
+        [[nodiscard]] uint64 GetMeanNanoseconds() const { return count > 0 ? totalNanoseconds / count : 0; }
+
+        // Upper bound of the bucket holding the given fraction of recorded times, at most the maximum
+        [[nodiscard]] uint64 GetPercentileNanoseconds(float fraction) const
+        {
+            uint64 target = static_cast<uint64>(fraction * static_cast<float>(count) + 0.5f);
+            uint64 cumulative = 0;
+
+            for (int32 i = 0; i < BucketCount; i++)
+            {
+                cumulative += buckets[i];
+
+                if (cumulative >= target && cumulative > 0)
+                {
+                    uint64 upperBound = i == 0 ? 0 : uint64(1) << i;
+                    return upperBound < maxNanoseconds ? upperBound : maxNanoseconds;
+                }
+            }
+
+            return maxNanoseconds;
+        }
+
+        void Reset() { *this = LatencyHistogram(); }
+    };
+
+    struct SubscriberProfile
+    {
+        SubscriptionHandle handle = 0;
+
+        // Object of raw and smart pointer subscriptions, null otherwise
+        const void* owner = nullptr;
+
+        LatencyHistogram latency = { };
+    };
+
+    // Statistics of one delegate, owned by the profiler so they outlive the delegate and make it into the final report
+    struct DelegateProfile
+    {
+        std::string name;
+
+        uint64 invokeCount = 0;
+        uint32 subscriberCount = 0;
+        uint32 peakSubscriberCount = 0;
+
+        // Deque, delegates keep pointers to their subscribers' entries.
+        // Entries of unsubscribed subscribers are reused, so it only grows to the most subscribers profiled at once
+        std::deque<SubscriberProfile> subscribers;
+        std::vector<SubscriberProfile*> freeSubscribers;
+
+        // Statistics of every unsubscribed subscriber merged together
+        LatencyHistogram unsubscribedLatency;
+        uint64 unsubscribedCount = 0;
+
+        void RecordInvoke(uint32 currentSubscriberCount)
+        {
+            invokeCount++;
+            subscriberCount = currentSubscriberCount;
+            peakSubscriberCount = currentSubscriberCount > peakSubscriberCount ? currentSubscriberCount : peakSubscriberCount;
+        }
+
+        SubscriberProfile* AcquireSubscriber(SubscriptionHandle handle, const void* owner)
+        {
+            if (freeSubscribers.empty())
+                return &subscribers.emplace_back(SubscriberProfile { handle, owner });
+
+            SubscriberProfile* subscriber = freeSubscribers.back();
+            freeSubscribers.pop_back();
+
+            subscriber->handle = handle;
+            subscriber->owner = owner;
+            return subscriber;
+        }
+
+        // Called once the subscriber is gone, its statistics move to the unsubscribed totals
+        void ReleaseSubscriber(SubscriberProfile* subscriber)
+        {
+            unsubscribedLatency.Merge(subscriber->latency);
+            unsubscribedCount++;
+
+            *subscriber = SubscriberProfile();
+            freeSubscribers.push_back(subscriber);
+        }
+    };
+
+    // Opt-in instrumentation of MulticastDelegate and EventQueue, compiled in with BYTEENGINE_EVENT_PROFILING.
+    // Without it delegates carry no profiling code and the report is empty.
+    // Statistics are recorded by the invoking thread without synchronization, read them from that thread
+    namespace EventProfiler
+    {
+        namespace Detail
+        {
+            inline std::atomic<bool> enabled = true;
+        }
+
+        // Recording can be paused at runtime, a paused delegate Invoke costs one extra branch
+        inline void SetEnabled(bool enabled) { Detail::enabled.store(enabled, std::memory_order_relaxed); }
+        [[nodiscard]] inline bool IsEnabled() { return Detail::enabled.load(std::memory_order_relaxed); }
+
+        DelegateProfile* CreateProfile(std::string name);
+        void SetProfileName(DelegateProfile* profile, std::string name);
+
+        // First profile with the given name, null if there is none
+        [[nodiscard]] const DelegateProfile* FindProfile(std::string_view name);
+
+        // Delegates by invoke count, their subscribers by total execution time
+        [[nodiscard]] std::string WriteReport();
+        void LogReport();
+
+        // Zeroes all statistics, profiles stay registered
+        void Reset();
+    }
+}
\ No newline at end of file
@@ -0,0 +1,93 @@
+﻿#pragma once
+
+#include <cassert>
+#include <memory>
+#include <vector>
+
+#include "ByteEngine/Detail/Core/EventSystem/EventChannel.h"
+
+namespace ByteEngine::EventSystem
+{
+    // Typed events collected over a frame and delivered together by Dispatch, as opposed to the immediate delegates.
+    // Each event type has its own contiguous ring buffer and listener delegate, and may coalesce its events,
+    // see EventCoalescing. Dispatch delivers event types in the order they were first used with this queue,
+    // events of one type in the order they were posted. Not thread-safe, post from the thread that dispatches
+    class EventQueue
+    {
+    private:
+        // Indexed by event type index, null for types this queue has not seen
+        std::vector<std::unique_ptr<Detail::EventChannelBase>> channels;
+        std::vector<Detail::EventChannelBase*> dispatchOrder;
+
+        bool dispatching = false;
+
+    public:
+        EventQueue() = default;
+
+        EventQueue(const EventQueue&) = delete;
+        EventQueue& operator=(const EventQueue&) = delete;
+
+        EventQueue(EventQueue&&) = default;
+        EventQueue& operator=(EventQueue&&) = default;
+
+        template<typename EventT>
+        void Post(EventT event)
+        {
+            GetChannel<EventT>().Post(std::move(event));
+        }
+
+        // Listeners receive const EventT&, e.g. queue.Listeners<WindowResizedEvent>().SubscribeLambda(...)
+        template<typename EventT>
+        MulticastDelegate<const EventT&>& Listeners()
+        {
+            return GetChannel<EventT>().Listeners();
+        }
+
+        template<typename EventT>
+        [[nodiscard]] size_t GetPendingCount()
+        {
+            return GetChannel<EventT>().GetPendingCount();
+        }
+
+        // Must not be called from a listener. Event types first posted by a listener are dispatched next time
+        void Dispatch()
+        {
+            assert(!dispatching && "Dispatch cannot be called from a listener.");
+            dispatching = true;
+
+            // By index, channels created by listeners reallocate dispatchOrder
+            size_t channelCount = dispatchOrder.size();
+
+            for (size_t i = 0; i < channelCount; i++)
+                dispatchOrder[i]->Dispatch();
+
+            dispatching = false;
+        }
+
+        // Drops pending events and destroys their payloads, listeners stay subscribed.
+        // From a listener this also drops the rest of the events being dispatched
+        void Clear()
+        {
+            for (Detail::EventChannelBase* channel : dispatchOrder)
+                channel->Clear();
+        }
+
+    private:
+        template<typename EventT>
+        Detail::EventChannel<EventT>& GetChannel()
+        {
+            uint32 index = Detail::GetEventTypeIndex<EventT>();
+
+            if (index >= channels.size())
+                channels.resize(index + 1);
+
+            if (!channels[index])
+            {
+                channels[index] = std::make_unique<Detail::EventChannel<EventT>>();
+                dispatchOrder.push_back(channels[index].get());
+            }
+
+            return static_cast<Detail::EventChannel<EventT>&>(*channels[index]);
+        }
+    };
+}
\ No newline at end of file
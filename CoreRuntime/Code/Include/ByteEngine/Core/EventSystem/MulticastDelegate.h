@@ -2,16 +2,33 @@
 
 #include <algorithm>
 #include <cassert>
-#include <iterator>
 #include <memory>
+#include <string_view>
 #include <type_traits>
 #include <vector>
 
+#ifdef BYTEENGINE_EVENT_PROFILING
+#include <chrono>
+#include <format>
+#include <string>
+
+#include "ByteEngine/Core/EventSystem/EventProfiler.h"
+#endif
+
+#include "ByteEngine/Detail/Core/EventSystem/InlineCallable.h"
 #include "ByteEngine/Detail/Core/EventSystem/Subscriptions.h"
 #include "ByteEngine/Primitives.h"
 
 namespace ByteEngine::EventSystem
 {
+    // Subscribers are kept in a slot map: callables are stored contiguously and inline, handles are a slot index
+    // plus a generation, so subscribe and unsubscribe are O(1) and a stale handle is ignored.
+    // Subscribing or unsubscribing from a callback is allowed: subscribers removed during Invoke are not called anymore,
+    // subscribers added during Invoke are first called by the next one. Storage is compacted after the outermost Invoke.
+    // Unsubscribing swaps the last subscriber into the gap,
+    // so the call order is only the subscription order as long as nothing is removed.
+    // Handles are only meaningful for the delegate that returned them.
+    // With BYTEENGINE_EVENT_PROFILING every Invoke and every subscriber call is recorded, see EventProfiler
     template<typename... Args>
     class MulticastDelegate
     {
@@ -19,16 +36,55 @@ namespace ByteEngine::EventSystem
         using FunctionType = void(*)(Args...);
 
     private:
-        using SubscriptionItem = std::pair<SubscriptionHandle, std::unique_ptr<Subcription<void, Args...>>>;
+        using Callable = InlineCallable<void, Args...>;
 
-        std::vector<SubscriptionItem> subscriptions;
+        static constexpr uint32 PendingBit = 1u << 31;
+        static constexpr uint32 NoFreeSlot = UINT32_MAX;
+
+        // Everything about a subscription except its callable, parallel to the callables
+        struct EntryInfo
+        {
+            const void* owner = nullptr;
 
-        std::vector<SubscriptionItem> pendingSubscriptions;
-        std::vector<SubscriptionHandle> pendingRemovals;
+            // Smart pointer subscriptions are dropped once their object is gone
+            std::weak_ptr<const void> lifetime = { };
+            bool tracksLifetime = false;
 
-        bool invoked = false;
+            // Unsubscribed during Invoke, erased afterwards
+            bool removed = false;
 
-        int32 invokesCount = 0;
+            uint32 slot = 0;
+
+#ifdef BYTEENGINE_EVENT_PROFILING
+            // Created on the first profiled call
+            SubscriberProfile* profile = nullptr;
+#endif
+        };
+
+        // Index of the entry, with PendingBit for pending ones, or the next free slot while the slot is unused
+        struct Slot
+        {
+            uint32 index = 0;
+            uint32 generation = 1;
+        };
+
+        std::vector<Callable> callables;
+        std::vector<EntryInfo> infos;
+
+        std::vector<Callable> pendingCallables;
+        std::vector<EntryInfo> pendingInfos;
+
+        std::vector<Slot> slots;
+        uint32 freeSlot = NoFreeSlot;
+
+        uint32 subscriberCount = 0;
+        int32 invokeDepth = 0;
+        bool hasRemovedEntries = false;
+
+#ifdef BYTEENGINE_EVENT_PROFILING
+        // Owned by the profiler, created by SetProfileName or the first profiled Invoke
+        DelegateProfile* profile = nullptr;
+#endif
 
     public:
         MulticastDelegate() = default;
@@ -41,142 +97,296 @@ namespace ByteEngine::EventSystem
 
         SubscriptionHandle SubscribeStatic(FunctionType func)
         {
-            if (invoked)
-                return SubscribePendingInternal(std::make_unique<StaticSubcription<void, Args...>>(func));
-            else
-                return SubscribeInternal(std::make_unique<StaticSubcription<void, Args...>>(func));
+            assert(func != nullptr && "Function pointer cannot be null.");
+            return Add<FunctionType>(EntryInfo { }, func);
         }
 
         template<typename InstanceT>
         SubscriptionHandle SubscribeRawPointer(InstanceT* instance, void(InstanceT::* method)(Args...))
         {
-            if (invoked)
-                return SubscribePendingInternal(std::make_unique<RawPtrSubcription<InstanceT, void, Args...>>(instance, method));
-            else
-                return SubscribeInternal(std::make_unique<RawPtrSubcription<InstanceT, void, Args...>>(instance, method));
+            return Add<RawPtrTarget<InstanceT, void, Args...>>(EntryInfo { .owner = instance }, instance, method);
         }
 
         template<typename InstanceT>
         SubscriptionHandle SubscribeSmartPointer(const std::shared_ptr<InstanceT>& instance, void(InstanceT::* method)(Args...))
         {
-            if (invoked)
-                return SubscribePendingInternal(std::make_unique<SmartPtrSubcription<InstanceT, void, Args...>>(instance, method));
-            else
-                return SubscribeInternal(std::make_unique<SmartPtrSubcription<InstanceT, void, Args...>>(instance, method));
+            return Add<SmartPtrTarget<InstanceT, void, Args...>>(EntryInfo { .owner = instance.get(), .lifetime = instance, .tracksLifetime = true }, instance, method);
         }
 
         template<typename LambdaT>
         SubscriptionHandle SubscribeLambda(LambdaT&& lambda)
         {
-            if (invoked)
-                return SubscribePendingInternal(std::make_unique<LambdaSubcription<std::decay_t<LambdaT>, Args...>>(std::forward<LambdaT>(lambda)));
-            else
-                return SubscribeInternal(std::make_unique<LambdaSubcription<std::decay_t<LambdaT>, void, Args...>>(std::forward<LambdaT>(lambda)));
+            return Add<std::decay_t<LambdaT>>(EntryInfo { }, std::forward<LambdaT>(lambda));
         }
 
+        // Does nothing for handles that were already unsubscribed
         void Unsubscribe(SubscriptionHandle handle)
         {
             assert(handle != 0 && "Subscription handle must not be equal to 0.");
 
-            if (invoked)
-                pendingRemovals.emplace_back(handle);
-            else
-                subscriptions.erase(handle);
+            uint32 slot = static_cast<uint32>(handle);
+            uint32 generation = static_cast<uint32>(handle >> 32);
+
+            if (slot < slots.size() && slots[slot].generation == generation)
+                Remove(slot);
         }
 
         void UnsubscribeObject(const void* objectToUnsubscribe)
         {
             assert(objectToUnsubscribe != nullptr && "Object pointer cannot be null.");
 
-            if (invoked)
+            // Backwards, removing outside of Invoke swaps the last entry into the current one
+            for (size_t i = infos.size(); i-- > 0;)
             {
-                for (const auto& [handle, subscription] : subscriptions)
-                {
-                    if (subscription->GetOwner() == objectToUnsubscribe)
-                        pendingRemovals.emplace_back(handle);
-                }
+                if (!infos[i].removed && infos[i].owner == objectToUnsubscribe)
+                    Remove(infos[i].slot);
             }
-            else
+
+            for (EntryInfo& info : pendingInfos)
             {
-                std::erase_if(subscriptions, [=](const SubscriptionItem& item)
-                {
-                    return item.second->GetOwner() == objectToUnsubscribe;
-                });
+                if (!info.removed && info.owner == objectToUnsubscribe)
+                    Remove(info.slot);
             }
         }
 
         void Clear()
         {
-            subscriptions.clear();
+            for (size_t i = infos.size(); i-- > 0;)
+            {
+                if (!infos[i].removed)
+                    Remove(infos[i].slot);
+            }
+
+            for (EntryInfo& info : pendingInfos)
+            {
+                if (!info.removed)
+                    Remove(info.slot);
+            }
         }
 
-        void Invoke(Args... args)
+        // Capacity is kept when subscribers leave, so a delegate that had many subscribers once does not reallocate again
+        void Reserve(size_t count)
         {
-            invokesCount++;
-            invoked = true;
-            std::erase_if(subscriptions, [](const SubscriptionItem& item) { return item.second->IsExpired(); });
+            callables.reserve(count);
+            infos.reserve(count);
+            slots.reserve(count);
+        }
 
-            for (const auto& [handle, subscription] : subscriptions)
-            {
-                if (subscription)
-                    subscription->Invoke(std::forward<Args>(args)...);
-            }
+        // Name of the delegate in the event profile report, does nothing without BYTEENGINE_EVENT_PROFILING
+        void SetProfileName([[maybe_unused]] std::string_view name)
+        {
+#ifdef BYTEENGINE_EVENT_PROFILING
+            if (profile)
+                EventProfiler::SetProfileName(profile, std::string(name));
+            else
+                profile = EventProfiler::CreateProfile(std::string(name));
+#endif
+        }
+
+        void Invoke(Args... args)
+        {
+            invokeDepth++;
 
-            invoked = false;
+#ifdef BYTEENGINE_EVENT_PROFILING
+            bool profiling = EventProfiler::IsEnabled();
 
-            for (SubscriptionHandle handle : pendingRemovals)
-                std::erase_if(subscriptions, [=](const SubscriptionItem& item) { return item.first == handle; });
-            pendingRemovals.clear();
+            if (profiling)
+                BeginProfiledInvoke();
+#endif
 
-            subscriptions.insert(subscriptions.end(), std::make_move_iterator(pendingSubscriptions.begin()), std::make_move_iterator(pendingSubscriptions.end()));
-            pendingSubscriptions.clear();
+            // Callables do not move during the loop: subscriptions go to the pending list and removals only mark entries
+            size_t count = callables.size();
 
-            if (invokesCount > 50)
+            for (size_t i = 0; i < count; i++)
             {
-                invokesCount = 0;
-                subscriptions.shrink_to_fit();
+                EntryInfo& info = infos[i];
 
-                if (pendingSubscriptions.capacity() > 10)
-                    subscriptions.reserve(10);
+                if (info.removed)
+                    continue;
 
-                if (pendingRemovals.capacity() > 10)
-                    pendingRemovals.reserve(10);
+                if (info.tracksLifetime && info.lifetime.expired())
+                {
+                    Remove(info.slot);
+                    continue;
+                }
+
+#ifdef BYTEENGINE_EVENT_PROFILING
+                if (profiling)
+                {
+                    InvokeProfiled(i, args...);
+                    continue;
+                }
+#endif
+
+                // Arguments are passed as lvalues, every subscriber gets the same values
+                callables[i](args...);
             }
+
+            invokeDepth--;
+
+            if (invokeDepth == 0)
+                ApplyDeferredChanges();
         }
 
         bool HasSubscribers() const
         {
-            return !subscriptions.empty();
+            return subscriberCount > 0;
         }
 
+        [[nodiscard]] uint32 GetSubscriberCount() const { return subscriberCount; }
+
         bool IsObjectSubscribed(const void* object) const
         {
-            return std::any_of(subscriptions.begin(), subscriptions.end(), [=](const SubscriptionItem& item)
-            {
-                return item.second->GetOwner() == object;
-            });
+            auto matches = [=](const EntryInfo& info)
+                {
+                    return !info.removed && info.owner == object && !(info.tracksLifetime && info.lifetime.expired());
+                };
+
+            return std::any_of(infos.begin(), infos.end(), matches) || std::any_of(pendingInfos.begin(), pendingInfos.end(), matches);
         }
 
     private:
-        static SubscriptionHandle GenerateUniqueId()
+        template<typename TargetT, typename... ConstructArgs>
+        SubscriptionHandle Add(EntryInfo info, ConstructArgs&&... constructArgs)
+        {
+            uint32 slot = AllocateSlot();
+            info.slot = slot;
+
+            bool pending = invokeDepth > 0;
+            std::vector<Callable>& targetCallables = pending ? pendingCallables : callables;
+            std::vector<EntryInfo>& targetInfos = pending ? pendingInfos : infos;
+
+            targetCallables.emplace_back().template Emplace<TargetT>(std::forward<ConstructArgs>(constructArgs)...);
+            targetInfos.push_back(std::move(info));
+
+            slots[slot].index = static_cast<uint32>(targetInfos.size() - 1) | (pending ? PendingBit : 0);
+            subscriberCount++;
+
+            return GetHandle(slot);
+        }
+
+        SubscriptionHandle GetHandle(uint32 slot) const
         {
-            static SubscriptionHandle idCounter = 1;
-            return idCounter++;
+            return static_cast<SubscriptionHandle>(slots[slot].generation) << 32 | slot;
         }
 
-        SubscriptionHandle SubscribeInternal(std::unique_ptr<Subcription<void, Args...>>&& instance)
+        uint32 AllocateSlot()
         {
-            SubscriptionHandle handle = GenerateUniqueId();
-            subscriptions.emplace_back(handle, std::move(instance));
-            return handle;
+            if (freeSlot != NoFreeSlot)
+            {
+                uint32 slot = freeSlot;
+                freeSlot = slots[slot].index;
+                return slot;
+            }
+
+            assert(slots.size() < PendingBit && "Too many subscriptions.");
+            slots.emplace_back();
+            return static_cast<uint32>(slots.size() - 1);
+        }
+
+        // Invalidates the handle right away, the entry is erased now or marked and erased after Invoke
+        void Remove(uint32 slot)
+        {
+            uint32 index = slots[slot].index;
+
+            // Generation 0 is skipped, so no handle is ever 0
+            if (++slots[slot].generation == 0)
+                slots[slot].generation = 1;
+
+            slots[slot].index = freeSlot;
+            freeSlot = slot;
+            subscriberCount--;
+
+            if (index & PendingBit)
+            {
+                pendingInfos[index & ~PendingBit].removed = true;
+            }
+            else if (invokeDepth > 0)
+            {
+                infos[index].removed = true;
+                hasRemovedEntries = true;
+            }
+            else
+            {
+                EraseEntry(index);
+            }
         }
 
-        SubscriptionHandle SubscribePendingInternal(std::unique_ptr<Subcription<void, Args...>>&& instance)
+        void EraseEntry(size_t index)
         {
-            SubscriptionHandle handle = GenerateUniqueId();
-            pendingSubscriptions.emplace_back(handle, std::move(instance));
-            return handle;
+#ifdef BYTEENGINE_EVENT_PROFILING
+            // Not earlier in Remove, a callable unsubscribing itself is still timed into its entry
+            if (infos[index].profile)
+                profile->ReleaseSubscriber(infos[index].profile);
+#endif
+
+            size_t last = infos.size() - 1;
+
+            if (index != last)
+            {
+                callables[index] = std::move(callables[last]);
+                infos[index] = std::move(infos[last]);
+                slots[infos[index].slot].index = static_cast<uint32>(index);
+            }
+
+            callables.pop_back();
+            infos.pop_back();
+        }
+
+        void ApplyDeferredChanges()
+        {
+            if (hasRemovedEntries)
+            {
+                // Backwards, so the entry swapped in has already been checked
+                for (size_t i = infos.size(); i-- > 0;)
+                {
+                    if (infos[i].removed)
+                        EraseEntry(i);
+                }
+
+                hasRemovedEntries = false;
+            }
+
+            for (size_t i = 0; i < pendingInfos.size(); i++)
+            {
+                if (pendingInfos[i].removed)
+                    continue;
+
+                slots[pendingInfos[i].slot].index = static_cast<uint32>(infos.size());
+                callables.push_back(std::move(pendingCallables[i]));
+                infos.push_back(std::move(pendingInfos[i]));
+            }
+
+            pendingCallables.clear();
+            pendingInfos.clear();
+        }
+
+#ifdef BYTEENGINE_EVENT_PROFILING
+        void BeginProfiledInvoke()
+        {
+            if (!profile)
+                profile = EventProfiler::CreateProfile(std::format("Unnamed delegate {}", static_cast<const void*>(this)));
+
+            profile->RecordInvoke(subscriberCount);
+        }
+
+        void InvokeProfiled(size_t index, Args&... args)
+        {
+            EntryInfo& info = infos[index];
+
+            if (!info.profile)
+                info.profile = profile->AcquireSubscriber(GetHandle(info.slot), info.owner);
+
+            // The entry stays in place during Invoke, even if the callable unsubscribes itself
+            SubscriberProfile* subscriberProfile = info.profile;
+            auto start = std::chrono::steady_clock::now();
+
+            callables[index](args...);
+
+            auto elapsed = std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - start);
+            subscriberProfile->latency.Record(static_cast<uint64>(elapsed.count()));
         }
+#endif
     };
 
     using MulticastDelegateVoid = MulticastDelegate<>;
@@ -0,0 +1,186 @@
+﻿#pragma once
+
+#include <atomic>
+#include <bit>
+#include <source_location>
+#include <string_view>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include "ByteEngine/Core/EventSystem/MulticastDelegate.h"
+#include "ByteEngine/Primitives.h"
+
+namespace ByteEngine::EventSystem
+{
+    // How events of one type posted within a frame are combined before dispatch
+    enum class EventCoalescing : uint8
+    {
+        // Every event is delivered
+        None,
+
+        // Only the last event of the frame is delivered, e.g. window resizes
+        KeepLast,
+
+        // Events are folded into the first one with first.Merge(later), e.g. accumulated mouse deltas
+        Merge
+    };
+
+    // Event types opt into coalescing with a static constexpr EventCoalescing Coalescing member
+    template<typename EventT>
+    consteval EventCoalescing GetEventCoalescing()
+    {
+        if constexpr (requires { EventT::Coalescing; })
+            return EventT::Coalescing;
+        else
+            return EventCoalescing::None;
+    }
+
+    namespace Detail
+    {
+        inline std::atomic<uint32> nextEventTypeIndex = 0;
+
+        // Dense index per event type, shared by all queues
+        template<typename EventT>
+        uint32 GetEventTypeIndex()
+        {
+            static const uint32 index = nextEventTypeIndex.fetch_add(1, std::memory_order_relaxed);
+            return index;
+        }
+
+        // Event type name cut out of the function signature, used as the profile name of event listeners.
+        // "... [with EventT = Name; ...]" on GCC and Clang, "... GetEventTypeName<struct Name>(void)" on MSVC
+        template<typename EventT>
+        consteval std::string_view GetEventTypeName()
+        {
+            std::string_view signature = std::source_location::current().function_name();
+
+            if (size_t start = signature.find("EventT = "); start != std::string_view::npos)
+            {
+                start += std::string_view("EventT = ").size();
+                return signature.substr(start, signature.find_first_of(";]", start) - start);
+            }
+
+            if (size_t start = signature.find("GetEventTypeName<"); start != std::string_view::npos)
+            {
+                start += std::string_view("GetEventTypeName<").size();
+                return signature.substr(start, signature.rfind(">(") - start);
+            }
+
+            return signature;
+        }
+
+        class EventChannelBase
+        {
+        public:
+            virtual ~EventChannelBase() = default;
+            virtual void Dispatch() = 0;
+            virtual void Clear() = 0;
+        };
+
+        // Pending events of one type in a ring buffer that grows by doubling, and the listeners for them
+        template<typename EventT>
+        class EventChannel final : public EventChannelBase
+        {
+        private:
+            static constexpr EventCoalescing Coalescing = GetEventCoalescing<EventT>();
+
+            static_assert(std::is_default_constructible_v<EventT> && std::is_move_assignable_v<EventT>, "Events are stored in a ring buffer of default constructed slots.");
+            static_assert(Coalescing != EventCoalescing::Merge || requires(EventT& first, const EventT& later) { first.Merge(later); },
+                "Merged events need a Merge(const EventT&) method.");
+
+            // Capacity is a power of two, or zero before the first event
+            std::vector<EventT> ring;
+            size_t head = 0;
+            size_t count = 0;
+
+            MulticastDelegate<const EventT&> listeners;
+
+        public:
+            EventChannel()
+            {
+                listeners.SetProfileName(GetEventTypeName<EventT>());
+            }
+
+            void Post(EventT&& event)
+            {
+                if constexpr (Coalescing == EventCoalescing::KeepLast)
+                {
+                    if (count > 0)
+                    {
+                        Back() = std::move(event);
+                        return;
+                    }
+                }
+                else if constexpr (Coalescing == EventCoalescing::Merge)
+                {
+                    if (count > 0)
+                    {
+                        Back().Merge(event);
+                        return;
+                    }
+                }
+
+                if (count == ring.size())
+                    Grow();
+
+                ring[(head + count) & (ring.size() - 1)] = std::move(event);
+                count++;
+            }
+
+            // Delivers the events pending when Dispatch starts. Events posted by listeners wait for the next Dispatch,
+            // each event is moved out of the ring before its listeners run so posting from a listener is safe.
+            // Stops early when a listener clears the queue
+            void Dispatch() override
+            {
+                size_t dispatchCount = count;
+
+                if (!listeners.HasSubscribers())
+                {
+                    Clear();
+                    return;
+                }
+
+                for (size_t i = 0; i < dispatchCount && count > 0; i++)
+                {
+                    EventT event = std::move(ring[head]);
+                    head = (head + 1) & (ring.size() - 1);
+                    count--;
+
+                    listeners.Invoke(event);
+                }
+            }
+
+            // Pending payloads are destroyed, e.g. strings of title events release their memory
+            void Clear() override
+            {
+                for (size_t i = 0; i < count; i++)
+                    ring[(head + i) & (ring.size() - 1)] = EventT();
+
+                head = 0;
+                count = 0;
+            }
+
+            [[nodiscard]] size_t GetPendingCount() const { return count; }
+
+            MulticastDelegate<const EventT&>& Listeners() { return listeners; }
+
+        private:
+            EventT& Back()
+            {
+                return ring[(head + count - 1) & (ring.size() - 1)];
+            }
+
+            void Grow()
+            {
+                std::vector<EventT> grown(ring.empty() ? 16 : ring.size() * 2);
+
+                for (size_t i = 0; i < count; i++)
+                    grown[i] = std::move(ring[(head + i) & (ring.size() - 1)]);
+
+                ring = std::move(grown);
+                head = 0;
+            }
+        };
+    }
+}
\ No newline at end of file
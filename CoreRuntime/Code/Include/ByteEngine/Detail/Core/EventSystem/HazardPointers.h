@@ -0,0 +1,137 @@
+﻿#pragma once
+
+#include <atomic>
+#include <cstdio>
+#include <cstdlib>
+#include <vector>
+
+#include "ByteEngine/Primitives.h"
+
+// Hazard pointers after M. Michael, "Hazard Pointers: Safe Memory Reclamation for Lock-Free Objects".
+// A reader publishes the pointer it is about to use in a slot owned by its thread, a writer that replaced the pointer
+// frees the old object only once no slot holds it. Readers write only to their own cache line, never to shared state
+namespace ByteEngine::EventSystem::Detail
+{
+    // One per thread, reused after the thread exits. Each nesting level of guards on a thread takes its own pointer
+    struct alignas(64) HazardSlot
+    {
+        static constexpr int32 MaxDepth = 8;
+
+        std::atomic<const void*> hazards[MaxDepth] = { };
+        std::atomic<bool> owned = false;
+
+        // Slots are never freed, so the list can be walked without locking
+        HazardSlot* next = nullptr;
+    };
+
+    inline std::atomic<HazardSlot*> hazardSlots = nullptr;
+
+    inline HazardSlot* AcquireHazardSlot()
+    {
+        for (HazardSlot* slot = hazardSlots.load(std::memory_order_acquire); slot; slot = slot->next)
+        {
+            bool expected = false;
+
+            if (!slot->owned.load(std::memory_order_relaxed) && slot->owned.compare_exchange_strong(expected, true, std::memory_order_acquire))
+                return slot;
+        }
+
+        HazardSlot* slot = new HazardSlot();
+        slot->owned.store(true, std::memory_order_relaxed);
+        slot->next = hazardSlots.load(std::memory_order_relaxed);
+
+        while (!hazardSlots.compare_exchange_weak(slot->next, slot, std::memory_order_release, std::memory_order_relaxed))
+        { }
+
+        return slot;
+    }
+
+    class ThreadHazards
+    {
+    private:
+        HazardSlot* slot = nullptr;
+        int32 depth = 0;
+
+    public:
+        ~ThreadHazards()
+        {
+            if (slot)
+                slot->owned.store(false, std::memory_order_release);
+        }
+
+        std::atomic<const void*>& Push()
+        {
+            // Checked in every build, one level deeper would overwrite owned and next of the shared slot list
+            if (depth >= HazardSlot::MaxDepth)
+            {
+                std::fputs("Too many nested invokes of concurrent delegates on one thread.\n", stderr);
+                std::abort();
+            }
+
+            if (!slot)
+                slot = AcquireHazardSlot();
+
+            return slot->hazards[depth++];
+        }
+
+        void Pop()
+        {
+            depth--;
+        }
+    };
+
+    inline thread_local ThreadHazards threadHazards;
+
+    // Keeps the object source points to at construction alive until the guard is destroyed
+    template<typename T>
+    class HazardGuard
+    {
+    private:
+        std::atomic<const void*>& hazard;
+        const T* pointer;
+
+    public:
+        explicit HazardGuard(const std::atomic<const T*>& source)
+            : hazard(threadHazards.Push()), pointer(source.load(std::memory_order_relaxed))
+        {
+            // Published, then checked that it is still current, so a writer scanning after replacing it sees the hazard
+            while (true)
+            {
+                hazard.store(pointer, std::memory_order_seq_cst);
+                const T* current = source.load(std::memory_order_seq_cst);
+
+                if (current == pointer)
+                    break;
+
+                pointer = current;
+            }
+        }
+
+        HazardGuard(const HazardGuard&) = delete;
+        HazardGuard& operator=(const HazardGuard&) = delete;
+
+        ~HazardGuard()
+        {
+            hazard.store(nullptr, std::memory_order_release);
+            threadHazards.Pop();
+        }
+
+        const T& operator*() const { return *pointer; }
+        const T* operator->() const { return pointer; }
+    };
+
+    // Pointers currently protected by any thread. Call after the replaced pointer was unpublished
+    inline void CollectHazards(std::vector<const void*>& hazards)
+    {
+        hazards.clear();
+
+        for (HazardSlot* slot = hazardSlots.load(std::memory_order_acquire); slot; slot = slot->next)
+        {
+            for (const std::atomic<const void*>& hazard : slot->hazards)
+            {
+                if (const void* pointer = hazard.load(std::memory_order_seq_cst))
+                    hazards.push_back(pointer);
+            }
+        }
+    }
+}
\ No newline at end of file
@@ -0,0 +1,222 @@
+﻿#pragma once
+
+#include <cassert>
+#include <cstddef>
+#include <cstring>
+#include <memory>
+#include <new>
+#include <type_traits>
+#include <utility>
+
+#include "ByteEngine/Primitives.h"
+
+namespace ByteEngine::EventSystem
+{
+    // Type erased callable with inline storage. Targets that fit the buffer live inside the object, larger ones
+    // fall back to the heap. A call goes through one function pointer, there is no vtable and no allocation for
+    // function pointers, object and method pairs or lambdas capturing a few pointers
+    template<typename Ret, typename... Args>
+    class InlineCallable
+    {
+    public:
+        // Enough for an object pointer with any method pointer, or a lambda capturing four pointers
+        static constexpr size_t InlineSize = 4 * sizeof(void*);
+
+        template<typename TargetT>
+        static constexpr bool IsStoredInline = sizeof(TargetT) <= InlineSize && alignof(TargetT) <= alignof(std::max_align_t)
+            && std::is_nothrow_move_constructible_v<TargetT>;
+
+    private:
+        enum class Operation : uint8
+        {
+            Move,
+            Destroy
+        };
+
+        union Storage
+        {
+            alignas(std::max_align_t) std::byte buffer[InlineSize];
+            void* heapTarget;
+        };
+
+        using InvokerType = Ret(*)(Storage& storage, Args... args);
+
+        // Moves the target from source to destination and destroys the source, or only destroys it.
+        // Null for inline targets that are trivially copyable, those are moved with memcpy
+        using ManagerType = void(*)(Operation operation, Storage& source, Storage* destination);
+
+        Storage storage;
+        InvokerType invoker = nullptr;
+        ManagerType manager = nullptr;
+
+    public:
+        InlineCallable() = default;
+
+        InlineCallable(const InlineCallable&) = delete;
+        InlineCallable& operator=(const InlineCallable&) = delete;
+
+        InlineCallable(InlineCallable&& other) noexcept
+        {
+            MoveFrom(other);
+        }
+
+        InlineCallable& operator=(InlineCallable&& other) noexcept
+        {
+            if (this != &other)
+            {
+                Reset();
+                MoveFrom(other);
+            }
+
+            return *this;
+        }
+
+        ~InlineCallable()
+        {
+            Reset();
+        }
+
+        template<typename TargetT, typename... ConstructArgs>
+        void Emplace(ConstructArgs&&... constructArgs)
+        {
+            Reset();
+
+            if constexpr (IsStoredInline<TargetT>)
+            {
+                ::new (static_cast<void*>(storage.buffer)) TargetT(std::forward<ConstructArgs>(constructArgs)...);
+                invoker = &InvokeInline<TargetT>;
+
+                if constexpr (!std::is_trivially_copyable_v<TargetT>)
+                    manager = &ManageInline<TargetT>;
+            }
+            else
+            {
+                storage.heapTarget = new TargetT(std::forward<ConstructArgs>(constructArgs)...);
+                invoker = &InvokeHeap<TargetT>;
+                manager = &ManageHeap<TargetT>;
+            }
+        }
+
+        void Reset()
+        {
+            if (manager)
+                manager(Operation::Destroy, storage, nullptr);
+
+            invoker = nullptr;
+            manager = nullptr;
+        }
+
+        [[nodiscard]] bool IsEmpty() const { return invoker == nullptr; }
+        explicit operator bool() const { return invoker != nullptr; }
+
+        Ret operator()(Args... args)
+        {
+            assert(invoker && "Invoking an empty callable.");
+            return invoker(storage, std::forward<Args>(args)...);
+        }
+
+    private:
+        void MoveFrom(InlineCallable& other)
+        {
+            if (other.manager)
+                other.manager(Operation::Move, other.storage, &storage);
+            else
+                std::memcpy(&storage, &other.storage, sizeof(Storage));
+
+            invoker = other.invoker;
+            manager = other.manager;
+            other.invoker = nullptr;
+            other.manager = nullptr;
+        }
+
+        template<typename TargetT>
+        static TargetT& GetInline(Storage& storage)
+        {
+            return *std::launder(reinterpret_cast<TargetT*>(storage.buffer));
+        }
+
+        template<typename TargetT>
+        static Ret InvokeInline(Storage& storage, Args... args)
+        {
+            if constexpr (std::is_void_v<Ret>)
+                GetInline<TargetT>(storage)(std::forward<Args>(args)...);
+            else
+                return GetInline<TargetT>(storage)(std::forward<Args>(args)...);
+        }
+
+        template<typename TargetT>
+        static Ret InvokeHeap(Storage& storage, Args... args)
+        {
+            if constexpr (std::is_void_v<Ret>)
+                (*static_cast<TargetT*>(storage.heapTarget))(std::forward<Args>(args)...);
+            else
+                return (*static_cast<TargetT*>(storage.heapTarget))(std::forward<Args>(args)...);
+        }
+
+        template<typename TargetT>
+        static void ManageInline(Operation operation, Storage& source, Storage* destination)
+        {
+            TargetT& target = GetInline<TargetT>(source);
+
+            if (operation == Operation::Move)
+                ::new (static_cast<void*>(destination->buffer)) TargetT(std::move(target));
+
+            target.~TargetT();
+        }
+
+        template<typename TargetT>
+        static void ManageHeap(Operation operation, Storage& source, Storage* destination)
+        {
+            if (operation == Operation::Move)
+                destination->heapTarget = source.heapTarget;
+            else
+                delete static_cast<TargetT*>(source.heapTarget);
+        }
+    };
+
+    // Method call on a raw object pointer, the caller keeps the object alive while subscribed
+    template<typename InstanceT, typename Ret, typename... Args>
+    struct RawPtrTarget
+    {
+        using MethodPtr = Ret(InstanceT::*)(Args...);
+
+        InstanceT* instance;
+        MethodPtr method;
+
+        Ret operator()(Args... args) const
+        {
+            if constexpr (std::is_void_v<Ret>)
+                (instance->*method)(std::forward<Args>(args)...);
+            else
+                return (instance->*method)(std::forward<Args>(args)...);
+        }
+    };
+
+    // Method call through a weak pointer, does nothing once the object is gone
+    template<typename InstanceT, typename Ret, typename... Args>
+    struct SmartPtrTarget
+    {
+        using MethodPtr = Ret(InstanceT::*)(Args...);
+
+        std::weak_ptr<InstanceT> instance;
+        MethodPtr method;
+
+        Ret operator()(Args... args) const
+        {
+            std::shared_ptr<InstanceT> pinned = instance.lock();
+
+            if (pinned)
+            {
+                if constexpr (std::is_void_v<Ret>)
+                    (pinned.get()->*method)(std::forward<Args>(args)...);
+                else
+                    return (pinned.get()->*method)(std::forward<Args>(args)...);
+            }
+            else
+            {
+                if constexpr (!std::is_void_v<Ret>)
+                    return Ret();
+            }
+        }
+    };
+}
\ No newline at end of file
@@ -0,0 +1,74 @@
+﻿#pragma once
+
+#include "ByteEngine/Math/Math.h"
+#include "ByteEngine/Math/Vector3.h"
+
+namespace ByteEngine::Math
+{
+    // Axis aligned bounding box
+    struct Bounds
+    {
+        Vector3F min;
+        Vector3F max;
+
+        // Empty bounds, min is larger than max so encapsulating anything replaces both
+        constexpr Bounds()
+            : min(Math::Infinity), max(Math::NegativeInfinity)
+        { }
+
+        constexpr Bounds(Vector3F min, Vector3F max)
+            : min(min), max(max)
+        { }
+
+        [[nodiscard]] constexpr Vector3F Center() const { return (min + max) * 0.5f; }
+        [[nodiscard]] constexpr Vector3F Extents() const { return (max - min) * 0.5f; }
+        [[nodiscard]] constexpr Vector3F Size() const { return max - min; }
+
+        [[nodiscard]] constexpr bool IsEmpty() const { return min.x > max.x || min.y > max.y || min.z > max.z; }
+
+        [[nodiscard]] constexpr float SurfaceArea() const
+        {
+            Vector3F size = max - min;
+            return 2.0f * (size.x * size.y + size.y * size.z + size.z * size.x);
+        }
+
+        constexpr void Encapsulate(Vector3F point)
+        {
+            min = Vector3F::Min(min, point);
+            max = Vector3F::Max(max, point);
+        }
+
+        constexpr void Encapsulate(const Bounds& other)
+        {
+            min = Vector3F::Min(min, other.min);
+            max = Vector3F::Max(max, other.max);
+        }
+
+        [[nodiscard]] constexpr bool Contains(Vector3F point) const
+        {
+            return point.x >= min.x && point.x <= max.x &&
+                point.y >= min.y && point.y <= max.y &&
+                point.z >= min.z && point.z <= max.z;
+        }
+
+        [[nodiscard]] constexpr bool Intersects(const Bounds& other) const
+        {
+            return min.x <= other.max.x && max.x >= other.min.x &&
+                min.y <= other.max.y && max.y >= other.min.y &&
+                min.z <= other.max.z && max.z >= other.min.z;
+        }
+
+        [[nodiscard]] static constexpr Bounds FromCenterExtents(Vector3F center, Vector3F extents)
+        {
+            return Bounds(center - extents, center + extents);
+        }
+
+        [[nodiscard]] static constexpr Bounds Union(const Bounds& a, const Bounds& b)
+        {
+            return Bounds(Vector3F::Min(a.min, b.min), Vector3F::Max(a.max, b.max));
+        }
+
+        [[nodiscard]] constexpr bool operator==(const Bounds& other) const { return min == other.min && max == other.max; }
+        [[nodiscard]] constexpr bool operator!=(const Bounds& other) const { return !(*this == other); }
+    };
+}
\ No newline at end of file
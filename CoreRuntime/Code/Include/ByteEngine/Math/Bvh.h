@@ -0,0 +1,203 @@
+﻿#pragma once
+
+#include <span>
+#include <utility>
+#include <vector>
+
+#include "ByteEngine/Math/Bounds.h"
+#include "ByteEngine/Math/Frustum.h"
+#include "ByteEngine/Math/Ray.h"
+
+namespace ByteEngine::Math
+{
+    // Bounding volume hierarchy over the bounds of externally owned items, identified by their index in the span passed to Build.
+    // Static content is built once with a binned SAH build. For moving content call Refit after the item bounds change,
+    // and Optimize every few frames to restore tree quality with local rotations.
+    // Queries report the items whose bounds pass the test, exact tests against the items themselves are up to the callback
+    class Bvh
+    {
+    public:
+        // Flattened node, 32 bytes. The children of an interior node are stored next to each other
+        struct alignas(32) Node
+        {
+            Vector3F boundsMin;
+
+            // Index of the left child for interior nodes, right child is leftFirst + 1.
+            // Index of the first entry in GetItemIndices() for leaves
+            uint32 leftFirst;
+
+            Vector3F boundsMax;
+
+            // Zero for interior nodes
+            uint32 itemCount;
+
+            [[nodiscard]] constexpr bool IsLeaf() const { return itemCount > 0; }
+            [[nodiscard]] constexpr Bounds GetBounds() const { return Bounds(boundsMin, boundsMax); }
+        };
+
+        // Build stops splitting at this depth, so queries can use a fixed size stack
+        static constexpr int32 MaxDepth = 64;
+        static constexpr uint32 MaxLeafSize = 8;
+
+    private:
+        std::vector<Node> nodes;
+        std::vector<uint32> itemIndices;
+
+        // Copy of the item bounds in the order of itemIndices, so leaves test their items without indirection
+        std::vector<Bounds> leafItemBounds;
+
+    public:
+        void Build(std::span<const Bounds> itemBounds);
+
+        // Recomputes node bounds from the new item bounds, keeping the tree topology.
+        // itemBounds must have the same size as in Build
+        void Refit(std::span<const Bounds> itemBounds);
+
+        // Swaps children and grandchildren where that lowers the SAH cost, never increases the tree height.
+        // Expects up to date bounds, call after Refit
+        void Optimize();
+
+        void Clear();
+
+        [[nodiscard]] bool IsEmpty() const { return nodes.empty(); }
+        [[nodiscard]] size_t GetItemCount() const { return itemIndices.size(); }
+        [[nodiscard]] std::span<const Node> GetNodes() const { return nodes; }
+        [[nodiscard]] std::span<const uint32> GetItemIndices() const { return itemIndices; }
+        [[nodiscard]] Bounds GetBounds() const { return nodes.empty() ? Bounds() : nodes[0].GetBounds(); }
+
+        // Surface area heuristic cost of the tree relative to the root, lower is better
+        [[nodiscard]] float GetCost() const;
+
+        // Visits items whose bounds the ray hits within maxDistance, nearest nodes first.
+        // callback(uint32 item, float& maxDistance) may lower maxDistance to skip everything farther than a found hit
+        template<typename Callback>
+        void QueryRay(const Ray& ray, float maxDistance, Callback&& callback) const
+        {
+            if (nodes.empty())
+                return;
+
+            Vector3F invDirection(1.0f / ray.direction.x, 1.0f / ray.direction.y, 1.0f / ray.direction.z);
+
+            std::pair<uint32, float> stack[MaxDepth + 1];
+            int32 stackSize = 0;
+
+            float rootDistance = IntersectRay(nodes[0].boundsMin, nodes[0].boundsMax, ray.origin, invDirection, maxDistance);
+
+            if (rootDistance == Math::Infinity)
+                return;
+
+            stack[stackSize++] = { 0, rootDistance };
+
+            while (stackSize > 0)
+            {
+                auto [nodeIndex, distance] = stack[--stackSize];
+
+                if (distance > maxDistance)
+                    continue;
+
+                while (true)
+                {
+                    const Node& node = nodes[nodeIndex];
+
+                    if (node.IsLeaf())
+                    {
+                        for (uint32 i = node.leftFirst; i < node.leftFirst + node.itemCount; i++)
+                        {
+                            const Bounds& bounds = leafItemBounds[i];
+
+                            if (IntersectRay(bounds.min, bounds.max, ray.origin, invDirection, maxDistance) != Math::Infinity)
+                                callback(itemIndices[i], maxDistance);
+                        }
+
+                        break;
+                    }
+
+                    uint32 nearIndex = node.leftFirst;
+                    uint32 farIndex = node.leftFirst + 1;
+                    float nearDistance = IntersectRay(nodes[nearIndex].boundsMin, nodes[nearIndex].boundsMax, ray.origin, invDirection, maxDistance);
+                    float farDistance = IntersectRay(nodes[farIndex].boundsMin, nodes[farIndex].boundsMax, ray.origin, invDirection, maxDistance);
+
+                    if (farDistance < nearDistance)
+                    {
+                        std::swap(nearIndex, farIndex);
+                        std::swap(nearDistance, farDistance);
+                    }
+
+                    if (nearDistance == Math::Infinity)
+                        break;
+
+                    if (farDistance != Math::Infinity)
+                        stack[stackSize++] = { farIndex, farDistance };
+
+                    nodeIndex = nearIndex;
+                }
+            }
+        }
+
+        // Visits items whose bounds overlap the given bounds. callback(uint32 item)
+        template<typename Callback>
+        void QueryBounds(const Bounds& bounds, Callback&& callback) const
+        {
+            Traverse([&](const Bounds& nodeBounds) { return bounds.Intersects(nodeBounds); }, callback);
+        }
+
+        // Visits items whose bounds intersect the frustum. callback(uint32 item)
+        template<typename Callback>
+        void QueryFrustum(const Frustum& frustum, Callback&& callback) const
+        {
+            Traverse([&](const Bounds& nodeBounds) { return frustum.IntersectsBox(nodeBounds.Center(), nodeBounds.Extents()); }, callback);
+        }
+
+    private:
+        // Slab test, returns the entry distance or infinity on a miss
+        static float IntersectRay(Vector3F boundsMin, Vector3F boundsMax, Vector3F origin, Vector3F invDirection, float maxDistance)
+        {
+            float x0 = (boundsMin.x - origin.x) * invDirection.x;
+            float x1 = (boundsMax.x - origin.x) * invDirection.x;
+            float y0 = (boundsMin.y - origin.y) * invDirection.y;
+            float y1 = (boundsMax.y - origin.y) * invDirection.y;
+            float z0 = (boundsMin.z - origin.z) * invDirection.z;
+            float z1 = (boundsMax.z - origin.z) * invDirection.z;
+
+            float entry = Math::Max(Math::Min(x0, x1), Math::Min(y0, y1), Math::Min(z0, z1));
+            float exit = Math::Min(Math::Max(x0, x1), Math::Max(y0, y1), Math::Max(z0, z1));
+
+            entry = Math::Max(entry, 0.0f);
+            return entry <= exit && entry <= maxDistance ? entry : Math::Infinity;
+        }
+
+        template<typename NodeTest, typename Callback>
+        void Traverse(NodeTest&& test, Callback&& callback) const
+        {
+            if (nodes.empty() || !test(nodes[0].GetBounds()))
+                return;
+
+            uint32 stack[MaxDepth + 1];
+            int32 stackSize = 0;
+            stack[stackSize++] = 0;
+
+            while (stackSize > 0)
+            {
+                const Node& node = nodes[stack[--stackSize]];
+
+                if (node.IsLeaf())
+                {
+                    for (uint32 i = node.leftFirst; i < node.leftFirst + node.itemCount; i++)
+                    {
+                        if (test(leafItemBounds[i]))
+                            callback(itemIndices[i]);
+                    }
+
+                    continue;
+                }
+
+                // Right first so the left subtree is visited first
+                if (test(nodes[node.leftFirst + 1].GetBounds()))
+                    stack[stackSize++] = node.leftFirst + 1;
+
+                if (test(nodes[node.leftFirst].GetBounds()))
+                    stack[stackSize++] = node.leftFirst;
+            }
+        }
+    };
+}
\ No newline at end of file
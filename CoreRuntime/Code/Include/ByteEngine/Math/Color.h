@@ -4,6 +4,7 @@
 #include <concepts>
 #include <format>
 #include <optional>
+#include <span>
 #include <string>
 
 #include "ByteEngine/Math/Math.h"
@@ -11,6 +12,17 @@
 
 namespace ByteEngine::Math
 {
+    struct ColorParseResult
+    {
+        // Number of colors written to the output
+        size_t count = 0;
+
+        // Number of characters read. On failure points to the start of the invalid entry
+        size_t consumed = 0;
+
+        bool succeeded = true;
+    };
+
     template<std::floating_point T>
     struct ColorT
     {
@@ -160,6 +172,82 @@ namespace ByteEngine::Math
             }
         }
 
+        // Same formats and output as ToString, written to the buffer instead of a new string.
+        // Returns the number of characters written, or std::nullopt if the format is invalid or the buffer is too small
+        [[nodiscard]] std::optional<size_t> FormatTo(std::span<char> buffer, std::string_view format = "F5A") const
+        {
+            if (format.empty())
+                return std::nullopt;
+
+            char* first = buffer.data();
+            char* last = first + buffer.size();
+            char* out = first;
+
+            auto append = [&](std::string_view text)
+                {
+                    if (static_cast<size_t>(last - out) < text.size())
+                        return false;
+
+                    out = std::copy(text.begin(), text.end(), out);
+                    return true;
+                };
+
+            if (format[0] == 'H')
+            {
+                constexpr std::string_view hexDigits = "0123456789ABCDEF";
+                int32 channelCount = format.size() > 1 && format[1] == 'A' ? 4 : 3;
+
+                if (buffer.size() < static_cast<size_t>(1 + channelCount * 2))
+                    return std::nullopt;
+
+                *out++ = '#';
+
+                for (int32 i = 0; i < channelCount; i++)
+                {
+                    uint8 value = static_cast<uint8>(Math::Round(Math::Clamp(data[i] * 255, 0, 255)));
+                    *out++ = hexDigits[value >> 4];
+                    *out++ = hexDigits[value & 0xF];
+                }
+            }
+            else if (format[0] == 'F')
+            {
+                bool withAlpha = format.size() > 1 && format[format.size() - 1] == 'A';
+                const char* precisionLast = format.data() + format.size() - (withAlpha ? 1 : 0);
+
+                int32 precision = 0;
+                auto result = std::from_chars(format.data() + 1, precisionLast, precision);
+
+                if (result.ec != std::errc() || precision < 0)
+                    return std::nullopt;
+
+                if (!append("Color("))
+                    return std::nullopt;
+
+                for (int32 i = 0; i < (withAlpha ? 4 : 3); i++)
+                {
+                    if (i > 0 && !append(", "))
+                        return std::nullopt;
+
+                    // to_chars with a precision is what std::format uses for {:.Nf}, so the output matches ToString
+                    auto [ptr, ec] = std::to_chars(out, last, data[i], std::chars_format::fixed, precision);
+
+                    if (ec != std::errc())
+                        return std::nullopt;
+
+                    out = ptr;
+                }
+
+                if (!append(")"))
+                    return std::nullopt;
+            }
+            else
+            {
+                return std::nullopt;
+            }
+
+            return static_cast<size_t>(out - first);
+        }
+
         [[nodiscard]] static ColorT HsvToRgb(T h, T s, T v, T a = 1)
         {
             if (s == 0)
@@ -281,6 +369,44 @@ namespace ByteEngine::Math
             return std::nullopt;
         }
 
+        // Parses a whole block of text with colors separated by whitespace, ',' or ';', without allocating.
+        // Accepts what ToString produces: "#RRGGBB", "#RRGGBBAA" (the '#' is optional, like in HtmlToRgb),
+        // "Color(r, g, b)" and "Color(r, g, b, a)". Every entry must be followed by a separator or the end of the text,
+        // infinite and NaN channels are invalid.
+        // Stops at the end of the text, when results is full or at the first invalid entry
+        [[nodiscard]] static ColorParseResult Parse(std::string_view text, std::span<ColorT> results)
+        {
+            const char* first = text.data();
+            const char* last = first + text.size();
+            const char* cursor = first;
+
+            ColorParseResult result;
+
+            while (true)
+            {
+                while (cursor != last && IsSeparator(*cursor))
+                    cursor++;
+
+                if (cursor == last || result.count == results.size())
+                    break;
+
+                const char* entry = cursor;
+                std::optional<ColorT> color = ParseEntry(cursor, last);
+
+                if (!color)
+                {
+                    result.consumed = static_cast<size_t>(entry - first);
+                    result.succeeded = false;
+                    return result;
+                }
+
+                results[result.count++] = *color;
+            }
+
+            result.consumed = static_cast<size_t>(cursor - first);
+            return result;
+        }
+
         [[nodiscard]] static ColorT Lerp(ColorT from, ColorT to, T t)
         {
             return from + (to - from) * t;
@@ -402,6 +528,114 @@ namespace ByteEngine::Math
         static const ColorT Red;
         static const ColorT Green;
         static const ColorT Blue;
+
+    private:
+        static constexpr bool IsSeparator(char c)
+        {
+            return c == ' ' || c == '\t' || c == '\n' || c == '\v' || c == '\f' || c == '\r' || c == ',' || c == ';';
+        }
+
+        static constexpr int32 HexDigitValue(char c)
+        {
+            if (c >= '0' && c <= '9')
+                return c - '0';
+
+            char lower = static_cast<char>(c | 0x20);
+
+            if (lower >= 'a' && lower <= 'f')
+                return lower - 'a' + 10;
+
+            return -1;
+        }
+
+        // Parses one entry starting at cursor and moves cursor past it
+        static std::optional<ColorT> ParseEntry(const char*& cursor, const char* last)
+        {
+            constexpr std::string_view floatPrefix = "Color(";
+
+            if (std::string_view(cursor, last).starts_with(floatPrefix))
+            {
+                cursor += floatPrefix.size();
+
+                T components[4] = { 0, 0, 0, 1 };
+                int32 componentCount = 0;
+
+                while (true)
+                {
+                    while (cursor != last && *cursor == ' ')
+                        cursor++;
+
+                    auto [ptr, ec] = std::from_chars(cursor, last, components[componentCount]);
+
+                    if (ec != std::errc() || !Math::IsFinite(components[componentCount]))
+                        return std::nullopt;
+
+                    cursor = ptr;
+                    componentCount++;
+
+                    while (cursor != last && *cursor == ' ')
+                        cursor++;
+
+                    if (cursor == last)
+                        return std::nullopt;
+
+                    if (*cursor == ')' && componentCount >= 3)
+                    {
+                        cursor++;
+
+                        if (cursor != last && !IsSeparator(*cursor))
+                            return std::nullopt;
+
+                        return ColorT(components);
+                    }
+
+                    if (*cursor != ',' || componentCount == 4)
+                        return std::nullopt;
+
+                    cursor++;
+                }
+            }
+
+            if (*cursor == '#')
+                cursor++;
+
+            const char* digits = cursor;
+            uint32 value = 0;
+
+            while (cursor != last && cursor - digits < 8)
+            {
+                int32 digit = HexDigitValue(*cursor);
+
+                if (digit < 0)
+                    break;
+
+                value = (value << 4) | static_cast<uint32>(digit);
+                cursor++;
+            }
+
+            if (cursor != last && !IsSeparator(*cursor))
+                return std::nullopt;
+
+            if (cursor - digits == 6)
+            {
+                return ColorT {
+                    ((value >> 16) & 0xFF) / T(255),
+                    ((value >> 8) & 0xFF) / T(255),
+                    (value & 0xFF) / T(255)
+                };
+            }
+            else if (cursor - digits == 8)
+            {
+                return ColorT {
+                    ((value >> 24) & 0xFF) / T(255),
+                    ((value >> 16) & 0xFF) / T(255),
+                    ((value >> 8) & 0xFF) / T(255),
+                    (value & 0xFF) / T(255)
+                };
+            }
+
+            return std::nullopt;
+        }
     };
 
     template<std::floating_point T>
@@ -419,6 +653,25 @@ namespace ByteEngine::Math
     template<std::floating_point T>
     inline constexpr ColorT<T> ColorT<T>::Blue { 0, 0, 1 };
 
+    // 8 bits per channel in r, g, b, a byte order, the memory layout of R8G8B8A8 textures
+    struct ColorRGBA8
+    {
+        uint8 r;
+        uint8 g;
+        uint8 b;
+        uint8 a;
+
+        constexpr ColorRGBA8()
+            : r(0), g(0), b(0), a(0)
+        { }
+
+        constexpr ColorRGBA8(uint8 r, uint8 g, uint8 b, uint8 a = 255)
+            : r(r), g(g), b(b), a(a)
+        { }
+
+        [[nodiscard]] constexpr bool operator==(const ColorRGBA8&) const = default;
+    };
+
     using ColorF = ColorT<float>;
     using ColorD = ColorT<double>;
     using Color = ColorF;
@@ -0,0 +1,23 @@
+﻿#pragma once
+
+#include <span>
+
+#include "ByteEngine/Math/Color.h"
+
+namespace ByteEngine::Math::Math
+{
+    // Bulk versions of GammaToLinearSpace and LinearToGammaSpace for whole images.
+    // Only r, g and b are converted, alpha is passed through. Output spans must have the same size as the input
+    // and may refer to the same memory when the element types match
+
+    // Max error against the scalar functions is about 1e-6
+    void GammaToLinearSpace(std::span<const ColorF> colors, std::span<ColorF> results) noexcept;
+    void LinearToGammaSpace(std::span<const ColorF> colors, std::span<ColorF> results) noexcept;
+
+    // Decodes sRGB pixels through a 256 entry lookup table built from the scalar function, so results are exact.
+    // Alpha is mapped to [0, 1]
+    void GammaToLinearSpace(std::span<const ColorRGBA8> pixels, std::span<ColorF> results) noexcept;
+
+    // Encodes linear colors to sRGB pixels. Channels are clamped to [0, 1] and rounded to the nearest 8-bit value
+    void LinearToGammaSpace(std::span<const ColorF> colors, std::span<ColorRGBA8> results) noexcept;
+}
\ No newline at end of file
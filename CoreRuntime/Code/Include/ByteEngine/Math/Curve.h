@@ -0,0 +1,263 @@
+﻿#pragma once
+
+#include <array>
+#include <span>
+#include <type_traits>
+#include <vector>
+
+#include "ByteEngine/Math/Quaternion.h"
+#include "ByteEngine/Math/QuaternionStream.h"
+#include "ByteEngine/Math/Vector3.h"
+#include "ByteEngine/Math/Vector3Stream.h"
+
+namespace ByteEngine::Math
+{
+    // Meaning of the four control points of a cubic curve
+    enum class CurveBasis : uint8
+    {
+        // p0, p1, p2, p3. Starts at p0 and ends at p3, p1 and p2 pull the curve towards them
+        Bezier,
+
+        // Start, start tangent, end, end tangent
+        Hermite,
+
+        // Uniform Catmull-Rom segment from p1 to p2, p0 and p3 are the neighbouring points of the path
+        CatmullRom
+    };
+
+    // Weight of control point k is c[k][0] + c[k][1] * t + c[k][2] * t^2 + c[k][3] * t^3
+    struct CurveCoefficients
+    {
+        float c[4][4];
+
+        [[nodiscard]] static constexpr CurveCoefficients Get(CurveBasis basis)
+        {
+            switch (basis)
+            {
+            case CurveBasis::Bezier:
+                return CurveCoefficients { {
+                    { 1.0f, -3.0f, 3.0f, -1.0f },
+                    { 0.0f, 3.0f, -6.0f, 3.0f },
+                    { 0.0f, 0.0f, 3.0f, -3.0f },
+                    { 0.0f, 0.0f, 0.0f, 1.0f }
+                } };
+            case CurveBasis::Hermite:
+                return CurveCoefficients { {
+                    { 1.0f, 0.0f, -3.0f, 2.0f },
+                    { 0.0f, 1.0f, -2.0f, 1.0f },
+                    { 0.0f, 0.0f, 3.0f, -2.0f },
+                    { 0.0f, 0.0f, -1.0f, 1.0f }
+                } };
+            default:
+                return CurveCoefficients { {
+                    { 0.0f, -0.5f, 1.0f, -0.5f },
+                    { 1.0f, 0.0f, -2.5f, 1.5f },
+                    { 0.0f, 0.5f, 2.0f, -1.5f },
+                    { 0.0f, 0.0f, -0.5f, 0.5f }
+                } };
+            }
+        }
+    };
+
+    // Batch layouts used by CubicCurve for each value type
+    template<typename T>
+    struct CurveStreamTraits;
+
+    template<>
+    struct CurveStreamTraits<float>
+    {
+        using Stream = std::span<float>;
+        using ConstStream = std::span<const float>;
+    };
+
+    template<>
+    struct CurveStreamTraits<Vector3F>
+    {
+        using Stream = Vector3FStream;
+        using ConstStream = ConstVector3FStream;
+    };
+
+    template<>
+    struct CurveStreamTraits<Quaternion>
+    {
+        using Stream = QuaternionStream;
+        using ConstStream = ConstQuaternionStream;
+    };
+
+    // Cubic curve over float, Vector3F or Quaternion, t from 0 to 1 covers the whole curve.
+    // Quaternion curves interpolate the components and normalize the result, so like Quaternion::Nlerp
+    // the angular speed is not constant. Each rotation is first flipped onto the hemisphere of the previous
+    // one so the curve takes the short way, Hermite tangents are used as given
+    template<typename T, CurveBasis Basis>
+    struct CubicCurve
+    {
+        using Stream = typename CurveStreamTraits<T>::Stream;
+        using ConstStream = typename CurveStreamTraits<T>::ConstStream;
+
+        static constexpr CurveCoefficients Coefficients = CurveCoefficients::Get(Basis);
+
+        T points[4];
+
+        constexpr CubicCurve(T p0, T p1, T p2, T p3)
+            : points { p0, p1, p2, p3 }
+        { }
+
+        // Catmull-Rom segment from points[segment] to points[segment + 1] of a path through all points.
+        // The first and last points are repeated to stand in for the missing neighbours
+        [[nodiscard]] static constexpr CubicCurve FromPath(std::span<const T> path, size_t segment) requires (Basis == CurveBasis::CatmullRom)
+        {
+            assert(path.size() >= 2 && segment + 1 < path.size());
+
+            return CubicCurve(
+                path[segment == 0 ? 0 : segment - 1],
+                path[segment],
+                path[segment + 1],
+                path[segment + 2 < path.size() ? segment + 2 : segment + 1]
+            );
+        }
+
+        [[nodiscard]] static constexpr std::array<float, 4> GetWeights(float t)
+        {
+            std::array<float, 4> weights;
+
+            for (int32 k = 0; k < 4; k++)
+                weights[k] = ((Coefficients.c[k][3] * t + Coefficients.c[k][2]) * t + Coefficients.c[k][1]) * t + Coefficients.c[k][0];
+
+            return weights;
+        }
+
+        [[nodiscard]] static constexpr std::array<float, 4> GetDerivativeWeights(float t)
+        {
+            std::array<float, 4> weights;
+
+            for (int32 k = 0; k < 4; k++)
+                weights[k] = (3.0f * Coefficients.c[k][3] * t + 2.0f * Coefficients.c[k][2]) * t + Coefficients.c[k][1];
+
+            return weights;
+        }
+
+        [[nodiscard]] constexpr T Evaluate(float t) const
+        {
+            std::array<float, 4> weights = GetWeights(t);
+
+            if constexpr (std::is_same_v<T, Quaternion>)
+            {
+                std::array<Quaternion, 4> aligned = GetAlignedPoints();
+                Quaternion result;
+
+                for (int32 i = 0; i < 4; i++)
+                    result[i] = aligned[0][i] * weights[0] + aligned[1][i] * weights[1] + aligned[2][i] * weights[2] + aligned[3][i] * weights[3];
+
+                return result.Normalized();
+            }
+            else
+            {
+                return points[0] * weights[0] + points[1] * weights[1] + points[2] * weights[2] + points[3] * weights[3];
+            }
+        }
+
+        // Derivative with respect to t, e.g. the velocity along a path that takes one second
+        [[nodiscard]] constexpr T EvaluateDerivative(float t) const requires (!std::is_same_v<T, Quaternion>)
+        {
+            std::array<float, 4> weights = GetDerivativeWeights(t);
+            return points[0] * weights[0] + points[1] * weights[1] + points[2] * weights[2] + points[3] * weights[3];
+        }
+
+        // results[i] = Evaluate(t[i]), 8 parameters per iteration. Spans must have the same size
+        void Evaluate(std::span<const float> t, std::span<T> results) const;
+
+        // Many curves of this kind in structure-of-arrays form, points[k] holds control point k of every curve.
+        // results[i] is curve i evaluated at t[i] or at the shared t. All streams must have the same size
+        static void Evaluate(const std::array<ConstStream, 4>& points, std::span<const float> t, Stream results);
+        static void Evaluate(const std::array<ConstStream, 4>& points, float t, Stream results);
+
+        // Control points with quaternions moved onto the hemisphere of the previous point, unchanged for other types
+        [[nodiscard]] constexpr std::array<T, 4> GetAlignedPoints() const
+        {
+            std::array<T, 4> aligned { points[0], points[1], points[2], points[3] };
+
+            if constexpr (std::is_same_v<T, Quaternion>)
+            {
+                if constexpr (Basis == CurveBasis::Hermite)
+                {
+                    if (Quaternion::Dot(aligned[0], aligned[2]) < 0.0f)
+                        aligned[2] = -aligned[2];
+                }
+                else
+                {
+                    for (int32 k = 1; k < 4; k++)
+                    {
+                        if (Quaternion::Dot(aligned[k - 1], aligned[k]) < 0.0f)
+                            aligned[k] = -aligned[k];
+                    }
+                }
+            }
+
+            return aligned;
+        }
+    };
+
+    template<typename T>
+    using BezierCurve = CubicCurve<T, CurveBasis::Bezier>;
+
+    template<typename T>
+    using HermiteCurve = CubicCurve<T, CurveBasis::Hermite>;
+
+    template<typename T>
+    using CatmullRomCurve = CubicCurve<T, CurveBasis::CatmullRom>;
+
+    // Maps distance travelled along a curve to the curve parameter, so a path can be followed at constant speed.
+    // Built from samples evenly spaced in t, the curve between two samples is treated as a straight line
+    class ArcLengthTable
+    {
+    public:
+        static constexpr uint32 DefaultSampleCount = 64;
+
+    private:
+        // Length from the start of the curve to each sample
+        std::vector<float> lengths;
+
+    public:
+        ArcLengthTable() = default;
+
+        template<typename T, CurveBasis Basis> requires (!std::is_same_v<T, Quaternion>)
+        explicit ArcLengthTable(const CubicCurve<T, Basis>& curve, uint32 sampleCount = DefaultSampleCount)
+        {
+            Build(curve, sampleCount);
+        }
+
+        template<typename T, CurveBasis Basis> requires (!std::is_same_v<T, Quaternion>)
+        void Build(const CubicCurve<T, Basis>& curve, uint32 sampleCount = DefaultSampleCount)
+        {
+            assert(sampleCount >= 1);
+
+            std::vector<float> t(static_cast<size_t>(sampleCount) + 1);
+            std::vector<T> samples(t.size(), T(0.0f));
+
+            for (uint32 i = 0; i <= sampleCount; i++)
+                t[i] = static_cast<float>(i) / static_cast<float>(sampleCount);
+
+            curve.Evaluate(t, samples);
+            Build(std::span<const T>(samples));
+        }
+
+        // Curve values at t = i / (samples.size() - 1), e.g. points of a multi-segment path. Needs at least two samples
+        void Build(std::span<const float> samples);
+        void Build(std::span<const Vector3F> samples);
+
+        [[nodiscard]] float GetLength() const { return lengths.empty() ? 0.0f : lengths.back(); }
+        [[nodiscard]] uint32 GetSampleCount() const { return static_cast<uint32>(lengths.size()); }
+
+        // Curve parameter at the given distance from the start, distance is clamped to [0, GetLength()]
+        [[nodiscard]] float GetParameter(float distance) const;
+
+        // results[i] = GetParameter(distances[i]). Spans must have the same size.
+        // Sorted distances, as when a path is sampled at a fixed step, continue the search from the previous result
+        void GetParameters(std::span<const float> distances, std::span<float> results) const;
+
+    private:
+        // Index of the sample that starts the segment containing distance, checks hint and the next segment first
+        [[nodiscard]] uint32 FindSegment(float distance, uint32 hint) const;
+        [[nodiscard]] float GetParameter(float distance, uint32 segment) const;
+    };
+}
\ No newline at end of file
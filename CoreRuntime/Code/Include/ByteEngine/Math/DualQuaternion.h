@@ -0,0 +1,57 @@
+﻿#pragma once
+
+#include "ByteEngine/Math/Matrix4x4F.h"
+#include "ByteEngine/Math/Quaternion.h"
+#include "ByteEngine/Math/Vector3.h"
+
+namespace ByteEngine::Math
+{
+    // Rigid transform, rotation followed by translation, as a unit dual quaternion real + dual * e.
+    // A normalized weighted sum of dual quaternions is still rigid, which is why skinning blends them instead of matrices
+    struct DualQuaternion
+    {
+        Quaternion real { 0.0f, 0.0f, 0.0f, 1.0f };
+
+        // 0.5 * translation * real, translation taken as a pure quaternion
+        Quaternion dual { 0.0f, 0.0f, 0.0f, 0.0f };
+
+        constexpr DualQuaternion() = default;
+
+        constexpr DualQuaternion(Quaternion real, Quaternion dual)
+            : real(real), dual(dual)
+        { }
+
+        [[nodiscard]] static constexpr DualQuaternion FromRotationTranslation(Quaternion rotation, Vector3F translation)
+        {
+            Quaternion dual = Quaternion(translation.x, translation.y, translation.z, 0.0f) * rotation;
+            return DualQuaternion(rotation, Quaternion(0.5f * dual.x, 0.5f * dual.y, 0.5f * dual.z, 0.5f * dual.w));
+        }
+
+        // Scale of the matrix is dropped, it is expected to be affine without shear
+        [[nodiscard]] static DualQuaternion FromMatrix(const Matrix4x4F& matrix)
+        {
+            return FromRotationTranslation(matrix.GetRotation(), matrix.GetTranslation());
+        }
+
+        [[nodiscard]] constexpr Quaternion GetRotation() const { return real; }
+
+        // 2 * dual * conjugate(real)
+        [[nodiscard]] constexpr Vector3F GetTranslation() const
+        {
+            Vector3F realVector(real.x, real.y, real.z);
+            Vector3F dualVector(dual.x, dual.y, dual.z);
+            return (dualVector * real.w - realVector * dual.w + Vector3F::Cross(realVector, dualVector)) * 2.0f;
+        }
+
+        [[nodiscard]] Matrix4x4F ToMatrix() const { return Matrix4x4F::CreateTRS(GetTranslation(), real, Vector3F(1.0f, 1.0f, 1.0f)); }
+
+        [[nodiscard]] constexpr Vector3F TransformPoint(Vector3F point) const { return real * point + GetTranslation(); }
+        [[nodiscard]] constexpr Vector3F TransformVector(Vector3F vector) const { return real * vector; }
+
+        // Transform of other followed by this one
+        [[nodiscard]] constexpr DualQuaternion operator*(const DualQuaternion& other) const
+        {
+            return DualQuaternion(real * other.real, real * other.dual + dual * other.real);
+        }
+    };
+}
\ No newline at end of file
@@ -0,0 +1,43 @@
+﻿#pragma once
+
+#include <span>
+
+#include "ByteEngine/Math/Matrix4x4F.h"
+#include "ByteEngine/Math/Vector3.h"
+#include "ByteEngine/Math/Vector3Stream.h"
+#include "ByteEngine/Math/Vector4.h"
+
+namespace ByteEngine::Math
+{
+    // View volume bounded by six planes. Each plane is stored as (normal, distance) with the normal pointing inside,
+    // so a point p is inside the plane when Dot(normal, p) + distance >= 0
+    struct Frustum
+    {
+        enum PlaneIndex : int32
+        {
+            Left,
+            Right,
+            Bottom,
+            Top,
+            Near,
+            Far,
+            PlaneCount
+        };
+
+        Vector4F planes[PlaneCount];
+
+        // Expects the row vector convention and [0, 1] depth range used by CreatePerspectiveProjection
+        // and CreateOrthographicProjection. Planes are normalized
+        [[nodiscard]] static Frustum FromViewProjection(const Matrix4x4F& viewProjection);
+
+        // Conservative tests: objects close to a frustum corner may be reported as visible
+        [[nodiscard]] bool IntersectsSphere(Vector3F center, float radius) const;
+        [[nodiscard]] bool IntersectsBox(Vector3F center, Vector3F extents) const;
+
+        // Batch versions of the tests above, 8 objects per iteration. Indices of the objects intersecting the frustum
+        // are written to the start of visibleIndices in increasing order, so it must be at least as large as the input.
+        // Returns the number of visible objects
+        [[nodiscard]] size_t CullSpheres(ConstVector3FStream centers, std::span<const float> radii, std::span<uint32> visibleIndices) const;
+        [[nodiscard]] size_t CullBoxes(ConstVector3FStream centers, ConstVector3FStream extents, std::span<uint32> visibleIndices) const;
+    };
+}
\ No newline at end of file
@@ -1,12 +1,14 @@
 ﻿#pragma once
 
+#include <span>
+
+#include "ByteEngine/Math/Quaternion.h"
 #include "ByteEngine/Math/Vector3.h"
+#include "ByteEngine/Math/Vector3Stream.h"
 #include "ByteEngine/Math/Vector4.h"
 
 namespace ByteEngine::Math
 {
-    struct Quaternion;
-
     struct alignas(16) Matrix4x4F
     {
         static constexpr int32 RowCount = 4;
@@ -23,14 +25,6 @@ namespace ByteEngine::Math
                 float m30, m31, m32, m33;
             };
 
-            struct
-            {
-                Vector4F row0;
-                Vector4F row1;
-                Vector4F row2;
-                Vector4F row3;
-            };
-
             Vector4F rows[4];
 
             float elements[16];
@@ -58,7 +52,7 @@ namespace ByteEngine::Math
         { }
 
         constexpr Matrix4x4F(Vector4F row0, Vector4F row1, Vector4F row2, Vector4F row3)
-            : row0(row0), row1(row1), row2(row2), row3(row3)
+            : rows { row0, row1, row2, row3 }
         { }
 
         constexpr Matrix4x4F(const float elements[16])
@@ -85,6 +79,17 @@ namespace ByteEngine::Math
         void Inverse();
         [[nodiscard]] Matrix4x4F Inversed() const;
 
+        // Cheaper inverses for transforms built from translation, rotation and scale.
+        // AffineInverse expects IsAffine(), RigidInverse also expects the 3x3 part to be a pure rotation
+        void AffineInverse();
+        [[nodiscard]] Matrix4x4F AffineInversed() const;
+
+        void RigidInverse();
+        [[nodiscard]] Matrix4x4F RigidInversed() const;
+
+        // True when the last column is (0, 0, 0, 1)
+        [[nodiscard]] constexpr bool IsAffine() const { return m03 == 0.0f && m13 == 0.0f && m23 == 0.0f && m33 == 1.0f; }
+
         constexpr void Transpose()
         {
             *this = Matrix4x4F {
@@ -95,7 +100,7 @@ namespace ByteEngine::Math
             };
         }
 
-        constexpr [[nodiscard]] Matrix4x4F Transposed() const
+        [[nodiscard]] constexpr Matrix4x4F Transposed() const
         {
             return Matrix4x4F {
                 m00, m10, m20, m30,
@@ -109,10 +114,38 @@ namespace ByteEngine::Math
         [[nodiscard]] Quaternion GetRotation() const;
         [[nodiscard]] Vector3F GetScale() const;
 
+        // Translation, rotation and scale in one pass, the inverse of CreateTRS.
+        // Expects an affine matrix without shear. A mirrored matrix comes out with a negative x scale
+        void Decompose(Vector3F& translation, Quaternion& rotation, Vector3F& scale) const;
+
         [[nodiscard]] Vector3F MultiplyPoint(Vector3F point) const;
         [[nodiscard]] Vector3F MultiplyPointFast(Vector3F point) const;
         [[nodiscard]] Vector3F MultiplyVector(Vector3F vector) const;
 
+        // Batch versions of the functions above, 8 elements per iteration.
+        // Source and destination must have the same size and may refer to the same memory
+        void MultiplyPoints(std::span<const Vector3F> points, std::span<Vector3F> results) const;
+        void MultiplyPointsFast(std::span<const Vector3F> points, std::span<Vector3F> results) const;
+        void MultiplyVectors(std::span<const Vector3F> vectors, std::span<Vector3F> results) const;
+
+        void MultiplyPoints(ConstVector3FStream points, Vector3FStream results) const;
+        void MultiplyPointsFast(ConstVector3FStream points, Vector3FStream results) const;
+        void MultiplyVectors(ConstVector3FStream vectors, Vector3FStream results) const;
+
+        // Same as operator* for two affine matrices, skips the last column
+        [[nodiscard]] Matrix4x4F MultiplyAffine(const Matrix4x4F& other) const;
+
+        // Batch versions of AffineInverse, RigidInverse and MultiplyAffine.
+        // Spans must have the same size, results may refer to the same memory as the inputs
+        static void AffineInverse(std::span<const Matrix4x4F> matrices, std::span<Matrix4x4F> results);
+        static void RigidInverse(std::span<const Matrix4x4F> matrices, std::span<Matrix4x4F> results);
+
+        // results[i] = left[i] * right[i]
+        static void MultiplyAffine(std::span<const Matrix4x4F> left, std::span<const Matrix4x4F> right, std::span<Matrix4x4F> results);
+
+        // results[i] = locals[i] * parent, e.g. local to world matrices of all children of one node
+        static void MultiplyAffine(std::span<const Matrix4x4F> locals, const Matrix4x4F& parent, std::span<Matrix4x4F> results);
+
         [[nodiscard]] static Matrix4x4F CreateTranslation(Vector3F translation)
         {
             return Matrix4x4F {
@@ -142,6 +175,11 @@ namespace ByteEngine::Math
 
         [[nodiscard]] static Matrix4x4F CreateTRS(Vector3F translation, Quaternion rotation, Vector3F scale);
 
+        // Batch versions of CreateTRS and Decompose, 8 matrices per iteration. Include QuaternionStream.h to use them.
+        // All streams and spans must have the same size
+        static void ComposeTRS(ConstVector3FStream translations, ConstQuaternionStream rotations, ConstVector3FStream scales, std::span<Matrix4x4F> results);
+        static void DecomposeTRS(std::span<const Matrix4x4F> matrices, Vector3FStream translations, QuaternionStream rotations, Vector3FStream scales);
+
         [[nodiscard]] constexpr Matrix4x4F operator+(const Matrix4x4F& other) const
         {
             Matrix4x4F result;
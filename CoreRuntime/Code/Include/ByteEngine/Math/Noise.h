@@ -0,0 +1,54 @@
+﻿#pragma once
+
+#include <span>
+
+#include "ByteEngine/Math/Vector2.h"
+#include "ByteEngine/Math/Vector3.h"
+#include "ByteEngine/Math/Vector4.h"
+
+namespace ByteEngine::Math
+{
+    enum class NoiseType : uint8
+    {
+        // Interpolated random values at the lattice points. Cheapest, with visible lattice structure
+        Value,
+
+        // Gradient noise on the square/cubic lattice, 2^N corners per sample
+        Perlin,
+
+        // Gradient noise on the simplex lattice, N + 1 corners per sample and fewer axis aligned artifacts
+        Simplex
+    };
+
+    // One octave when octaves is 1. Every further octave multiplies the frequency by lacunarity and the amplitude by gain.
+    // The sum is divided by the total amplitude, so fractal noise stays in the range of a single octave
+    struct NoiseSettings
+    {
+        NoiseType type = NoiseType::Perlin;
+        uint32 seed = 0;
+        float frequency = 1.0f;
+        int32 octaves = 1;
+        float lacunarity = 2.0f;
+        float gain = 0.5f;
+    };
+}
+
+// Results are in [-1, 1]. All functions evaluate the same 8-wide kernels, so a single sample
+// equals the grid sample at the same float position bit for bit
+namespace ByteEngine::Math::Noise
+{
+    [[nodiscard]] float Sample(const NoiseSettings& settings, Vector2F position);
+    [[nodiscard]] float Sample(const NoiseSettings& settings, Vector3F position);
+    [[nodiscard]] float Sample(const NoiseSettings& settings, Vector4F position);
+
+    // Fills a grid of sizeX * sizeY (* sizeZ) samples stored x fastest, e.g. a heightmap tile or a density volume.
+    // Sample (i, j, k) is taken at origin + (i, j, k) * spacing, results must hold exactly that many values.
+    // The multiply-add may be fused, so a position computed by the caller can differ in the last bit
+    // unless (i, j, k) * spacing is exact, e.g. spacing with a short binary fraction like 0.25 or 0.1875
+    // Rows are split between threadCount threads, 0 uses every hardware thread
+    void FillGrid2D(const NoiseSettings& settings, std::span<float> results, Vector2F origin, Vector2F spacing, int32 sizeX, int32 sizeY, uint32 threadCount = 1);
+    void FillGrid3D(const NoiseSettings& settings, std::span<float> results, Vector3F origin, Vector3F spacing, int32 sizeX, int32 sizeY, int32 sizeZ, uint32 threadCount = 1);
+
+    // 3D grid through 4D noise at origin.w, e.g. a volume animated with time in w
+    void FillGrid4D(const NoiseSettings& settings, std::span<float> results, Vector4F origin, Vector3F spacing, int32 sizeX, int32 sizeY, int32 sizeZ, uint32 threadCount = 1);
+}
\ No newline at end of file
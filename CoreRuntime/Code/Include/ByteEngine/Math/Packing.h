@@ -0,0 +1,277 @@
+﻿#pragma once
+
+#include <bit>
+#include <span>
+
+#include "ByteEngine/Math/Quaternion.h"
+#include "ByteEngine/Math/Vector2.h"
+#include "ByteEngine/Math/Vector3.h"
+#include "ByteEngine/Math/Vector4.h"
+
+namespace ByteEngine::Math::Math
+{
+    // IEEE 754 binary16. Rounds to nearest even, values beyond 65504 become infinity, NaN stays NaN.
+    // Relative error is at most 2^-11 (4.9e-4) for magnitudes in [6.1e-5, 65504], absolute error is at most 2^-25 below that
+    [[nodiscard]] inline uint16 FloatToHalf(float value) noexcept
+    {
+        uint32 bits = std::bit_cast<uint32>(value);
+        uint32 sign = (bits >> 16) & 0x8000;
+        uint32 absBits = bits & 0x7FFFFFFF;
+        uint32 result;
+
+        if (absBits > 0x7F800000)
+        {
+            result = 0x7E00;
+        }
+        else if (absBits >= 0x47800000)
+        {
+            result = 0x7C00;
+        }
+        else if (absBits < 0x38800000)
+        {
+            // Subnormal half. Adding 0.5 lines the mantissa up with the half precision one and rounds it to nearest even
+            result = std::bit_cast<uint32>(std::bit_cast<float>(absBits) + 0.5f) - 0x3F000000;
+        }
+        else
+        {
+            // Rebias the exponent and round the 13 dropped mantissa bits to nearest even
+            uint32 mantissaOdd = (absBits >> 13) & 1;
+            result = (absBits + 0xC8000FFF + mantissaOdd) >> 13;
+        }
+
+        return static_cast<uint16>(sign | result);
+    }
+
+    // Exact, every half value is representable as a float
+    [[nodiscard]] inline float HalfToFloat(uint16 half) noexcept
+    {
+        uint32 expMantissa = half & 0x7FFF;
+        uint32 sign = static_cast<uint32>(half & 0x8000) << 16;
+
+        // Multiplying by 2^112 rebiases the exponent and normalizes subnormals
+        uint32 result = std::bit_cast<uint32>(std::bit_cast<float>(expMantissa << 13) * std::bit_cast<float>(0x77800000u));
+
+        if (expMantissa > 0x7BFF)
+            result |= 0x7F800000;
+
+        return std::bit_cast<float>(result | sign);
+    }
+
+    // [-1, 1] mapped to [-32767, 32767], values outside are clamped and NaN becomes -1. Error is at most 1.53e-5
+    [[nodiscard]] inline int16 FloatToSNorm16(float value) noexcept
+    {
+        return static_cast<int16>(std::nearbyint(Min(Max(value, -1.0f), 1.0f) * 32767.0f));
+    }
+
+    // -32768 decodes to -1 like -32767
+    [[nodiscard]] inline float SNorm16ToFloat(int16 value) noexcept
+    {
+        return Max(static_cast<float>(value) * (1.0f / 32767.0f), -1.0f);
+    }
+
+    // [0, 1] mapped to [0, 65535], values outside are clamped and NaN becomes 0. Error is at most 7.6e-6
+    [[nodiscard]] inline uint16 FloatToUNorm16(float value) noexcept
+    {
+        return static_cast<uint16>(std::nearbyint(Min(Max(value, 0.0f), 1.0f) * 65535.0f));
+    }
+
+    [[nodiscard]] inline float UNorm16ToFloat(uint16 value) noexcept
+    {
+        return static_cast<float>(value) * (1.0f / 65535.0f);
+    }
+}
+
+namespace ByteEngine::Math
+{
+    // Storage types for vertex streams and snapshots. Each one wraps the encoded bits and converts to and from float
+    // with the functions above. Results of the bulk functions below are bit-identical to the scalar conversions,
+    // except for the bulk PackedQuaternion Unpack, see there
+
+    struct Half
+    {
+        uint16 bits;
+
+        constexpr Half()
+            : bits(0)
+        { }
+
+        explicit Half(float value)
+            : bits(Math::FloatToHalf(value))
+        { }
+
+        [[nodiscard]] static constexpr Half FromBits(uint16 bits)
+        {
+            Half half;
+            half.bits = bits;
+            return half;
+        }
+
+        [[nodiscard]] float ToFloat() const { return Math::HalfToFloat(bits); }
+
+        [[nodiscard]] constexpr bool operator==(const Half&) const = default;
+    };
+
+    struct SNorm16
+    {
+        int16 bits;
+
+        constexpr SNorm16()
+            : bits(0)
+        { }
+
+        explicit SNorm16(float value)
+            : bits(Math::FloatToSNorm16(value))
+        { }
+
+        [[nodiscard]] float ToFloat() const { return Math::SNorm16ToFloat(bits); }
+
+        [[nodiscard]] constexpr bool operator==(const SNorm16&) const = default;
+    };
+
+    struct UNorm16
+    {
+        uint16 bits;
+
+        constexpr UNorm16()
+            : bits(0)
+        { }
+
+        explicit UNorm16(float value)
+            : bits(Math::FloatToUNorm16(value))
+        { }
+
+        [[nodiscard]] float ToFloat() const { return Math::UNorm16ToFloat(bits); }
+
+        [[nodiscard]] constexpr bool operator==(const UNorm16&) const = default;
+    };
+
+    // Vectors with Half, SNorm16 or UNorm16 components. Tightly packed, so a span of them can be converted
+    // in bulk as a flat component span
+    template<typename Component>
+    struct PackedVector2T
+    {
+        Component x;
+        Component y;
+
+        constexpr PackedVector2T() = default;
+
+        explicit PackedVector2T(Vector2F value)
+            : x(value.x), y(value.y)
+        { }
+
+        [[nodiscard]] Vector2F Unpack() const { return Vector2F(x.ToFloat(), y.ToFloat()); }
+
+        [[nodiscard]] constexpr bool operator==(const PackedVector2T&) const = default;
+    };
+
+    template<typename Component>
+    struct PackedVector3T
+    {
+        Component x;
+        Component y;
+        Component z;
+
+        constexpr PackedVector3T() = default;
+
+        explicit PackedVector3T(Vector3F value)
+            : x(value.x), y(value.y), z(value.z)
+        { }
+
+        [[nodiscard]] Vector3F Unpack() const { return Vector3F(x.ToFloat(), y.ToFloat(), z.ToFloat()); }
+
+        [[nodiscard]] constexpr bool operator==(const PackedVector3T&) const = default;
+    };
+
+    template<typename Component>
+    struct PackedVector4T
+    {
+        Component x;
+        Component y;
+        Component z;
+        Component w;
+
+        constexpr PackedVector4T() = default;
+
+        explicit PackedVector4T(Vector4F value)
+            : x(value.x), y(value.y), z(value.z), w(value.w)
+        { }
+
+        [[nodiscard]] Vector4F Unpack() const { return Vector4F(x.ToFloat(), y.ToFloat(), z.ToFloat(), w.ToFloat()); }
+
+        [[nodiscard]] constexpr bool operator==(const PackedVector4T&) const = default;
+    };
+
+    using HalfVector2 = PackedVector2T<Half>;
+    using HalfVector3 = PackedVector3T<Half>;
+    using HalfVector4 = PackedVector4T<Half>;
+    using SNorm16Vector2 = PackedVector2T<SNorm16>;
+    using SNorm16Vector3 = PackedVector3T<SNorm16>;
+    using SNorm16Vector4 = PackedVector4T<SNorm16>;
+    using UNorm16Vector2 = PackedVector2T<UNorm16>;
+    using UNorm16Vector3 = PackedVector3T<UNorm16>;
+    using UNorm16Vector4 = PackedVector4T<UNorm16>;
+
+    // 10 bits for x, y and z and 2 bits for w, same layout as DXGI_FORMAT_R10G10B10A2_UNORM (x in the low bits).
+    // Components are clamped to [0, 1]. Error is at most 4.9e-4 for x, y, z and 0.17 for w.
+    // Signed data such as normals can be stored as value * 0.5 + 0.5
+    struct UNorm1010102
+    {
+        uint32 bits;
+
+        constexpr UNorm1010102()
+            : bits(0)
+        { }
+
+        explicit UNorm1010102(Vector4F value);
+
+        [[nodiscard]] Vector4F Unpack() const;
+
+        [[nodiscard]] constexpr bool operator==(const UNorm1010102&) const = default;
+    };
+
+    // Unit quaternion in 32 bits with the smallest three encoding: the index of the largest component in the top
+    // 2 bits and the other three quantized to 10 bits each. The largest component is rebuilt from the unit length,
+    // and the sign is chosen so it is positive, which represents the same rotation.
+    // Component error is at most 7e-4 for the stored components and 2e-3 for the rebuilt one,
+    // rotation error stays below 0.25 degrees
+    struct PackedQuaternion
+    {
+        uint32 bits;
+
+        constexpr PackedQuaternion()
+            : bits(0)
+        { }
+
+        // Expects a normalized quaternion
+        explicit PackedQuaternion(Quaternion value);
+
+        [[nodiscard]] Quaternion Unpack() const;
+
+        [[nodiscard]] constexpr bool operator==(const PackedQuaternion&) const = default;
+    };
+}
+
+namespace ByteEngine::Math::Math
+{
+    // Bulk conversions, 8 components per iteration. Output spans must have the same size as the input.
+    // Vector spans are passed as flat component spans, e.g. std::span<const float>(positions.data()->data, positions.size() * 3)
+
+    void FloatToHalf(std::span<const float> values, std::span<Half> results) noexcept;
+    void HalfToFloat(std::span<const Half> values, std::span<float> results) noexcept;
+
+    void FloatToSNorm16(std::span<const float> values, std::span<SNorm16> results) noexcept;
+    void SNorm16ToFloat(std::span<const SNorm16> values, std::span<float> results) noexcept;
+
+    void FloatToUNorm16(std::span<const float> values, std::span<UNorm16> results) noexcept;
+    void UNorm16ToFloat(std::span<const UNorm16> values, std::span<float> results) noexcept;
+
+    void Pack(std::span<const Vector4F> values, std::span<UNorm1010102> results) noexcept;
+    void Unpack(std::span<const UNorm1010102> values, std::span<Vector4F> results) noexcept;
+
+    // Include QuaternionStream.h to use these.
+    // Pack is bit-identical to PackedQuaternion. Unpack fuses multiply-adds whenever the backend has FMA and sums the
+    // squares in a different order, so it differs from PackedQuaternion::Unpack by at most 5e-7 per component
+    // for values packed from unit quaternions
+    void Pack(ConstQuaternionStream values, std::span<PackedQuaternion> results) noexcept;
+    void Unpack(std::span<const PackedQuaternion> values, QuaternionStream results) noexcept;
+}
\ No newline at end of file
@@ -1,12 +1,23 @@
 ﻿#pragma once
 
+#include <span>
+
 #include "ByteEngine/Math/Vector2.h"
 #include "ByteEngine/Math/Vector3.h"
+#include "ByteEngine/Math/Vector3Stream.h"
 #include "ByteEngine/Math/Vector4.h"
 
 namespace ByteEngine::Math
 {
     struct EulerDeg;
+    struct Matrix4x4F;
+
+    // Defined in QuaternionStream.h
+    template<typename T>
+    struct QuaternionStreamT;
+
+    using QuaternionStream = QuaternionStreamT<float>;
+    using ConstQuaternionStream = QuaternionStreamT<const float>;
 
     struct EulerRad
     {
@@ -97,12 +108,35 @@ namespace ByteEngine::Math
         [[nodiscard]] static Quaternion FromEuler(RadianF pitch, RadianF yaw, RadianF roll);
         [[nodiscard]] static Quaternion FromEuler(DegreeF pitch, DegreeF yaw, DegreeF roll);
 
+        // Expects the upper 3x3 part of the matrix to be a pure rotation
+        [[nodiscard]] static Quaternion FromRotationMatrix(const Matrix4x4F& matrix);
+
         [[nodiscard]] static Quaternion FromLookDirection(Vector3F direction, Vector3F worldUp = Vector3F::Up());
         [[nodiscard]] static Quaternion FromToRotation(Vector3F from, Vector3F target);
 
         [[nodiscard]] static Quaternion Slerp(Quaternion from, Quaternion to, float t);
         [[nodiscard]] static Quaternion SlerpClamped(Quaternion from, Quaternion to, float t);
 
+        // Normalized linear interpolation along the shortest path. Cheaper than Slerp, but the angular speed is not constant
+        [[nodiscard]] static Quaternion Nlerp(Quaternion from, Quaternion to, float t);
+
+        // Batch versions, 8 quaternions per iteration. Include QuaternionStream.h to use them.
+        // All streams must have the same size, results may refer to the same memory as an input
+        static void Slerp(ConstQuaternionStream from, ConstQuaternionStream to, std::span<const float> t, QuaternionStream results);
+        static void Slerp(ConstQuaternionStream from, ConstQuaternionStream to, float t, QuaternionStream results);
+        static void Nlerp(ConstQuaternionStream from, ConstQuaternionStream to, std::span<const float> t, QuaternionStream results);
+        static void Nlerp(ConstQuaternionStream from, ConstQuaternionStream to, float t, QuaternionStream results);
+
+        // results[i] = a[i] * b[i]
+        static void Multiply(ConstQuaternionStream a, ConstQuaternionStream b, QuaternionStream results);
+        // results[i] = a * b[i], e.g. a parent rotation applied to all children
+        static void Multiply(Quaternion a, ConstQuaternionStream b, QuaternionStream results);
+
+        // results[i] = rotations[i] * vectors[i]
+        static void Rotate(ConstQuaternionStream rotations, ConstVector3FStream vectors, Vector3FStream results);
+
+        static void Normalize(QuaternionStream quaternions);
+
         [[nodiscard]] static bool IsEqualApproximetly(Quaternion a, Quaternion b, float tolerance = Math::Epsilon);
 
         [[nodiscard]] constexpr Quaternion operator+() const { return Quaternion(+x, +y, +z, +w); }
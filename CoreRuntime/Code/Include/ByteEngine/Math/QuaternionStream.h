@@ -0,0 +1,56 @@
+﻿#pragma once
+
+#include <span>
+#include <type_traits>
+
+#include "ByteEngine/Math/Quaternion.h"
+
+namespace ByteEngine::Math
+{
+    // Structure-of-arrays view over four component arrays of equal size. Does not own the memory
+    template<typename T>
+    struct QuaternionStreamT
+    {
+        std::span<T> x;
+        std::span<T> y;
+        std::span<T> z;
+        std::span<T> w;
+
+        constexpr QuaternionStreamT() = default;
+
+        constexpr QuaternionStreamT(std::span<T> x, std::span<T> y, std::span<T> z, std::span<T> w)
+            : x(x), y(y), z(z), w(w)
+        {
+            assert(x.size() == y.size() && x.size() == z.size() && x.size() == w.size());
+        }
+
+        // Allows passing a mutable stream where a read-only one is expected
+        template<typename U> requires (!std::is_same_v<T, U> && std::is_convertible_v<U(*)[], T(*)[]>)
+        constexpr QuaternionStreamT(const QuaternionStreamT<U>& other)
+            : x(other.x), y(other.y), z(other.z), w(other.w)
+        { }
+
+        [[nodiscard]] constexpr size_t Size() const { return x.size(); }
+        [[nodiscard]] constexpr bool IsEmpty() const { return x.empty(); }
+
+        [[nodiscard]] constexpr Quaternion Get(size_t index) const
+        {
+            assert(index < Size());
+            return Quaternion(x[index], y[index], z[index], w[index]);
+        }
+
+        constexpr void Set(size_t index, Quaternion value) requires (!std::is_const_v<T>)
+        {
+            assert(index < Size());
+            x[index] = value.x;
+            y[index] = value.y;
+            z[index] = value.z;
+            w[index] = value.w;
+        }
+
+        [[nodiscard]] constexpr QuaternionStreamT Subspan(size_t offset, size_t count) const
+        {
+            return QuaternionStreamT(x.subspan(offset, count), y.subspan(offset, count), z.subspan(offset, count), w.subspan(offset, count));
+        }
+    };
+}
\ No newline at end of file
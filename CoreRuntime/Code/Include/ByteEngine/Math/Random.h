@@ -0,0 +1,66 @@
+﻿#pragma once
+
+#include <span>
+
+#include "ByteEngine/Math/Quaternion.h"
+#include "ByteEngine/Math/Vector3.h"
+#include "ByteEngine/Math/Vector3Stream.h"
+
+namespace ByteEngine::Math
+{
+    // xoshiro128** generator by Blackman and Vigna with 8 independent lanes, one per SIMD lane.
+    // Single values come from lane 0. The Fill functions step all lanes together and write 8 values per step,
+    // value i of a fill comes from lane i % 8, a partial tail still steps every lane once.
+    // Lanes start 2^64 steps apart, so their sequences never overlap in practice.
+    // The same seed and the same sequence of calls always give the same values. Integers and floats in [0, 1)
+    // are bit exact across SIMD backends, vectors and rotations may differ in the last bits.
+    // Not suitable for anything security related
+    class Random
+    {
+    public:
+        static constexpr size_t LaneCount = 8;
+        static constexpr uint64 DefaultSeed = 0x853C49E6748FEA9B;
+
+    private:
+        // state[word][lane], laid out so one word of all lanes loads as one register
+        alignas(32) uint32 state[4][LaneCount];
+
+    public:
+        explicit Random(uint64 seed = DefaultSeed);
+
+        void Seed(uint64 seed);
+
+        // Advances every lane past the start of all lanes of a copy, e.g. to give each worker thread its own generator:
+        // copy the generator and call Jump once more for every following copy
+        void Jump();
+
+        [[nodiscard]] uint32 NextUInt();
+
+        // Uniform in [min, max), expects min < max. The bias is below (max - min) / 2^32
+        [[nodiscard]] int32 NextInt(int32 min, int32 max);
+
+        // Uniform in [0, 1) with 24 bits of precision
+        [[nodiscard]] float NextFloat();
+
+        // Uniform in [min, max)
+        [[nodiscard]] float NextFloat(float min, float max);
+
+        // Uniform on the unit sphere
+        [[nodiscard]] Vector3F NextUnitVector();
+
+        // Uniform inside the ball with the given center and radius
+        [[nodiscard]] Vector3F NextPointInSphere(Vector3F center = Vector3F(0.0f), float radius = 1.0f);
+
+        // Uniform over all rotations, normalized
+        [[nodiscard]] Quaternion NextRotation();
+
+        // Batch versions of the functions above, 8 values per step. Include QuaternionStream.h for FillRotations
+        void Fill(std::span<uint32> results);
+        void Fill(std::span<int32> results, int32 min, int32 max);
+        void Fill(std::span<float> results);
+        void Fill(std::span<float> results, float min, float max);
+        void FillUnitVectors(Vector3FStream results);
+        void FillPointsInSphere(Vector3FStream results, Vector3F center = Vector3F(0.0f), float radius = 1.0f);
+        void FillRotations(QuaternionStream results);
+    };
+}
\ No newline at end of file
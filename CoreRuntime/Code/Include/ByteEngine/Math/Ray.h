@@ -0,0 +1,111 @@
+﻿#pragma once
+
+#include <span>
+#include <vector>
+
+#include "ByteEngine/Math/Bounds.h"
+#include "ByteEngine/Math/Math.h"
+#include "ByteEngine/Math/Vector3.h"
+
+namespace ByteEngine::Math
+{
+    // Closest hit of a ray query. Queries only accept hits nearer than distance, so a fresh RayHit accepts everything
+    // and one with a lowered distance limits the search, e.g. to the length of a line of sight segment
+    struct RayHit
+    {
+        float distance = Math::Infinity;
+
+        // Barycentric coordinates of the hit point, point = (1 - u - v) * a + u * b + v * c
+        float u = 0.0f;
+        float v = 0.0f;
+
+        uint32 triangle = UINT32_MAX;
+
+        [[nodiscard]] constexpr bool IsHit() const { return triangle != UINT32_MAX; }
+    };
+
+    // 8 triangles in SoA layout, one vertex and the two edges from it as Möller-Trumbore uses them
+    struct alignas(32) TriangleBlock
+    {
+        static constexpr int32 Width = 8;
+
+        float vertex[3][Width];
+        float edge1[3][Width];
+        float edge2[3][Width];
+
+        // Builds blocks from a triangle soup, three vertices per triangle.
+        // The last block is padded with degenerate triangles that are never hit
+        [[nodiscard]] static std::vector<TriangleBlock> FromTriangles(std::span<const Vector3F> vertices);
+    };
+
+    struct Ray
+    {
+        Vector3F origin;
+        Vector3F direction;
+
+        constexpr Ray(Vector3F origin, Vector3F direction)
+            : origin(origin), direction(direction)
+        { }
+
+        [[nodiscard]] constexpr Vector3F GetPoint(float distance) const { return origin + direction * distance; }
+
+        // Slab test, returns the entry distance (0 when the origin is inside) or infinity on a miss
+        [[nodiscard]] float IntersectBounds(const Bounds& bounds, float maxDistance = Math::Infinity) const;
+
+        // Möller-Trumbore test against both sides of the triangle. Updates hit and returns true when the triangle
+        // is hit nearer than hit.distance
+        bool IntersectTriangle(Vector3F a, Vector3F b, Vector3F c, uint32 triangle, RayHit& hit) const;
+
+        // Same test against 8 triangles at once, the triangle index reported for lane i is firstTriangle + i
+        bool IntersectTriangles(const TriangleBlock& block, uint32 firstTriangle, RayHit& hit) const;
+
+        // Closest hit in a triangle soup built with TriangleBlock::FromTriangles, triangles are numbered in vertex order
+        bool IntersectTriangles(std::span<const TriangleBlock> blocks, RayHit& hit) const;
+    };
+
+    // Closest hits of the 8 rays of a packet, lane i belongs to ray i
+    struct alignas(32) RayPacketHit
+    {
+        float distance[8] = { Math::Infinity, Math::Infinity, Math::Infinity, Math::Infinity, Math::Infinity, Math::Infinity, Math::Infinity, Math::Infinity };
+        float u[8] = { };
+        float v[8] = { };
+        uint32 triangle[8] = { UINT32_MAX, UINT32_MAX, UINT32_MAX, UINT32_MAX, UINT32_MAX, UINT32_MAX, UINT32_MAX, UINT32_MAX };
+
+        [[nodiscard]] constexpr RayHit Get(int32 lane) const
+        {
+            assert(lane >= 0 && lane < 8);
+            return RayHit { distance[lane], u[lane], v[lane], triangle[lane] };
+        }
+    };
+
+    // 8 rays in SoA layout traced together, e.g. neighbouring pixels of a lightmap texel or picking rays.
+    // Coherent rays visit the same triangles and boxes, so each test runs once for all of them.
+    // Lanes that are not Set keep a zero direction and never hit anything
+    struct alignas(32) RayPacket
+    {
+        static constexpr int32 Width = 8;
+
+        float origin[3][Width];
+        float direction[3][Width];
+
+        // Reciprocal of direction for the slab tests, maintained by Set
+        float inverseDirection[3][Width];
+
+        RayPacket();
+
+        // Rays beyond Width are ignored, missing lanes stay empty
+        explicit RayPacket(std::span<const Ray> rays);
+
+        void Set(int32 lane, const Ray& ray);
+        [[nodiscard]] Ray Get(int32 lane) const;
+
+        // Bit i is set when ray i enters the bounds nearer than hits.distance[i]
+        [[nodiscard]] uint32 IntersectBounds(const Bounds& bounds, const RayPacketHit& hits) const;
+
+        // Returns the mask of rays whose closest hit became this triangle
+        uint32 IntersectTriangle(Vector3F a, Vector3F b, Vector3F c, uint32 triangle, RayPacketHit& hits) const;
+
+        // Closest hits in a triangle soup, three vertices per triangle
+        void IntersectTriangles(std::span<const Vector3F> vertices, RayPacketHit& hits) const;
+    };
+}
\ No newline at end of file
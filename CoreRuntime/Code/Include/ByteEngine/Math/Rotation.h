@@ -7,17 +7,9 @@ namespace ByteEngine::Math
 {
     struct Rotation
     {
-        union
-        {
-            struct
-            {
-                DegreeF pitch;
-                DegreeF yaw;
-                DegreeF roll;
-            };
-
-            DegreeF data[3];
-        };
+        DegreeF pitch;
+        DegreeF yaw;
+        DegreeF roll;
 
         constexpr Rotation()
             : pitch(0), yaw(0), roll(0)
@@ -47,7 +39,7 @@ namespace ByteEngine::Math
             : pitch(euler.pitch.ToDegree()), yaw(euler.yaw.ToDegree()), roll(euler.roll.ToDegree())
         { }
 
-        explicit constexpr Rotation(const Quaternion& q)
+        explicit Rotation(const Quaternion& q)
             : Rotation(q.GetEulerInDegrees())
         { }
 
@@ -127,13 +119,16 @@ namespace ByteEngine::Math
         [[nodiscard]] constexpr DegreeF operator[](int32 index) const
         {
             assert(index >= 0 && index < 3);
-            return data[index];
+            return this->*Components[index];
         }
 
         [[nodiscard]] constexpr DegreeF& operator[](int32 index)
         {
             assert(index >= 0 && index < 3);
-            return data[index];
+            return this->*Components[index];
         }
+
+    private:
+        static constexpr DegreeF Rotation::* Components[3] = { &Rotation::pitch, &Rotation::yaw, &Rotation::roll };
     };
 }
\ No newline at end of file
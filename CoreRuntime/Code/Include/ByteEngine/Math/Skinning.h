@@ -0,0 +1,53 @@
+﻿#pragma once
+
+#include <span>
+
+#include "ByteEngine/Math/DualQuaternion.h"
+#include "ByteEngine/Math/Matrix4x4F.h"
+#include "ByteEngine/Math/Vector3Stream.h"
+
+namespace ByteEngine::Math
+{
+    // Bone influences of a mesh in structure-of-arrays form: influence k of vertex i is bone boneIndices[k][i]
+    // with weight weights[k][i]. The weights of a vertex are expected to sum to one.
+    // Unused trailing slots stay empty, vertices with fewer influences than the mesh maximum use zero weights
+    struct SkinInfluences
+    {
+        static constexpr int32 MaxInfluences = 4;
+
+        std::span<const uint16> boneIndices[MaxInfluences];
+        std::span<const float> weights[MaxInfluences];
+
+        // Number of leading slots that are in use
+        [[nodiscard]] constexpr int32 GetInfluenceCount() const
+        {
+            int32 count = 0;
+
+            while (count < MaxInfluences && !weights[count].empty())
+                count++;
+
+            return count;
+        }
+    };
+}
+
+// Batched CPU skinning, 8 vertices per iteration. Bones are skinning transforms, i.e. the inverse bind pose
+// followed by the animated bone to model transform, in the row vector convention of Matrix4x4F.
+// All streams must have the same size as the influence spans. Results may refer to the same memory as the inputs.
+// normals and skinnedNormals may both be empty to skip normals. Vertex ranges are split between threadCount
+// threads, 0 uses every hardware thread
+namespace ByteEngine::Math::Skinning
+{
+    // Linear blend skinning. Normals go through the blended 3x3 part and are renormalized,
+    // which is exact for rotations and uniform scale
+    void LinearBlend(std::span<const Matrix4x4F> bones, const SkinInfluences& influences, ConstVector3FStream positions, ConstVector3FStream normals,
+        Vector3FStream skinnedPositions, Vector3FStream skinnedNormals, uint32 threadCount = 1);
+
+    // Dual quaternion skinning. Bones are rigid, influences are blended along the shortest path to the first one,
+    // which avoids the collapsing joints of linear blending at the cost of ignoring bone scale
+    void DualQuaternionBlend(std::span<const DualQuaternion> bones, const SkinInfluences& influences, ConstVector3FStream positions, ConstVector3FStream normals,
+        Vector3FStream skinnedPositions, Vector3FStream skinnedNormals, uint32 threadCount = 1);
+
+    // DualQuaternion::FromMatrix for a whole palette, spans must have the same size
+    void ToDualQuaternions(std::span<const Matrix4x4F> matrices, std::span<DualQuaternion> results);
+}
\ No newline at end of file
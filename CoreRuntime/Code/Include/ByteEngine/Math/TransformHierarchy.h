@@ -0,0 +1,124 @@
+﻿#pragma once
+
+#include <span>
+#include <vector>
+
+#include "ByteEngine/Math/Matrix4x4F.h"
+#include "ByteEngine/Math/Quaternion.h"
+#include "ByteEngine/Math/Vector3.h"
+
+namespace ByteEngine::Math
+{
+    // Store of parent-relative transforms that keeps world matrices up to date lazily.
+    // Local position, rotation and scale live in separate arrays ordered so parents come before children.
+    // Update sorts them by depth when Destroy or SetParent broke that order.
+    // Setters only mark the node dirty, Update recomputes the world matrices of dirty nodes and their subtrees
+    // and leaves everything else untouched, so the cost follows the number of moved nodes rather than the total.
+    // World matrices use the row vector convention of Matrix4x4F: world = local * parentWorld
+    class TransformHierarchy
+    {
+    public:
+        // Stable handle, stays valid until the node is destroyed. Ids of destroyed nodes are reused
+        using NodeId = uint32;
+
+        static constexpr NodeId InvalidNode = UINT32_MAX;
+
+    private:
+        static constexpr uint32 InvalidIndex = UINT32_MAX;
+
+        // Update sweeps all nodes in order instead of walking dirty subtrees once more than 1 / SweepThreshold of them are dirty
+        static constexpr size_t SweepThreshold = 8;
+
+        // Everything below is indexed by dense index, which changes when the hierarchy is sorted
+        std::vector<Vector3F> localPositions;
+        std::vector<Quaternion> localRotations;
+        std::vector<Vector3F> localScales;
+        std::vector<Matrix4x4F> worldMatrices;
+
+        std::vector<uint32> parents;
+        std::vector<uint32> firstChildren;
+        std::vector<uint32> nextSiblings;
+        std::vector<uint32> depths;
+        std::vector<NodeId> nodeIds;
+
+        // Local transform changed since the last Update
+        std::vector<uint8> dirtyFlags;
+
+        // Update pass that last recomputed the world matrix, so shared subtrees are visited once per pass
+        std::vector<uint32> updateStamps;
+
+        // Dense index of every id, InvalidIndex for free ids
+        std::vector<uint32> denseIndices;
+        std::vector<NodeId> freeIds;
+
+        // Nodes whose local transform changed, may contain destroyed nodes
+        std::vector<NodeId> dirtyNodes;
+
+        // Scratch for the traversals, kept to avoid allocations every frame
+        std::vector<uint32> stack;
+
+        uint32 updateStamp = 0;
+        uint32 destroyedCount = 0;
+
+        // Set by Destroy and by SetParent to a later node, the dense arrays are compacted and sorted at the next Update
+        bool orderDirty = false;
+
+    public:
+        NodeId Create(NodeId parent = InvalidNode, Vector3F position = Vector3F(0.0f), Quaternion rotation = Quaternion::Identity, Vector3F scale = Vector3F(1.0f));
+
+        // Destroys the node and all of its descendants
+        void Destroy(NodeId node);
+
+        // Keeps the local transform, so the node moves with its new parent. InvalidNode makes it a root.
+        // parent must not be the node itself or one of its descendants
+        void SetParent(NodeId node, NodeId parent);
+
+        void SetLocalPosition(NodeId node, Vector3F position);
+        void SetLocalRotation(NodeId node, Quaternion rotation);
+        void SetLocalScale(NodeId node, Vector3F scale);
+        void SetLocalTransform(NodeId node, Vector3F position, Quaternion rotation, Vector3F scale);
+
+        // Recomputes the world matrices of nodes changed since the last call and of their descendants.
+        // Returns the number of world matrices recomputed
+        size_t Update();
+
+        void Clear();
+
+        [[nodiscard]] bool IsValid(NodeId node) const { return node < denseIndices.size() && denseIndices[node] != InvalidIndex; }
+        [[nodiscard]] size_t GetNodeCount() const { return nodeIds.size() - destroyedCount; }
+
+        [[nodiscard]] NodeId GetParent(NodeId node) const;
+        [[nodiscard]] uint32 GetDepth(NodeId node) const { return depths[GetDenseIndex(node)]; }
+
+        [[nodiscard]] Vector3F GetLocalPosition(NodeId node) const { return localPositions[GetDenseIndex(node)]; }
+        [[nodiscard]] Quaternion GetLocalRotation(NodeId node) const { return localRotations[GetDenseIndex(node)]; }
+        [[nodiscard]] Vector3F GetLocalScale(NodeId node) const { return localScales[GetDenseIndex(node)]; }
+
+        // As of the last Update
+        [[nodiscard]] const Matrix4x4F& GetWorldMatrix(NodeId node) const { return worldMatrices[GetDenseIndex(node)]; }
+
+        // All world matrices in dense order, with the id of each in GetNodeIds(). Only valid right after Update
+        [[nodiscard]] std::span<const Matrix4x4F> GetWorldMatrices() const { return worldMatrices; }
+        [[nodiscard]] std::span<const NodeId> GetNodeIds() const { return nodeIds; }
+
+    private:
+        [[nodiscard]] uint32 GetDenseIndex(NodeId node) const
+        {
+            assert(IsValid(node));
+            return denseIndices[node];
+        }
+
+        void MarkDirty(uint32 index);
+        void LinkChild(uint32 parent, uint32 child);
+        void UnlinkChild(uint32 child);
+
+        // Drops destroyed nodes and orders the rest by depth, keeping creation order within a depth
+        void SortByDepth();
+
+        // Recomputes the world matrix of index and everything below it
+        size_t UpdateSubtree(uint32 index);
+
+        // Expects the world matrix of the parent to be up to date
+        void UpdateNode(uint32 index);
+    };
+}
\ No newline at end of file
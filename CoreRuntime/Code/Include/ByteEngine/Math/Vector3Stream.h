@@ -0,0 +1,59 @@
+﻿#pragma once
+
+#include <span>
+#include <type_traits>
+
+#include "ByteEngine/Math/Vector3.h"
+
+namespace ByteEngine::Math
+{
+    // Structure-of-arrays view over three component arrays of equal size. Does not own the memory
+    template<typename T>
+    struct Vector3Stream
+    {
+        using ValueT = std::remove_const_t<T>;
+
+        std::span<T> x;
+        std::span<T> y;
+        std::span<T> z;
+
+        constexpr Vector3Stream() = default;
+
+        constexpr Vector3Stream(std::span<T> x, std::span<T> y, std::span<T> z)
+            : x(x), y(y), z(z)
+        {
+            assert(x.size() == y.size() && x.size() == z.size());
+        }
+
+        // Allows passing a mutable stream where a read-only one is expected
+        template<typename U> requires (!std::is_same_v<T, U> && std::is_convertible_v<U(*)[], T(*)[]>)
+        constexpr Vector3Stream(const Vector3Stream<U>& other)
+            : x(other.x), y(other.y), z(other.z)
+        { }
+
+        [[nodiscard]] constexpr size_t Size() const { return x.size(); }
+        [[nodiscard]] constexpr bool IsEmpty() const { return x.empty(); }
+
+        [[nodiscard]] constexpr Vector3T<ValueT> Get(size_t index) const
+        {
+            assert(index < Size());
+            return Vector3T<ValueT>(x[index], y[index], z[index]);
+        }
+
+        constexpr void Set(size_t index, Vector3T<ValueT> value) requires (!std::is_const_v<T>)
+        {
+            assert(index < Size());
+            x[index] = value.x;
+            y[index] = value.y;
+            z[index] = value.z;
+        }
+
+        [[nodiscard]] constexpr Vector3Stream Subspan(size_t offset, size_t count) const
+        {
+            return Vector3Stream(x.subspan(offset, count), y.subspan(offset, count), z.subspan(offset, count));
+        }
+    };
+
+    using Vector3FStream = Vector3Stream<float>;
+    using ConstVector3FStream = Vector3Stream<const float>;
+}
\ No newline at end of file
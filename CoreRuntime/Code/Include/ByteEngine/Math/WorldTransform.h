@@ -0,0 +1,49 @@
+﻿#pragma once
+
+#include <span>
+
+#include "ByteEngine/Math/Matrix4x4F.h"
+#include "ByteEngine/Math/Quaternion.h"
+#include "ByteEngine/Math/Vector3.h"
+
+namespace ByteEngine::Math
+{
+    // Transform with a double precision world position, for worlds too large for float positions.
+    // Rendering uses float matrices relative to the camera: the subtraction happens in double, so precision
+    // is highest next to the viewer no matter how far from the world origin it is
+    struct WorldTransform
+    {
+        Vector3D position;
+        Quaternion rotation;
+        Vector3F scale;
+
+        WorldTransform()
+            : position(0.0), rotation(Quaternion::Identity), scale(1.0f)
+        { }
+
+        WorldTransform(Vector3D position, Quaternion rotation, Vector3F scale = Vector3F(1.0f))
+            : position(position), rotation(rotation), scale(scale)
+        { }
+
+        // Same as Matrix4x4F::CreateTRS with the translation taken relative to cameraPosition
+        [[nodiscard]] Matrix4x4F ToCameraRelativeMatrix(Vector3D cameraPosition) const;
+
+        // Batch version of ToCameraRelativeMatrix, 8 transforms per iteration. Spans must have the same size
+        static void ToCameraRelativeMatrices(std::span<const WorldTransform> transforms, Vector3D cameraPosition, std::span<Matrix4x4F> results);
+    };
+}
+
+namespace ByteEngine::Math::Math
+{
+    // position - origin, rounded to float after the subtraction
+    [[nodiscard]] inline Vector3F ToRelative(Vector3D position, Vector3D origin)
+    {
+        return Vector3F(static_cast<float>(position.x - origin.x), static_cast<float>(position.y - origin.y), static_cast<float>(position.z - origin.z));
+    }
+
+    // Bulk version of ToRelative, e.g. for particles or debug geometry. Spans must have the same size
+    void ToRelative(std::span<const Vector3D> positions, Vector3D origin, std::span<Vector3F> results) noexcept;
+
+    // View matrix for camera-relative rendering. The eye sits at the origin, so it is exact for any world position
+    [[nodiscard]] Matrix4x4F CreateCameraRelativeLookAt(Vector3D eyePos, Vector3D targetPos, Vector3F worldUp = Vector3F::Up());
+}
\ No newline at end of file
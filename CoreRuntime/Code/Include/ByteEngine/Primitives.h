@@ -1,14 +1,16 @@
 ﻿#pragma once
 
+#include <cstdint>
+
 namespace ByteEngine
 {
-    using int8 = __int8;
-    using int16 = __int16;
-    using int32 = __int32;
-    using int64 = __int64;
+    using int8 = std::int8_t;
+    using int16 = std::int16_t;
+    using int32 = std::int32_t;
+    using int64 = std::int64_t;
 
-    using uint8 = unsigned __int8;
-    using uint16 = unsigned __int16;
-    using uint32 = unsigned __int32;
-    using uint64 = unsigned __int64;
+    using uint8 = std::uint8_t;
+    using uint16 = std::uint16_t;
+    using uint32 = std::uint32_t;
+    using uint64 = std::uint64_t;
 }
\ No newline at end of file
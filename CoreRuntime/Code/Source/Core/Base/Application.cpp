@@ -4,6 +4,7 @@
 
 #include "ByteEngine/Core/Base/Application.h"
 #include "ByteEngine/Core/Base/MainWindow.h"
+#include "ByteEngine/Core/EventSystem/EventProfiler.h"
 #include "ByteEngine/Core/Input/Input.h"
 #include "ByteEngine/Core/Renderer/RenderContext.h"
 #include "ByteEngine/Utilities/BitFlagsHelper.h"
@@ -43,9 +44,12 @@ namespace ByteEngine
         Input input;
         Input::SetInstance(&input);
 
+        mainWindow.eventQueue = &events;
+
         while (isRunning)
         {
             mainWindow.PollEvents();
+            events.Dispatch();
 
             if (mainWindow.closeRequested)
             {
@@ -74,6 +78,10 @@ namespace ByteEngine
             input.Update();
         }
 
+        mainWindow.eventQueue = nullptr;
+
+        EventProfiler::LogReport();
+
         DebugHelper::LogDebugMessage("Application is closing");
 
         return exitCode;
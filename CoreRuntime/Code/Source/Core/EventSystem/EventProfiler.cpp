@@ -0,0 +1,129 @@
+﻿#include <algorithm>
+#include <format>
+#include <memory>
+#include <mutex>
+#include <vector>
+
+#include "ByteEngine/Core/EventSystem/EventProfiler.h"
+#include "ByteEngine/DebugLogHelper.h"
+
+namespace ByteEngine::EventSystem::EventProfiler
+{
+    namespace
+    {
+        std::mutex profilesMutex;
+        std::vector<std::unique_ptr<DelegateProfile>> profiles;
+    }
+
+    DelegateProfile* CreateProfile(std::string name)
+    {
+        std::scoped_lock lock(profilesMutex);
+
+        profiles.push_back(std::make_unique<DelegateProfile>());
+        profiles.back()->name = std::move(name);
+        return profiles.back().get();
+    }
+
+    void SetProfileName(DelegateProfile* profile, std::string name)
+    {
+        std::scoped_lock lock(profilesMutex);
+        profile->name = std::move(name);
+    }
+
+    const DelegateProfile* FindProfile(std::string_view name)
+    {
+        std::scoped_lock lock(profilesMutex);
+
+        for (const std::unique_ptr<DelegateProfile>& profile : profiles)
+        {
+            if (profile->name == name)
+                return profile.get();
+        }
+
+        return nullptr;
+    }
+
+    namespace
+    {
+        void WriteLatency(std::string& report, const LatencyHistogram& latency)
+        {
+            report += std::format("{} calls, total {} ns, mean {} ns, p50 {} ns, p99 {} ns, max {} ns\n",
+                latency.count, latency.totalNanoseconds, latency.GetMeanNanoseconds(),
+                latency.GetPercentileNanoseconds(0.5f), latency.GetPercentileNanoseconds(0.99f), latency.maxNanoseconds);
+        }
+    }
+
+    std::string WriteReport()
+    {
+        std::scoped_lock lock(profilesMutex);
+
+        std::vector<const DelegateProfile*> sorted;
+
+        for (const std::unique_ptr<DelegateProfile>& profile : profiles)
+        {
+            if (profile->invokeCount > 0)
+                sorted.push_back(profile.get());
+        }
+
+        std::ranges::stable_sort(sorted, [](const DelegateProfile* a, const DelegateProfile* b) { return a->invokeCount > b->invokeCount; });
+
+        std::string report = std::format("Event profile, {} invoked delegates\n", sorted.size());
+
+        for (const DelegateProfile* profile : sorted)
+        {
+            report += std::format("{}: {} invokes, {} subscribers, peak {}\n",
+                profile->name, profile->invokeCount, profile->subscriberCount, profile->peakSubscriberCount);
+
+            std::vector<const SubscriberProfile*> subscribers;
+
+            for (const SubscriberProfile& subscriber : profile->subscribers)
+            {
+                if (subscriber.latency.count > 0)
+                    subscribers.push_back(&subscriber);
+            }
+
+            std::ranges::stable_sort(subscribers, [](const SubscriberProfile* a, const SubscriberProfile* b)
+                {
+                    return a->latency.totalNanoseconds > b->latency.totalNanoseconds;
+                });
+
+            for (const SubscriberProfile* subscriber : subscribers)
+            {
+                report += std::format("    subscriber 0x{:x}, owner {}: ", subscriber->handle, subscriber->owner);
+                WriteLatency(report, subscriber->latency);
+            }
+
+            if (profile->unsubscribedLatency.count > 0)
+            {
+                report += std::format("    {} unsubscribed: ", profile->unsubscribedCount);
+                WriteLatency(report, profile->unsubscribedLatency);
+            }
+        }
+
+        return report;
+    }
+
+    void LogReport()
+    {
+#ifdef BYTEENGINE_EVENT_PROFILING
+        std::string report = WriteReport();
+        DebugHelper::LogDebugMessage("{}", report);
+#endif
+    }
+
+    void Reset()
+    {
+        std::scoped_lock lock(profilesMutex);
+
+        for (const std::unique_ptr<DelegateProfile>& profile : profiles)
+        {
+            profile->invokeCount = 0;
+            profile->peakSubscriberCount = profile->subscriberCount;
+            profile->unsubscribedLatency.Reset();
+            profile->unsubscribedCount = 0;
+
+            for (SubscriberProfile& subscriber : profile->subscribers)
+                subscriber.latency.Reset();
+        }
+    }
+}
\ No newline at end of file
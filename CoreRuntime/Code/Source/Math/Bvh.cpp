@@ -0,0 +1,371 @@
+﻿#include <algorithm>
+
+#include "ByteEngine/Math/Bvh.h"
+
+namespace ByteEngine::Math
+{
+    namespace
+    {
+        constexpr int32 BinCount = 12;
+
+        // SAH costs relative to one item bounds test
+        constexpr float TraversalCost = 1.0f;
+        constexpr float ItemCost = 1.0f;
+
+        struct Bin
+        {
+            Bounds bounds;
+            uint32 count = 0;
+        };
+
+        struct Split
+        {
+            int32 axis = -1;
+            int32 bin = 0;
+            float cost = Math::Infinity;
+        };
+
+        // Items are partitioned by value so the build reads memory sequentially
+        struct BuildItem
+        {
+            Bounds bounds;
+            Vector3F centroid;
+            uint32 index;
+        };
+
+        class BvhBuilder
+        {
+        private:
+            std::vector<Bvh::Node>& nodes;
+            std::vector<BuildItem> items;
+
+        public:
+            BvhBuilder(std::vector<Bvh::Node>& nodes, std::span<const Bounds> itemBounds)
+                : nodes(nodes)
+            {
+                items.reserve(itemBounds.size());
+
+                for (size_t i = 0; i < itemBounds.size(); i++)
+                    items.push_back(BuildItem { itemBounds[i], itemBounds[i].Center(), static_cast<uint32>(i) });
+            }
+
+            const std::vector<BuildItem>& GetItems() const { return items; }
+
+            void BuildNode(uint32 nodeIndex, uint32 first, uint32 count, int32 depth)
+            {
+                Bounds bounds;
+                Bounds centroidBounds;
+
+                for (uint32 i = first; i < first + count; i++)
+                {
+                    bounds.Encapsulate(items[i].bounds);
+                    centroidBounds.Encapsulate(items[i].centroid);
+                }
+
+                nodes[nodeIndex].boundsMin = bounds.min;
+                nodes[nodeIndex].boundsMax = bounds.max;
+
+                if (count == 1 || depth >= Bvh::MaxDepth)
+                {
+                    MakeLeaf(nodeIndex, first, count);
+                    return;
+                }
+
+                Split split = FindSplit(first, count, centroidBounds, bounds.SurfaceArea());
+                float leafCost = ItemCost * static_cast<float>(count);
+                uint32 leftCount = 0;
+
+                if (split.axis >= 0 && (split.cost < leafCost || count > Bvh::MaxLeafSize))
+                {
+                    int32 axis = split.axis;
+                    float minimum = centroidBounds.min[axis];
+                    float scale = BinCount / (centroidBounds.max[axis] - minimum);
+
+                    auto middle = std::partition(items.begin() + first, items.begin() + first + count, [&](const BuildItem& item)
+                        {
+                            return GetBinIndex(item.centroid[axis], minimum, scale) <= split.bin;
+                        });
+
+                    leftCount = static_cast<uint32>(middle - (items.begin() + first));
+                }
+                else if (count > Bvh::MaxLeafSize)
+                {
+                    // All centroids coincide, split in the middle to keep leaves small
+                    leftCount = count / 2;
+                }
+                else
+                {
+                    MakeLeaf(nodeIndex, first, count);
+                    return;
+                }
+
+                assert(leftCount > 0 && leftCount < count);
+
+                uint32 leftIndex = static_cast<uint32>(nodes.size());
+                nodes.emplace_back();
+                nodes.emplace_back();
+
+                nodes[nodeIndex].leftFirst = leftIndex;
+                nodes[nodeIndex].itemCount = 0;
+
+                BuildNode(leftIndex, first, leftCount, depth + 1);
+                BuildNode(leftIndex + 1, first + leftCount, count - leftCount, depth + 1);
+            }
+
+        private:
+            void MakeLeaf(uint32 nodeIndex, uint32 first, uint32 count)
+            {
+                nodes[nodeIndex].leftFirst = first;
+                nodes[nodeIndex].itemCount = count;
+            }
+
+            static int32 GetBinIndex(float centroid, float minimum, float scale)
+            {
+                return Math::Min(static_cast<int32>((centroid - minimum) * scale), BinCount - 1);
+            }
+
+            // Binned SAH over all three axes in one pass, split.bin is the last bin on the left side
+            Split FindSplit(uint32 first, uint32 count, const Bounds& centroidBounds, float area) const
+            {
+                Bin bins[3][BinCount];
+                float minimum[3];
+                float scale[3];
+
+                for (int32 axis = 0; axis < 3; axis++)
+                {
+                    float extent = centroidBounds.max[axis] - centroidBounds.min[axis];
+                    minimum[axis] = centroidBounds.min[axis];
+                    scale[axis] = extent > 0.0f ? BinCount / extent : 0.0f;
+                }
+
+                for (uint32 i = first; i < first + count; i++)
+                {
+                    const BuildItem& item = items[i];
+
+                    for (int32 axis = 0; axis < 3; axis++)
+                    {
+                        Bin& bin = bins[axis][GetBinIndex(item.centroid[axis], minimum[axis], scale[axis])];
+                        bin.bounds.Encapsulate(item.bounds);
+                        bin.count++;
+                    }
+                }
+
+                Split best;
+
+                for (int32 axis = 0; axis < 3; axis++)
+                {
+                    if (scale[axis] == 0.0f)
+                        continue;
+
+                    // Right side areas and counts accumulated from the end, left side in the second sweep
+                    float rightArea[BinCount - 1];
+                    uint32 rightCount[BinCount - 1];
+                    Bounds accumulated;
+                    uint32 accumulatedCount = 0;
+
+                    for (int32 i = BinCount - 1; i > 0; i--)
+                    {
+                        accumulated.Encapsulate(bins[axis][i].bounds);
+                        accumulatedCount += bins[axis][i].count;
+                        rightArea[i - 1] = accumulatedCount > 0 ? accumulated.SurfaceArea() : 0.0f;
+                        rightCount[i - 1] = accumulatedCount;
+                    }
+
+                    accumulated = Bounds();
+                    accumulatedCount = 0;
+
+                    for (int32 i = 0; i < BinCount - 1; i++)
+                    {
+                        accumulated.Encapsulate(bins[axis][i].bounds);
+                        accumulatedCount += bins[axis][i].count;
+
+                        if (accumulatedCount == 0 || rightCount[i] == 0)
+                            continue;
+
+                        float cost = accumulated.SurfaceArea() * static_cast<float>(accumulatedCount) + rightArea[i] * static_cast<float>(rightCount[i]);
+
+                        if (cost < best.cost)
+                            best = Split { axis, i, cost };
+                    }
+                }
+
+                if (best.axis >= 0)
+                    best.cost = area > 0.0f ? TraversalCost + ItemCost * best.cost / area : TraversalCost;
+
+                return best;
+            }
+        };
+
+        // Post-order refit from the leaf item bounds, returns the node bounds
+        Bounds RefitNode(std::vector<Bvh::Node>& nodes, std::span<const Bounds> leafItemBounds, uint32 nodeIndex)
+        {
+            Bvh::Node& node = nodes[nodeIndex];
+            Bounds bounds;
+
+            if (node.IsLeaf())
+            {
+                for (uint32 i = node.leftFirst; i < node.leftFirst + node.itemCount; i++)
+                    bounds.Encapsulate(leafItemBounds[i]);
+            }
+            else
+            {
+                uint32 left = node.leftFirst;
+                bounds = Bounds::Union(RefitNode(nodes, leafItemBounds, left), RefitNode(nodes, leafItemBounds, left + 1));
+            }
+
+            node.boundsMin = bounds.min;
+            node.boundsMax = bounds.max;
+            return bounds;
+        }
+
+        // Tree rotations after "Fast, Effective BVH Updates for Animated Scenes" by Kopta et al.
+        // Tries to swap each child with one of its sibling's children. The parent bounds do not change,
+        // so the SAH gain is the surface area saved on the sibling whose subtree changes.
+        // heights holds the height of every visited node, returns the height of this one
+        int32 OptimizeNode(std::vector<Bvh::Node>& nodes, std::vector<int32>& heights, uint32 nodeIndex)
+        {
+            if (nodes[nodeIndex].IsLeaf())
+                return 0;
+
+            uint32 left = nodes[nodeIndex].leftFirst;
+            uint32 right = left + 1;
+
+            heights[left] = OptimizeNode(nodes, heights, left);
+            heights[right] = OptimizeNode(nodes, heights, right);
+
+            int32 height = 1 + Math::Max(heights[left], heights[right]);
+
+            // child: stays in place and is swapped into the sibling subtree, grandchild: moves up to the child slot
+            uint32 bestChild = 0;
+            uint32 bestGrandchild = 0;
+            float bestGain = 0.0f;
+
+            auto consider = [&](uint32 child, uint32 sibling)
+                {
+                    const Bvh::Node& siblingNode = nodes[sibling];
+
+                    if (siblingNode.IsLeaf())
+                        return;
+
+                    float siblingArea = siblingNode.GetBounds().SurfaceArea();
+
+                    for (uint32 i = 0; i < 2; i++)
+                    {
+                        uint32 grandchild = siblingNode.leftFirst + i;
+                        uint32 remaining = siblingNode.leftFirst + 1 - i;
+
+                        float gain = siblingArea - Bounds::Union(nodes[child].GetBounds(), nodes[remaining].GetBounds()).SurfaceArea();
+
+                        int32 newSiblingHeight = 1 + Math::Max(heights[child], heights[remaining]);
+                        int32 newHeight = 1 + Math::Max(heights[grandchild], newSiblingHeight);
+
+                        if (gain > bestGain && newHeight <= height)
+                        {
+                            bestGain = gain;
+                            bestChild = child;
+                            bestGrandchild = grandchild;
+                        }
+                    }
+                };
+
+            consider(left, right);
+            consider(right, left);
+
+            // Ignore gains that are only float noise
+            if (bestGain <= nodes[nodeIndex].GetBounds().SurfaceArea() * 1e-4f)
+                return height;
+
+            uint32 sibling = bestChild == left ? right : left;
+            uint32 remaining = nodes[sibling].leftFirst + (bestGrandchild == nodes[sibling].leftFirst ? 1 : 0);
+
+            // Swapping the node records moves whole subtrees, since children are referenced by index
+            std::swap(nodes[bestChild], nodes[bestGrandchild]);
+            std::swap(heights[bestChild], heights[bestGrandchild]);
+
+            Bounds siblingBounds = Bounds::Union(nodes[bestGrandchild].GetBounds(), nodes[remaining].GetBounds());
+            nodes[sibling].boundsMin = siblingBounds.min;
+            nodes[sibling].boundsMax = siblingBounds.max;
+            heights[sibling] = 1 + Math::Max(heights[bestGrandchild], heights[remaining]);
+
+            return 1 + Math::Max(heights[left], heights[right]);
+        }
+    }
+
+    void Bvh::Build(std::span<const Bounds> itemBounds)
+    {
+        Clear();
+
+        if (itemBounds.empty())
+            return;
+
+        assert(itemBounds.size() <= UINT32_MAX);
+
+        uint32 count = static_cast<uint32>(itemBounds.size());
+
+        nodes.reserve(2 * static_cast<size_t>(count) - 1);
+        nodes.emplace_back();
+
+        BvhBuilder builder(nodes, itemBounds);
+        builder.BuildNode(0, 0, count, 0);
+
+        itemIndices.reserve(count);
+        leafItemBounds.reserve(count);
+
+        for (const BuildItem& item : builder.GetItems())
+        {
+            itemIndices.push_back(item.index);
+            leafItemBounds.push_back(item.bounds);
+        }
+    }
+
+    void Bvh::Refit(std::span<const Bounds> itemBounds)
+    {
+        assert(itemBounds.size() == itemIndices.size());
+
+        if (nodes.empty())
+            return;
+
+        for (size_t i = 0; i < itemIndices.size(); i++)
+            leafItemBounds[i] = itemBounds[itemIndices[i]];
+
+        (void)RefitNode(nodes, leafItemBounds, 0);
+    }
+
+    void Bvh::Optimize()
+    {
+        if (nodes.empty())
+            return;
+
+        std::vector<int32> heights(nodes.size(), 0);
+        (void)OptimizeNode(nodes, heights, 0);
+    }
+
+    void Bvh::Clear()
+    {
+        nodes.clear();
+        itemIndices.clear();
+        leafItemBounds.clear();
+    }
+
+    float Bvh::GetCost() const
+    {
+        if (nodes.empty())
+            return 0.0f;
+
+        float rootArea = nodes[0].GetBounds().SurfaceArea();
+
+        if (rootArea <= 0.0f)
+            return 0.0f;
+
+        float cost = 0.0f;
+
+        for (size_t i = 0; i < nodes.size(); i++)
+        {
+            const Node& node = nodes[i];
+            float area = node.GetBounds().SurfaceArea() / rootArea;
+            cost += node.IsLeaf() ? area * ItemCost * static_cast<float>(node.itemCount) : area * TraversalCost;
+        }
+
+        return cost;
+    }
+}
\ No newline at end of file
@@ -0,0 +1,112 @@
+﻿#include <array>
+
+#include "ByteEngine/Math/ColorConversion.h"
+#include "Math/Simd/SimdExponential.h"
+
+namespace ByteEngine::Math
+{
+    namespace
+    {
+        using namespace Simd;
+
+        static_assert(sizeof(ColorF) == 4 * sizeof(float), "Bulk color conversion expects tightly packed ColorF");
+        static_assert(sizeof(ColorRGBA8) == 4, "Bulk color conversion expects tightly packed ColorRGBA8");
+
+        // Colors are processed as flat channel arrays, 2 colors per block. Lanes 3 and 7 hold alpha
+        constexpr int32 AlphaLaneBits[8] = { 0, 0, 0, -1, 0, 0, 0, -1 };
+
+        const std::array<float, 256> GammaToLinearTable = []
+            {
+                std::array<float, 256> table;
+
+                for (size_t i = 0; i < table.size(); i++)
+                    table[i] = Math::GammaToLinearSpace(static_cast<float>(i) / 255.0f);
+
+                return table;
+            }();
+
+        // Same curve as Math::GammaToLinearSpace
+        Float8 GammaToLinear8(Float8 value)
+        {
+            Float8 linear = Div(value, Splat8(12.92f));
+            Float8 curve = Pow(Div(Add(value, Splat8(0.055f)), Splat8(1.055f)), Splat8(2.4f));
+            return Select(CompareLessEqual(value, Splat8(0.04045f)), linear, curve);
+        }
+
+        // Same curve as Math::LinearToGammaSpace. Lanes at or below zero take the linear segment, so Pow never sees them
+        Float8 LinearToGamma8(Float8 value)
+        {
+            Float8 linear = Mul(value, Splat8(12.92f));
+            Float8 curve = Sub(Mul(Splat8(1.055f), Pow(value, Splat8(1.0f / 2.4f))), Splat8(0.055f));
+            return Select(CompareLessEqual(value, Splat8(0.0031308f)), linear, curve);
+        }
+
+        const float* Channels(std::span<const ColorF> colors) { return reinterpret_cast<const float*>(colors.data()); }
+        float* Channels(std::span<ColorF> colors) { return reinterpret_cast<float*>(colors.data()); }
+    }
+}
+
+namespace ByteEngine::Math::Math
+{
+    void GammaToLinearSpace(std::span<const ColorF> colors, std::span<ColorF> results) noexcept
+    {
+        assert(colors.size() == results.size());
+
+        const float* source = Channels(colors);
+        float* destination = Channels(results);
+        Float8 alphaMask = AsFloat(Load8(AlphaLaneBits));
+
+        ForEachBlock8(colors.size() * 4, [&](auto block)
+            {
+                Float8 value = block.Load(source);
+                block.Store(destination, Select(alphaMask, value, GammaToLinear8(value)));
+            });
+    }
+
+    void LinearToGammaSpace(std::span<const ColorF> colors, std::span<ColorF> results) noexcept
+    {
+        assert(colors.size() == results.size());
+
+        const float* source = Channels(colors);
+        float* destination = Channels(results);
+        Float8 alphaMask = AsFloat(Load8(AlphaLaneBits));
+
+        ForEachBlock8(colors.size() * 4, [&](auto block)
+            {
+                Float8 value = block.Load(source);
+                block.Store(destination, Select(alphaMask, value, LinearToGamma8(value)));
+            });
+    }
+
+    void GammaToLinearSpace(std::span<const ColorRGBA8> pixels, std::span<ColorF> results) noexcept
+    {
+        assert(pixels.size() == results.size());
+
+        const uint8* source = reinterpret_cast<const uint8*>(pixels.data());
+        float* destination = Channels(results);
+        Float8 alphaMask = AsFloat(Load8(AlphaLaneBits));
+
+        ForEachBlock8(pixels.size() * 4, [&](auto block)
+            {
+                Int8 bytes = block.LoadBytes(source);
+                Float8 alpha = Div(ConvertToFloat(bytes), Splat8(255.0f));
+                block.Store(destination, Select(alphaMask, alpha, Gather(GammaToLinearTable.data(), bytes)));
+            });
+    }
+
+    void LinearToGammaSpace(std::span<const ColorF> colors, std::span<ColorRGBA8> results) noexcept
+    {
+        assert(colors.size() == results.size());
+
+        const float* source = Channels(colors);
+        uint8* destination = reinterpret_cast<uint8*>(results.data());
+        Float8 alphaMask = AsFloat(Load8(AlphaLaneBits));
+
+        ForEachBlock8(colors.size() * 4, [&](auto block)
+            {
+                Float8 value = Simd::Min(Simd::Max(block.Load(source), Zero8()), Splat8(1.0f));
+                Float8 encoded = Select(alphaMask, value, LinearToGamma8(value));
+                block.StoreBytes(destination, ConvertToInt(Mul(encoded, Splat8(255.0f))));
+            });
+    }
+}
\ No newline at end of file
@@ -0,0 +1,322 @@
+﻿#include <algorithm>
+#include <cstring>
+
+#include "ByteEngine/Math/Curve.h"
+#include "Math/Simd/SimdMath.h"
+
+namespace ByteEngine::Math
+{
+    namespace
+    {
+        using namespace Simd;
+
+        template<typename T>
+        constexpr size_t ComponentCount = std::is_same_v<T, float> ? 1 : std::is_same_v<T, Vector3F> ? 3 : 4;
+
+        // A plain array in a struct, Float8 loses its alignment attributes as a template argument of std::array
+        template<size_t N>
+        struct Components8
+        {
+            Float8 c[N];
+
+            Float8& operator[](size_t i) { return c[i]; }
+            const Float8& operator[](size_t i) const { return c[i]; }
+        };
+
+        // Weights of the four control points
+        using Weights8 = Components8<4>;
+
+        const float* GetData(const float& value) { return &value; }
+        const float* GetData(const Vector3F& value) { return value.data; }
+        const float* GetData(const Quaternion& value) { return value.data; }
+
+        std::array<const float*, 1> GetComponents(std::span<const float> stream) { return { stream.data() }; }
+        std::array<float*, 1> GetComponents(std::span<float> stream) { return { stream.data() }; }
+        std::array<const float*, 3> GetComponents(ConstVector3FStream stream) { return { stream.x.data(), stream.y.data(), stream.z.data() }; }
+        std::array<float*, 3> GetComponents(Vector3FStream stream) { return { stream.x.data(), stream.y.data(), stream.z.data() }; }
+        std::array<const float*, 4> GetComponents(ConstQuaternionStream stream) { return { stream.x.data(), stream.y.data(), stream.z.data(), stream.w.data() }; }
+        std::array<float*, 4> GetComponents(QuaternionStream stream) { return { stream.x.data(), stream.y.data(), stream.z.data(), stream.w.data() }; }
+
+        size_t GetSize(std::span<const float> stream) { return stream.size(); }
+        size_t GetSize(ConstVector3FStream stream) { return stream.Size(); }
+        size_t GetSize(ConstQuaternionStream stream) { return stream.Size(); }
+
+        // c[0] + c[1] * t + c[2] * t^2 + c[3] * t^3
+        Float8 EvaluatePolynomial(const Float8 c[4], Float8 t)
+        {
+            return MulAdd(MulAdd(MulAdd(c[3], t, c[2]), t, c[1]), t, c[0]);
+        }
+
+        Weights8 GetWeights8(const CurveCoefficients& coefficients, Float8 t)
+        {
+            Weights8 weights;
+
+            for (int32 k = 0; k < 4; k++)
+            {
+                const float* c = coefficients.c[k];
+                Float8 splatted[4] = { Splat8(c[0]), Splat8(c[1]), Splat8(c[2]), Splat8(c[3]) };
+                weights[k] = EvaluatePolynomial(splatted, t);
+            }
+
+            return weights;
+        }
+
+        // Same rule as CubicCurve::GetAlignedPoints
+        template<CurveBasis Basis>
+        void AlignQuaternions8(std::array<Components8<4>, 4>& points)
+        {
+            auto align = [](const Components8<4>& reference, Components8<4>& q)
+                {
+                    Float8 dot = MulAdd(reference[3], q[3], MulAdd(reference[2], q[2], MulAdd(reference[1], q[1], Mul(reference[0], q[0]))));
+                    Float8 flip = BitAnd(CompareLess(dot, Zero8()), Splat8(-0.0f));
+
+                    for (Float8& component : q.c)
+                        component = BitXor(component, flip);
+                };
+
+            if constexpr (Basis == CurveBasis::Hermite)
+            {
+                align(points[0], points[2]);
+            }
+            else
+            {
+                align(points[0], points[1]);
+                align(points[1], points[2]);
+                align(points[2], points[3]);
+            }
+        }
+
+        // Same guard as Quaternion::Normalize, near zero quaternions are left untouched
+        void NormalizeQuaternion8(Components8<4>& q)
+        {
+            Float8 lengthSquared = MulAdd(q[3], q[3], MulAdd(q[2], q[2], MulAdd(q[1], q[1], Mul(q[0], q[0]))));
+            Float8 invLength = Div(Splat8(1.0f), Sqrt(lengthSquared));
+            Float8 scale = Select(CompareGreater(lengthSquared, Splat8(Math::Epsilon)), invLength, Splat8(1.0f));
+
+            for (Float8& component : q.c)
+                component = Mul(component, scale);
+        }
+
+        template<bool Partial>
+        void StoreValues(const Block8<Partial>& block, std::span<float> results, const Components8<1>& values)
+        {
+            block.Store(results.data(), values[0]);
+        }
+
+        template<bool Partial>
+        void StoreValues(const Block8<Partial>& block, std::span<Vector3F> results, const Components8<3>& values)
+        {
+            float* destination = reinterpret_cast<float*>(results.data() + block.offset);
+
+            if constexpr (Partial)
+            {
+                float buffer[BlockWidth * 3];
+                Store3x8(buffer, values[0], values[1], values[2]);
+                std::memcpy(destination, buffer, block.count * 3 * sizeof(float));
+            }
+            else
+            {
+                Store3x8(destination, values[0], values[1], values[2]);
+            }
+        }
+
+        template<bool Partial>
+        void StoreValues(const Block8<Partial>& block, std::span<Quaternion> results, const Components8<4>& values)
+        {
+            float buffer[4][BlockWidth];
+
+            for (size_t c = 0; c < 4; c++)
+                Store8(buffer[c], values[c]);
+
+            for (size_t i = 0; i < block.count; i++)
+                results[block.offset + i] = Quaternion(buffer[0][i], buffer[1][i], buffer[2][i], buffer[3][i]);
+        }
+
+        // getWeights(block) returns the weights of the four control points for the lanes of the block
+        template<typename T, CurveBasis Basis, typename ConstStream, typename Stream, typename GetWeights>
+        void EvaluateCurves(const std::array<ConstStream, 4>& points, Stream results, GetWeights&& getWeights)
+        {
+            constexpr size_t N = ComponentCount<T>;
+
+            size_t count = GetSize(results);
+            std::array<std::array<const float*, N>, 4> sources;
+
+            for (size_t k = 0; k < 4; k++)
+            {
+                assert(GetSize(points[k]) == count);
+                sources[k] = GetComponents(points[k]);
+            }
+
+            std::array<float*, N> destination = GetComponents(results);
+
+            ForEachBlock8(count, [&](auto block)
+                {
+                    Weights8 weights = getWeights(block);
+                    std::array<Components8<N>, 4> p;
+
+                    for (size_t k = 0; k < 4; k++)
+                    {
+                        for (size_t c = 0; c < N; c++)
+                            p[k][c] = block.Load(sources[k][c]);
+                    }
+
+                    if constexpr (std::is_same_v<T, Quaternion>)
+                        AlignQuaternions8<Basis>(p);
+
+                    Components8<N> value;
+
+                    for (size_t c = 0; c < N; c++)
+                        value[c] = MulAdd(weights[3], p[3][c], MulAdd(weights[2], p[2][c], MulAdd(weights[1], p[1][c], Mul(weights[0], p[0][c]))));
+
+                    if constexpr (std::is_same_v<T, Quaternion>)
+                        NormalizeQuaternion8(value);
+
+                    for (size_t c = 0; c < N; c++)
+                        block.Store(destination[c], value[c]);
+                });
+        }
+    }
+
+    template<typename T, CurveBasis Basis>
+    void CubicCurve<T, Basis>::Evaluate(std::span<const float> t, std::span<T> results) const
+    {
+        assert(t.size() == results.size());
+
+        constexpr size_t N = ComponentCount<T>;
+        std::array<T, 4> aligned = GetAlignedPoints();
+
+        // Power form of the whole curve, component c = power[c][0] + power[c][1] * t + power[c][2] * t^2 + power[c][3] * t^3
+        Float8 power[N][4];
+
+        for (size_t c = 0; c < N; c++)
+        {
+            for (size_t j = 0; j < 4; j++)
+            {
+                float sum = 0.0f;
+
+                for (size_t k = 0; k < 4; k++)
+                    sum += Coefficients.c[k][j] * GetData(aligned[k])[c];
+
+                power[c][j] = Splat8(sum);
+            }
+        }
+
+        ForEachBlock8(t.size(), [&](auto block)
+            {
+                Float8 t8 = block.Load(t.data());
+                Components8<N> value;
+
+                for (size_t c = 0; c < N; c++)
+                    value[c] = EvaluatePolynomial(power[c], t8);
+
+                if constexpr (std::is_same_v<T, Quaternion>)
+                    NormalizeQuaternion8(value);
+
+                StoreValues(block, results, value);
+            });
+    }
+
+    template<typename T, CurveBasis Basis>
+    void CubicCurve<T, Basis>::Evaluate(const std::array<ConstStream, 4>& points, std::span<const float> t, Stream results)
+    {
+        assert(t.size() == GetSize(results));
+
+        EvaluateCurves<T, Basis>(points, results, [&](auto block) { return GetWeights8(Coefficients, block.Load(t.data())); });
+    }
+
+    template<typename T, CurveBasis Basis>
+    void CubicCurve<T, Basis>::Evaluate(const std::array<ConstStream, 4>& points, float t, Stream results)
+    {
+        std::array<float, 4> scalarWeights = GetWeights(t);
+        Weights8 weights = { { Splat8(scalarWeights[0]), Splat8(scalarWeights[1]), Splat8(scalarWeights[2]), Splat8(scalarWeights[3]) } };
+
+        EvaluateCurves<T, Basis>(points, results, [&](auto) { return weights; });
+    }
+
+    template struct CubicCurve<float, CurveBasis::Bezier>;
+    template struct CubicCurve<float, CurveBasis::Hermite>;
+    template struct CubicCurve<float, CurveBasis::CatmullRom>;
+    template struct CubicCurve<Vector3F, CurveBasis::Bezier>;
+    template struct CubicCurve<Vector3F, CurveBasis::Hermite>;
+    template struct CubicCurve<Vector3F, CurveBasis::CatmullRom>;
+    template struct CubicCurve<Quaternion, CurveBasis::Bezier>;
+    template struct CubicCurve<Quaternion, CurveBasis::Hermite>;
+    template struct CubicCurve<Quaternion, CurveBasis::CatmullRom>;
+
+    // ─────────────────────────────────────────────
+    // Arc length
+    // ─────────────────────────────────────────────
+
+    void ArcLengthTable::Build(std::span<const float> samples)
+    {
+        assert(samples.size() >= 2);
+
+        lengths.resize(samples.size());
+        lengths[0] = 0.0f;
+
+        for (size_t i = 1; i < samples.size(); i++)
+            lengths[i] = lengths[i - 1] + Math::Abs(samples[i] - samples[i - 1]);
+    }
+
+    void ArcLengthTable::Build(std::span<const Vector3F> samples)
+    {
+        assert(samples.size() >= 2);
+
+        lengths.resize(samples.size());
+        lengths[0] = 0.0f;
+
+        for (size_t i = 1; i < samples.size(); i++)
+            lengths[i] = lengths[i - 1] + (samples[i] - samples[i - 1]).Length();
+    }
+
+    float ArcLengthTable::GetParameter(float distance) const
+    {
+        if (lengths.size() < 2)
+            return 0.0f;
+
+        return GetParameter(distance, FindSegment(distance, 0));
+    }
+
+    void ArcLengthTable::GetParameters(std::span<const float> distances, std::span<float> results) const
+    {
+        assert(distances.size() == results.size());
+
+        if (lengths.size() < 2)
+        {
+            std::fill(results.begin(), results.end(), 0.0f);
+            return;
+        }
+
+        uint32 segment = 0;
+
+        for (size_t i = 0; i < distances.size(); i++)
+        {
+            segment = FindSegment(distances[i], segment);
+            results[i] = GetParameter(distances[i], segment);
+        }
+    }
+
+    uint32 ArcLengthTable::FindSegment(float distance, uint32 hint) const
+    {
+        uint32 last = static_cast<uint32>(lengths.size()) - 2;
+
+        // The hinted segment and the one after it cover steadily increasing distances without a search
+        for (uint32 segment = hint; segment <= Math::Min(hint + 1, last); segment++)
+        {
+            if (distance >= lengths[segment] && distance <= lengths[segment + 1])
+                return segment;
+        }
+
+        auto upper = std::upper_bound(lengths.begin() + 1, lengths.end() - 1, distance);
+        return static_cast<uint32>(upper - lengths.begin()) - 1;
+    }
+
+    float ArcLengthTable::GetParameter(float distance, uint32 segment) const
+    {
+        float start = lengths[segment];
+        float length = lengths[segment + 1] - start;
+        float fraction = length > 0.0f ? Math::Clamp((distance - start) / length) : 0.0f;
+
+        return (static_cast<float>(segment) + fraction) / static_cast<float>(lengths.size() - 1);
+    }
+}
\ No newline at end of file
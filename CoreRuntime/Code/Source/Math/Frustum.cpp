@@ -0,0 +1,171 @@
+﻿#include <bit>
+
+#include "ByteEngine/Math/Frustum.h"
+#include "Math/Simd/SimdMath.h"
+
+using namespace ByteEngine::Math::Simd;
+
+namespace ByteEngine::Math
+{
+    namespace
+    {
+        Vector4F NormalizePlane(Vector4F plane)
+        {
+            float invLength = 1.0f / Math::Sqrt(plane.x * plane.x + plane.y * plane.y + plane.z * plane.z);
+            return plane * invLength;
+        }
+
+        // Plane components splatted across 8 lanes
+        struct SplattedPlane
+        {
+            Float8 x, y, z, w;
+            Float8 absX, absY, absZ;
+        };
+
+        struct SplattedFrustum
+        {
+            SplattedPlane planes[Frustum::PlaneCount];
+
+            explicit SplattedFrustum(const Frustum& frustum)
+            {
+                for (int32 i = 0; i < Frustum::PlaneCount; i++)
+                {
+                    const Vector4F& plane = frustum.planes[i];
+                    planes[i] = SplattedPlane {
+                        Splat8(plane.x), Splat8(plane.y), Splat8(plane.z), Splat8(plane.w),
+                        Splat8(Math::Abs(plane.x)), Splat8(Math::Abs(plane.y)), Splat8(Math::Abs(plane.z))
+                    };
+                }
+            }
+        };
+
+        Float8 PlaneDistance8(const SplattedPlane& plane, Float8 x, Float8 y, Float8 z)
+        {
+            return MulAdd(z, plane.z, MulAdd(y, plane.y, MulAdd(x, plane.x, plane.w)));
+        }
+
+        // Appends offset + lane for every set bit of the mask
+        size_t AppendVisible(int32 mask, size_t offset, uint32* visibleIndices, size_t visibleCount)
+        {
+            uint32 bits = static_cast<uint32>(mask);
+
+            while (bits != 0)
+            {
+                visibleIndices[visibleCount++] = static_cast<uint32>(offset) + static_cast<uint32>(std::countr_zero(bits));
+                bits &= bits - 1;
+            }
+
+            return visibleCount;
+        }
+
+        // Padding lanes of a partial block must never be reported
+        template<typename Block>
+        int32 ValidLanes(const Block& block)
+        {
+            return static_cast<int32>((1u << block.count) - 1u);
+        }
+    }
+
+    // Gribb-Hartmann extraction: with clip = p * M, each plane is a sum or difference of the matrix columns
+    Frustum Frustum::FromViewProjection(const Matrix4x4F& viewProjection)
+    {
+        Vector4F column0 = viewProjection.GetColumn(0);
+        Vector4F column1 = viewProjection.GetColumn(1);
+        Vector4F column2 = viewProjection.GetColumn(2);
+        Vector4F column3 = viewProjection.GetColumn(3);
+
+        Frustum frustum;
+        frustum.planes[Left] = NormalizePlane(column3 + column0);
+        frustum.planes[Right] = NormalizePlane(column3 - column0);
+        frustum.planes[Bottom] = NormalizePlane(column3 + column1);
+        frustum.planes[Top] = NormalizePlane(column3 - column1);
+        frustum.planes[Near] = NormalizePlane(column2);
+        frustum.planes[Far] = NormalizePlane(column3 - column2);
+        return frustum;
+    }
+
+    bool Frustum::IntersectsSphere(Vector3F center, float radius) const
+    {
+        for (const Vector4F& plane : planes)
+        {
+            if (plane.x * center.x + plane.y * center.y + plane.z * center.z + plane.w < -radius)
+                return false;
+        }
+
+        return true;
+    }
+
+    bool Frustum::IntersectsBox(Vector3F center, Vector3F extents) const
+    {
+        for (const Vector4F& plane : planes)
+        {
+            float distance = plane.x * center.x + plane.y * center.y + plane.z * center.z + plane.w;
+            float radius = Math::Abs(plane.x) * extents.x + Math::Abs(plane.y) * extents.y + Math::Abs(plane.z) * extents.z;
+
+            if (distance < -radius)
+                return false;
+        }
+
+        return true;
+    }
+
+    size_t Frustum::CullSpheres(ConstVector3FStream centers, std::span<const float> radii, std::span<uint32> visibleIndices) const
+    {
+        assert(centers.Size() == radii.size());
+        assert(visibleIndices.size() >= centers.Size());
+
+        SplattedFrustum frustum(*this);
+        size_t visibleCount = 0;
+
+        ForEachBlock8(centers.Size(), [&](auto block)
+            {
+                Float8 x = block.Load(centers.x.data());
+                Float8 y = block.Load(centers.y.data());
+                Float8 z = block.Load(centers.z.data());
+                Float8 negRadius = Negate(block.Load(radii.data()));
+
+                Float8 outside = Zero8();
+
+                for (const SplattedPlane& plane : frustum.planes)
+                    outside = BitOr(outside, CompareLess(PlaneDistance8(plane, x, y, z), negRadius));
+
+                int32 visible = ~MoveMask(outside) & ValidLanes(block);
+                visibleCount = AppendVisible(visible, block.offset, visibleIndices.data(), visibleCount);
+            });
+
+        return visibleCount;
+    }
+
+    size_t Frustum::CullBoxes(ConstVector3FStream centers, ConstVector3FStream extents, std::span<uint32> visibleIndices) const
+    {
+        assert(centers.Size() == extents.Size());
+        assert(visibleIndices.size() >= centers.Size());
+
+        SplattedFrustum frustum(*this);
+        size_t visibleCount = 0;
+
+        ForEachBlock8(centers.Size(), [&](auto block)
+            {
+                Float8 x = block.Load(centers.x.data());
+                Float8 y = block.Load(centers.y.data());
+                Float8 z = block.Load(centers.z.data());
+                Float8 extentX = block.Load(extents.x.data());
+                Float8 extentY = block.Load(extents.y.data());
+                Float8 extentZ = block.Load(extents.z.data());
+
+                Float8 outside = Zero8();
+
+                for (const SplattedPlane& plane : frustum.planes)
+                {
+                    // Projected radius of the box onto the plane normal
+                    Float8 radius = MulAdd(extentZ, plane.absZ, MulAdd(extentY, plane.absY, Mul(extentX, plane.absX)));
+                    outside = BitOr(outside, CompareLess(PlaneDistance8(plane, x, y, z), Negate(radius)));
+                }
+
+                int32 visible = ~MoveMask(outside) & ValidLanes(block);
+                visibleCount = AppendVisible(visible, block.offset, visibleIndices.data(), visibleCount);
+            });
+
+        return visibleCount;
+    }
+}
\ No newline at end of file
@@ -1,56 +1,144 @@
 ﻿#include "ByteEngine/Math/Math.h"
+#include "Math/Simd/SimdTrigonometry.h"
+
+namespace ByteEngine::Math
+{
+    namespace
+    {
+        using namespace Simd;
+
+        static_assert(sizeof(RadianF) == sizeof(float), "Batch trigonometry expects RadianF to be a plain float");
+
+        template<typename Variant>
+        struct Kernels
+        {
+            static void Sin(Float8 angle, Float8 (&results)[1]) { results[0] = Variant::Sin(angle); }
+            static void Cos(Float8 angle, Float8 (&results)[1]) { results[0] = Variant::Cos(angle); }
+            static void SinCos(Float8 angle, Float8 (&results)[2]) { Variant::SinCos(results[0], results[1], angle); }
+            static void Asin(Float8 value, Float8 (&results)[1]) { results[0] = Variant::Asin(value); }
+            static void Acos(Float8 value, Float8 (&results)[1]) { results[0] = Variant::Acos(value); }
+        };
+
+        using FastKernels = Kernels<Simd::FastTrigonometry>;
+        using PreciseKernels = Kernels<Simd::PreciseTrigonometry>;
+
+        // Runs the kernel over count inputs, 8 at a time
+        template<size_t OutputCount, typename Kernel>
+        void Evaluate8(const float* input, float* const (&outputs)[OutputCount], size_t count, Kernel kernel)
+        {
+            ForEachBlock8(count, [&](auto lanes)
+                {
+                    Float8 results[OutputCount];
+                    kernel(lanes.Load(input), results);
+
+                    for (size_t output = 0; output < OutputCount; output++)
+                        lanes.Store(outputs[output], results[output]);
+                });
+        }
+    }
+}
 
 namespace ByteEngine::Math::Math
 {
     double Sin(RadianD rad) { return std::sin(rad.value); }
     double Cos(RadianD rad) { return std::cos(rad.value); }
 
-    // Asin implementation adapted from DirectXMath (MIT License). See THIRDPARTY.md
-    // Source: DirectX::XMScalarASin
-    RadianF Asin(float value) noexcept
+    namespace Fast
     {
-        // Clamp input to [-1,1].
-        bool nonnegative = (value >= 0.0f);
-        float x = fabsf(value);
-        float omx = 1.0f - x;
-        if (omx < 0.0f)
+        // Asin implementation adapted from DirectXMath (MIT License). See THIRDPARTY.md
+        // Source: DirectX::XMScalarASin
+        RadianF Asin(float value) noexcept
         {
-            omx = 0.0f;
+            // Clamp input to [-1,1].
+            bool nonnegative = (value >= 0.0f);
+            float x = fabsf(value);
+            float omx = 1.0f - x;
+            if (omx < 0.0f)
+            {
+                omx = 0.0f;
+            }
+            float root = sqrtf(omx);
+
+            // 7-degree minimax approximation
+            float result = ((((((-0.0012624911f * x + 0.0066700901f) * x - 0.0170881256f) * x + 0.0308918810f) * x - 0.0501743046f) * x + 0.0889789874f) * x - 0.2145988016f) * x + 1.5707963050f;
+            result *= root;  // acos(|x|)
+
+            // acos(x) = pi - acos(-x) when x < 0, asin(x) = pi/2 - acos(x)
+            return RadianF(nonnegative ? PI / 2.0f - result : result - PI / 2.0f);
         }
-        float root = sqrtf(omx);
 
-        // 7-degree minimax approximation
-        float result = ((((((-0.0012624911f * x + 0.0066700901f) * x - 0.0170881256f) * x + 0.0308918810f) * x - 0.0501743046f) * x + 0.0889789874f) * x - 0.2145988016f) * x + 1.5707963050f;
-        result *= root;  // acos(|x|)
+        // Acos implementation adapted from DirectXMath (MIT License). See THIRDPARTY.md
+        // Source: DirectX::XMScalarACos
+        RadianF Acos(float value) noexcept
+        {
+            // Clamp input to [-1,1].
+            bool nonnegative = (value >= 0.0f);
+            float x = fabsf(value);
+            float omx = 1.0f - x;
+            if (omx < 0.0f)
+            {
+                omx = 0.0f;
+            }
+            float root = sqrtf(omx);
 
-        // acos(x) = pi - acos(-x) when x < 0, asin(x) = pi/2 - acos(x)
-        return RadianF(nonnegative ? PI / 2.0f - result : result - PI / 2.0f);
-    }
+            // 7-degree minimax approximation
+            float result = ((((((-0.0012624911f * x + 0.0066700901f) * x - 0.0170881256f) * x + 0.0308918810f) * x - 0.0501743046f) * x + 0.0889789874f) * x - 0.2145988016f) * x + 1.5707963050f;
+            result *= root;
 
-    RadianD Asin(double value) { return RadianD(std::asin(value)); }
+            // acos(x) = pi - acos(-x) when x < 0
+            return RadianF(nonnegative ? result : PI - result);
+        }
+    }
 
-    // Acos implementation adapted from DirectXMath (MIT License). See THIRDPARTY.md
-    // Source: DirectX::XMScalarACos
-    RadianF Acos(float value) noexcept
+    namespace Precise
     {
-        // Clamp input to [-1,1].
-        bool nonnegative = (value >= 0.0f);
-        float x = fabsf(value);
-        float omx = 1.0f - x;
-        if (omx < 0.0f)
+        namespace
+        {
+            // asin(x) for x in [0, 0.5]
+            float AsinPolynomial(float x, float x2)
+            {
+                return ((((4.2163199048e-2f * x2 + 2.4181311049e-2f) * x2 + 4.5470025998e-2f) * x2 + 7.4953002686e-2f) * x2 + 1.6666752422e-1f) * x2 * x + x;
+            }
+
+            // asin(|value|) with |value| clamped to 1. Branchless, the two halves of the domain are equally likely
+            float AsinOfAbs(float value)
+            {
+                float x = Min(fabsf(value), 1.0f);
+                bool large = x > 0.5f;
+
+                // asin(x) = pi/2 - 2 * asin(sqrt((1 - x) / 2)) for x > 0.5
+                float z = large ? 0.5f * (1.0f - x) : x * x;
+                float root = sqrtf(z);
+                float result = AsinPolynomial(large ? root : x, z);
+                return large ? PI / 2.0f - 2.0f * result : result;
+            }
+        }
+
+        RadianF Asin(float value) noexcept
         {
-            omx = 0.0f;
+            float result = AsinOfAbs(value);
+            return RadianF(value >= 0.0f ? result : -result);
         }
-        float root = sqrtf(omx);
 
-        // 7-degree minimax approximation
-        float result = ((((((-0.0012624911f * x + 0.0066700901f) * x - 0.0170881256f) * x + 0.0308918810f) * x - 0.0501743046f) * x + 0.0889789874f) * x - 0.2145988016f) * x + 1.5707963050f;
-        result *= root;
+        RadianF Acos(float value) noexcept
+        {
+            // acos(x) = pi/2 - asin(x) for |x| <= 0.5, acos(x) = 2 * asin(sqrt((1 - x) / 2)) and acos(-x) = pi - acos(x) above
+            float x = Min(fabsf(value), 1.0f);
+            bool large = x > 0.5f;
+
+            float z = large ? 0.5f * (1.0f - x) : x * x;
+            float root = sqrtf(z);
+            float result = AsinPolynomial(large ? root : x, z);
 
-        // acos(x) = pi - acos(-x) when x < 0
-        return RadianF(nonnegative ? result : PI - result);
+            if (!large)
+                return RadianF(PI / 2.0f - (value >= 0.0f ? result : -result));
+
+            return RadianF(value >= 0.0f ? 2.0f * result : PI - 2.0f * result);
+        }
     }
 
+    RadianD Asin(double value) { return RadianD(std::asin(value)); }
+
     RadianD Acos(double value) { return RadianD(std::acos(value)); }
 
     RadianF AngleDifference(RadianF from, RadianF to) noexcept
@@ -70,4 +158,80 @@ namespace ByteEngine::Math::Math
 
     RadianF LerpAngleClamped(RadianF from, RadianF to, float t) noexcept { return LerpAngle(from, to, Clamp(t)); }
     RadianD LerpAngleClamped(RadianD from, RadianD to, double t) noexcept { return LerpAngle(from, to, Clamp(t)); }
+
+    namespace Fast
+    {
+        void Sin(std::span<const RadianF> angles, std::span<float> results) noexcept
+        {
+            assert(angles.size() == results.size());
+            float* const outputs[] = { results.data() };
+            Evaluate8(reinterpret_cast<const float*>(angles.data()), outputs, angles.size(), FastKernels::Sin);
+        }
+
+        void Cos(std::span<const RadianF> angles, std::span<float> results) noexcept
+        {
+            assert(angles.size() == results.size());
+            float* const outputs[] = { results.data() };
+            Evaluate8(reinterpret_cast<const float*>(angles.data()), outputs, angles.size(), FastKernels::Cos);
+        }
+
+        void SinCos(std::span<float> sin, std::span<float> cos, std::span<const RadianF> angles) noexcept
+        {
+            assert(angles.size() == sin.size() && angles.size() == cos.size());
+            float* const outputs[] = { sin.data(), cos.data() };
+            Evaluate8(reinterpret_cast<const float*>(angles.data()), outputs, angles.size(), FastKernels::SinCos);
+        }
+
+        void Asin(std::span<const float> values, std::span<RadianF> results) noexcept
+        {
+            assert(values.size() == results.size());
+            float* const outputs[] = { reinterpret_cast<float*>(results.data()) };
+            Evaluate8(values.data(), outputs, values.size(), FastKernels::Asin);
+        }
+
+        void Acos(std::span<const float> values, std::span<RadianF> results) noexcept
+        {
+            assert(values.size() == results.size());
+            float* const outputs[] = { reinterpret_cast<float*>(results.data()) };
+            Evaluate8(values.data(), outputs, values.size(), FastKernels::Acos);
+        }
+    }
+
+    namespace Precise
+    {
+        void Sin(std::span<const RadianF> angles, std::span<float> results) noexcept
+        {
+            assert(angles.size() == results.size());
+            float* const outputs[] = { results.data() };
+            Evaluate8(reinterpret_cast<const float*>(angles.data()), outputs, angles.size(), PreciseKernels::Sin);
+        }
+
+        void Cos(std::span<const RadianF> angles, std::span<float> results) noexcept
+        {
+            assert(angles.size() == results.size());
+            float* const outputs[] = { results.data() };
+            Evaluate8(reinterpret_cast<const float*>(angles.data()), outputs, angles.size(), PreciseKernels::Cos);
+        }
+
+        void SinCos(std::span<float> sin, std::span<float> cos, std::span<const RadianF> angles) noexcept
+        {
+            assert(angles.size() == sin.size() && angles.size() == cos.size());
+            float* const outputs[] = { sin.data(), cos.data() };
+            Evaluate8(reinterpret_cast<const float*>(angles.data()), outputs, angles.size(), PreciseKernels::SinCos);
+        }
+
+        void Asin(std::span<const float> values, std::span<RadianF> results) noexcept
+        {
+            assert(values.size() == results.size());
+            float* const outputs[] = { reinterpret_cast<float*>(results.data()) };
+            Evaluate8(values.data(), outputs, values.size(), PreciseKernels::Asin);
+        }
+
+        void Acos(std::span<const float> values, std::span<RadianF> results) noexcept
+        {
+            assert(values.size() == results.size());
+            float* const outputs[] = { reinterpret_cast<float*>(results.data()) };
+            Evaluate8(values.data(), outputs, values.size(), PreciseKernels::Acos);
+        }
+    }
 }
\ No newline at end of file
@@ -1,197 +1,942 @@
-﻿#include <DirectXMath.h> 
+﻿#include <cstring>
+#include <utility>
 
 #include "ByteEngine/Math/Matrix4x4F.h"
 #include "ByteEngine/Math/Quaternion.h"
+#include "ByteEngine/Math/QuaternionStream.h"
+#include "Math/Simd/SimdMath.h"
 
-using namespace DirectX;
+using namespace ByteEngine::Math::Simd;
 
 namespace ByteEngine::Math
 {
-    const Matrix4x4F Matrix4x4F::Identity { 
+    const Matrix4x4F Matrix4x4F::Identity {
         1, 0, 0, 0,
         0, 1, 0, 0,
         0, 0, 1, 0,
-        0, 0, 0, 1 
+        0, 0, 0, 1
     };
 
+    Matrix4x4F& Matrix4x4F::operator*=(const Matrix4x4F& other)
+    {
+        *this = *this * other;
+        return *this;
+    }
+
+    namespace
+    {
+        struct MatrixRows
+        {
+            Float4 r[4];
+        };
+
+        MatrixRows LoadRows(const Matrix4x4F& matrix)
+        {
+            return MatrixRows { {
+                Load4Aligned(matrix.elements),
+                Load4Aligned(matrix.elements + 4),
+                Load4Aligned(matrix.elements + 8),
+                Load4Aligned(matrix.elements + 12)
+            } };
+        }
+
+        void StoreRows(Matrix4x4F& matrix, const MatrixRows& rows)
+        {
+            Store4Aligned(matrix.elements, rows.r[0]);
+            Store4Aligned(matrix.elements + 4, rows.r[1]);
+            Store4Aligned(matrix.elements + 8, rows.r[2]);
+            Store4Aligned(matrix.elements + 12, rows.r[3]);
+        }
+    }
+
+#ifndef BYTEENGINE_MATH_SIMD_DIRECTXMATH
+    namespace
+    {
+        // 2x2 block helpers for the inverse below. A 2x2 matrix is packed into a Float4 as { m00, m01, m10, m11 }.
+        // Block-wise inverse adapted from "Fast 4x4 Matrix Inverse with SSE SIMD, Explained" by Eric Zhang.
+
+        // a * b
+        Float4 Mat2Mul(Float4 a, Float4 b)
+        {
+            return MulAdd(a, Swizzle<0, 3, 0, 3>(b), Mul(Swizzle<1, 0, 3, 2>(a), Swizzle<2, 1, 2, 1>(b)));
+        }
+
+        // adj(a) * b
+        Float4 Mat2AdjMul(Float4 a, Float4 b)
+        {
+            return Sub(Mul(Swizzle<3, 3, 0, 0>(a), b), Mul(Swizzle<1, 1, 2, 2>(a), Swizzle<2, 3, 0, 1>(b)));
+        }
+
+        // a * adj(b)
+        Float4 Mat2MulAdj(Float4 a, Float4 b)
+        {
+            return Sub(Mul(a, Swizzle<3, 0, 3, 0>(b)), Mul(Swizzle<1, 0, 3, 2>(a), Swizzle<2, 1, 2, 1>(b)));
+        }
+
+        // Returns the adjugate rows and the determinant splatted in all lanes
+        MatrixRows Adjugate(const MatrixRows& m, Float4& determinant)
+        {
+            Float4 a = Shuffle<0, 1, 0, 1>(m.r[0], m.r[1]);
+            Float4 b = Shuffle<2, 3, 2, 3>(m.r[0], m.r[1]);
+            Float4 c = Shuffle<0, 1, 0, 1>(m.r[2], m.r[3]);
+            Float4 d = Shuffle<2, 3, 2, 3>(m.r[2], m.r[3]);
+
+            Float4 detSub = Sub(
+                Mul(Shuffle<0, 2, 0, 2>(m.r[0], m.r[2]), Shuffle<1, 3, 1, 3>(m.r[1], m.r[3])),
+                Mul(Shuffle<1, 3, 1, 3>(m.r[0], m.r[2]), Shuffle<0, 2, 0, 2>(m.r[1], m.r[3]))
+            );
+
+            Float4 detA = SplatLane<0>(detSub);
+            Float4 detB = SplatLane<1>(detSub);
+            Float4 detC = SplatLane<2>(detSub);
+            Float4 detD = SplatLane<3>(detSub);
+
+            Float4 dc = Mat2AdjMul(d, c);
+            Float4 ab = Mat2AdjMul(a, b);
+
+            Float4 x = Sub(Mul(detD, a), Mat2Mul(b, dc));
+            Float4 w = Sub(Mul(detA, d), Mat2Mul(c, ab));
+            Float4 y = Sub(Mul(detB, c), Mat2MulAdj(d, ab));
+            Float4 z = Sub(Mul(detC, b), Mat2MulAdj(a, dc));
+
+            Float4 trace = Mul(ab, Swizzle<0, 2, 1, 3>(dc));
+            trace = Add(trace, Swizzle<2, 3, 0, 1>(trace));
+            trace = Add(trace, Swizzle<1, 0, 3, 2>(trace));
+
+            determinant = Sub(MulAdd(detA, detD, Mul(detB, detC)), trace);
+
+            Float4 sign = Set(1.0f, -1.0f, -1.0f, 1.0f);
+            x = Mul(x, sign);
+            y = Mul(y, sign);
+            z = Mul(z, sign);
+            w = Mul(w, sign);
+
+            return MatrixRows { {
+                Shuffle<3, 1, 3, 1>(x, y),
+                Shuffle<2, 0, 2, 0>(x, y),
+                Shuffle<3, 1, 3, 1>(z, w),
+                Shuffle<2, 0, 2, 0>(z, w)
+            } };
+        }
+
+        MatrixRows InverseRows(const MatrixRows& m)
+        {
+            Float4 determinant;
+            MatrixRows adjugate = Adjugate(m, determinant);
+            Float4 invDeterminant = Div(Splat(1.0f), determinant);
+
+            for (Float4& row : adjugate.r)
+                row = Mul(row, invDeterminant);
+
+            return adjugate;
+        }
+
+        Float4 TransformByMatrix(Float4 value, const Matrix4x4F& matrix)
+        {
+            MatrixRows rows = LoadRows(matrix);
+            return Simd::Transform(value, rows.r);
+        }
+    }
+
     float Matrix4x4F::Determinant() const
     {
-        XMMATRIX matrix = XMLoadFloat4x4A(reinterpret_cast<const XMFLOAT4X4A*>(this->elements));
-        XMVECTOR det = XMMatrixDeterminant(matrix);
-        return XMVectorGetX(det);
+        Float4 determinant;
+        (void)Adjugate(LoadRows(*this), determinant);
+        return GetX(determinant);
     }
 
     void Matrix4x4F::Inverse()
     {
-        XMMATRIX matrix = XMLoadFloat4x4A(reinterpret_cast<const XMFLOAT4X4A*>(this->elements));
-        XMMATRIX invMatrix = XMMatrixInverse(nullptr, matrix);
-        XMStoreFloat4x4A(reinterpret_cast<XMFLOAT4X4A*>(this->elements), invMatrix);
+        StoreRows(*this, InverseRows(LoadRows(*this)));
     }
 
     Matrix4x4F Matrix4x4F::Inversed() const
     {
-        XMMATRIX matrix = XMLoadFloat4x4A(reinterpret_cast<const XMFLOAT4X4A*>(this->elements));
-        XMMATRIX invMatrix = XMMatrixInverse(nullptr, matrix);
-
         Matrix4x4F result;
-        XMStoreFloat4x4A(reinterpret_cast<XMFLOAT4X4A*>(&result), invMatrix);
+        StoreRows(result, InverseRows(LoadRows(*this)));
         return result;
     }
 
     Quaternion Matrix4x4F::GetRotation() const
     {
-        XMMATRIX matrix = XMLoadFloat4x4A(reinterpret_cast<const XMFLOAT4X4A*>(this->elements));
+        MatrixRows rows = LoadRows(*this);
 
-        XMVECTOR x = matrix.r[0];
-        XMVECTOR y = matrix.r[1];
-        XMVECTOR z = matrix.r[2];
+        Float4 x = Normalize3(rows.r[0]);
 
-        x = XMVector3Normalize(x);
+        Float4 y = NegMulAdd(x, Dot3(rows.r[1], x), rows.r[1]);
+        y = Normalize3(y);
 
-        XMVECTOR dotYX = XMVector3Dot(y, x);
-        y = XMVectorSubtract(y, XMVectorMultiply(x, dotYX));
-        y = XMVector3Normalize(y);
+        Float4 z = NegMulAdd(x, Dot3(rows.r[2], x), rows.r[2]);
+        z = NegMulAdd(y, Dot3(rows.r[2], y), z);
+        z = Normalize3(z);
 
-        XMVECTOR dotZX = XMVector3Dot(z, x);
-        XMVECTOR dotZY = XMVector3Dot(z, y);
-        z = XMVectorSubtract(z, XMVectorMultiply(x, dotZX));
-        z = XMVectorSubtract(z, XMVectorMultiply(y, dotZY));
-        z = XMVector3Normalize(z);
+        Matrix4x4F orthoMatrix = Identity;
+        Store3(orthoMatrix.elements, x);
+        Store3(orthoMatrix.elements + 4, y);
+        Store3(orthoMatrix.elements + 8, z);
 
-        XMMATRIX orthoMatrix;
-        orthoMatrix.r[0] = XMVectorSelect(g_XMIdentityR3, x, g_XMSelect1110);
-        orthoMatrix.r[1] = XMVectorSelect(g_XMIdentityR3, y, g_XMSelect1110);
-        orthoMatrix.r[2] = XMVectorSelect(g_XMIdentityR3, z, g_XMSelect1110);
-        orthoMatrix.r[3] = g_XMIdentityR3;
-
-        XMVECTOR quat = XMQuaternionRotationMatrix(orthoMatrix);
-        Quaternion result;        
-        XMStoreFloat4(reinterpret_cast<XMFLOAT4*>(&result), quat);
-
-        return result;
+        return Quaternion::FromRotationMatrix(orthoMatrix);
     }
 
     Vector3F Matrix4x4F::GetScale() const
     {
-        XMMATRIX matrix = XMLoadFloat4x4A(reinterpret_cast<const XMFLOAT4X4A*>(this->elements));
-
-        XMVECTOR x = XMVector3Length(matrix.r[0]);
-        XMVECTOR y = XMVector3Length(matrix.r[1]);
-        XMVECTOR z = XMVector3Length(matrix.r[2]);
+        MatrixRows rows = LoadRows(*this);
 
-        Vector3F scale;
-
-        XMVectorGetXPtr(&scale.x, x);
-        XMVectorGetXPtr(&scale.y, y);
-        XMVectorGetXPtr(&scale.z, z);
-
-        return scale;
+        return Vector3F {
+            GetX(Length3(rows.r[0])),
+            GetX(Length3(rows.r[1])),
+            GetX(Length3(rows.r[2]))
+        };
     }
 
     Vector3F Matrix4x4F::MultiplyPoint(Vector3F point) const
     {
-        XMVECTOR vec = XMLoadFloat3(reinterpret_cast<const XMFLOAT3*>(&point));
-        XMMATRIX matrix = XMLoadFloat4x4A(reinterpret_cast<const XMFLOAT4X4A*>(this->elements));
-        XMVECTOR transformedPoint = XMVector3TransformCoord(vec, matrix);
+        Float4 transformed = TransformByMatrix(Set(point.x, point.y, point.z, 1.0f), *this);
+        transformed = Div(transformed, SplatLane<3>(transformed));
 
         Vector3F result;
-        XMStoreFloat3(reinterpret_cast<XMFLOAT3*>(&result), transformedPoint);
+        Store3(result.data, transformed);
         return result;
     }
 
     Vector3F Matrix4x4F::MultiplyPointFast(Vector3F point) const
     {
-        XMVECTOR vec = XMLoadFloat3(reinterpret_cast<const XMFLOAT3*>(&point));
-        XMMATRIX matrix = XMLoadFloat4x4A(reinterpret_cast<const XMFLOAT4X4A*>(this->elements));
-        XMVECTOR transformedPoint = XMVector3Transform(vec, matrix);
+        Float4 transformed = TransformByMatrix(Set(point.x, point.y, point.z, 1.0f), *this);
 
         Vector3F result;
-        XMStoreFloat3(reinterpret_cast<XMFLOAT3*>(&result), transformedPoint);
+        Store3(result.data, transformed);
         return result;
     }
 
     Vector3F Matrix4x4F::MultiplyVector(Vector3F vector) const
     {
-        XMVECTOR vec = XMLoadFloat3(reinterpret_cast<const XMFLOAT3*>(&vector));
-        XMMATRIX matrix = XMLoadFloat4x4A(reinterpret_cast<const XMFLOAT4X4A*>(this->elements));
-        XMVECTOR transformedPoint = XMVector3TransformNormal(vec, matrix);
+        Float4 transformed = TransformByMatrix(Set(vector.x, vector.y, vector.z, 0.0f), *this);
 
         Vector3F result;
-        XMStoreFloat3(reinterpret_cast<XMFLOAT3*>(&result), transformedPoint);
+        Store3(result.data, transformed);
         return result;
     }
 
+    // CreateRotation implementation adapted from DirectXMath (MIT License). See THIRDPARTY.md
+    // Source: DirectX::XMMatrixRotationQuaternion
     Matrix4x4F Matrix4x4F::CreateRotation(Quaternion quat)
     {
-        XMVECTOR quatVec = XMLoadFloat4(reinterpret_cast<const XMFLOAT4*>(&quat));
-        XMMATRIX rotMatrix = XMMatrixRotationQuaternion(quatVec);
-
-        Matrix4x4F result;
-        XMStoreFloat4x4A(reinterpret_cast<XMFLOAT4X4A*>(&result), rotMatrix);
-        return result;
-    }    
+        float xx = quat.x * quat.x;
+        float yy = quat.y * quat.y;
+        float zz = quat.z * quat.z;
+        float xy = quat.x * quat.y;
+        float xz = quat.x * quat.z;
+        float yz = quat.y * quat.z;
+        float wx = quat.w * quat.x;
+        float wy = quat.w * quat.y;
+        float wz = quat.w * quat.z;
+
+        return Matrix4x4F {
+            1.0f - 2.0f * (yy + zz), 2.0f * (xy + wz), 2.0f * (xz - wy), 0.0f,
+            2.0f * (xy - wz), 1.0f - 2.0f * (xx + zz), 2.0f * (yz + wx), 0.0f,
+            2.0f * (xz + wy), 2.0f * (yz - wx), 1.0f - 2.0f * (xx + yy), 0.0f,
+            0.0f, 0.0f, 0.0f, 1.0f
+        };
+    }
 
+    // CreatePerspectiveProjection implementation adapted from DirectXMath (MIT License). See THIRDPARTY.md
+    // Source: DirectX::XMMatrixPerspectiveFovLH
     Matrix4x4F Matrix4x4F::CreatePerspectiveProjection(float fovY, float aspectRatio, float nearPlane, float farPlane)
     {
-        XMMATRIX matrix = XMMatrixPerspectiveFovLH(fovY, aspectRatio, nearPlane, farPlane);
-        Matrix4x4F result;
-        XMStoreFloat4x4A(reinterpret_cast<XMFLOAT4X4A*>(&result), matrix);
-        return result;
+        assert(nearPlane > 0.0f && farPlane > 0.0f);
+        assert(!Math::IsEqualApproximetly(fovY, 0.0f, 0.00001f * 2.0f));
+        assert(!Math::IsEqualApproximetly(aspectRatio, 0.0f, 0.00001f));
+        assert(!Math::IsEqualApproximetly(farPlane, nearPlane, 0.00001f));
+
+        float sinFov, cosFov;
+        Math::SinCos(sinFov, cosFov, RadianF(0.5f * fovY));
+
+        float height = cosFov / sinFov;
+        float width = height / aspectRatio;
+        float range = farPlane / (farPlane - nearPlane);
+
+        return Matrix4x4F {
+            width, 0.0f, 0.0f, 0.0f,
+            0.0f, height, 0.0f, 0.0f,
+            0.0f, 0.0f, range, 1.0f,
+            0.0f, 0.0f, -range * nearPlane, 0.0f
+        };
     }
 
+    // CreateOrthographicProjection implementation adapted from DirectXMath (MIT License). See THIRDPARTY.md
+    // Source: DirectX::XMMatrixOrthographicOffCenterLH
     Matrix4x4F Matrix4x4F::CreateOrthographicProjection(float left, float right, float top, float bottom, float nearPlane, float farPlane)
     {
-        XMMATRIX matrix = XMMatrixOrthographicOffCenterLH(left, right, bottom, top, nearPlane, farPlane);
-        Matrix4x4F result;
-        XMStoreFloat4x4A(reinterpret_cast<XMFLOAT4X4A*>(&result), matrix);
-        return result;
+        assert(!Math::IsEqualApproximetly(right, left, 0.00001f));
+        assert(!Math::IsEqualApproximetly(top, bottom, 0.00001f));
+        assert(!Math::IsEqualApproximetly(farPlane, nearPlane, 0.00001f));
+
+        float invWidth = 1.0f / (right - left);
+        float invHeight = 1.0f / (top - bottom);
+        float range = 1.0f / (farPlane - nearPlane);
+
+        return Matrix4x4F {
+            invWidth + invWidth, 0.0f, 0.0f, 0.0f,
+            0.0f, invHeight + invHeight, 0.0f, 0.0f,
+            0.0f, 0.0f, range, 0.0f,
+            -(left + right) * invWidth, -(top + bottom) * invHeight, -range * nearPlane, 1.0f
+        };
     }
 
+    // CreateLookAt implementation adapted from DirectXMath (MIT License). See THIRDPARTY.md
+    // Source: DirectX::XMMatrixLookToLH
     Matrix4x4F Matrix4x4F::CreateLookAt(Vector3F eyePos, Vector3F targetPos, Vector3F worldUp)
     {
         Vector3F direction = Vector3F::Direction(eyePos, targetPos);
 
-        XMVECTOR eyeVec = XMLoadFloat3(reinterpret_cast<const XMFLOAT3*>(&eyePos));
-        XMVECTOR dirVec = XMLoadFloat3(reinterpret_cast<const XMFLOAT3*>(&direction));
-        XMVECTOR upVec = XMLoadFloat3(reinterpret_cast<const XMFLOAT3*>(&worldUp));
+        Float4 eye = Load3(eyePos.data);
+        Float4 forward = Normalize3(Load3(direction.data));
+        Float4 right = Normalize3(Cross3(Load3(worldUp.data), forward));
+        Float4 up = Cross3(forward, right);
+
+        Float4 negEye = Sub(Zero4(), eye);
+
+        Matrix4x4F result {
+            Vector4F(0.0f),
+            Vector4F(0.0f),
+            Vector4F(0.0f),
+            Vector4F(GetX(Dot3(right, negEye)), GetX(Dot3(up, negEye)), GetX(Dot3(forward, negEye)), 1.0f)
+        };
+
+        Store3(result.elements, right);
+        Store3(result.elements + 4, up);
+        Store3(result.elements + 8, forward);
+
+        // Basis vectors were written as rows, the view matrix needs them as columns
+        std::swap(result.m01, result.m10);
+        std::swap(result.m02, result.m20);
+        std::swap(result.m12, result.m21);
 
-        XMMATRIX viewMatrix = XMMatrixLookToLH(eyeVec, dirVec, upVec);
-        Matrix4x4F result;
-        XMStoreFloat4x4A(reinterpret_cast<XMFLOAT4X4A*>(&result), viewMatrix);
         return result;
     }
 
     Matrix4x4F Matrix4x4F::CreateTRS(Vector3F translation, Quaternion rotation, Vector3F scale)
     {
-        XMVECTOR translationVec = XMLoadFloat3(reinterpret_cast<const XMFLOAT3*>(&translation));
-        XMVECTOR rotationVec = XMLoadFloat4(reinterpret_cast<const XMFLOAT4*>(&rotation));
+        Matrix4x4F result = CreateRotation(rotation);
+        MatrixRows rows = LoadRows(result);
+
+        rows.r[0] = Mul(rows.r[0], Splat(scale.x));
+        rows.r[1] = Mul(rows.r[1], Splat(scale.y));
+        rows.r[2] = Mul(rows.r[2], Splat(scale.z));
+        rows.r[3] = Set(translation.x, translation.y, translation.z, 1.0f);
+
+        StoreRows(result, rows);
+        return result;
+    }
+
+    Matrix4x4F Matrix4x4F::operator*(const Matrix4x4F& other) const
+    {
+        MatrixRows a = LoadRows(*this);
+        MatrixRows b = LoadRows(other);
+
+        MatrixRows result;
+
+        for (int32 i = 0; i < RowCount; i++)
+            result.r[i] = Simd::Transform(a.r[i], b.r);
+
+        Matrix4x4F matrix;
+        StoreRows(matrix, result);
+        return matrix;
+    }
+#endif
+
+    // ─────────────────────────────────────────────
+    // Batch transforms
+    // ─────────────────────────────────────────────
+
+    namespace
+    {
+        static_assert(sizeof(Vector3F) == 3 * sizeof(float), "Batch transforms expect tightly packed Vector3F");
+
+        constexpr size_t BatchWidth = 8;
+
+        enum class BatchTransformKind
+        {
+            Point,
+            PointFast,
+            Vector
+        };
+
+        // Every matrix element splatted across 8 lanes
+        struct SplattedMatrix
+        {
+            Float8 m[4][4];
+
+            explicit SplattedMatrix(const Matrix4x4F& matrix)
+            {
+                for (int32 row = 0; row < Matrix4x4F::RowCount; row++)
+                {
+                    for (int32 column = 0; column < Matrix4x4F::ColumnCount; column++)
+                        m[row][column] = Splat8(matrix[row, column]);
+                }
+            }
+        };
+
+        template<BatchTransformKind Kind>
+        void Transform8(const SplattedMatrix& matrix, Float8& x, Float8& y, Float8& z)
+        {
+            const auto& m = matrix.m;
+
+            Float8 rx, ry, rz;
+
+            if constexpr (Kind == BatchTransformKind::Vector)
+            {
+                rx = Mul(x, m[0][0]);
+                ry = Mul(x, m[0][1]);
+                rz = Mul(x, m[0][2]);
+            }
+            else
+            {
+                rx = MulAdd(x, m[0][0], m[3][0]);
+                ry = MulAdd(x, m[0][1], m[3][1]);
+                rz = MulAdd(x, m[0][2], m[3][2]);
+            }
+
+            rx = MulAdd(z, m[2][0], MulAdd(y, m[1][0], rx));
+            ry = MulAdd(z, m[2][1], MulAdd(y, m[1][1], ry));
+            rz = MulAdd(z, m[2][2], MulAdd(y, m[1][2], rz));
+
+            if constexpr (Kind == BatchTransformKind::Point)
+            {
+                Float8 w = MulAdd(z, m[2][3], MulAdd(y, m[1][3], MulAdd(x, m[0][3], m[3][3])));
+                Float8 invW = Div(Splat8(1.0f), w);
+                rx = Mul(rx, invW);
+                ry = Mul(ry, invW);
+                rz = Mul(rz, invW);
+            }
+
+            x = rx;
+            y = ry;
+            z = rz;
+        }
+
+        template<BatchTransformKind Kind>
+        void TransformBatch(const Matrix4x4F& matrix, std::span<const Vector3F> source, std::span<Vector3F> destination)
+        {
+            assert(source.size() == destination.size());
+
+            SplattedMatrix m(matrix);
+            const float* in = reinterpret_cast<const float*>(source.data());
+            float* out = reinterpret_cast<float*>(destination.data());
+
+            size_t count = source.size();
+            size_t i = 0;
+            Float8 x, y, z;
+
+            for (; i + BatchWidth <= count; i += BatchWidth)
+            {
+                Load3x8(in + i * 3, x, y, z);
+                Transform8<Kind>(m, x, y, z);
+                Store3x8(out + i * 3, x, y, z);
+            }
+
+            // Tail goes through a zero padded stack buffer so the kernel never touches memory past the end.
+            // Padding lanes are discarded; for projective points they may divide by zero, which is harmless
+            if (size_t remaining = count - i; remaining > 0)
+            {
+                float tail[BatchWidth * 3] = { };
+                std::memcpy(tail, in + i * 3, remaining * 3 * sizeof(float));
+
+                Load3x8(tail, x, y, z);
+                Transform8<Kind>(m, x, y, z);
+                Store3x8(tail, x, y, z);
+
+                std::memcpy(out + i * 3, tail, remaining * 3 * sizeof(float));
+            }
+        }
+
+        template<BatchTransformKind Kind>
+        void TransformBatch(const Matrix4x4F& matrix, ConstVector3FStream source, Vector3FStream destination)
+        {
+            assert(source.Size() == destination.Size());
+
+            SplattedMatrix m(matrix);
+
+            size_t count = source.Size();
+            size_t i = 0;
+
+            for (; i + BatchWidth <= count; i += BatchWidth)
+            {
+                Float8 x = Load8(source.x.data() + i);
+                Float8 y = Load8(source.y.data() + i);
+                Float8 z = Load8(source.z.data() + i);
+
+                Transform8<Kind>(m, x, y, z);
+
+                Store8(destination.x.data() + i, x);
+                Store8(destination.y.data() + i, y);
+                Store8(destination.z.data() + i, z);
+            }
+
+            if (size_t remaining = count - i; remaining > 0)
+            {
+                float tail[3][BatchWidth] = { };
+                std::memcpy(tail[0], source.x.data() + i, remaining * sizeof(float));
+                std::memcpy(tail[1], source.y.data() + i, remaining * sizeof(float));
+                std::memcpy(tail[2], source.z.data() + i, remaining * sizeof(float));
+
+                Float8 x = Load8(tail[0]);
+                Float8 y = Load8(tail[1]);
+                Float8 z = Load8(tail[2]);
+
+                Transform8<Kind>(m, x, y, z);
+
+                Store8(tail[0], x);
+                Store8(tail[1], y);
+                Store8(tail[2], z);
+
+                std::memcpy(destination.x.data() + i, tail[0], remaining * sizeof(float));
+                std::memcpy(destination.y.data() + i, tail[1], remaining * sizeof(float));
+                std::memcpy(destination.z.data() + i, tail[2], remaining * sizeof(float));
+            }
+        }
+    }
+
+    void Matrix4x4F::MultiplyPoints(std::span<const Vector3F> points, std::span<Vector3F> results) const
+    {
+        TransformBatch<BatchTransformKind::Point>(*this, points, results);
+    }
+
+    void Matrix4x4F::MultiplyPointsFast(std::span<const Vector3F> points, std::span<Vector3F> results) const
+    {
+        TransformBatch<BatchTransformKind::PointFast>(*this, points, results);
+    }
+
+    void Matrix4x4F::MultiplyVectors(std::span<const Vector3F> vectors, std::span<Vector3F> results) const
+    {
+        TransformBatch<BatchTransformKind::Vector>(*this, vectors, results);
+    }
+
+    void Matrix4x4F::MultiplyPoints(ConstVector3FStream points, Vector3FStream results) const
+    {
+        TransformBatch<BatchTransformKind::Point>(*this, points, results);
+    }
+
+    void Matrix4x4F::MultiplyPointsFast(ConstVector3FStream points, Vector3FStream results) const
+    {
+        TransformBatch<BatchTransformKind::PointFast>(*this, points, results);
+    }
+
+    void Matrix4x4F::MultiplyVectors(ConstVector3FStream vectors, Vector3FStream results) const
+    {
+        TransformBatch<BatchTransformKind::Vector>(*this, vectors, results);
+    }
+
+    // ─────────────────────────────────────────────
+    // Affine and rigid fast paths
+    // ─────────────────────────────────────────────
+
+    namespace
+    {
+        // Transposed 3x3 part, the last column and the translation row are zero
+        MatrixRows Transpose3x3(Float4 row0, Float4 row1, Float4 row2)
+        {
+            Float4 zero = Zero4();
+            Float4 xy01 = Shuffle<0, 1, 0, 1>(row0, row1);
+            Float4 zw01 = Shuffle<2, 3, 2, 3>(row0, row1);
+            Float4 xy2 = Shuffle<0, 1, 0, 1>(row2, zero);
+            Float4 zw2 = Shuffle<2, 3, 2, 3>(row2, zero);
+
+            return MatrixRows { {
+                Shuffle<0, 2, 0, 2>(xy01, xy2),
+                Shuffle<1, 3, 1, 3>(xy01, xy2),
+                Shuffle<0, 2, 0, 2>(zw01, zw2),
+                zero
+            } };
+        }
+
+        // Fills the translation row of an inverse from the original translation: (-translation * inverse3x3, 1)
+        void SetInverseTranslation(MatrixRows& inverse, Float4 translation)
+        {
+            Float4 rotated = Mul(SplatLane<0>(translation), inverse.r[0]);
+            rotated = MulAdd(SplatLane<1>(translation), inverse.r[1], rotated);
+            rotated = MulAdd(SplatLane<2>(translation), inverse.r[2], rotated);
+
+            inverse.r[3] = Sub(Set(0.0f, 0.0f, 0.0f, 1.0f), rotated);
+        }
+
+        MatrixRows AffineInverseRows(const MatrixRows& m)
+        {
+            // The inverse of a 3x3 matrix has the cross products of its rows as columns, divided by the determinant
+            Float4 cross12 = Cross3(m.r[1], m.r[2]);
+            Float4 cross20 = Cross3(m.r[2], m.r[0]);
+            Float4 cross01 = Cross3(m.r[0], m.r[1]);
+            Float4 invDeterminant = Div(Splat(1.0f), Dot3(m.r[0], cross12));
+
+            MatrixRows inverse = Transpose3x3(cross12, cross20, cross01);
+
+            for (int32 i = 0; i < 3; i++)
+                inverse.r[i] = Mul(inverse.r[i], invDeterminant);
+
+            SetInverseTranslation(inverse, m.r[3]);
+            return inverse;
+        }
+
+        MatrixRows RigidInverseRows(const MatrixRows& m)
+        {
+            MatrixRows inverse = Transpose3x3(m.r[0], m.r[1], m.r[2]);
+            SetInverseTranslation(inverse, m.r[3]);
+            return inverse;
+        }
+
+        // Rows 0-2 of an affine matrix have w = 0 and row 3 has w = 1, so the last column of b is never needed
+        Float4 MultiplyAffineRow(Float4 row, const MatrixRows& b)
+        {
+            Float4 result = Mul(SplatLane<0>(row), b.r[0]);
+            result = MulAdd(SplatLane<1>(row), b.r[1], result);
+            return MulAdd(SplatLane<2>(row), b.r[2], result);
+        }
+
+        MatrixRows MultiplyAffineRows(const MatrixRows& a, const MatrixRows& b)
+        {
+            return MatrixRows { {
+                MultiplyAffineRow(a.r[0], b),
+                MultiplyAffineRow(a.r[1], b),
+                MultiplyAffineRow(a.r[2], b),
+                Add(MultiplyAffineRow(a.r[3], b), b.r[3])
+            } };
+        }
+    }
 
-        XMMATRIX translationMatrix = XMMatrixTranslationFromVector(translationVec);
-        XMMATRIX rotationMatrix = XMMatrixRotationQuaternion(rotationVec);
-        XMMATRIX scaleMatrix = XMMatrixScaling(scale.x, scale.y, scale.z);
+    void Matrix4x4F::AffineInverse()
+    {
+        assert(IsAffine());
+        StoreRows(*this, AffineInverseRows(LoadRows(*this)));
+    }
 
-        XMMATRIX trsMatrix = scaleMatrix * rotationMatrix * translationMatrix;
+    Matrix4x4F Matrix4x4F::AffineInversed() const
+    {
+        assert(IsAffine());
 
         Matrix4x4F result;
-        XMStoreFloat4x4A(reinterpret_cast<XMFLOAT4X4A*>(&result), trsMatrix);
+        StoreRows(result, AffineInverseRows(LoadRows(*this)));
         return result;
     }
 
-    Matrix4x4F Matrix4x4F::operator*(const Matrix4x4F& other) const
+    void Matrix4x4F::RigidInverse()
     {
-        XMMATRIX matrixA = XMLoadFloat4x4A(reinterpret_cast<const XMFLOAT4X4A*>(this->elements));
-        XMMATRIX matrixB = XMLoadFloat4x4A(reinterpret_cast<const XMFLOAT4X4A*>(other.elements));
+        assert(IsAffine());
+        StoreRows(*this, RigidInverseRows(LoadRows(*this)));
+    }
 
-        XMMATRIX resultMatrix = matrixA * matrixB;
+    Matrix4x4F Matrix4x4F::RigidInversed() const
+    {
+        assert(IsAffine());
 
         Matrix4x4F result;
-        XMStoreFloat4x4A(reinterpret_cast<XMFLOAT4X4A*>(&result), resultMatrix);
+        StoreRows(result, RigidInverseRows(LoadRows(*this)));
         return result;
     }
 
-    Matrix4x4F& Matrix4x4F::operator*=(const Matrix4x4F& other)
+    Matrix4x4F Matrix4x4F::MultiplyAffine(const Matrix4x4F& other) const
     {
-        *this = *this * other;
-        return *this;
+        assert(IsAffine() && other.IsAffine());
+
+        Matrix4x4F result;
+        StoreRows(result, MultiplyAffineRows(LoadRows(*this), LoadRows(other)));
+        return result;
+    }
+
+    void Matrix4x4F::AffineInverse(std::span<const Matrix4x4F> matrices, std::span<Matrix4x4F> results)
+    {
+        assert(matrices.size() == results.size());
+
+        for (size_t i = 0; i < matrices.size(); i++)
+        {
+            assert(matrices[i].IsAffine());
+            StoreRows(results[i], AffineInverseRows(LoadRows(matrices[i])));
+        }
+    }
+
+    void Matrix4x4F::RigidInverse(std::span<const Matrix4x4F> matrices, std::span<Matrix4x4F> results)
+    {
+        assert(matrices.size() == results.size());
+
+        for (size_t i = 0; i < matrices.size(); i++)
+        {
+            assert(matrices[i].IsAffine());
+            StoreRows(results[i], RigidInverseRows(LoadRows(matrices[i])));
+        }
+    }
+
+    void Matrix4x4F::MultiplyAffine(std::span<const Matrix4x4F> left, std::span<const Matrix4x4F> right, std::span<Matrix4x4F> results)
+    {
+        assert(left.size() == right.size() && left.size() == results.size());
+
+        for (size_t i = 0; i < left.size(); i++)
+        {
+            assert(left[i].IsAffine() && right[i].IsAffine());
+            StoreRows(results[i], MultiplyAffineRows(LoadRows(left[i]), LoadRows(right[i])));
+        }
+    }
+
+    void Matrix4x4F::MultiplyAffine(std::span<const Matrix4x4F> locals, const Matrix4x4F& parent, std::span<Matrix4x4F> results)
+    {
+        assert(locals.size() == results.size());
+        assert(parent.IsAffine());
+
+        MatrixRows parentRows = LoadRows(parent);
+
+        for (size_t i = 0; i < locals.size(); i++)
+        {
+            assert(locals[i].IsAffine());
+            StoreRows(results[i], MultiplyAffineRows(LoadRows(locals[i]), parentRows));
+        }
+    }
+
+    // ─────────────────────────────────────────────
+    // Decomposition
+    // ─────────────────────────────────────────────
+
+    void Matrix4x4F::Decompose(Vector3F& translation, Quaternion& rotation, Vector3F& scale) const
+    {
+        assert(IsAffine());
+
+        MatrixRows rows = LoadRows(*this);
+        Matrix4x4F rotationMatrix = Identity;
+
+        Float4 epsilon = Splat(Math::Epsilon);
+        float lengths[3];
+
+        for (int32 i = 0; i < 3; i++)
+        {
+            Float4 length = Length3(rows.r[i]);
+
+            // Zero scale leaves no rotation to recover, the axis is kept as is instead of dividing by zero
+            Store3(rotationMatrix.elements + i * 4, Select(CompareGreater(length, epsilon), Div(rows.r[i], length), rows.r[i]));
+            lengths[i] = GetX(length);
+        }
+
+        scale = Vector3F(lengths[0], lengths[1], lengths[2]);
+
+        if (GetX(Dot3(rows.r[0], Cross3(rows.r[1], rows.r[2]))) < 0.0f)
+        {
+            scale.x = -scale.x;
+            rotationMatrix.m00 = -rotationMatrix.m00;
+            rotationMatrix.m01 = -rotationMatrix.m01;
+            rotationMatrix.m02 = -rotationMatrix.m02;
+        }
+
+        translation = GetTranslation();
+        rotation = Quaternion::FromRotationMatrix(rotationMatrix).Normalized();
+    }
+
+    namespace
+    {
+        // Elements 0-2, 4-6, 8-10 and 12-14 of 8 affine matrices, one register per element
+        struct AffineMatrix8
+        {
+            Float8 m[4][3];
+        };
+
+        // Matrices go through a stack buffer in element-major order, which turns the transpose into plain copies
+        template<bool Partial>
+        AffineMatrix8 LoadMatrices(const Block8<Partial>& block, std::span<const Matrix4x4F> matrices)
+        {
+            float buffer[4][3][BlockWidth] = { };
+
+            for (size_t i = 0; i < block.count; i++)
+            {
+                const Matrix4x4F& matrix = matrices[block.offset + i];
+                assert(matrix.IsAffine());
+
+                for (int32 row = 0; row < 4; row++)
+                {
+                    for (int32 column = 0; column < 3; column++)
+                        buffer[row][column][i] = matrix.rows[row][column];
+                }
+            }
+
+            AffineMatrix8 result;
+
+            for (int32 row = 0; row < 4; row++)
+            {
+                for (int32 column = 0; column < 3; column++)
+                    result.m[row][column] = Load8(buffer[row][column]);
+            }
+
+            return result;
+        }
+
+        template<bool Partial>
+        void StoreMatrices(const Block8<Partial>& block, const AffineMatrix8& value, std::span<Matrix4x4F> matrices)
+        {
+            float buffer[4][3][BlockWidth];
+
+            for (int32 row = 0; row < 4; row++)
+            {
+                for (int32 column = 0; column < 3; column++)
+                    Store8(buffer[row][column], value.m[row][column]);
+            }
+
+            for (size_t i = 0; i < block.count; i++)
+            {
+                Matrix4x4F& matrix = matrices[block.offset + i];
+
+                for (int32 row = 0; row < 4; row++)
+                    matrix.rows[row] = Vector4F(buffer[row][0][i], buffer[row][1][i], buffer[row][2][i], row == 3 ? 1.0f : 0.0f);
+            }
+        }
+
+        // Same math as CreateTRS
+        AffineMatrix8 ComposeTRS8(Float8 tx, Float8 ty, Float8 tz, Float8 qx, Float8 qy, Float8 qz, Float8 qw, Float8 sx, Float8 sy, Float8 sz)
+        {
+            Float8 two = Splat8(2.0f);
+            Float8 one = Splat8(1.0f);
+
+            Float8 x2 = Mul(qx, two);
+            Float8 y2 = Mul(qy, two);
+            Float8 z2 = Mul(qz, two);
+
+            Float8 xx = Mul(qx, x2);
+            Float8 yy = Mul(qy, y2);
+            Float8 zz = Mul(qz, z2);
+            Float8 xy = Mul(qx, y2);
+            Float8 xz = Mul(qx, z2);
+            Float8 yz = Mul(qy, z2);
+            Float8 wx = Mul(qw, x2);
+            Float8 wy = Mul(qw, y2);
+            Float8 wz = Mul(qw, z2);
+
+            AffineMatrix8 result;
+
+            result.m[0][0] = Mul(Sub(one, Add(yy, zz)), sx);
+            result.m[0][1] = Mul(Add(xy, wz), sx);
+            result.m[0][2] = Mul(Sub(xz, wy), sx);
+
+            result.m[1][0] = Mul(Sub(xy, wz), sy);
+            result.m[1][1] = Mul(Sub(one, Add(xx, zz)), sy);
+            result.m[1][2] = Mul(Add(yz, wx), sy);
+
+            result.m[2][0] = Mul(Add(xz, wy), sz);
+            result.m[2][1] = Mul(Sub(yz, wx), sz);
+            result.m[2][2] = Mul(Sub(one, Add(xx, yy)), sz);
+
+            result.m[3][0] = tx;
+            result.m[3][1] = ty;
+            result.m[3][2] = tz;
+
+            return result;
+        }
+
+        // Same decision tree as Quaternion::FromRotationMatrix, all four candidates are computed and the right one selected per lane
+        void QuaternionFromRotation8(const Float8 r[3][3], Float8& qx, Float8& qy, Float8& qz, Float8& qw)
+        {
+            Float8 zero = Zero8();
+            Float8 one = Splat8(1.0f);
+
+            Float8 dif10 = Sub(r[1][1], r[0][0]);
+            Float8 sum10 = Add(r[1][1], r[0][0]);
+            Float8 omr22 = Sub(one, r[2][2]);
+            Float8 opr22 = Add(one, r[2][2]);
+
+            // lowerHalf: x or y is the largest component, xLargest and zLargest pick within each half
+            Float8 lowerHalf = CompareLessEqual(r[2][2], zero);
+            Float8 xLargest = CompareLessEqual(dif10, zero);
+            Float8 zLargest = CompareLessEqual(sum10, zero);
+
+            Float8 fourSqr = Select(lowerHalf,
+                Select(xLargest, Sub(omr22, dif10), Add(omr22, dif10)),
+                Select(zLargest, Sub(opr22, sum10), Add(opr22, sum10)));
+
+            Float8 inv = Div(Splat8(0.5f), Sqrt(fourSqr));
+
+            Float8 sum01 = Add(r[0][1], r[1][0]);
+            Float8 sum02 = Add(r[0][2], r[2][0]);
+            Float8 sum12 = Add(r[1][2], r[2][1]);
+            Float8 dif12 = Sub(r[1][2], r[2][1]);
+            Float8 dif20 = Sub(r[2][0], r[0][2]);
+            Float8 dif01 = Sub(r[0][1], r[1][0]);
+
+            auto pick = [&](Float8 ifX, Float8 ifY, Float8 ifZ, Float8 ifW)
+                {
+                    return Mul(Select(lowerHalf, Select(xLargest, ifX, ifY), Select(zLargest, ifZ, ifW)), inv);
+                };
+
+            qx = pick(fourSqr, sum01, sum02, dif12);
+            qy = pick(sum01, fourSqr, sum12, dif20);
+            qz = pick(sum02, sum12, fourSqr, dif01);
+            qw = pick(dif12, dif20, dif01, fourSqr);
+
+            // Same as the Normalized() call in Decompose
+            Float8 lengthSquared = MulAdd(qw, qw, MulAdd(qz, qz, MulAdd(qy, qy, Mul(qx, qx))));
+            Float8 scale = Select(CompareGreater(lengthSquared, Splat8(Math::Epsilon)), Div(one, Sqrt(lengthSquared)), one);
+
+            qx = Mul(qx, scale);
+            qy = Mul(qy, scale);
+            qz = Mul(qz, scale);
+            qw = Mul(qw, scale);
+        }
+    }
+
+    void Matrix4x4F::ComposeTRS(ConstVector3FStream translations, ConstQuaternionStream rotations, ConstVector3FStream scales, std::span<Matrix4x4F> results)
+    {
+        assert(translations.Size() == rotations.Size() && translations.Size() == scales.Size() && translations.Size() == results.size());
+
+        ForEachBlock8(results.size(), [&](auto block)
+            {
+                AffineMatrix8 matrices = ComposeTRS8(
+                    block.Load(translations.x.data()), block.Load(translations.y.data()), block.Load(translations.z.data()),
+                    block.Load(rotations.x.data()), block.Load(rotations.y.data()), block.Load(rotations.z.data()), block.Load(rotations.w.data()),
+                    block.Load(scales.x.data()), block.Load(scales.y.data()), block.Load(scales.z.data()));
+
+                StoreMatrices(block, matrices, results);
+            });
+    }
+
+    void Matrix4x4F::DecomposeTRS(std::span<const Matrix4x4F> matrices, Vector3FStream translations, QuaternionStream rotations, Vector3FStream scales)
+    {
+        assert(matrices.size() == translations.Size() && matrices.size() == rotations.Size() && matrices.size() == scales.Size());
+
+        ForEachBlock8(matrices.size(), [&](auto block)
+            {
+                AffineMatrix8 matrix = LoadMatrices(block, matrices);
+                const auto& m = matrix.m;
+
+                Float8 scale[3];
+
+                for (int32 row = 0; row < 3; row++)
+                    scale[row] = Sqrt(MulAdd(m[row][2], m[row][2], MulAdd(m[row][1], m[row][1], Mul(m[row][0], m[row][0]))));
+
+                // Determinant of the 3x3 part, row0 . (row1 x row2), its sign goes to the x scale
+                Float8 cross0 = NegMulAdd(m[1][2], m[2][1], Mul(m[1][1], m[2][2]));
+                Float8 cross1 = NegMulAdd(m[1][0], m[2][2], Mul(m[1][2], m[2][0]));
+                Float8 cross2 = NegMulAdd(m[1][1], m[2][0], Mul(m[1][0], m[2][1]));
+                Float8 determinant = MulAdd(m[0][2], cross2, MulAdd(m[0][1], cross1, Mul(m[0][0], cross0)));
+
+                scale[0] = BitXor(scale[0], BitAnd(CompareLess(determinant, Zero8()), Splat8(-0.0f)));
+
+                Float8 rotation[3][3];
+
+                for (int32 row = 0; row < 3; row++)
+                {
+                    Float8 valid = CompareGreater(Simd::Abs(scale[row]), Splat8(Math::Epsilon));
+                    Float8 invScale = Select(valid, Div(Splat8(1.0f), scale[row]), Splat8(1.0f));
+
+                    for (int32 column = 0; column < 3; column++)
+                        rotation[row][column] = Mul(m[row][column], invScale);
+                }
+
+                Float8 qx, qy, qz, qw;
+                QuaternionFromRotation8(rotation, qx, qy, qz, qw);
+
+                block.Store(translations.x.data(), m[3][0]);
+                block.Store(translations.y.data(), m[3][1]);
+                block.Store(translations.z.data(), m[3][2]);
+
+                block.Store(rotations.x.data(), qx);
+                block.Store(rotations.y.data(), qy);
+                block.Store(rotations.z.data(), qz);
+                block.Store(rotations.w.data(), qw);
+
+                block.Store(scales.x.data(), scale[0]);
+                block.Store(scales.y.data(), scale[1]);
+                block.Store(scales.z.data(), scale[2]);
+            });
     }
 }
\ No newline at end of file
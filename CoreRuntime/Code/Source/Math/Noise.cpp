@@ -0,0 +1,368 @@
+﻿#include "ByteEngine/Math/Noise.h"
+#include "Math/ParallelFor.h"
+#include "Math/Simd/SimdMath.h"
+
+using namespace ByteEngine::Math::Simd;
+
+namespace ByteEngine::Math
+{
+    namespace
+    {
+        // Lattice coordinates are multiplied by large primes and combined with xor, which avoids permutation tables
+        constexpr int32 Primes[4] = { 501125321, 1136930381, 1720413743, 1066037191 };
+
+        // Corner falloff radius squared of simplex noise. 0.5 keeps the noise continuous in every dimension
+        constexpr float SimplexRadius = 0.5f;
+
+        template<int32 Dimension>
+        struct Lattice;
+
+        template<>
+        struct Lattice<2>
+        {
+            // 8 unit vectors at 45 degree steps, one array per axis for gathers
+            static constexpr int32 GradientShift = 29;
+            static constexpr float Gradients[2][8] = {
+                { 1.0f, 0.70710678f, 0.0f, -0.70710678f, -1.0f, -0.70710678f, 0.0f, 0.70710678f },
+                { 0.0f, 0.70710678f, 1.0f, 0.70710678f, 0.0f, -0.70710678f, -1.0f, -0.70710678f }
+            };
+
+            // (sqrt(3) - 1) / 2 and (3 - sqrt(3)) / 6
+            static constexpr float SimplexSkew = 0.36602540f;
+            static constexpr float SimplexUnskew = 0.21132487f;
+
+            static constexpr float PerlinScale = 1.4142135f;
+            static constexpr float SimplexScale = 99.2f;
+        };
+
+        template<>
+        struct Lattice<3>
+        {
+            // Edge midpoints of a cube, the first four repeated to fill 16 entries
+            static constexpr int32 GradientShift = 28;
+            static constexpr float Gradients[3][16] = {
+                { 1, -1, 1, -1, 1, -1, 1, -1, 0, 0, 0, 0, 1, -1, 1, -1 },
+                { 1, 1, -1, -1, 0, 0, 0, 0, 1, -1, 1, -1, 1, 1, -1, -1 },
+                { 0, 0, 0, 0, 1, 1, -1, -1, 1, 1, -1, -1, 0, 0, 0, 0 }
+            };
+
+            static constexpr float SimplexSkew = 1.0f / 3.0f;
+            static constexpr float SimplexUnskew = 1.0f / 6.0f;
+
+            static constexpr float PerlinScale = 0.96f;
+            static constexpr float SimplexScale = 75.0f;
+        };
+
+        template<>
+        struct Lattice<4>
+        {
+            // Edge midpoints of a tesseract, all permutations of (0, +-1, +-1, +-1)
+            static constexpr int32 GradientShift = 27;
+            static constexpr float Gradients[4][32] = {
+                { 0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1, 1, -1, -1, -1, -1, 1, 1, 1, 1, -1, -1, -1, -1, 1, 1, 1, 1, -1, -1, -1, -1 },
+                { 1, 1, 1, 1, -1, -1, -1, -1, 0, 0, 0, 0, 0, 0, 0, 0, 1, 1, -1, -1, 1, 1, -1, -1, 1, 1, -1, -1, 1, 1, -1, -1 },
+                { 1, 1, -1, -1, 1, 1, -1, -1, 1, 1, -1, -1, 1, 1, -1, -1, 0, 0, 0, 0, 0, 0, 0, 0, 1, -1, 1, -1, 1, -1, 1, -1 },
+                { 1, -1, 1, -1, 1, -1, 1, -1, 1, -1, 1, -1, 1, -1, 1, -1, 1, -1, 1, -1, 1, -1, 1, -1, 0, 0, 0, 0, 0, 0, 0, 0 }
+            };
+
+            // (sqrt(5) - 1) / 4 and (5 - sqrt(5)) / 20
+            static constexpr float SimplexSkew = 0.30901699f;
+            static constexpr float SimplexUnskew = 0.13819660f;
+
+            static constexpr float PerlinScale = 0.84f;
+            static constexpr float SimplexScale = 62.0f;
+        };
+
+        Int8 Hash(Int8 value)
+        {
+            value = Mul(value, SplatInt8(0x27D4EB2D));
+            return BitXor(value, ShiftRight<15>(value));
+        }
+
+        // Dot product of the corner gradient with the offset from the corner. The top bits of the hash select the gradient
+        template<int32 Dimension>
+        Float8 GradientDot(Int8 hash, const Float8 (&offset)[Dimension])
+        {
+            Int8 index = ShiftRight<Lattice<Dimension>::GradientShift>(hash);
+            Float8 dot = Zero8();
+
+            for (int32 axis = 0; axis < Dimension; axis++)
+                dot = MulAdd(Gather(Lattice<Dimension>::Gradients[axis], index), offset[axis], dot);
+
+            return dot;
+        }
+
+        // 6t^5 - 15t^4 + 10t^3, zero first and second derivative at the lattice points
+        Float8 Fade(Float8 t)
+        {
+            Float8 p = MulAdd(t, Splat8(6.0f), Splat8(-15.0f));
+            p = MulAdd(p, t, Splat8(10.0f));
+            return Mul(Mul(p, t), Mul(t, t));
+        }
+
+        Float8 Lerp(Float8 a, Float8 b, Float8 t)
+        {
+            return MulAdd(Sub(b, a), t, a);
+        }
+
+        // Shared by Value and Perlin: evaluates every corner of the lattice cell, then interpolates one axis at a time
+        template<int32 Dimension, bool Gradient>
+        Float8 LatticeNoise(const Float8 (&position)[Dimension], Int8 seed)
+        {
+            constexpr int32 CornerCount = 1 << Dimension;
+
+            Float8 offsets[2][Dimension];
+            Float8 fades[Dimension];
+            Int8 primed[2][Dimension];
+
+            for (int32 axis = 0; axis < Dimension; axis++)
+            {
+                Float8 cell = Floor(position[axis]);
+                Int8 prime = SplatInt8(Primes[axis]);
+
+                offsets[0][axis] = Sub(position[axis], cell);
+                offsets[1][axis] = Sub(offsets[0][axis], Splat8(1.0f));
+                fades[axis] = Fade(offsets[0][axis]);
+                primed[0][axis] = Mul(ConvertToInt(cell), prime);
+                primed[1][axis] = Add(primed[0][axis], prime);
+            }
+
+            Float8 values[CornerCount];
+
+            for (int32 corner = 0; corner < CornerCount; corner++)
+            {
+                Int8 hash = seed;
+                Float8 offset[Dimension];
+
+                for (int32 axis = 0; axis < Dimension; axis++)
+                {
+                    int32 side = (corner >> axis) & 1;
+                    hash = BitXor(hash, primed[side][axis]);
+                    offset[axis] = offsets[side][axis];
+                }
+
+                hash = Hash(hash);
+
+                if constexpr (Gradient)
+                    values[corner] = GradientDot<Dimension>(hash, offset);
+                else
+                    values[corner] = Mul(ConvertToFloat(hash), Splat8(1.0f / 2147483648.0f));
+            }
+
+            // Bit 0 of the corner index is the axis being interpolated, the results move down to the lower half
+            for (int32 axis = 0; axis < Dimension; axis++)
+            {
+                for (int32 i = 0; i < CornerCount >> (axis + 1); i++)
+                    values[i] = Lerp(values[2 * i], values[2 * i + 1], fades[axis]);
+            }
+
+            if constexpr (Gradient)
+                return Mul(values[0], Splat8(Lattice<Dimension>::PerlinScale));
+            else
+                return values[0];
+        }
+
+        // Simplex noise after "Simplex noise demystified" by Stefan Gustavson. The corners are ordered by ranking the
+        // offset components against each other, which works for any dimension without branches
+        template<int32 Dimension>
+        Float8 SimplexNoise(const Float8 (&position)[Dimension], Int8 seed)
+        {
+            using Constants = Lattice<Dimension>;
+
+            Float8 skew = Zero8();
+
+            for (int32 axis = 0; axis < Dimension; axis++)
+                skew = Add(skew, position[axis]);
+
+            skew = Mul(skew, Splat8(Constants::SimplexSkew));
+
+            Float8 origin[Dimension];
+            Int8 primed[Dimension];
+            Float8 unskew = Zero8();
+
+            for (int32 axis = 0; axis < Dimension; axis++)
+            {
+                Float8 cell = Floor(Add(position[axis], skew));
+                primed[axis] = Mul(ConvertToInt(cell), SplatInt8(Primes[axis]));
+                unskew = Add(unskew, cell);
+                origin[axis] = cell;
+            }
+
+            unskew = Mul(unskew, Splat8(Constants::SimplexUnskew));
+
+            for (int32 axis = 0; axis < Dimension; axis++)
+                origin[axis] = Add(Sub(position[axis], origin[axis]), unskew);
+
+            // rank[axis] counts the axes with a smaller offset, ties go to the lower axis
+            Int8 rank[Dimension];
+
+            for (int32 axis = 0; axis < Dimension; axis++)
+                rank[axis] = SplatInt8(0);
+
+            for (int32 a = 0; a < Dimension; a++)
+            {
+                for (int32 b = a + 1; b < Dimension; b++)
+                {
+                    Int8 greater = AsInt(CompareGreater(origin[a], origin[b]));
+                    rank[a] = Sub(rank[a], greater);
+                    rank[b] = Add(rank[b], Add(greater, SplatInt8(1)));
+                }
+            }
+
+            Float8 result = Zero8();
+
+            // Corner k steps along the k axes with the largest offsets
+            for (int32 k = 0; k <= Dimension; k++)
+            {
+                Float8 offset[Dimension];
+                Int8 hash = seed;
+                Float8 falloff = Splat8(SimplexRadius);
+
+                for (int32 axis = 0; axis < Dimension; axis++)
+                {
+                    Int8 step = CompareGreater(rank[axis], SplatInt8(Dimension - k - 1));
+                    offset[axis] = Add(Sub(origin[axis], BitAnd(AsFloat(step), Splat8(1.0f))), Splat8(k * Constants::SimplexUnskew));
+                    hash = BitXor(hash, Add(primed[axis], BitAnd(step, SplatInt8(Primes[axis]))));
+                    falloff = NegMulAdd(offset[axis], offset[axis], falloff);
+                }
+
+                falloff = Simd::Max(falloff, Zero8());
+                falloff = Mul(falloff, falloff);
+                result = MulAdd(Mul(falloff, falloff), GradientDot<Dimension>(Hash(hash), offset), result);
+            }
+
+            return Mul(result, Splat8(Constants::SimplexScale));
+        }
+
+        template<int32 Dimension>
+        Float8 Octave(NoiseType type, const Float8 (&position)[Dimension], Int8 seed)
+        {
+            switch (type)
+            {
+            case NoiseType::Value:
+                return LatticeNoise<Dimension, false>(position, seed);
+            case NoiseType::Perlin:
+                return LatticeNoise<Dimension, true>(position, seed);
+            default:
+                return SimplexNoise<Dimension>(position, seed);
+            }
+        }
+
+        template<int32 Dimension>
+        Float8 Fractal(const NoiseSettings& settings, const Float8 (&position)[Dimension])
+        {
+            assert(settings.octaves >= 1);
+
+            Float8 result = Zero8();
+            float frequency = settings.frequency;
+            float amplitude = 1.0f;
+            float totalAmplitude = 0.0f;
+
+            for (int32 octave = 0; octave < settings.octaves; octave++)
+            {
+                Float8 scaled[Dimension];
+
+                for (int32 axis = 0; axis < Dimension; axis++)
+                    scaled[axis] = Mul(position[axis], Splat8(frequency));
+
+                // Each octave gets its own seed, otherwise all octaves line up at the origin
+                Int8 seed = SplatInt8(static_cast<int32>(settings.seed + static_cast<uint32>(octave)));
+                result = MulAdd(Octave<Dimension>(settings.type, scaled, seed), Splat8(amplitude), result);
+
+                totalAmplitude += amplitude;
+                amplitude *= settings.gain;
+                frequency *= settings.lacunarity;
+            }
+
+            return settings.octaves == 1 ? result : Mul(result, Splat8(1.0f / totalAmplitude));
+        }
+
+        template<int32 Dimension>
+        float SampleOne(const NoiseSettings& settings, const float (&coordinates)[Dimension])
+        {
+            Float8 position[Dimension];
+
+            for (int32 axis = 0; axis < Dimension; axis++)
+                position[axis] = Splat8(coordinates[axis]);
+
+            float lanes[BlockWidth];
+            Store8(lanes, Fractal<Dimension>(settings, position));
+            return lanes[0];
+        }
+
+        // origin and spacing hold Dimension values, spacing only uses the first three.
+        // Rows are numbered y fastest, then z
+        template<int32 Dimension>
+        void FillRows(const NoiseSettings& settings, float* results, const float* origin, const float* spacing, int32 sizeX, int32 sizeY, size_t firstRow, size_t lastRow)
+        {
+            static constexpr float LaneOffsets[BlockWidth] = { 0, 1, 2, 3, 4, 5, 6, 7 };
+
+            Float8 laneOffsets = Load8(LaneOffsets);
+            Float8 originX = Splat8(origin[0]);
+            Float8 spacingX = Splat8(spacing[0]);
+
+            for (size_t row = firstRow; row < lastRow; row++)
+            {
+                Float8 position[Dimension];
+                position[1] = Splat8(origin[1] + static_cast<float>(row % sizeY) * spacing[1]);
+
+                if constexpr (Dimension >= 3)
+                    position[2] = Splat8(origin[2] + static_cast<float>(row / sizeY) * spacing[2]);
+
+                if constexpr (Dimension == 4)
+                    position[3] = Splat8(origin[3]);
+
+                float* rowResults = results + row * sizeX;
+
+                ForEachBlock8(static_cast<size_t>(sizeX), [&](auto block)
+                    {
+                        Float8 index = Add(Splat8(static_cast<float>(block.offset)), laneOffsets);
+                        position[0] = MulAdd(index, spacingX, originX);
+                        block.Store(rowResults, Fractal<Dimension>(settings, position));
+                    });
+            }
+        }
+
+        template<int32 Dimension>
+        void FillNoiseGrid(const NoiseSettings& settings, std::span<float> results, const float (&origin)[Dimension], const float (&spacing)[3], int32 sizeX, int32 sizeY, int32 sizeZ, uint32 threadCount)
+        {
+            assert(sizeX >= 0 && sizeY >= 0 && sizeZ >= 0);
+            assert(results.size() == static_cast<size_t>(sizeX) * sizeY * sizeZ);
+
+            ParallelFor(static_cast<size_t>(sizeY) * sizeZ, threadCount, 1, [&](size_t firstRow, size_t lastRow)
+                {
+                    FillRows<Dimension>(settings, results.data(), origin, spacing, sizeX, sizeY, firstRow, lastRow);
+                });
+        }
+    }
+
+    float Noise::Sample(const NoiseSettings& settings, Vector2F position)
+    {
+        return SampleOne<2>(settings, { position.x, position.y });
+    }
+
+    float Noise::Sample(const NoiseSettings& settings, Vector3F position)
+    {
+        return SampleOne<3>(settings, { position.x, position.y, position.z });
+    }
+
+    float Noise::Sample(const NoiseSettings& settings, Vector4F position)
+    {
+        return SampleOne<4>(settings, { position.x, position.y, position.z, position.w });
+    }
+
+    void Noise::FillGrid2D(const NoiseSettings& settings, std::span<float> results, Vector2F origin, Vector2F spacing, int32 sizeX, int32 sizeY, uint32 threadCount)
+    {
+        FillNoiseGrid<2>(settings, results, { origin.x, origin.y }, { spacing.x, spacing.y, 0.0f }, sizeX, sizeY, 1, threadCount);
+    }
+
+    void Noise::FillGrid3D(const NoiseSettings& settings, std::span<float> results, Vector3F origin, Vector3F spacing, int32 sizeX, int32 sizeY, int32 sizeZ, uint32 threadCount)
+    {
+        FillNoiseGrid<3>(settings, results, { origin.x, origin.y, origin.z }, { spacing.x, spacing.y, spacing.z }, sizeX, sizeY, sizeZ, threadCount);
+    }
+
+    void Noise::FillGrid4D(const NoiseSettings& settings, std::span<float> results, Vector4F origin, Vector3F spacing, int32 sizeX, int32 sizeY, int32 sizeZ, uint32 threadCount)
+    {
+        FillNoiseGrid<4>(settings, results, { origin.x, origin.y, origin.z, origin.w }, { spacing.x, spacing.y, spacing.z }, sizeX, sizeY, sizeZ, threadCount);
+    }
+}
\ No newline at end of file
@@ -0,0 +1,341 @@
+﻿#include "ByteEngine/Math/Packing.h"
+#include "ByteEngine/Math/QuaternionStream.h"
+#include "Math/Simd/SimdMath.h"
+
+using namespace ByteEngine::Math::Simd;
+
+namespace ByteEngine::Math
+{
+    namespace
+    {
+        static_assert(sizeof(Half) == 2 && sizeof(SNorm16) == 2 && sizeof(UNorm16) == 2, "Packed components must be tightly packed");
+        static_assert(sizeof(HalfVector3) == 6 && sizeof(UNorm16Vector4) == 8, "Packed vectors must be tightly packed");
+        static_assert(sizeof(UNorm1010102) == 4 && sizeof(PackedQuaternion) == 4, "Packed formats must be 32 bits");
+
+        // Smallest three components of a unit quaternion lie in [-1/sqrt(2), 1/sqrt(2)]
+        constexpr float QuaternionComponentRange = 0.70710678f;
+        constexpr float QuaternionQuantizeScale = 1023.0f / (2.0f * QuaternionComponentRange);
+        constexpr float QuaternionDequantizeScale = 2.0f * QuaternionComponentRange / 1023.0f;
+
+        // Add before multiply, so no compiler contracts it into a fused multiply-add and the result matches the SIMD version
+        uint32 QuantizeQuaternionComponent(float value)
+        {
+            float scaled = (value + QuaternionComponentRange) * QuaternionQuantizeScale;
+            return static_cast<uint32>(std::nearbyint(Math::Min(Math::Max(scaled, 0.0f), 1023.0f)));
+        }
+
+        float DequantizeQuaternionComponent(uint32 value)
+        {
+            return static_cast<float>(value) * QuaternionDequantizeScale - QuaternionComponentRange;
+        }
+
+        // Same steps as Math::FloatToHalf
+        Int8 FloatToHalf8(Float8 value)
+        {
+            Int8 bits = AsInt(value);
+            Int8 absBits = BitAnd(bits, SplatInt8(0x7FFFFFFF));
+            Int8 sign = BitAnd(ShiftRight<16>(bits), SplatInt8(0x8000));
+
+            Int8 subnormal = Sub(AsInt(Add(AsFloat(absBits), Splat8(0.5f))), SplatInt8(0x3F000000));
+            Int8 mantissaOdd = BitAnd(ShiftRight<13>(absBits), SplatInt8(1));
+            Int8 normal = ShiftRight<13>(Add(Add(absBits, SplatInt8(static_cast<int32>(0xC8000FFF))), mantissaOdd));
+
+            Int8 result = Select(CompareGreater(SplatInt8(0x38800000), absBits), subnormal, normal);
+            result = Select(CompareGreater(SplatInt8(0x47800000), absBits), result, SplatInt8(0x7C00));
+            result = Select(CompareGreater(absBits, SplatInt8(0x7F800000)), SplatInt8(0x7E00), result);
+            return BitOr(result, sign);
+        }
+
+        // Same steps as Math::HalfToFloat
+        Float8 HalfToFloat8(Int8 half)
+        {
+            Int8 expMantissa = BitAnd(half, SplatInt8(0x7FFF));
+            Int8 sign = ShiftLeft<16>(BitAnd(half, SplatInt8(0x8000)));
+            Float8 scaled = Mul(AsFloat(ShiftLeft<13>(expMantissa)), AsFloat(SplatInt8(0x77800000)));
+            Int8 infNan = BitAnd(CompareGreater(expMantissa, SplatInt8(0x7BFF)), SplatInt8(0x7F800000));
+            return AsFloat(BitOr(BitOr(AsInt(scaled), infNan), sign));
+        }
+
+        Int8 Quantize8(Float8 value, float minimum, float scale)
+        {
+            return ConvertToInt(Mul(Simd::Min(Simd::Max(value, Splat8(minimum)), Splat8(1.0f)), Splat8(scale)));
+        }
+
+        // Vector4F arrays are transposed through the stack so every component gets its own register
+        template<typename Block>
+        void LoadComponents(Block block, const Vector4F* values, Float8 (&components)[4])
+        {
+            float buffer[4][BlockWidth] = { };
+
+            for (size_t i = 0; i < block.count; i++)
+            {
+                for (int32 c = 0; c < 4; c++)
+                    buffer[c][i] = values[block.offset + i].data[c];
+            }
+
+            for (int32 c = 0; c < 4; c++)
+                components[c] = Load8(buffer[c]);
+        }
+
+        template<typename Block>
+        void StoreComponents(Block block, Vector4F* values, const Float8 (&components)[4])
+        {
+            float buffer[4][BlockWidth];
+
+            for (int32 c = 0; c < 4; c++)
+                Store8(buffer[c], components[c]);
+
+            for (size_t i = 0; i < block.count; i++)
+            {
+                for (int32 c = 0; c < 4; c++)
+                    values[block.offset + i].data[c] = buffer[c][i];
+            }
+        }
+    }
+
+    UNorm1010102::UNorm1010102(Vector4F value)
+    {
+        auto quantize = [](float component, float scale) { return static_cast<uint32>(std::nearbyint(Math::Min(Math::Max(component, 0.0f), 1.0f) * scale)); };
+        bits = quantize(value.x, 1023.0f) | quantize(value.y, 1023.0f) << 10 | quantize(value.z, 1023.0f) << 20 | quantize(value.w, 3.0f) << 30;
+    }
+
+    Vector4F UNorm1010102::Unpack() const
+    {
+        return Vector4F(
+            static_cast<float>(bits & 0x3FF) * (1.0f / 1023.0f),
+            static_cast<float>((bits >> 10) & 0x3FF) * (1.0f / 1023.0f),
+            static_cast<float>((bits >> 20) & 0x3FF) * (1.0f / 1023.0f),
+            static_cast<float>(bits >> 30) * (1.0f / 3.0f));
+    }
+
+    PackedQuaternion::PackedQuaternion(Quaternion value)
+    {
+        float largest = Math::Max(Math::Max(Math::Abs(value.x), Math::Abs(value.y)), Math::Max(Math::Abs(value.z), Math::Abs(value.w)));
+        uint32 index = Math::Abs(value.x) == largest ? 0 : Math::Abs(value.y) == largest ? 1 : Math::Abs(value.z) == largest ? 2 : 3;
+
+        // q and -q are the same rotation, flip so the dropped component is positive
+        float sign = value.data[index] < 0.0f ? -1.0f : 1.0f;
+        float a = (index == 0 ? value.y : value.x) * sign;
+        float b = (index <= 1 ? value.z : value.y) * sign;
+        float c = (index <= 2 ? value.w : value.z) * sign;
+
+        bits = index << 30 | QuantizeQuaternionComponent(a) << 20 | QuantizeQuaternionComponent(b) << 10 | QuantizeQuaternionComponent(c);
+    }
+
+    Quaternion PackedQuaternion::Unpack() const
+    {
+        uint32 index = bits >> 30;
+        float a = DequantizeQuaternionComponent((bits >> 20) & 0x3FF);
+        float b = DequantizeQuaternionComponent((bits >> 10) & 0x3FF);
+        float c = DequantizeQuaternionComponent(bits & 0x3FF);
+        float largest = Math::Sqrt(Math::Max(1.0f - (a * a + b * b + c * c), 0.0f));
+
+        switch (index)
+        {
+        case 0:
+            return Quaternion(largest, a, b, c);
+        case 1:
+            return Quaternion(a, largest, b, c);
+        case 2:
+            return Quaternion(a, b, largest, c);
+        default:
+            return Quaternion(a, b, c, largest);
+        }
+    }
+}
+
+namespace ByteEngine::Math::Math
+{
+    void FloatToHalf(std::span<const float> values, std::span<Half> results) noexcept
+    {
+        assert(values.size() == results.size());
+
+        uint16* destination = reinterpret_cast<uint16*>(results.data());
+
+        ForEachBlock8(values.size(), [&](auto block)
+            {
+                block.StoreWords(destination, FloatToHalf8(block.Load(values.data())));
+            });
+    }
+
+    void HalfToFloat(std::span<const Half> values, std::span<float> results) noexcept
+    {
+        assert(values.size() == results.size());
+
+        const uint16* source = reinterpret_cast<const uint16*>(values.data());
+
+        ForEachBlock8(values.size(), [&](auto block)
+            {
+                block.Store(results.data(), HalfToFloat8(block.LoadWords(source)));
+            });
+    }
+
+    void FloatToSNorm16(std::span<const float> values, std::span<SNorm16> results) noexcept
+    {
+        assert(values.size() == results.size());
+
+        uint16* destination = reinterpret_cast<uint16*>(results.data());
+
+        ForEachBlock8(values.size(), [&](auto block)
+            {
+                // Keep the two's complement low half so the saturating store leaves it intact
+                Int8 quantized = Quantize8(block.Load(values.data()), -1.0f, 32767.0f);
+                block.StoreWords(destination, BitAnd(quantized, SplatInt8(0xFFFF)));
+            });
+    }
+
+    void SNorm16ToFloat(std::span<const SNorm16> values, std::span<float> results) noexcept
+    {
+        assert(values.size() == results.size());
+
+        const uint16* source = reinterpret_cast<const uint16*>(values.data());
+
+        ForEachBlock8(values.size(), [&](auto block)
+            {
+                Int8 signExtended = ShiftRightArithmetic<16>(ShiftLeft<16>(block.LoadWords(source)));
+                Float8 value = Mul(ConvertToFloat(signExtended), Splat8(1.0f / 32767.0f));
+                block.Store(results.data(), Simd::Max(value, Splat8(-1.0f)));
+            });
+    }
+
+    void FloatToUNorm16(std::span<const float> values, std::span<UNorm16> results) noexcept
+    {
+        assert(values.size() == results.size());
+
+        uint16* destination = reinterpret_cast<uint16*>(results.data());
+
+        ForEachBlock8(values.size(), [&](auto block)
+            {
+                block.StoreWords(destination, Quantize8(block.Load(values.data()), 0.0f, 65535.0f));
+            });
+    }
+
+    void UNorm16ToFloat(std::span<const UNorm16> values, std::span<float> results) noexcept
+    {
+        assert(values.size() == results.size());
+
+        const uint16* source = reinterpret_cast<const uint16*>(values.data());
+
+        ForEachBlock8(values.size(), [&](auto block)
+            {
+                block.Store(results.data(), Mul(ConvertToFloat(block.LoadWords(source)), Splat8(1.0f / 65535.0f)));
+            });
+    }
+
+    void Pack(std::span<const Vector4F> values, std::span<UNorm1010102> results) noexcept
+    {
+        assert(values.size() == results.size());
+
+        int32* destination = reinterpret_cast<int32*>(results.data());
+
+        ForEachBlock8(values.size(), [&](auto block)
+            {
+                Float8 components[4];
+                LoadComponents(block, values.data(), components);
+
+                Int8 bits = Quantize8(components[0], 0.0f, 1023.0f);
+                bits = BitOr(bits, ShiftLeft<10>(Quantize8(components[1], 0.0f, 1023.0f)));
+                bits = BitOr(bits, ShiftLeft<20>(Quantize8(components[2], 0.0f, 1023.0f)));
+                bits = BitOr(bits, ShiftLeft<30>(Quantize8(components[3], 0.0f, 3.0f)));
+                block.StoreInts(destination, bits);
+            });
+    }
+
+    void Unpack(std::span<const UNorm1010102> values, std::span<Vector4F> results) noexcept
+    {
+        assert(values.size() == results.size());
+
+        const int32* source = reinterpret_cast<const int32*>(values.data());
+        Int8 mask = SplatInt8(0x3FF);
+        Float8 scale = Splat8(1.0f / 1023.0f);
+
+        ForEachBlock8(values.size(), [&](auto block)
+            {
+                Int8 bits = block.LoadInts(source);
+
+                Float8 components[4] = {
+                    Mul(ConvertToFloat(BitAnd(bits, mask)), scale),
+                    Mul(ConvertToFloat(BitAnd(ShiftRight<10>(bits), mask)), scale),
+                    Mul(ConvertToFloat(BitAnd(ShiftRight<20>(bits), mask)), scale),
+                    Mul(ConvertToFloat(ShiftRight<30>(bits)), Splat8(1.0f / 3.0f))
+                };
+
+                StoreComponents(block, results.data(), components);
+            });
+    }
+
+    void Pack(ConstQuaternionStream values, std::span<PackedQuaternion> results) noexcept
+    {
+        assert(values.Size() == results.size());
+
+        int32* destination = reinterpret_cast<int32*>(results.data());
+
+        ForEachBlock8(values.Size(), [&](auto block)
+            {
+                Float8 x = block.Load(values.x.data());
+                Float8 y = block.Load(values.y.data());
+                Float8 z = block.Load(values.z.data());
+                Float8 w = block.Load(values.w.data());
+
+                Float8 absX = Simd::Abs(x);
+                Float8 absY = Simd::Abs(y);
+                Float8 absZ = Simd::Abs(z);
+                Float8 largest = Simd::Max(Simd::Max(absX, absY), Simd::Max(absZ, Simd::Abs(w)));
+
+                // Masks for index == 0, index <= 1 and index <= 2, the first of equal components wins like in the scalar version
+                Float8 isX = CompareEqual(absX, largest);
+                Float8 upToY = BitOr(isX, CompareEqual(absY, largest));
+                Float8 upToZ = BitOr(upToY, CompareEqual(absZ, largest));
+
+                Float8 largestValue = Select(isX, x, Select(upToY, y, Select(upToZ, z, w)));
+                Float8 sign = BitAnd(largestValue, Splat8(-0.0f));
+
+                Float8 range = Splat8(QuaternionComponentRange);
+                Float8 scale = Splat8(QuaternionQuantizeScale);
+                auto quantize = [&](Float8 component)
+                    {
+                        Float8 scaled = Mul(Add(BitXor(component, sign), range), scale);
+                        return ConvertToInt(Simd::Min(Simd::Max(scaled, Zero8()), Splat8(1023.0f)));
+                    };
+
+                Int8 index = Select(AsInt(upToZ), Select(AsInt(upToY), Select(AsInt(isX), SplatInt8(0), SplatInt8(1)), SplatInt8(2)), SplatInt8(3));
+                Int8 bits = ShiftLeft<30>(index);
+                bits = BitOr(bits, ShiftLeft<20>(quantize(Select(isX, y, x))));
+                bits = BitOr(bits, ShiftLeft<10>(quantize(Select(upToY, z, y))));
+                bits = BitOr(bits, quantize(Select(upToZ, w, z)));
+                block.StoreInts(destination, bits);
+            });
+    }
+
+    void Unpack(std::span<const PackedQuaternion> values, QuaternionStream results) noexcept
+    {
+        assert(values.size() == results.Size());
+
+        const int32* source = reinterpret_cast<const int32*>(values.data());
+        Int8 mask = SplatInt8(0x3FF);
+        Float8 scale = Splat8(QuaternionDequantizeScale);
+        Float8 offset = Splat8(-QuaternionComponentRange);
+
+        ForEachBlock8(values.size(), [&](auto block)
+            {
+                Int8 bits = block.LoadInts(source);
+                Int8 index = ShiftRight<30>(bits);
+
+                Float8 a = MulAdd(ConvertToFloat(BitAnd(ShiftRight<20>(bits), mask)), scale, offset);
+                Float8 b = MulAdd(ConvertToFloat(BitAnd(ShiftRight<10>(bits), mask)), scale, offset);
+                Float8 c = MulAdd(ConvertToFloat(BitAnd(bits, mask)), scale, offset);
+                Float8 lengthSquared = MulAdd(a, a, MulAdd(b, b, Mul(c, c)));
+                Float8 largest = Simd::Sqrt(Simd::Max(Sub(Splat8(1.0f), lengthSquared), Zero8()));
+
+                Float8 isX = AsFloat(CompareEqual(index, SplatInt8(0)));
+                Float8 isY = AsFloat(CompareEqual(index, SplatInt8(1)));
+                Float8 isZ = AsFloat(CompareEqual(index, SplatInt8(2)));
+                Float8 isW = AsFloat(CompareEqual(index, SplatInt8(3)));
+
+                block.Store(results.x.data(), Select(isX, largest, a));
+                block.Store(results.y.data(), Select(isX, a, Select(isY, largest, b)));
+                block.Store(results.z.data(), Select(BitOr(isX, isY), b, Select(isZ, largest, c)));
+                block.Store(results.w.data(), Select(isW, largest, c));
+            });
+    }
+}
\ No newline at end of file
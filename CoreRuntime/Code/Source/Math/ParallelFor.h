@@ -0,0 +1,46 @@
+﻿#pragma once
+
+#include <algorithm>
+#include <cassert>
+#include <thread>
+#include <vector>
+
+#include "ByteEngine/Primitives.h"
+
+namespace ByteEngine::Math
+{
+    // Splits [0, count) into contiguous ranges, one per thread, and calls body(first, last) for each.
+    // Range starts are multiples of granularity, e.g. the SIMD block width, so only the last range ends in a partial block.
+    // The calling thread takes the first range, threadCount 0 uses every hardware thread.
+    // Threads are started per call, meant for batches large enough to hide that cost
+    template<typename Body>
+    void ParallelFor(size_t count, uint32 threadCount, size_t granularity, Body&& body)
+    {
+        assert(granularity > 0);
+
+        if (threadCount == 0)
+            threadCount = std::max(1u, std::thread::hardware_concurrency());
+
+        size_t chunkCount = (count + granularity - 1) / granularity;
+        threadCount = static_cast<uint32>(std::min<size_t>(threadCount, chunkCount));
+
+        if (threadCount <= 1)
+        {
+            body(size_t(0), count);
+            return;
+        }
+
+        auto rangeStart = [&](uint32 thread) { return std::min(chunkCount * thread / threadCount * granularity, count); };
+
+        std::vector<std::thread> threads;
+        threads.reserve(threadCount - 1);
+
+        for (uint32 thread = 1; thread < threadCount; thread++)
+            threads.emplace_back([&body, first = rangeStart(thread), last = rangeStart(thread + 1)] { body(first, last); });
+
+        body(size_t(0), rangeStart(1));
+
+        for (std::thread& thread : threads)
+            thread.join();
+    }
+}
\ No newline at end of file
@@ -1,9 +1,8 @@
-﻿#include <DirectXMath.h>
-
+﻿#include "ByteEngine/Math/Matrix4x4F.h"
 #include "ByteEngine/Math/Vector2.h"
 #include "ByteEngine/Math/Quaternion.h"
-
-using namespace DirectX;
+#include "ByteEngine/Math/QuaternionStream.h"
+#include "Math/Simd/SimdTrigonometry.h"
 
 namespace ByteEngine::Math
 {
@@ -50,6 +49,11 @@ namespace ByteEngine::Math
 
         float sinp = 2.0f * (w * x - z * y);
 
+        // Gimbal lock at pitch +-90 degrees: only yaw - roll (or yaw + roll) is defined and cosy, cosr
+        // come out as rounding noise. Fold everything into yaw, from FromEuler with pitch +-90 and roll 0
+        if (Math::Abs(sinp) >= 0.999999f)
+            return EulerRad { RadianF(sinp > 0.0f ? Math::PI / 2.0f : -Math::PI / 2.0f), 2.0f * Math::Atan2(y, w), RadianF(0.0f) };
+
         float siny = 2.0f * (w * y + x * z);
         float cosy = 1.0f - 2.0f * (x * x + y * y);
 
@@ -107,36 +111,96 @@ namespace ByteEngine::Math
 
     Quaternion Quaternion::FromAngleAxis(DegreeF angle, Vector3F axis) { return FromAngleAxis(angle.ToRadian(), axis); }
 
+    // FromEuler implementation adapted from DirectXMath (MIT License). See THIRDPARTY.md
+    // Source: DirectX::XMQuaternionRotationRollPitchYaw
     Quaternion Quaternion::FromEuler(RadianF pitch, RadianF yaw, RadianF roll)
     {
-        XMVECTOR q = XMQuaternionRotationRollPitchYaw(pitch.value, yaw.value, roll.value);
-        Quaternion result;
-        XMStoreFloat4(reinterpret_cast<XMFLOAT4*>(&result), q);
-        return result;
+        float sp, cp, sy, cy, sr, cr;
+        Math::SinCos(sp, cp, pitch * 0.5f);
+        Math::SinCos(sy, cy, yaw * 0.5f);
+        Math::SinCos(sr, cr, roll * 0.5f);
+
+        return Quaternion(
+            cr * sp * cy + sr * cp * sy,
+            cr * cp * sy - sr * sp * cy,
+            sr * cp * cy - cr * sp * sy,
+            cr * cp * cy + sr * sp * sy
+        );
     }
 
     Quaternion Quaternion::FromEuler(DegreeF pitch, DegreeF yaw, DegreeF roll) { return FromEuler(pitch.ToRadian(), yaw.ToRadian(), roll.ToRadian()); }
 
+    // FromRotationMatrix implementation adapted from DirectXMath (MIT License). See THIRDPARTY.md
+    // Source: DirectX::XMQuaternionRotationMatrix
+    Quaternion Quaternion::FromRotationMatrix(const Matrix4x4F& matrix)
+    {
+        float r22 = matrix.m22;
+
+        if (r22 <= 0.0f)
+        {
+            // x^2 + y^2 >= z^2 + w^2
+            float dif10 = matrix.m11 - matrix.m00;
+            float omr22 = 1.0f - r22;
+
+            if (dif10 <= 0.0f)
+            {
+                // x^2 >= y^2
+                float fourXSqr = omr22 - dif10;
+                float inv4x = 0.5f / Math::Sqrt(fourXSqr);
+                return Quaternion(fourXSqr * inv4x, (matrix.m01 + matrix.m10) * inv4x, (matrix.m02 + matrix.m20) * inv4x, (matrix.m12 - matrix.m21) * inv4x);
+            }
+            else
+            {
+                // y^2 >= x^2
+                float fourYSqr = omr22 + dif10;
+                float inv4y = 0.5f / Math::Sqrt(fourYSqr);
+                return Quaternion((matrix.m01 + matrix.m10) * inv4y, fourYSqr * inv4y, (matrix.m12 + matrix.m21) * inv4y, (matrix.m20 - matrix.m02) * inv4y);
+            }
+        }
+        else
+        {
+            // z^2 + w^2 >= x^2 + y^2
+            float sum10 = matrix.m11 + matrix.m00;
+            float opr22 = 1.0f + r22;
+
+            if (sum10 <= 0.0f)
+            {
+                // z^2 >= w^2
+                float fourZSqr = opr22 - sum10;
+                float inv4z = 0.5f / Math::Sqrt(fourZSqr);
+                return Quaternion((matrix.m02 + matrix.m20) * inv4z, (matrix.m12 + matrix.m21) * inv4z, fourZSqr * inv4z, (matrix.m01 - matrix.m10) * inv4z);
+            }
+            else
+            {
+                // w^2 >= z^2
+                float fourWSqr = opr22 + sum10;
+                float inv4w = 0.5f / Math::Sqrt(fourWSqr);
+                return Quaternion((matrix.m12 - matrix.m21) * inv4w, (matrix.m20 - matrix.m02) * inv4w, (matrix.m01 - matrix.m10) * inv4w, fourWSqr * inv4w);
+            }
+        }
+    }
+
     Quaternion Quaternion::FromLookDirection(Vector3F direction, Vector3F worldUp)
     {
         if (Math::IsEqualApproximetly(direction.LengthSquared(), 0.0f))
             return Identity;
 
-        XMVECTOR forward = XMLoadFloat3(reinterpret_cast<XMFLOAT3*>(&direction));
-        XMVECTOR worldUp2 = XMLoadFloat3(reinterpret_cast<XMFLOAT3*>(&worldUp));
+        Vector3F forward = direction;
 
         if (!direction.IsNormalized())
-            forward = XMVector3Normalize(forward);
+            forward.Normalize();
 
-        XMVECTOR right = XMVector3Cross(worldUp2, forward);
-        XMVECTOR up = XMVector3Cross(forward, right);
+        Vector3F right = Vector3F::Cross(worldUp, forward);
+        Vector3F up = Vector3F::Cross(forward, right);
 
-        XMMATRIX m { right, up, forward, g_XMIdentityR3 };
+        Matrix4x4F matrix {
+            Vector4F(right.x, right.y, right.z, 0.0f),
+            Vector4F(up.x, up.y, up.z, 0.0f),
+            Vector4F(forward.x, forward.y, forward.z, 0.0f),
+            Matrix4x4F::IdentityRow3
+        };
 
-        XMVECTOR q = XMQuaternionRotationMatrix(m);
-        Quaternion result;
-        XMStoreFloat4(reinterpret_cast<XMFLOAT4*>(&result), q);
-        return result;
+        return FromRotationMatrix(matrix);
     }
 
     Quaternion Quaternion::FromToRotation(Vector3F from, Vector3F to)
@@ -207,8 +271,234 @@ namespace ByteEngine::Math
         return Slerp(from, to, Math::Clamp(t));
     }
 
+    Quaternion Quaternion::Nlerp(Quaternion from, Quaternion to, float t)
+    {
+        // Flip the target when the quaternions are more than 90 degrees apart to take the shortest path
+        if (Dot(from, to) < 0.0f)
+            to = -to;
+
+        Quaternion result(
+            from.x + (to.x - from.x) * t,
+            from.y + (to.y - from.y) * t,
+            from.z + (to.z - from.z) * t,
+            from.w + (to.w - from.w) * t
+        );
+
+        result.Normalize();
+        return result;
+    }
+
     bool Quaternion::IsEqualApproximetly(Quaternion a, Quaternion b, float tolerance)
     {
         return Math::IsEqualApproximetly(a.x, b.x, tolerance) && Math::IsEqualApproximetly(a.y, b.y, tolerance) && Math::IsEqualApproximetly(a.z, b.z, tolerance) && Math::IsEqualApproximetly(a.w, b.w, tolerance);
     }
+
+    // ─────────────────────────────────────────────
+    // Batch operations
+    // ─────────────────────────────────────────────
+
+    namespace
+    {
+        using namespace Simd;
+
+        struct Quaternion8
+        {
+            Float8 x, y, z, w;
+        };
+
+        struct Vector3F8
+        {
+            Float8 x, y, z;
+        };
+
+        template<bool Partial>
+        Quaternion8 LoadQuaternions(const Block8<Partial>& block, ConstQuaternionStream stream)
+        {
+            return Quaternion8 { block.Load(stream.x.data()), block.Load(stream.y.data()), block.Load(stream.z.data()), block.Load(stream.w.data()) };
+        }
+
+        template<bool Partial>
+        void StoreQuaternions(const Block8<Partial>& block, QuaternionStream stream, const Quaternion8& value)
+        {
+            block.Store(stream.x.data(), value.x);
+            block.Store(stream.y.data(), value.y);
+            block.Store(stream.z.data(), value.z);
+            block.Store(stream.w.data(), value.w);
+        }
+
+        Float8 Dot8(const Quaternion8& a, const Quaternion8& b)
+        {
+            return MulAdd(a.w, b.w, MulAdd(a.z, b.z, MulAdd(a.y, b.y, Mul(a.x, b.x))));
+        }
+
+        // Same guard as Quaternion::Normalize, near zero quaternions are left untouched
+        Quaternion8 Normalize8(const Quaternion8& q)
+        {
+            Float8 lengthSquared = Dot8(q, q);
+            Float8 invLength = Div(Splat8(1.0f), Sqrt(lengthSquared));
+            Float8 scale = Select(CompareGreater(lengthSquared, Splat8(Math::Epsilon)), invLength, Splat8(1.0f));
+            return Quaternion8 { Mul(q.x, scale), Mul(q.y, scale), Mul(q.z, scale), Mul(q.w, scale) };
+        }
+
+        // Same math as Quaternion::Slerp
+        Quaternion8 Slerp8(const Quaternion8& from, const Quaternion8& to, Float8 t)
+        {
+            Float8 cosom = Dot8(from, to);
+
+            // Shortest path: the sign of the dot product is folded into the scale of the target
+            Float8 flip = BitAnd(cosom, Splat8(-0.0f));
+            cosom = Abs(cosom);
+
+            Float8 oneMinusT = Sub(Splat8(1.0f), t);
+            Float8 omega = Simd::Acos(cosom);
+            Float8 invSinom = Div(Splat8(1.0f), Simd::Sin(omega));
+            Float8 scale0 = Mul(Simd::Sin(Mul(oneMinusT, omega)), invSinom);
+            Float8 scale1 = Mul(Simd::Sin(Mul(t, omega)), invSinom);
+
+            // Nearly identical quaternions use linear interpolation. Those lanes may have divided by zero above, the result is discarded
+            Float8 linear = CompareLessEqual(Sub(Splat8(1.0f), cosom), Splat8(Math::Epsilon));
+            scale0 = Select(linear, oneMinusT, scale0);
+            scale1 = BitXor(Select(linear, t, scale1), flip);
+
+            return Quaternion8 {
+                MulAdd(scale0, from.x, Mul(scale1, to.x)),
+                MulAdd(scale0, from.y, Mul(scale1, to.y)),
+                MulAdd(scale0, from.z, Mul(scale1, to.z)),
+                MulAdd(scale0, from.w, Mul(scale1, to.w))
+            };
+        }
+
+        // Same math as Quaternion::Nlerp
+        Quaternion8 Nlerp8(const Quaternion8& from, const Quaternion8& to, Float8 t)
+        {
+            Float8 flip = BitAnd(Dot8(from, to), Splat8(-0.0f));
+
+            return Normalize8(Quaternion8 {
+                MulAdd(Sub(BitXor(to.x, flip), from.x), t, from.x),
+                MulAdd(Sub(BitXor(to.y, flip), from.y), t, from.y),
+                MulAdd(Sub(BitXor(to.z, flip), from.z), t, from.z),
+                MulAdd(Sub(BitXor(to.w, flip), from.w), t, from.w)
+            });
+        }
+
+        // Same math as Quaternion::operator*(Quaternion)
+        Quaternion8 Multiply8(const Quaternion8& a, const Quaternion8& b)
+        {
+            return Quaternion8 {
+                NegMulAdd(a.z, b.y, MulAdd(a.y, b.z, MulAdd(a.x, b.w, Mul(a.w, b.x)))),
+                MulAdd(a.z, b.x, MulAdd(a.y, b.w, NegMulAdd(a.x, b.z, Mul(a.w, b.y)))),
+                MulAdd(a.z, b.w, NegMulAdd(a.y, b.x, MulAdd(a.x, b.y, Mul(a.w, b.z)))),
+                NegMulAdd(a.z, b.z, NegMulAdd(a.y, b.y, NegMulAdd(a.x, b.x, Mul(a.w, b.w))))
+            };
+        }
+
+        Vector3F8 Cross8(Float8 ax, Float8 ay, Float8 az, Float8 bx, Float8 by, Float8 bz)
+        {
+            return Vector3F8 {
+                NegMulAdd(az, by, Mul(ay, bz)),
+                NegMulAdd(ax, bz, Mul(az, bx)),
+                NegMulAdd(ay, bx, Mul(ax, by))
+            };
+        }
+
+        // Same math as Quaternion::operator*(Vector3F)
+        Vector3F8 Rotate8(const Quaternion8& q, const Vector3F8& v)
+        {
+            Vector3F8 uv = Cross8(q.x, q.y, q.z, v.x, v.y, v.z);
+            Vector3F8 uuv = Cross8(q.x, q.y, q.z, uv.x, uv.y, uv.z);
+            Float8 two = Splat8(2.0f);
+
+            return Vector3F8 {
+                MulAdd(MulAdd(uv.x, q.w, uuv.x), two, v.x),
+                MulAdd(MulAdd(uv.y, q.w, uuv.y), two, v.y),
+                MulAdd(MulAdd(uv.z, q.w, uuv.z), two, v.z)
+            };
+        }
+    }
+
+    void Quaternion::Slerp(ConstQuaternionStream from, ConstQuaternionStream to, std::span<const float> t, QuaternionStream results)
+    {
+        assert(from.Size() == to.Size() && from.Size() == t.size() && from.Size() == results.Size());
+
+        ForEachBlock8(from.Size(), [&](auto block)
+            {
+                StoreQuaternions(block, results, Slerp8(LoadQuaternions(block, from), LoadQuaternions(block, to), block.Load(t.data())));
+            });
+    }
+
+    void Quaternion::Slerp(ConstQuaternionStream from, ConstQuaternionStream to, float t, QuaternionStream results)
+    {
+        assert(from.Size() == to.Size() && from.Size() == results.Size());
+
+        Float8 t8 = Splat8(t);
+        ForEachBlock8(from.Size(), [&](auto block)
+            {
+                StoreQuaternions(block, results, Slerp8(LoadQuaternions(block, from), LoadQuaternions(block, to), t8));
+            });
+    }
+
+    void Quaternion::Nlerp(ConstQuaternionStream from, ConstQuaternionStream to, std::span<const float> t, QuaternionStream results)
+    {
+        assert(from.Size() == to.Size() && from.Size() == t.size() && from.Size() == results.Size());
+
+        ForEachBlock8(from.Size(), [&](auto block)
+            {
+                StoreQuaternions(block, results, Nlerp8(LoadQuaternions(block, from), LoadQuaternions(block, to), block.Load(t.data())));
+            });
+    }
+
+    void Quaternion::Nlerp(ConstQuaternionStream from, ConstQuaternionStream to, float t, QuaternionStream results)
+    {
+        assert(from.Size() == to.Size() && from.Size() == results.Size());
+
+        Float8 t8 = Splat8(t);
+        ForEachBlock8(from.Size(), [&](auto block)
+            {
+                StoreQuaternions(block, results, Nlerp8(LoadQuaternions(block, from), LoadQuaternions(block, to), t8));
+            });
+    }
+
+    void Quaternion::Multiply(ConstQuaternionStream a, ConstQuaternionStream b, QuaternionStream results)
+    {
+        assert(a.Size() == b.Size() && a.Size() == results.Size());
+
+        ForEachBlock8(a.Size(), [&](auto block)
+            {
+                StoreQuaternions(block, results, Multiply8(LoadQuaternions(block, a), LoadQuaternions(block, b)));
+            });
+    }
+
+    void Quaternion::Multiply(Quaternion a, ConstQuaternionStream b, QuaternionStream results)
+    {
+        assert(b.Size() == results.Size());
+
+        Quaternion8 a8 { Splat8(a.x), Splat8(a.y), Splat8(a.z), Splat8(a.w) };
+        ForEachBlock8(b.Size(), [&](auto block)
+            {
+                StoreQuaternions(block, results, Multiply8(a8, LoadQuaternions(block, b)));
+            });
+    }
+
+    void Quaternion::Rotate(ConstQuaternionStream rotations, ConstVector3FStream vectors, Vector3FStream results)
+    {
+        assert(rotations.Size() == vectors.Size() && rotations.Size() == results.Size());
+
+        ForEachBlock8(rotations.Size(), [&](auto block)
+            {
+                Vector3F8 v { block.Load(vectors.x.data()), block.Load(vectors.y.data()), block.Load(vectors.z.data()) };
+                Vector3F8 rotated = Rotate8(LoadQuaternions(block, rotations), v);
+
+                block.Store(results.x.data(), rotated.x);
+                block.Store(results.y.data(), rotated.y);
+                block.Store(results.z.data(), rotated.z);
+            });
+    }
+
+    void Quaternion::Normalize(QuaternionStream quaternions)
+    {
+        ForEachBlock8(quaternions.Size(), [&](auto block)
+            {
+                StoreQuaternions(block, quaternions, Normalize8(LoadQuaternions(block, quaternions)));
+            });
+    }
 }
\ No newline at end of file
@@ -0,0 +1,352 @@
+﻿#include <cmath>
+
+#include "ByteEngine/Math/Random.h"
+#include "ByteEngine/Math/QuaternionStream.h"
+#include "Math/Simd/SimdExponential.h"
+#include "Math/Simd/SimdTrigonometry.h"
+
+using namespace ByteEngine::Math::Simd;
+
+namespace ByteEngine::Math
+{
+    namespace
+    {
+        using State = uint32[4][Random::LaneCount];
+
+        // Polynomial for a jump of 2^64 steps, from the reference implementation of xoshiro128**
+        constexpr uint32 JumpPolynomial[4] = { 0x8764000B, 0xF542D2D3, 0x6FA035C3, 0x77F2DB5B };
+
+        // 2^-24, the upper 24 bits of a draw convert to float exactly
+        constexpr float UnitFloatScale = 1.0f / 16777216.0f;
+
+        // Expands the seed into well mixed state words, as recommended by the xoshiro authors
+        uint64 SplitMix64(uint64& seed)
+        {
+            uint64 z = (seed += 0x9E3779B97F4A7C15);
+            z = (z ^ (z >> 30)) * 0xBF58476D1CE4E5B9;
+            z = (z ^ (z >> 27)) * 0x94D049BB133111EB;
+            return z ^ (z >> 31);
+        }
+
+        constexpr uint32 RotateLeft(uint32 value, int32 bits)
+        {
+            return (value << bits) | (value >> (32 - bits));
+        }
+
+        template<int32 Bits>
+        Int8 RotateLeft(Int8 value)
+        {
+            return BitOr(ShiftLeft<Bits>(value), ShiftRight<32 - Bits>(value));
+        }
+
+        uint32 NextLane(State& state, size_t lane)
+        {
+            uint32& s0 = state[0][lane];
+            uint32& s1 = state[1][lane];
+            uint32& s2 = state[2][lane];
+            uint32& s3 = state[3][lane];
+
+            uint32 result = RotateLeft(s1 * 5, 7) * 9;
+            uint32 t = s1 << 9;
+
+            s2 ^= s0;
+            s3 ^= s1;
+            s1 ^= s2;
+            s0 ^= s3;
+            s2 ^= t;
+            s3 = RotateLeft(s3, 11);
+
+            return result;
+        }
+
+        void JumpLane(State& state, size_t lane)
+        {
+            uint32 jumped[4] = { };
+
+            for (uint32 polynomial : JumpPolynomial)
+            {
+                for (int32 bit = 0; bit < 32; bit++)
+                {
+                    if (polynomial & (1u << bit))
+                    {
+                        for (int32 word = 0; word < 4; word++)
+                            jumped[word] ^= state[word][lane];
+                    }
+
+                    (void)NextLane(state, lane);
+                }
+            }
+
+            for (int32 word = 0; word < 4; word++)
+                state[word][lane] = jumped[word];
+        }
+
+        float ToUnitFloat(uint32 bits)
+        {
+            return static_cast<float>(bits >> 8) * UnitFloatScale;
+        }
+
+        // Keeps all lanes in registers for the duration of a fill, writes them back on destruction
+        class LaneGenerator
+        {
+        private:
+            State& state;
+            Int8 s0, s1, s2, s3;
+
+        public:
+            explicit LaneGenerator(State& state)
+                : state(state),
+                s0(Load8(reinterpret_cast<const int32*>(state[0]))),
+                s1(Load8(reinterpret_cast<const int32*>(state[1]))),
+                s2(Load8(reinterpret_cast<const int32*>(state[2]))),
+                s3(Load8(reinterpret_cast<const int32*>(state[3])))
+            { }
+
+            LaneGenerator(const LaneGenerator&) = delete;
+            LaneGenerator& operator=(const LaneGenerator&) = delete;
+
+            ~LaneGenerator()
+            {
+                Store8(reinterpret_cast<int32*>(state[0]), s0);
+                Store8(reinterpret_cast<int32*>(state[1]), s1);
+                Store8(reinterpret_cast<int32*>(state[2]), s2);
+                Store8(reinterpret_cast<int32*>(state[3]), s3);
+            }
+
+            // Same as NextLane for all lanes, the multiplications by 5 and 9 are shifts and adds
+            Int8 Next()
+            {
+                Int8 rotated = RotateLeft<7>(Add(ShiftLeft<2>(s1), s1));
+                Int8 result = Add(ShiftLeft<3>(rotated), rotated);
+                Int8 t = ShiftLeft<9>(s1);
+
+                s2 = BitXor(s2, s0);
+                s3 = BitXor(s3, s1);
+                s1 = BitXor(s1, s2);
+                s0 = BitXor(s0, s3);
+                s2 = BitXor(s2, t);
+                s3 = RotateLeft<11>(s3);
+
+                return result;
+            }
+
+            // [0, 1)
+            Float8 NextFloat()
+            {
+                return Mul(ConvertToFloat(ShiftRight<8>(Next())), Splat8(UnitFloatScale));
+            }
+
+            // [-pi, pi), the most accurate range of SinCos
+            Float8 NextAngle()
+            {
+                return MulAdd(NextFloat(), Splat8(2.0f * Math::PI), Splat8(-Math::PI));
+            }
+
+            void NextUnitVector(Float8& x, Float8& y, Float8& z)
+            {
+                z = NegMulAdd(Splat8(2.0f), NextFloat(), Splat8(1.0f));
+                Float8 radius = Simd::Sqrt(Simd::Max(NegMulAdd(z, z, Splat8(1.0f)), Zero8()));
+
+                Float8 sin, cos;
+                Simd::SinCos(sin, cos, NextAngle());
+
+                x = Mul(radius, cos);
+                y = Mul(radius, sin);
+            }
+        };
+    }
+
+    Random::Random(uint64 seed)
+    {
+        Seed(seed);
+    }
+
+    void Random::Seed(uint64 seed)
+    {
+        uint64 low = SplitMix64(seed);
+        uint64 high = SplitMix64(seed);
+
+        state[0][0] = static_cast<uint32>(low);
+        state[1][0] = static_cast<uint32>(low >> 32);
+        state[2][0] = static_cast<uint32>(high);
+        state[3][0] = static_cast<uint32>(high >> 32);
+
+        // Each lane starts one jump after the previous one
+        for (size_t lane = 1; lane < LaneCount; lane++)
+        {
+            for (int32 word = 0; word < 4; word++)
+                state[word][lane] = state[word][lane - 1];
+
+            JumpLane(state, lane);
+        }
+    }
+
+    void Random::Jump()
+    {
+        for (size_t lane = 0; lane < LaneCount; lane++)
+        {
+            for (size_t i = 0; i < LaneCount; i++)
+                JumpLane(state, lane);
+        }
+    }
+
+    uint32 Random::NextUInt()
+    {
+        return NextLane(state, 0);
+    }
+
+    int32 Random::NextInt(int32 min, int32 max)
+    {
+        assert(min < max);
+
+        // Multiply-shift maps the draw to the range without a division
+        uint32 range = static_cast<uint32>(max) - static_cast<uint32>(min);
+        uint32 offset = static_cast<uint32>((static_cast<uint64>(NextUInt()) * range) >> 32);
+        return static_cast<int32>(static_cast<uint32>(min) + offset);
+    }
+
+    float Random::NextFloat()
+    {
+        return ToUnitFloat(NextUInt());
+    }
+
+    float Random::NextFloat(float min, float max)
+    {
+        return min + (max - min) * NextFloat();
+    }
+
+    Vector3F Random::NextUnitVector()
+    {
+        float z = 1.0f - 2.0f * NextFloat();
+        float radius = Math::Sqrt(Math::Max(1.0f - z * z, 0.0f));
+
+        float sin, cos;
+        Math::SinCos(sin, cos, RadianF(NextFloat() * 2.0f * Math::PI - Math::PI));
+
+        return Vector3F(radius * cos, radius * sin, z);
+    }
+
+    Vector3F Random::NextPointInSphere(Vector3F center, float radius)
+    {
+        Vector3F direction = NextUnitVector();
+
+        // Volume grows with r^3, so the distance is the cube root of a uniform value.
+        // 1 - u is in (0, 1] like in the batch version, where Pow needs a positive base
+        return center + direction * (radius * std::cbrt(1.0f - NextFloat()));
+    }
+
+    Quaternion Random::NextRotation()
+    {
+        // "Uniform Random Rotations" by Ken Shoemake
+        float u = NextFloat();
+        float a = Math::Sqrt(1.0f - u);
+        float b = Math::Sqrt(u);
+
+        float sin0, cos0, sin1, cos1;
+        Math::SinCos(sin0, cos0, RadianF(NextFloat() * 2.0f * Math::PI - Math::PI));
+        Math::SinCos(sin1, cos1, RadianF(NextFloat() * 2.0f * Math::PI - Math::PI));
+
+        return Quaternion(a * sin0, a * cos0, b * sin1, b * cos1);
+    }
+
+    void Random::Fill(std::span<uint32> results)
+    {
+        LaneGenerator generator(state);
+        int32* destination = reinterpret_cast<int32*>(results.data());
+
+        ForEachBlock8(results.size(), [&](auto block)
+            {
+                block.StoreInts(destination, generator.Next());
+            });
+    }
+
+    void Random::Fill(std::span<int32> results, int32 min, int32 max)
+    {
+        assert(min < max);
+
+        LaneGenerator generator(state);
+        Int8 base = SplatInt8(min);
+        Int8 range = SplatInt8(static_cast<int32>(static_cast<uint32>(max) - static_cast<uint32>(min)));
+
+        ForEachBlock8(results.size(), [&](auto block)
+            {
+                block.StoreInts(results.data(), Add(base, MulHigh(generator.Next(), range)));
+            });
+    }
+
+    void Random::Fill(std::span<float> results)
+    {
+        LaneGenerator generator(state);
+
+        ForEachBlock8(results.size(), [&](auto block)
+            {
+                block.Store(results.data(), generator.NextFloat());
+            });
+    }
+
+    void Random::Fill(std::span<float> results, float min, float max)
+    {
+        LaneGenerator generator(state);
+        Float8 base = Splat8(min);
+        Float8 range = Splat8(max - min);
+
+        ForEachBlock8(results.size(), [&](auto block)
+            {
+                block.Store(results.data(), MulAdd(generator.NextFloat(), range, base));
+            });
+    }
+
+    void Random::FillUnitVectors(Vector3FStream results)
+    {
+        LaneGenerator generator(state);
+
+        ForEachBlock8(results.Size(), [&](auto block)
+            {
+                Float8 x, y, z;
+                generator.NextUnitVector(x, y, z);
+
+                block.Store(results.x.data(), x);
+                block.Store(results.y.data(), y);
+                block.Store(results.z.data(), z);
+            });
+    }
+
+    void Random::FillPointsInSphere(Vector3FStream results, Vector3F center, float radius)
+    {
+        LaneGenerator generator(state);
+        Float8 third = Splat8(1.0f / 3.0f);
+
+        ForEachBlock8(results.Size(), [&](auto block)
+            {
+                Float8 x, y, z;
+                generator.NextUnitVector(x, y, z);
+
+                Float8 distance = Mul(Splat8(radius), Simd::Pow(Sub(Splat8(1.0f), generator.NextFloat()), third));
+
+                block.Store(results.x.data(), MulAdd(x, distance, Splat8(center.x)));
+                block.Store(results.y.data(), MulAdd(y, distance, Splat8(center.y)));
+                block.Store(results.z.data(), MulAdd(z, distance, Splat8(center.z)));
+            });
+    }
+
+    void Random::FillRotations(QuaternionStream results)
+    {
+        LaneGenerator generator(state);
+
+        ForEachBlock8(results.Size(), [&](auto block)
+            {
+                Float8 u = generator.NextFloat();
+                Float8 a = Simd::Sqrt(Sub(Splat8(1.0f), u));
+                Float8 b = Simd::Sqrt(u);
+
+                Float8 sin0, cos0, sin1, cos1;
+                Simd::SinCos(sin0, cos0, generator.NextAngle());
+                Simd::SinCos(sin1, cos1, generator.NextAngle());
+
+                block.Store(results.x.data(), Mul(a, sin0));
+                block.Store(results.y.data(), Mul(a, cos0));
+                block.Store(results.z.data(), Mul(b, sin1));
+                block.Store(results.w.data(), Mul(b, cos1));
+            });
+    }
+}
\ No newline at end of file
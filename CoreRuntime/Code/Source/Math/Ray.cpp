@@ -0,0 +1,287 @@
+﻿#include <bit>
+
+#include "ByteEngine/Math/Ray.h"
+#include "Math/Simd/SimdMath.h"
+
+using namespace ByteEngine::Math::Simd;
+
+namespace ByteEngine::Math
+{
+    namespace
+    {
+        // Rejects rays parallel to the triangle plane and degenerate triangles, including the padding of TriangleBlock
+        constexpr float MinDeterminant = 1e-20f;
+
+        struct Vector8
+        {
+            Float8 x, y, z;
+        };
+
+        Vector8 Load(const float (&components)[3][8])
+        {
+            return Vector8 { Load8(components[0]), Load8(components[1]), Load8(components[2]) };
+        }
+
+        Vector8 Splat(Vector3F vector)
+        {
+            return Vector8 { Splat8(vector.x), Splat8(vector.y), Splat8(vector.z) };
+        }
+
+        Float8 Dot(const Vector8& a, const Vector8& b)
+        {
+            return MulAdd(a.z, b.z, MulAdd(a.y, b.y, Mul(a.x, b.x)));
+        }
+
+        Vector8 Cross(const Vector8& a, const Vector8& b)
+        {
+            return Vector8 {
+                NegMulAdd(a.z, b.y, Mul(a.y, b.z)),
+                NegMulAdd(a.x, b.z, Mul(a.z, b.x)),
+                NegMulAdd(a.y, b.x, Mul(a.x, b.y))
+            };
+        }
+
+        Vector8 Subtract(const Vector8& a, const Vector8& b)
+        {
+            return Vector8 { Sub(a.x, b.x), Sub(a.y, b.y), Sub(a.z, b.z) };
+        }
+
+        struct TriangleHits8
+        {
+            Float8 distance;
+            Float8 u;
+            Float8 v;
+            Float8 mask;
+        };
+
+        // Möller-Trumbore for 8 ray/triangle pairs, any mix of splatted and per-lane inputs
+        TriangleHits8 IntersectTriangles8(const Vector8& origin, const Vector8& direction, const Vector8& vertex, const Vector8& edge1, const Vector8& edge2, Float8 maxDistance)
+        {
+            Vector8 p = Cross(direction, edge2);
+            Float8 determinant = Dot(edge1, p);
+            Float8 inverseDeterminant = Div(Splat8(1.0f), determinant);
+
+            Vector8 toOrigin = Subtract(origin, vertex);
+            Float8 u = Mul(Dot(toOrigin, p), inverseDeterminant);
+
+            Vector8 q = Cross(toOrigin, edge1);
+            Float8 v = Mul(Dot(direction, q), inverseDeterminant);
+            Float8 distance = Mul(Dot(edge2, q), inverseDeterminant);
+
+            Float8 mask = CompareGreater(Simd::Abs(determinant), Splat8(MinDeterminant));
+            mask = BitAnd(mask, CompareGreaterEqual(u, Zero8()));
+            mask = BitAnd(mask, CompareGreaterEqual(v, Zero8()));
+            mask = BitAnd(mask, CompareLessEqual(Add(u, v), Splat8(1.0f)));
+            mask = BitAnd(mask, CompareGreater(distance, Zero8()));
+            mask = BitAnd(mask, CompareLess(distance, maxDistance));
+
+            return TriangleHits8 { distance, u, v, mask };
+        }
+    }
+
+    // ─────────────────────────────────────────────
+    // Single ray
+    // ─────────────────────────────────────────────
+
+    float Ray::IntersectBounds(const Bounds& bounds, float maxDistance) const
+    {
+        Vector3F inverseDirection(1.0f / direction.x, 1.0f / direction.y, 1.0f / direction.z);
+        Vector3F t0 = (bounds.min - origin) * inverseDirection;
+        Vector3F t1 = (bounds.max - origin) * inverseDirection;
+
+        float entry = Math::Max(Math::Max(Math::Min(t0.x, t1.x), Math::Min(t0.y, t1.y), Math::Min(t0.z, t1.z)), 0.0f);
+        float exit = Math::Min(Math::Max(t0.x, t1.x), Math::Max(t0.y, t1.y), Math::Max(t0.z, t1.z));
+
+        return entry <= exit && entry <= maxDistance ? entry : Math::Infinity;
+    }
+
+    bool Ray::IntersectTriangle(Vector3F a, Vector3F b, Vector3F c, uint32 triangle, RayHit& hit) const
+    {
+        Vector3F edge1 = b - a;
+        Vector3F edge2 = c - a;
+
+        Vector3F p = Vector3F::Cross(direction, edge2);
+        float determinant = Vector3F::Dot(edge1, p);
+
+        if (Math::Abs(determinant) <= MinDeterminant)
+            return false;
+
+        float inverseDeterminant = 1.0f / determinant;
+        Vector3F toOrigin = origin - a;
+        float u = Vector3F::Dot(toOrigin, p) * inverseDeterminant;
+
+        if (u < 0.0f || u > 1.0f)
+            return false;
+
+        Vector3F q = Vector3F::Cross(toOrigin, edge1);
+        float v = Vector3F::Dot(direction, q) * inverseDeterminant;
+
+        if (v < 0.0f || u + v > 1.0f)
+            return false;
+
+        float distance = Vector3F::Dot(edge2, q) * inverseDeterminant;
+
+        if (distance <= 0.0f || distance >= hit.distance)
+            return false;
+
+        hit = RayHit { distance, u, v, triangle };
+        return true;
+    }
+
+    bool Ray::IntersectTriangles(const TriangleBlock& block, uint32 firstTriangle, RayHit& hit) const
+    {
+        TriangleHits8 hits = IntersectTriangles8(Splat(origin), Splat(direction), Load(block.vertex), Load(block.edge1), Load(block.edge2), Splat8(hit.distance));
+        uint32 mask = static_cast<uint32>(MoveMask(hits.mask));
+
+        if (mask == 0)
+            return false;
+
+        alignas(32) float distances[8];
+        alignas(32) float u[8];
+        alignas(32) float v[8];
+        Store8(distances, hits.distance);
+        Store8(u, hits.u);
+        Store8(v, hits.v);
+
+        // Every lane in the mask is nearer than hit.distance, keep the nearest of them
+        int32 nearest = std::countr_zero(mask);
+
+        for (mask &= mask - 1; mask != 0; mask &= mask - 1)
+        {
+            int32 lane = std::countr_zero(mask);
+
+            if (distances[lane] < distances[nearest])
+                nearest = lane;
+        }
+
+        hit = RayHit { distances[nearest], u[nearest], v[nearest], firstTriangle + static_cast<uint32>(nearest) };
+        return true;
+    }
+
+    bool Ray::IntersectTriangles(std::span<const TriangleBlock> blocks, RayHit& hit) const
+    {
+        bool found = false;
+
+        for (size_t i = 0; i < blocks.size(); i++)
+            found |= IntersectTriangles(blocks[i], static_cast<uint32>(i * TriangleBlock::Width), hit);
+
+        return found;
+    }
+
+    std::vector<TriangleBlock> TriangleBlock::FromTriangles(std::span<const Vector3F> vertices)
+    {
+        assert(vertices.size() % 3 == 0);
+
+        size_t triangleCount = vertices.size() / 3;
+        std::vector<TriangleBlock> blocks((triangleCount + Width - 1) / Width, TriangleBlock { });
+
+        for (size_t i = 0; i < triangleCount; i++)
+        {
+            TriangleBlock& block = blocks[i / Width];
+            size_t lane = i % Width;
+
+            Vector3F a = vertices[i * 3];
+            Vector3F edge1 = vertices[i * 3 + 1] - a;
+            Vector3F edge2 = vertices[i * 3 + 2] - a;
+
+            for (int32 axis = 0; axis < 3; axis++)
+            {
+                block.vertex[axis][lane] = a[axis];
+                block.edge1[axis][lane] = edge1[axis];
+                block.edge2[axis][lane] = edge2[axis];
+            }
+        }
+
+        return blocks;
+    }
+
+    // ─────────────────────────────────────────────
+    // Packets
+    // ─────────────────────────────────────────────
+
+    // Empty lanes sit at infinity with a zero direction, every slab interval is empty and every determinant zero
+    RayPacket::RayPacket()
+    {
+        for (int32 axis = 0; axis < 3; axis++)
+        {
+            for (int32 lane = 0; lane < Width; lane++)
+            {
+                origin[axis][lane] = Math::Infinity;
+                direction[axis][lane] = 0.0f;
+                inverseDirection[axis][lane] = Math::Infinity;
+            }
+        }
+    }
+
+    RayPacket::RayPacket(std::span<const Ray> rays)
+        : RayPacket()
+    {
+        for (size_t i = 0; i < rays.size() && i < Width; i++)
+            Set(static_cast<int32>(i), rays[i]);
+    }
+
+    void RayPacket::Set(int32 lane, const Ray& ray)
+    {
+        assert(lane >= 0 && lane < Width);
+
+        for (int32 axis = 0; axis < 3; axis++)
+        {
+            origin[axis][lane] = ray.origin[axis];
+            direction[axis][lane] = ray.direction[axis];
+            inverseDirection[axis][lane] = 1.0f / ray.direction[axis];
+        }
+    }
+
+    Ray RayPacket::Get(int32 lane) const
+    {
+        assert(lane >= 0 && lane < Width);
+        return Ray(Vector3F(origin[0][lane], origin[1][lane], origin[2][lane]), Vector3F(direction[0][lane], direction[1][lane], direction[2][lane]));
+    }
+
+    uint32 RayPacket::IntersectBounds(const Bounds& bounds, const RayPacketHit& hits) const
+    {
+        Float8 entry = Zero8();
+        Float8 exit = Load8(hits.distance);
+
+        for (int32 axis = 0; axis < 3; axis++)
+        {
+            Float8 rayOrigin = Load8(origin[axis]);
+            Float8 inverse = Load8(inverseDirection[axis]);
+            Float8 t0 = Mul(Sub(Splat8(bounds.min[axis]), rayOrigin), inverse);
+            Float8 t1 = Mul(Sub(Splat8(bounds.max[axis]), rayOrigin), inverse);
+
+            entry = Simd::Max(entry, Simd::Min(t0, t1));
+            exit = Simd::Min(exit, Simd::Max(t0, t1));
+        }
+
+        return static_cast<uint32>(MoveMask(CompareLessEqual(entry, exit)));
+    }
+
+    uint32 RayPacket::IntersectTriangle(Vector3F a, Vector3F b, Vector3F c, uint32 triangle, RayPacketHit& hits) const
+    {
+        Float8 closest = Load8(hits.distance);
+        TriangleHits8 found = IntersectTriangles8(Load(origin), Load(direction), Splat(a), Splat(b - a), Splat(c - a), closest);
+
+        uint32 mask = static_cast<uint32>(MoveMask(found.mask));
+
+        if (mask == 0)
+            return 0;
+
+        Store8(hits.distance, Select(found.mask, found.distance, closest));
+        Store8(hits.u, Select(found.mask, found.u, Load8(hits.u)));
+        Store8(hits.v, Select(found.mask, found.v, Load8(hits.v)));
+
+        int32* triangles = reinterpret_cast<int32*>(hits.triangle);
+        Store8(triangles, Select(AsInt(found.mask), SplatInt8(static_cast<int32>(triangle)), Load8(triangles)));
+
+        return mask;
+    }
+
+    void RayPacket::IntersectTriangles(std::span<const Vector3F> vertices, RayPacketHit& hits) const
+    {
+        assert(vertices.size() % 3 == 0);
+
+        for (size_t i = 0; i < vertices.size() / 3; i++)
+            (void)IntersectTriangle(vertices[i * 3], vertices[i * 3 + 1], vertices[i * 3 + 2], static_cast<uint32>(i), hits);
+    }
+}
\ No newline at end of file
@@ -0,0 +1,62 @@
+﻿#pragma once
+
+#include "Math/Simd/SimdMath.h"
+
+// 8-lane Log2, Exp2 and Pow. Relative error is around 2e-7 over the normal float range,
+// close to what std::pow gives in single precision
+
+namespace ByteEngine::Math::Simd
+{
+    // Expects value > 0. Denormals, zero and negative values give meaningless results
+    inline Float8 Log2(Float8 value)
+    {
+        // value = 2^exponent * mantissa, mantissa in [sqrt(2)/2, sqrt(2)) so the series below converges fast
+        Int8 bits = AsInt(value);
+        Int8 exponent = Sub(ShiftRight<23>(bits), SplatInt8(127));
+        Float8 mantissa = AsFloat(BitOr(BitAnd(bits, SplatInt8(0x007FFFFF)), SplatInt8(0x3F800000)));
+
+        Float8 large = CompareGreater(mantissa, Splat8(1.41421356f));
+        mantissa = Select(large, Mul(mantissa, Splat8(0.5f)), mantissa);
+        Float8 exponentF = Add(ConvertToFloat(exponent), BitAnd(large, Splat8(1.0f)));
+
+        // log2(m) = 2 / ln(2) * atanh(t), t = (m - 1) / (m + 1), |t| <= 0.172
+        Float8 t = Div(Sub(mantissa, Splat8(1.0f)), Add(mantissa, Splat8(1.0f)));
+        Float8 t2 = Mul(t, t);
+
+        Float8 p = MulAdd(Splat8(1.0f / 9.0f), t2, Splat8(1.0f / 7.0f));
+        p = MulAdd(p, t2, Splat8(1.0f / 5.0f));
+        p = MulAdd(p, t2, Splat8(1.0f / 3.0f));
+        p = MulAdd(p, t2, Splat8(1.0f));
+
+        return MulAdd(Mul(p, t), Splat8(2.88539008f), exponentF);
+    }
+
+    // Input is clamped to [-126, 127], so the result never becomes a denormal or infinity
+    inline Float8 Exp2(Float8 value)
+    {
+        value = Min(Max(value, Splat8(-126.0f)), Splat8(127.0f));
+
+        // 2^value = 2^integer * 2^fraction, fraction in [-0.5, 0.5]
+        Int8 integer = ConvertToInt(value);
+        Float8 fraction = Sub(value, ConvertToFloat(integer));
+
+        // Taylor series of e^(fraction * ln(2)), degree 7
+        Float8 x = Mul(fraction, Splat8(0.693147181f));
+        Float8 p = MulAdd(Splat8(1.0f / 5040.0f), x, Splat8(1.0f / 720.0f));
+        p = MulAdd(p, x, Splat8(1.0f / 120.0f));
+        p = MulAdd(p, x, Splat8(1.0f / 24.0f));
+        p = MulAdd(p, x, Splat8(1.0f / 6.0f));
+        p = MulAdd(p, x, Splat8(0.5f));
+        p = MulAdd(p, x, Splat8(1.0f));
+        p = MulAdd(p, x, Splat8(1.0f));
+
+        Float8 scale = AsFloat(ShiftLeft<23>(Add(integer, SplatInt8(127))));
+        return Mul(p, scale);
+    }
+
+    // base^exponent for base > 0
+    inline Float8 Pow(Float8 base, Float8 exponent)
+    {
+        return Exp2(Mul(exponent, Log2(base)));
+    }
+}
\ No newline at end of file
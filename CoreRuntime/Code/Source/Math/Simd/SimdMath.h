@@ -0,0 +1,890 @@
+﻿#pragma once
+
+// Compile-time selection of the math backend. CMake defines one of BYTEENGINE_MATH_SIMD_AVX2,
+// BYTEENGINE_MATH_SIMD_SSE4, BYTEENGINE_MATH_SIMD_SCALAR or BYTEENGINE_MATH_SIMD_DIRECTXMATH
+// (see BYTEENGINE_MATH_SIMD in GlobalBuildConfigs.cmake). When none is defined the backend is
+// picked from the instruction sets the compiler targets.
+
+#if !defined(BYTEENGINE_MATH_SIMD_AVX2) && !defined(BYTEENGINE_MATH_SIMD_SSE4) && !defined(BYTEENGINE_MATH_SIMD_SCALAR) && !defined(BYTEENGINE_MATH_SIMD_DIRECTXMATH)
+    #if defined(__AVX2__)
+        #define BYTEENGINE_MATH_SIMD_AVX2
+    #elif defined(__SSE4_1__)
+        #define BYTEENGINE_MATH_SIMD_SSE4
+    #else
+        #define BYTEENGINE_MATH_SIMD_SCALAR
+    #endif
+#endif
+
+// DirectXMath backend only replaces the Matrix4x4F entry points, the rest of the library still needs a vector backend
+#if defined(BYTEENGINE_MATH_SIMD_DIRECTXMATH)
+    #if defined(__AVX2__)
+        #define BYTEENGINE_MATH_SIMD_AVX2
+    #else
+        #define BYTEENGINE_MATH_SIMD_SSE4
+    #endif
+#endif
+
+#if defined(BYTEENGINE_MATH_SIMD_AVX2) || defined(BYTEENGINE_MATH_SIMD_SSE4)
+    #include <immintrin.h>
+#endif
+
+#include <bit>
+#include <cmath>
+#include <cstring>
+
+#include "ByteEngine/Primitives.h"
+
+namespace ByteEngine::Math::Simd
+{
+#if defined(BYTEENGINE_MATH_SIMD_DIRECTXMATH)
+    constexpr const char* BackendName = "DirectXMath";
+#elif defined(BYTEENGINE_MATH_SIMD_AVX2)
+    constexpr const char* BackendName = "AVX2";
+#elif defined(BYTEENGINE_MATH_SIMD_SSE4)
+    constexpr const char* BackendName = "SSE4";
+#else
+    constexpr const char* BackendName = "Scalar";
+#endif
+
+#if defined(BYTEENGINE_MATH_SIMD_AVX2) || defined(BYTEENGINE_MATH_SIMD_SSE4)
+    using Float4 = __m128;
+
+    inline Float4 Load4(const float* source) { return _mm_loadu_ps(source); }
+    inline Float4 Load4Aligned(const float* source) { return _mm_load_ps(source); }
+    inline Float4 Load3(const float* source) { return _mm_set_ps(0.0f, source[2], source[1], source[0]); }
+
+    inline void Store4(float* destination, Float4 value) { _mm_storeu_ps(destination, value); }
+    inline void Store4Aligned(float* destination, Float4 value) { _mm_store_ps(destination, value); }
+
+    inline void Store3(float* destination, Float4 value)
+    {
+        _mm_store_ss(destination, value);
+        _mm_store_ss(destination + 1, _mm_shuffle_ps(value, value, _MM_SHUFFLE(1, 1, 1, 1)));
+        _mm_store_ss(destination + 2, _mm_shuffle_ps(value, value, _MM_SHUFFLE(2, 2, 2, 2)));
+    }
+
+    inline Float4 Set(float x, float y, float z, float w) { return _mm_set_ps(w, z, y, x); }
+    inline Float4 Splat(float value) { return _mm_set1_ps(value); }
+    inline Float4 Zero4() { return _mm_setzero_ps(); }
+
+    inline float GetX(Float4 value) { return _mm_cvtss_f32(value); }
+
+    inline Float4 Add(Float4 a, Float4 b) { return _mm_add_ps(a, b); }
+    inline Float4 Sub(Float4 a, Float4 b) { return _mm_sub_ps(a, b); }
+    inline Float4 Mul(Float4 a, Float4 b) { return _mm_mul_ps(a, b); }
+    inline Float4 Div(Float4 a, Float4 b) { return _mm_div_ps(a, b); }
+    inline Float4 Sqrt(Float4 value) { return _mm_sqrt_ps(value); }
+    inline Float4 Min(Float4 a, Float4 b) { return _mm_min_ps(a, b); }
+    inline Float4 Max(Float4 a, Float4 b) { return _mm_max_ps(a, b); }
+
+    // a * b + c
+    inline Float4 MulAdd(Float4 a, Float4 b, Float4 c)
+    {
+    #if defined(BYTEENGINE_MATH_SIMD_AVX2)
+        return _mm_fmadd_ps(a, b, c);
+    #else
+        return _mm_add_ps(_mm_mul_ps(a, b), c);
+    #endif
+    }
+
+    // c - a * b
+    inline Float4 NegMulAdd(Float4 a, Float4 b, Float4 c)
+    {
+    #if defined(BYTEENGINE_MATH_SIMD_AVX2)
+        return _mm_fnmadd_ps(a, b, c);
+    #else
+        return _mm_sub_ps(c, _mm_mul_ps(a, b));
+    #endif
+    }
+
+    // Result is { a[X], a[Y], b[Z], b[W] }
+    template<int32 X, int32 Y, int32 Z, int32 W>
+    inline Float4 Shuffle(Float4 a, Float4 b) { return _mm_shuffle_ps(a, b, _MM_SHUFFLE(W, Z, Y, X)); }
+
+    template<int32 X, int32 Y, int32 Z, int32 W>
+    inline Float4 Swizzle(Float4 value) { return _mm_shuffle_ps(value, value, _MM_SHUFFLE(W, Z, Y, X)); }
+
+    inline Float4 Dot3(Float4 a, Float4 b) { return _mm_dp_ps(a, b, 0x7F); }
+    inline Float4 Dot4(Float4 a, Float4 b) { return _mm_dp_ps(a, b, 0xFF); }
+
+    // Comparisons return a mask with all bits set in the lanes where the condition holds
+    inline Float4 CompareEqual(Float4 a, Float4 b) { return _mm_cmpeq_ps(a, b); }
+    inline Float4 CompareLess(Float4 a, Float4 b) { return _mm_cmplt_ps(a, b); }
+    inline Float4 CompareLessEqual(Float4 a, Float4 b) { return _mm_cmple_ps(a, b); }
+    inline Float4 CompareGreater(Float4 a, Float4 b) { return _mm_cmpgt_ps(a, b); }
+    inline Float4 CompareGreaterEqual(Float4 a, Float4 b) { return _mm_cmpge_ps(a, b); }
+
+    inline Float4 BitAnd(Float4 a, Float4 b) { return _mm_and_ps(a, b); }
+    inline Float4 BitOr(Float4 a, Float4 b) { return _mm_or_ps(a, b); }
+    inline Float4 BitXor(Float4 a, Float4 b) { return _mm_xor_ps(a, b); }
+    // ~a & b
+    inline Float4 BitAndNot(Float4 a, Float4 b) { return _mm_andnot_ps(a, b); }
+
+    // Per lane mask ? ifTrue : ifFalse
+    inline Float4 Select(Float4 mask, Float4 ifTrue, Float4 ifFalse) { return _mm_blendv_ps(ifFalse, ifTrue, mask); }
+    // One bit per lane, taken from the sign bit
+    inline int32 MoveMask(Float4 value) { return _mm_movemask_ps(value); }
+
+    inline Float4 Truncate(Float4 value) { return _mm_round_ps(value, _MM_FROUND_TO_ZERO | _MM_FROUND_NO_EXC); }
+    inline Float4 Floor(Float4 value) { return _mm_floor_ps(value); }
+#else
+    struct Float4
+    {
+        float v[4];
+    };
+
+    inline Float4 Load4(const float* source) { return Float4 { source[0], source[1], source[2], source[3] }; }
+    inline Float4 Load4Aligned(const float* source) { return Load4(source); }
+    inline Float4 Load3(const float* source) { return Float4 { source[0], source[1], source[2], 0.0f }; }
+
+    inline void Store4(float* destination, Float4 value)
+    {
+        for (int32 i = 0; i < 4; i++)
+            destination[i] = value.v[i];
+    }
+
+    inline void Store4Aligned(float* destination, Float4 value) { Store4(destination, value); }
+
+    inline void Store3(float* destination, Float4 value)
+    {
+        for (int32 i = 0; i < 3; i++)
+            destination[i] = value.v[i];
+    }
+
+    inline Float4 Set(float x, float y, float z, float w) { return Float4 { x, y, z, w }; }
+    inline Float4 Splat(float value) { return Float4 { value, value, value, value }; }
+    inline Float4 Zero4() { return Splat(0.0f); }
+
+    inline float GetX(Float4 value) { return value.v[0]; }
+
+    template<typename Op>
+    inline Float4 Apply(Float4 a, Float4 b, Op op)
+    {
+        return Float4 { op(a.v[0], b.v[0]), op(a.v[1], b.v[1]), op(a.v[2], b.v[2]), op(a.v[3], b.v[3]) };
+    }
+
+    inline Float4 Add(Float4 a, Float4 b) { return Apply(a, b, [](float x, float y) { return x + y; }); }
+    inline Float4 Sub(Float4 a, Float4 b) { return Apply(a, b, [](float x, float y) { return x - y; }); }
+    inline Float4 Mul(Float4 a, Float4 b) { return Apply(a, b, [](float x, float y) { return x * y; }); }
+    inline Float4 Div(Float4 a, Float4 b) { return Apply(a, b, [](float x, float y) { return x / y; }); }
+    inline Float4 Sqrt(Float4 value) { return Float4 { std::sqrt(value.v[0]), std::sqrt(value.v[1]), std::sqrt(value.v[2]), std::sqrt(value.v[3]) }; }
+    inline Float4 Min(Float4 a, Float4 b) { return Apply(a, b, [](float x, float y) { return x < y ? x : y; }); }
+    inline Float4 Max(Float4 a, Float4 b) { return Apply(a, b, [](float x, float y) { return x > y ? x : y; }); }
+
+    inline Float4 MulAdd(Float4 a, Float4 b, Float4 c) { return Add(Mul(a, b), c); }
+    inline Float4 NegMulAdd(Float4 a, Float4 b, Float4 c) { return Sub(c, Mul(a, b)); }
+
+    template<int32 X, int32 Y, int32 Z, int32 W>
+    inline Float4 Shuffle(Float4 a, Float4 b) { return Float4 { a.v[X], a.v[Y], b.v[Z], b.v[W] }; }
+
+    template<int32 X, int32 Y, int32 Z, int32 W>
+    inline Float4 Swizzle(Float4 value) { return Float4 { value.v[X], value.v[Y], value.v[Z], value.v[W] }; }
+
+    inline Float4 Dot3(Float4 a, Float4 b) { return Splat(a.v[0] * b.v[0] + a.v[1] * b.v[1] + a.v[2] * b.v[2]); }
+    inline Float4 Dot4(Float4 a, Float4 b) { return Splat(a.v[0] * b.v[0] + a.v[1] * b.v[1] + a.v[2] * b.v[2] + a.v[3] * b.v[3]); }
+
+    template<typename Op>
+    inline Float4 ApplyBits(Float4 a, Float4 b, Op op)
+    {
+        Float4 result;
+
+        for (int32 i = 0; i < 4; i++)
+            result.v[i] = std::bit_cast<float>(op(std::bit_cast<uint32>(a.v[i]), std::bit_cast<uint32>(b.v[i])));
+
+        return result;
+    }
+
+    template<typename Op>
+    inline Float4 Compare(Float4 a, Float4 b, Op op)
+    {
+        Float4 result;
+
+        for (int32 i = 0; i < 4; i++)
+            result.v[i] = std::bit_cast<float>(op(a.v[i], b.v[i]) ? 0xFFFFFFFFu : 0u);
+
+        return result;
+    }
+
+    inline Float4 CompareEqual(Float4 a, Float4 b) { return Compare(a, b, [](float x, float y) { return x == y; }); }
+    inline Float4 CompareLess(Float4 a, Float4 b) { return Compare(a, b, [](float x, float y) { return x < y; }); }
+    inline Float4 CompareLessEqual(Float4 a, Float4 b) { return Compare(a, b, [](float x, float y) { return x <= y; }); }
+    inline Float4 CompareGreater(Float4 a, Float4 b) { return Compare(a, b, [](float x, float y) { return x > y; }); }
+    inline Float4 CompareGreaterEqual(Float4 a, Float4 b) { return Compare(a, b, [](float x, float y) { return x >= y; }); }
+
+    inline Float4 BitAnd(Float4 a, Float4 b) { return ApplyBits(a, b, [](uint32 x, uint32 y) { return x & y; }); }
+    inline Float4 BitOr(Float4 a, Float4 b) { return ApplyBits(a, b, [](uint32 x, uint32 y) { return x | y; }); }
+    inline Float4 BitXor(Float4 a, Float4 b) { return ApplyBits(a, b, [](uint32 x, uint32 y) { return x ^ y; }); }
+    inline Float4 BitAndNot(Float4 a, Float4 b) { return ApplyBits(a, b, [](uint32 x, uint32 y) { return ~x & y; }); }
+
+    inline Float4 Select(Float4 mask, Float4 ifTrue, Float4 ifFalse) { return BitOr(BitAnd(mask, ifTrue), BitAndNot(mask, ifFalse)); }
+
+    inline int32 MoveMask(Float4 value)
+    {
+        int32 result = 0;
+
+        for (int32 i = 0; i < 4; i++)
+            result |= static_cast<int32>(std::bit_cast<uint32>(value.v[i]) >> 31) << i;
+
+        return result;
+    }
+
+    inline Float4 Truncate(Float4 value) { return Float4 { std::trunc(value.v[0]), std::trunc(value.v[1]), std::trunc(value.v[2]), std::trunc(value.v[3]) }; }
+    inline Float4 Floor(Float4 value) { return Float4 { std::floor(value.v[0]), std::floor(value.v[1]), std::floor(value.v[2]), std::floor(value.v[3]) }; }
+#endif
+
+    template<int32 Lane>
+    inline Float4 SplatLane(Float4 value) { return Swizzle<Lane, Lane, Lane, Lane>(value); }
+
+    inline Float4 Abs(Float4 value) { return BitAndNot(Splat(-0.0f), value); }
+    inline Float4 Negate(Float4 value) { return BitXor(Splat(-0.0f), value); }
+
+    inline Float4 Length3(Float4 value) { return Sqrt(Dot3(value, value)); }
+
+    inline Float4 Normalize3(Float4 value)
+    {
+        Float4 length = Length3(value);
+        return GetX(length) > 0.0f ? Div(value, length) : Zero4();
+    }
+
+    inline Float4 Cross3(Float4 a, Float4 b)
+    {
+        Float4 aYZX = Swizzle<1, 2, 0, 3>(a);
+        Float4 bYZX = Swizzle<1, 2, 0, 3>(b);
+        Float4 result = NegMulAdd(aYZX, b, Mul(a, bYZX));
+        return Swizzle<1, 2, 0, 3>(result);
+    }
+
+    // Row-vector transform: value * rows, the convention used by Matrix4x4F
+    inline Float4 Transform(Float4 value, const Float4 rows[4])
+    {
+        Float4 result = Mul(SplatLane<0>(value), rows[0]);
+        result = MulAdd(SplatLane<1>(value), rows[1], result);
+        result = MulAdd(SplatLane<2>(value), rows[2], result);
+        return MulAdd(SplatLane<3>(value), rows[3], result);
+    }
+
+    // ─────────────────────────────────────────────
+    // Float8, 8 lanes used by the batch kernels. A native register with AVX2, a pair of Float4 with SSE4
+    // ─────────────────────────────────────────────
+
+#if defined(BYTEENGINE_MATH_SIMD_AVX2)
+    using Float8 = __m256;
+
+    inline Float8 Load8(const float* source) { return _mm256_loadu_ps(source); }
+    inline void Store8(float* destination, Float8 value) { _mm256_storeu_ps(destination, value); }
+
+    inline Float8 Splat8(float value) { return _mm256_set1_ps(value); }
+    inline Float8 Zero8() { return _mm256_setzero_ps(); }
+
+    inline Float8 Add(Float8 a, Float8 b) { return _mm256_add_ps(a, b); }
+    inline Float8 Sub(Float8 a, Float8 b) { return _mm256_sub_ps(a, b); }
+    inline Float8 Mul(Float8 a, Float8 b) { return _mm256_mul_ps(a, b); }
+    inline Float8 Div(Float8 a, Float8 b) { return _mm256_div_ps(a, b); }
+    inline Float8 Sqrt(Float8 value) { return _mm256_sqrt_ps(value); }
+    inline Float8 Min(Float8 a, Float8 b) { return _mm256_min_ps(a, b); }
+    inline Float8 Max(Float8 a, Float8 b) { return _mm256_max_ps(a, b); }
+    inline Float8 MulAdd(Float8 a, Float8 b, Float8 c) { return _mm256_fmadd_ps(a, b, c); }
+    inline Float8 NegMulAdd(Float8 a, Float8 b, Float8 c) { return _mm256_fnmadd_ps(a, b, c); }
+
+    inline Float8 CompareEqual(Float8 a, Float8 b) { return _mm256_cmp_ps(a, b, _CMP_EQ_OQ); }
+    inline Float8 CompareLess(Float8 a, Float8 b) { return _mm256_cmp_ps(a, b, _CMP_LT_OQ); }
+    inline Float8 CompareLessEqual(Float8 a, Float8 b) { return _mm256_cmp_ps(a, b, _CMP_LE_OQ); }
+    inline Float8 CompareGreater(Float8 a, Float8 b) { return _mm256_cmp_ps(a, b, _CMP_GT_OQ); }
+    inline Float8 CompareGreaterEqual(Float8 a, Float8 b) { return _mm256_cmp_ps(a, b, _CMP_GE_OQ); }
+
+    inline Float8 BitAnd(Float8 a, Float8 b) { return _mm256_and_ps(a, b); }
+    inline Float8 BitOr(Float8 a, Float8 b) { return _mm256_or_ps(a, b); }
+    inline Float8 BitXor(Float8 a, Float8 b) { return _mm256_xor_ps(a, b); }
+    inline Float8 BitAndNot(Float8 a, Float8 b) { return _mm256_andnot_ps(a, b); }
+
+    inline Float8 Select(Float8 mask, Float8 ifTrue, Float8 ifFalse) { return _mm256_blendv_ps(ifFalse, ifTrue, mask); }
+    inline int32 MoveMask(Float8 value) { return _mm256_movemask_ps(value); }
+
+    inline Float8 Truncate(Float8 value) { return _mm256_round_ps(value, _MM_FROUND_TO_ZERO | _MM_FROUND_NO_EXC); }
+    inline Float8 Floor(Float8 value) { return _mm256_floor_ps(value); }
+
+    // Loads 8 packed xyz triplets (24 floats) and splits them into one register per component.
+    // Each 128-bit half holds 4 triplets, so the shuffles below never cross lanes.
+    inline void Load3x8(const float* source, Float8& x, Float8& y, Float8& z)
+    {
+        __m256 m03 = _mm256_insertf128_ps(_mm256_castps128_ps256(_mm_loadu_ps(source)), _mm_loadu_ps(source + 12), 1);
+        __m256 m14 = _mm256_insertf128_ps(_mm256_castps128_ps256(_mm_loadu_ps(source + 4)), _mm_loadu_ps(source + 16), 1);
+        __m256 m25 = _mm256_insertf128_ps(_mm256_castps128_ps256(_mm_loadu_ps(source + 8)), _mm_loadu_ps(source + 20), 1);
+
+        __m256 xy = _mm256_shuffle_ps(m14, m25, _MM_SHUFFLE(2, 1, 3, 2));
+        __m256 yz = _mm256_shuffle_ps(m03, m14, _MM_SHUFFLE(1, 0, 2, 1));
+
+        x = _mm256_shuffle_ps(m03, xy, _MM_SHUFFLE(2, 0, 3, 0));
+        y = _mm256_shuffle_ps(yz, xy, _MM_SHUFFLE(3, 1, 2, 0));
+        z = _mm256_shuffle_ps(yz, m25, _MM_SHUFFLE(3, 0, 3, 1));
+    }
+
+    // Inverse of Load3x8
+    inline void Store3x8(float* destination, Float8 x, Float8 y, Float8 z)
+    {
+        __m256 rxy = _mm256_shuffle_ps(x, y, _MM_SHUFFLE(2, 0, 2, 0));
+        __m256 ryz = _mm256_shuffle_ps(y, z, _MM_SHUFFLE(3, 1, 3, 1));
+        __m256 rzx = _mm256_shuffle_ps(z, x, _MM_SHUFFLE(3, 1, 2, 0));
+
+        __m256 m03 = _mm256_shuffle_ps(rxy, rzx, _MM_SHUFFLE(2, 0, 2, 0));
+        __m256 m14 = _mm256_shuffle_ps(ryz, rxy, _MM_SHUFFLE(3, 1, 2, 0));
+        __m256 m25 = _mm256_shuffle_ps(rzx, ryz, _MM_SHUFFLE(3, 1, 3, 1));
+
+        _mm_storeu_ps(destination, _mm256_castps256_ps128(m03));
+        _mm_storeu_ps(destination + 4, _mm256_castps256_ps128(m14));
+        _mm_storeu_ps(destination + 8, _mm256_castps256_ps128(m25));
+        _mm_storeu_ps(destination + 12, _mm256_extractf128_ps(m03, 1));
+        _mm_storeu_ps(destination + 16, _mm256_extractf128_ps(m14, 1));
+        _mm_storeu_ps(destination + 20, _mm256_extractf128_ps(m25, 1));
+    }
+#else
+    struct Float8
+    {
+        Float4 lo;
+        Float4 hi;
+    };
+
+    inline Float8 Load8(const float* source) { return Float8 { Load4(source), Load4(source + 4) }; }
+
+    inline void Store8(float* destination, Float8 value)
+    {
+        Store4(destination, value.lo);
+        Store4(destination + 4, value.hi);
+    }
+
+    inline Float8 Splat8(float value) { return Float8 { Splat(value), Splat(value) }; }
+    inline Float8 Zero8() { return Float8 { Zero4(), Zero4() }; }
+
+    inline Float8 Add(Float8 a, Float8 b) { return Float8 { Add(a.lo, b.lo), Add(a.hi, b.hi) }; }
+    inline Float8 Sub(Float8 a, Float8 b) { return Float8 { Sub(a.lo, b.lo), Sub(a.hi, b.hi) }; }
+    inline Float8 Mul(Float8 a, Float8 b) { return Float8 { Mul(a.lo, b.lo), Mul(a.hi, b.hi) }; }
+    inline Float8 Div(Float8 a, Float8 b) { return Float8 { Div(a.lo, b.lo), Div(a.hi, b.hi) }; }
+    inline Float8 Sqrt(Float8 value) { return Float8 { Sqrt(value.lo), Sqrt(value.hi) }; }
+    inline Float8 Min(Float8 a, Float8 b) { return Float8 { Min(a.lo, b.lo), Min(a.hi, b.hi) }; }
+    inline Float8 Max(Float8 a, Float8 b) { return Float8 { Max(a.lo, b.lo), Max(a.hi, b.hi) }; }
+    inline Float8 MulAdd(Float8 a, Float8 b, Float8 c) { return Float8 { MulAdd(a.lo, b.lo, c.lo), MulAdd(a.hi, b.hi, c.hi) }; }
+    inline Float8 NegMulAdd(Float8 a, Float8 b, Float8 c) { return Float8 { NegMulAdd(a.lo, b.lo, c.lo), NegMulAdd(a.hi, b.hi, c.hi) }; }
+
+    inline Float8 CompareEqual(Float8 a, Float8 b) { return Float8 { CompareEqual(a.lo, b.lo), CompareEqual(a.hi, b.hi) }; }
+    inline Float8 CompareLess(Float8 a, Float8 b) { return Float8 { CompareLess(a.lo, b.lo), CompareLess(a.hi, b.hi) }; }
+    inline Float8 CompareLessEqual(Float8 a, Float8 b) { return Float8 { CompareLessEqual(a.lo, b.lo), CompareLessEqual(a.hi, b.hi) }; }
+    inline Float8 CompareGreater(Float8 a, Float8 b) { return Float8 { CompareGreater(a.lo, b.lo), CompareGreater(a.hi, b.hi) }; }
+    inline Float8 CompareGreaterEqual(Float8 a, Float8 b) { return Float8 { CompareGreaterEqual(a.lo, b.lo), CompareGreaterEqual(a.hi, b.hi) }; }
+
+    inline Float8 BitAnd(Float8 a, Float8 b) { return Float8 { BitAnd(a.lo, b.lo), BitAnd(a.hi, b.hi) }; }
+    inline Float8 BitOr(Float8 a, Float8 b) { return Float8 { BitOr(a.lo, b.lo), BitOr(a.hi, b.hi) }; }
+    inline Float8 BitXor(Float8 a, Float8 b) { return Float8 { BitXor(a.lo, b.lo), BitXor(a.hi, b.hi) }; }
+    inline Float8 BitAndNot(Float8 a, Float8 b) { return Float8 { BitAndNot(a.lo, b.lo), BitAndNot(a.hi, b.hi) }; }
+
+    inline Float8 Select(Float8 mask, Float8 ifTrue, Float8 ifFalse) { return Float8 { Select(mask.lo, ifTrue.lo, ifFalse.lo), Select(mask.hi, ifTrue.hi, ifFalse.hi) }; }
+    inline int32 MoveMask(Float8 value) { return MoveMask(value.lo) | (MoveMask(value.hi) << 4); }
+
+    inline Float8 Truncate(Float8 value) { return Float8 { Truncate(value.lo), Truncate(value.hi) }; }
+    inline Float8 Floor(Float8 value) { return Float8 { Floor(value.lo), Floor(value.hi) }; }
+
+    // Loads 4 packed xyz triplets (12 floats) and splits them into one register per component
+    inline void Load3x4(const float* source, Float4& x, Float4& y, Float4& z)
+    {
+        Float4 m0 = Load4(source);
+        Float4 m1 = Load4(source + 4);
+        Float4 m2 = Load4(source + 8);
+
+        Float4 xy = Shuffle<2, 3, 1, 2>(m1, m2);
+        Float4 yz = Shuffle<1, 2, 0, 1>(m0, m1);
+
+        x = Shuffle<0, 3, 0, 2>(m0, xy);
+        y = Shuffle<0, 2, 1, 3>(yz, xy);
+        z = Shuffle<1, 3, 0, 3>(yz, m2);
+    }
+
+    // Inverse of Load3x4
+    inline void Store3x4(float* destination, Float4 x, Float4 y, Float4 z)
+    {
+        Float4 rxy = Shuffle<0, 2, 0, 2>(x, y);
+        Float4 ryz = Shuffle<1, 3, 1, 3>(y, z);
+        Float4 rzx = Shuffle<0, 2, 1, 3>(z, x);
+
+        Store4(destination, Shuffle<0, 2, 0, 2>(rxy, rzx));
+        Store4(destination + 4, Shuffle<0, 2, 1, 3>(ryz, rxy));
+        Store4(destination + 8, Shuffle<1, 3, 1, 3>(rzx, ryz));
+    }
+
+    inline void Load3x8(const float* source, Float8& x, Float8& y, Float8& z)
+    {
+        Load3x4(source, x.lo, y.lo, z.lo);
+        Load3x4(source + 12, x.hi, y.hi, z.hi);
+    }
+
+    inline void Store3x8(float* destination, Float8 x, Float8 y, Float8 z)
+    {
+        Store3x4(destination, x.lo, y.lo, z.lo);
+        Store3x4(destination + 12, x.hi, y.hi, z.hi);
+    }
+#endif
+
+    inline Float8 Abs(Float8 value) { return BitAndNot(Splat8(-0.0f), value); }
+    inline Float8 Negate(Float8 value) { return BitXor(Splat8(-0.0f), value); }
+
+    // ─────────────────────────────────────────────
+    // Int4 and Int8, 4 and 8 lanes of int32. Used for bit manipulation, conversions and hashing
+    // ─────────────────────────────────────────────
+
+#if defined(BYTEENGINE_MATH_SIMD_AVX2) || defined(BYTEENGINE_MATH_SIMD_SSE4)
+    using Int4 = __m128i;
+
+    inline Int4 Load4(const int32* source) { return _mm_loadu_si128(reinterpret_cast<const __m128i*>(source)); }
+    inline void Store4(int32* destination, Int4 value) { _mm_storeu_si128(reinterpret_cast<__m128i*>(destination), value); }
+
+    inline Int4 SplatInt4(int32 value) { return _mm_set1_epi32(value); }
+
+    inline Int4 Add(Int4 a, Int4 b) { return _mm_add_epi32(a, b); }
+    inline Int4 Sub(Int4 a, Int4 b) { return _mm_sub_epi32(a, b); }
+    // Low 32 bits of the product
+    inline Int4 Mul(Int4 a, Int4 b) { return _mm_mullo_epi32(a, b); }
+
+    // High 32 bits of the unsigned 64-bit product
+    inline Int4 MulHigh(Int4 a, Int4 b)
+    {
+        __m128i even = _mm_srli_epi64(_mm_mul_epu32(a, b), 32);
+        __m128i odd = _mm_mul_epu32(_mm_srli_epi64(a, 32), _mm_srli_epi64(b, 32));
+        return _mm_blend_epi16(even, odd, 0xCC);
+    }
+
+    inline Int4 Min(Int4 a, Int4 b) { return _mm_min_epi32(a, b); }
+    inline Int4 Max(Int4 a, Int4 b) { return _mm_max_epi32(a, b); }
+
+    inline Int4 BitAnd(Int4 a, Int4 b) { return _mm_and_si128(a, b); }
+    inline Int4 BitOr(Int4 a, Int4 b) { return _mm_or_si128(a, b); }
+    inline Int4 BitXor(Int4 a, Int4 b) { return _mm_xor_si128(a, b); }
+    inline Int4 BitAndNot(Int4 a, Int4 b) { return _mm_andnot_si128(a, b); }
+
+    template<int32 Bits>
+    inline Int4 ShiftLeft(Int4 value) { return _mm_slli_epi32(value, Bits); }
+    // Shifts in zeros
+    template<int32 Bits>
+    inline Int4 ShiftRight(Int4 value) { return _mm_srli_epi32(value, Bits); }
+    // Shifts in the sign bit
+    template<int32 Bits>
+    inline Int4 ShiftRightArithmetic(Int4 value) { return _mm_srai_epi32(value, Bits); }
+
+    inline Int4 CompareEqual(Int4 a, Int4 b) { return _mm_cmpeq_epi32(a, b); }
+    inline Int4 CompareGreater(Int4 a, Int4 b) { return _mm_cmpgt_epi32(a, b); }
+    inline Int4 Select(Int4 mask, Int4 ifTrue, Int4 ifFalse) { return _mm_blendv_epi8(ifFalse, ifTrue, mask); }
+
+    inline Float4 ConvertToFloat(Int4 value) { return _mm_cvtepi32_ps(value); }
+    // Rounds to nearest even
+    inline Int4 ConvertToInt(Float4 value) { return _mm_cvtps_epi32(value); }
+    inline Int4 TruncateToInt(Float4 value) { return _mm_cvttps_epi32(value); }
+    inline Int4 AsInt(Float4 value) { return _mm_castps_si128(value); }
+    inline Float4 AsFloat(Int4 value) { return _mm_castsi128_ps(value); }
+
+    // Zero extends 4 bytes to 4 lanes
+    inline Int4 LoadBytes4(const uint8* source)
+    {
+        int32 packed;
+        std::memcpy(&packed, source, sizeof(packed));
+        return _mm_cvtepu8_epi32(_mm_cvtsi32_si128(packed));
+    }
+
+    // Saturates each lane to [0, 255] and stores it as a byte
+    inline void StoreBytes4(uint8* destination, Int4 value)
+    {
+        __m128i words = _mm_packus_epi32(value, value);
+        int32 packed = _mm_cvtsi128_si32(_mm_packus_epi16(words, words));
+        std::memcpy(destination, &packed, sizeof(packed));
+    }
+
+    // Zero extends 4 16-bit values to 4 lanes
+    inline Int4 LoadWords4(const uint16* source) { return _mm_cvtepu16_epi32(_mm_loadl_epi64(reinterpret_cast<const __m128i*>(source))); }
+
+    // Saturates each lane to [0, 65535] and stores it as a 16-bit value
+    inline void StoreWords4(uint16* destination, Int4 value) { _mm_storel_epi64(reinterpret_cast<__m128i*>(destination), _mm_packus_epi32(value, value)); }
+#else
+    struct Int4
+    {
+        int32 v[4];
+    };
+
+    inline Int4 Load4(const int32* source) { return Int4 { source[0], source[1], source[2], source[3] }; }
+
+    inline void Store4(int32* destination, Int4 value)
+    {
+        for (int32 i = 0; i < 4; i++)
+            destination[i] = value.v[i];
+    }
+
+    inline Int4 SplatInt4(int32 value) { return Int4 { value, value, value, value }; }
+
+    // Integer lanes are computed as uint32 so overflow wraps like the SIMD instructions
+    template<typename Op>
+    inline Int4 Apply(Int4 a, Int4 b, Op op)
+    {
+        Int4 result;
+
+        for (int32 i = 0; i < 4; i++)
+            result.v[i] = static_cast<int32>(op(static_cast<uint32>(a.v[i]), static_cast<uint32>(b.v[i])));
+
+        return result;
+    }
+
+    template<typename Op>
+    inline Int4 ApplySigned(Int4 a, Int4 b, Op op)
+    {
+        Int4 result;
+
+        for (int32 i = 0; i < 4; i++)
+            result.v[i] = op(a.v[i], b.v[i]);
+
+        return result;
+    }
+
+    inline Int4 Add(Int4 a, Int4 b) { return Apply(a, b, [](uint32 x, uint32 y) { return x + y; }); }
+    inline Int4 Sub(Int4 a, Int4 b) { return Apply(a, b, [](uint32 x, uint32 y) { return x - y; }); }
+    inline Int4 Mul(Int4 a, Int4 b) { return Apply(a, b, [](uint32 x, uint32 y) { return x * y; }); }
+    inline Int4 MulHigh(Int4 a, Int4 b) { return Apply(a, b, [](uint32 x, uint32 y) { return static_cast<uint32>((static_cast<uint64>(x) * y) >> 32); }); }
+    inline Int4 Min(Int4 a, Int4 b) { return ApplySigned(a, b, [](int32 x, int32 y) { return x < y ? x : y; }); }
+    inline Int4 Max(Int4 a, Int4 b) { return ApplySigned(a, b, [](int32 x, int32 y) { return x > y ? x : y; }); }
+
+    inline Int4 BitAnd(Int4 a, Int4 b) { return Apply(a, b, [](uint32 x, uint32 y) { return x & y; }); }
+    inline Int4 BitOr(Int4 a, Int4 b) { return Apply(a, b, [](uint32 x, uint32 y) { return x | y; }); }
+    inline Int4 BitXor(Int4 a, Int4 b) { return Apply(a, b, [](uint32 x, uint32 y) { return x ^ y; }); }
+    inline Int4 BitAndNot(Int4 a, Int4 b) { return Apply(a, b, [](uint32 x, uint32 y) { return ~x & y; }); }
+
+    template<int32 Bits>
+    inline Int4 ShiftLeft(Int4 value) { return Apply(value, value, [](uint32 x, uint32) { return x << Bits; }); }
+
+    template<int32 Bits>
+    inline Int4 ShiftRight(Int4 value) { return Apply(value, value, [](uint32 x, uint32) { return x >> Bits; }); }
+
+    template<int32 Bits>
+    inline Int4 ShiftRightArithmetic(Int4 value) { return ApplySigned(value, value, [](int32 x, int32) { return x >> Bits; }); }
+
+    inline Int4 CompareEqual(Int4 a, Int4 b) { return ApplySigned(a, b, [](int32 x, int32 y) { return x == y ? -1 : 0; }); }
+    inline Int4 CompareGreater(Int4 a, Int4 b) { return ApplySigned(a, b, [](int32 x, int32 y) { return x > y ? -1 : 0; }); }
+    inline Int4 Select(Int4 mask, Int4 ifTrue, Int4 ifFalse) { return BitOr(BitAnd(mask, ifTrue), BitAndNot(mask, ifFalse)); }
+
+    inline Float4 ConvertToFloat(Int4 value)
+    {
+        return Float4 { static_cast<float>(value.v[0]), static_cast<float>(value.v[1]), static_cast<float>(value.v[2]), static_cast<float>(value.v[3]) };
+    }
+
+    inline Int4 ConvertToInt(Float4 value)
+    {
+        Int4 result;
+
+        for (int32 i = 0; i < 4; i++)
+            result.v[i] = static_cast<int32>(std::nearbyint(value.v[i]));
+
+        return result;
+    }
+
+    inline Int4 TruncateToInt(Float4 value)
+    {
+        return Int4 { static_cast<int32>(value.v[0]), static_cast<int32>(value.v[1]), static_cast<int32>(value.v[2]), static_cast<int32>(value.v[3]) };
+    }
+
+    inline Int4 AsInt(Float4 value) { return std::bit_cast<Int4>(value); }
+    inline Float4 AsFloat(Int4 value) { return std::bit_cast<Float4>(value); }
+
+    inline Int4 LoadBytes4(const uint8* source) { return Int4 { source[0], source[1], source[2], source[3] }; }
+
+    inline void StoreBytes4(uint8* destination, Int4 value)
+    {
+        for (int32 i = 0; i < 4; i++)
+            destination[i] = static_cast<uint8>(value.v[i] < 0 ? 0 : value.v[i] > 255 ? 255 : value.v[i]);
+    }
+
+    inline Int4 LoadWords4(const uint16* source) { return Int4 { source[0], source[1], source[2], source[3] }; }
+
+    inline void StoreWords4(uint16* destination, Int4 value)
+    {
+        for (int32 i = 0; i < 4; i++)
+            destination[i] = static_cast<uint16>(value.v[i] < 0 ? 0 : value.v[i] > 65535 ? 65535 : value.v[i]);
+    }
+#endif
+
+#if defined(BYTEENGINE_MATH_SIMD_AVX2)
+    using Int8 = __m256i;
+
+    inline Int8 Load8(const int32* source) { return _mm256_loadu_si256(reinterpret_cast<const __m256i*>(source)); }
+    inline void Store8(int32* destination, Int8 value) { _mm256_storeu_si256(reinterpret_cast<__m256i*>(destination), value); }
+
+    inline Int8 SplatInt8(int32 value) { return _mm256_set1_epi32(value); }
+
+    inline Int8 Add(Int8 a, Int8 b) { return _mm256_add_epi32(a, b); }
+    inline Int8 Sub(Int8 a, Int8 b) { return _mm256_sub_epi32(a, b); }
+    inline Int8 Mul(Int8 a, Int8 b) { return _mm256_mullo_epi32(a, b); }
+
+    inline Int8 MulHigh(Int8 a, Int8 b)
+    {
+        __m256i even = _mm256_srli_epi64(_mm256_mul_epu32(a, b), 32);
+        __m256i odd = _mm256_mul_epu32(_mm256_srli_epi64(a, 32), _mm256_srli_epi64(b, 32));
+        return _mm256_blend_epi32(even, odd, 0xAA);
+    }
+
+    inline Int8 Min(Int8 a, Int8 b) { return _mm256_min_epi32(a, b); }
+    inline Int8 Max(Int8 a, Int8 b) { return _mm256_max_epi32(a, b); }
+
+    inline Int8 BitAnd(Int8 a, Int8 b) { return _mm256_and_si256(a, b); }
+    inline Int8 BitOr(Int8 a, Int8 b) { return _mm256_or_si256(a, b); }
+    inline Int8 BitXor(Int8 a, Int8 b) { return _mm256_xor_si256(a, b); }
+    inline Int8 BitAndNot(Int8 a, Int8 b) { return _mm256_andnot_si256(a, b); }
+
+    template<int32 Bits>
+    inline Int8 ShiftLeft(Int8 value) { return _mm256_slli_epi32(value, Bits); }
+
+    template<int32 Bits>
+    inline Int8 ShiftRight(Int8 value) { return _mm256_srli_epi32(value, Bits); }
+
+    template<int32 Bits>
+    inline Int8 ShiftRightArithmetic(Int8 value) { return _mm256_srai_epi32(value, Bits); }
+
+    inline Int8 CompareEqual(Int8 a, Int8 b) { return _mm256_cmpeq_epi32(a, b); }
+    inline Int8 CompareGreater(Int8 a, Int8 b) { return _mm256_cmpgt_epi32(a, b); }
+    inline Int8 Select(Int8 mask, Int8 ifTrue, Int8 ifFalse) { return _mm256_blendv_epi8(ifFalse, ifTrue, mask); }
+
+    inline Float8 ConvertToFloat(Int8 value) { return _mm256_cvtepi32_ps(value); }
+    inline Int8 ConvertToInt(Float8 value) { return _mm256_cvtps_epi32(value); }
+    inline Int8 TruncateToInt(Float8 value) { return _mm256_cvttps_epi32(value); }
+    inline Int8 AsInt(Float8 value) { return _mm256_castps_si256(value); }
+    inline Float8 AsFloat(Int8 value) { return _mm256_castsi256_ps(value); }
+
+    // table[indices[i]] for each lane
+    inline Float8 Gather(const float* table, Int8 indices) { return _mm256_i32gather_ps(table, indices, 4); }
+
+    inline Int8 LoadBytes8(const uint8* source) { return _mm256_cvtepu8_epi32(_mm_loadl_epi64(reinterpret_cast<const __m128i*>(source))); }
+
+    inline void StoreBytes8(uint8* destination, Int8 value)
+    {
+        __m128i words = _mm_packus_epi32(_mm256_castsi256_si128(value), _mm256_extracti128_si256(value, 1));
+        _mm_storel_epi64(reinterpret_cast<__m128i*>(destination), _mm_packus_epi16(words, words));
+    }
+
+    inline Int8 LoadWords8(const uint16* source) { return _mm256_cvtepu16_epi32(_mm_loadu_si128(reinterpret_cast<const __m128i*>(source))); }
+
+    inline void StoreWords8(uint16* destination, Int8 value)
+    {
+        __m128i words = _mm_packus_epi32(_mm256_castsi256_si128(value), _mm256_extracti128_si256(value, 1));
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(destination), words);
+    }
+#else
+    struct Int8
+    {
+        Int4 lo;
+        Int4 hi;
+    };
+
+    inline Int8 Load8(const int32* source) { return Int8 { Load4(source), Load4(source + 4) }; }
+
+    inline void Store8(int32* destination, Int8 value)
+    {
+        Store4(destination, value.lo);
+        Store4(destination + 4, value.hi);
+    }
+
+    inline Int8 SplatInt8(int32 value) { return Int8 { SplatInt4(value), SplatInt4(value) }; }
+
+    inline Int8 Add(Int8 a, Int8 b) { return Int8 { Add(a.lo, b.lo), Add(a.hi, b.hi) }; }
+    inline Int8 Sub(Int8 a, Int8 b) { return Int8 { Sub(a.lo, b.lo), Sub(a.hi, b.hi) }; }
+    inline Int8 Mul(Int8 a, Int8 b) { return Int8 { Mul(a.lo, b.lo), Mul(a.hi, b.hi) }; }
+    inline Int8 MulHigh(Int8 a, Int8 b) { return Int8 { MulHigh(a.lo, b.lo), MulHigh(a.hi, b.hi) }; }
+    inline Int8 Min(Int8 a, Int8 b) { return Int8 { Min(a.lo, b.lo), Min(a.hi, b.hi) }; }
+    inline Int8 Max(Int8 a, Int8 b) { return Int8 { Max(a.lo, b.lo), Max(a.hi, b.hi) }; }
+
+    inline Int8 BitAnd(Int8 a, Int8 b) { return Int8 { BitAnd(a.lo, b.lo), BitAnd(a.hi, b.hi) }; }
+    inline Int8 BitOr(Int8 a, Int8 b) { return Int8 { BitOr(a.lo, b.lo), BitOr(a.hi, b.hi) }; }
+    inline Int8 BitXor(Int8 a, Int8 b) { return Int8 { BitXor(a.lo, b.lo), BitXor(a.hi, b.hi) }; }
+    inline Int8 BitAndNot(Int8 a, Int8 b) { return Int8 { BitAndNot(a.lo, b.lo), BitAndNot(a.hi, b.hi) }; }
+
+    template<int32 Bits>
+    inline Int8 ShiftLeft(Int8 value) { return Int8 { ShiftLeft<Bits>(value.lo), ShiftLeft<Bits>(value.hi) }; }
+
+    template<int32 Bits>
+    inline Int8 ShiftRight(Int8 value) { return Int8 { ShiftRight<Bits>(value.lo), ShiftRight<Bits>(value.hi) }; }
+
+    template<int32 Bits>
+    inline Int8 ShiftRightArithmetic(Int8 value) { return Int8 { ShiftRightArithmetic<Bits>(value.lo), ShiftRightArithmetic<Bits>(value.hi) }; }
+
+    inline Int8 CompareEqual(Int8 a, Int8 b) { return Int8 { CompareEqual(a.lo, b.lo), CompareEqual(a.hi, b.hi) }; }
+    inline Int8 CompareGreater(Int8 a, Int8 b) { return Int8 { CompareGreater(a.lo, b.lo), CompareGreater(a.hi, b.hi) }; }
+    inline Int8 Select(Int8 mask, Int8 ifTrue, Int8 ifFalse) { return Int8 { Select(mask.lo, ifTrue.lo, ifFalse.lo), Select(mask.hi, ifTrue.hi, ifFalse.hi) }; }
+
+    inline Float8 ConvertToFloat(Int8 value) { return Float8 { ConvertToFloat(value.lo), ConvertToFloat(value.hi) }; }
+    inline Int8 ConvertToInt(Float8 value) { return Int8 { ConvertToInt(value.lo), ConvertToInt(value.hi) }; }
+    inline Int8 TruncateToInt(Float8 value) { return Int8 { TruncateToInt(value.lo), TruncateToInt(value.hi) }; }
+    inline Int8 AsInt(Float8 value) { return Int8 { AsInt(value.lo), AsInt(value.hi) }; }
+    inline Float8 AsFloat(Int8 value) { return Float8 { AsFloat(value.lo), AsFloat(value.hi) }; }
+
+    inline Float8 Gather(const float* table, Int8 indices)
+    {
+        int32 lanes[8];
+        float result[8];
+        Store8(lanes, indices);
+
+        for (int32 i = 0; i < 8; i++)
+            result[i] = table[lanes[i]];
+
+        return Load8(result);
+    }
+
+    inline Int8 LoadBytes8(const uint8* source) { return Int8 { LoadBytes4(source), LoadBytes4(source + 4) }; }
+
+    inline void StoreBytes8(uint8* destination, Int8 value)
+    {
+        StoreBytes4(destination, value.lo);
+        StoreBytes4(destination + 4, value.hi);
+    }
+
+    inline Int8 LoadWords8(const uint16* source) { return Int8 { LoadWords4(source), LoadWords4(source + 4) }; }
+
+    inline void StoreWords8(uint16* destination, Int8 value)
+    {
+        StoreWords4(destination, value.lo);
+        StoreWords4(destination + 4, value.hi);
+    }
+#endif
+
+    // ─────────────────────────────────────────────
+    // Loops over streams, 8 elements per block
+    // ─────────────────────────────────────────────
+
+    constexpr size_t BlockWidth = 8;
+
+    // Lanes [offset, offset + count) of a stream. Partial blocks only occur at the tail, they go
+    // through a zero padded stack buffer so nothing is read or written past the end of the stream
+    template<bool Partial>
+    struct Block8
+    {
+        size_t offset;
+        size_t count;
+
+        Float8 Load(const float* stream) const
+        {
+            if constexpr (Partial)
+            {
+                float buffer[BlockWidth] = { };
+                std::memcpy(buffer, stream + offset, count * sizeof(float));
+                return Load8(buffer);
+            }
+            else
+            {
+                return Load8(stream + offset);
+            }
+        }
+
+        void Store(float* stream, Float8 value) const
+        {
+            if constexpr (Partial)
+            {
+                float buffer[BlockWidth];
+                Store8(buffer, value);
+                std::memcpy(stream + offset, buffer, count * sizeof(float));
+            }
+            else
+            {
+                Store8(stream + offset, value);
+            }
+        }
+
+        // Byte streams, each byte is zero extended to an int32 lane
+        Int8 LoadBytes(const uint8* stream) const
+        {
+            if constexpr (Partial)
+            {
+                uint8 buffer[BlockWidth] = { };
+                std::memcpy(buffer, stream + offset, count);
+                return LoadBytes8(buffer);
+            }
+            else
+            {
+                return LoadBytes8(stream + offset);
+            }
+        }
+
+        // Lanes are saturated to [0, 255]
+        void StoreBytes(uint8* stream, Int8 value) const
+        {
+            if constexpr (Partial)
+            {
+                uint8 buffer[BlockWidth];
+                StoreBytes8(buffer, value);
+                std::memcpy(stream + offset, buffer, count);
+            }
+            else
+            {
+                StoreBytes8(stream + offset, value);
+            }
+        }
+
+        // 16-bit streams, each value is zero extended to an int32 lane
+        Int8 LoadWords(const uint16* stream) const
+        {
+            if constexpr (Partial)
+            {
+                uint16 buffer[BlockWidth] = { };
+                std::memcpy(buffer, stream + offset, count * sizeof(uint16));
+                return LoadWords8(buffer);
+            }
+            else
+            {
+                return LoadWords8(stream + offset);
+            }
+        }
+
+        // Lanes are saturated to [0, 65535]
+        void StoreWords(uint16* stream, Int8 value) const
+        {
+            if constexpr (Partial)
+            {
+                uint16 buffer[BlockWidth];
+                StoreWords8(buffer, value);
+                std::memcpy(stream + offset, buffer, count * sizeof(uint16));
+            }
+            else
+            {
+                StoreWords8(stream + offset, value);
+            }
+        }
+
+        Int8 LoadInts(const int32* stream) const
+        {
+            if constexpr (Partial)
+            {
+                int32 buffer[BlockWidth] = { };
+                std::memcpy(buffer, stream + offset, count * sizeof(int32));
+                return Load8(buffer);
+            }
+            else
+            {
+                return Load8(stream + offset);
+            }
+        }
+
+        void StoreInts(int32* stream, Int8 value) const
+        {
+            if constexpr (Partial)
+            {
+                int32 buffer[BlockWidth];
+                Store8(buffer, value);
+                std::memcpy(stream + offset, buffer, count * sizeof(int32));
+            }
+            else
+            {
+                Store8(stream + offset, value);
+            }
+        }
+    };
+
+    // Calls body(Block8<false>) for every full block and body(Block8<true>) once for the tail
+    template<typename Body>
+    inline void ForEachBlock8(size_t count, Body&& body)
+    {
+        size_t offset = 0;
+
+        for (; offset + BlockWidth <= count; offset += BlockWidth)
+            body(Block8<false> { offset, BlockWidth });
+
+        if (offset < count)
+            body(Block8<true> { offset, count - offset });
+    }
+}
\ No newline at end of file
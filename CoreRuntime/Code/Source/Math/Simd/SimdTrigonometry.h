@@ -0,0 +1,226 @@
+﻿#pragma once
+
+#include "ByteEngine/Math/Math.h"
+#include "Math/Simd/SimdMath.h"
+
+// 8-lane versions of the scalar Fast and Precise Sin/Cos/SinCos in Math.h and Asin/Acos in Math.cpp.
+// Same range reduction and polynomials, so the error bounds match the scalar versions.
+// MulAdd is fused on FMA backends regardless of the optimization level, so results may differ from the scalar code in the last bits
+
+namespace ByteEngine::Math::Simd
+{
+    namespace Detail
+    {
+        // Maps the angle to y in [-pi/2, pi/2] with sin(y) = sin(angle) and cos(y) = sign * cos(angle)
+        inline Float8 ReduceAngle(Float8 angle, Float8& cosSign)
+        {
+            // Map angle to y in [-pi,pi], x = 2*pi*quotient + remainder.
+            // Quotient is rounded half away from zero like the scalar version
+            Float8 halfWithSign = BitOr(Splat8(0.5f), BitAnd(angle, Splat8(-0.0f)));
+            Float8 quotient = Truncate(Add(Mul(Splat8(1.0f / (Math::PI * 2.0f)), angle), halfWithSign));
+            Float8 y = Sub(angle, Mul(Splat8(Math::PI * 2.0f), quotient));
+
+            // y = pi - y when y > pi/2, y = -pi - y when y < -pi/2
+            Float8 reflect = CompareGreater(Abs(y), Splat8(Math::PI / 2.0f));
+            Float8 piWithSign = BitOr(Splat8(Math::PI), BitAnd(y, Splat8(-0.0f)));
+
+            cosSign = Select(reflect, Splat8(-1.0f), Splat8(1.0f));
+            return Select(reflect, Sub(piWithSign, y), y);
+        }
+
+        // 11-degree minimax approximation
+        inline Float8 SinPolynomial(Float8 y, Float8 y2)
+        {
+            Float8 p = MulAdd(Splat8(-2.3889859e-08f), y2, Splat8(2.7525562e-06f));
+            p = MulAdd(p, y2, Splat8(-0.00019840874f));
+            p = MulAdd(p, y2, Splat8(0.0083333310f));
+            p = MulAdd(p, y2, Splat8(-0.16666667f));
+            p = MulAdd(p, y2, Splat8(1.0f));
+            return Mul(p, y);
+        }
+
+        // 10-degree minimax approximation
+        inline Float8 CosPolynomial(Float8 y2)
+        {
+            Float8 p = MulAdd(Splat8(-2.6051615e-07f), y2, Splat8(2.4760495e-05f));
+            p = MulAdd(p, y2, Splat8(-0.0013888378f));
+            p = MulAdd(p, y2, Splat8(0.041666638f));
+            p = MulAdd(p, y2, Splat8(-0.5f));
+            return MulAdd(p, y2, Splat8(1.0f));
+        }
+
+        // acos(|value|), 7-degree minimax approximation
+        inline Float8 AcosOfAbs(Float8 value)
+        {
+            Float8 x = Abs(value);
+            Float8 root = Sqrt(Max(Sub(Splat8(1.0f), x), Zero8()));
+
+            Float8 p = MulAdd(Splat8(-0.0012624911f), x, Splat8(0.0066700901f));
+            p = MulAdd(p, x, Splat8(-0.0170881256f));
+            p = MulAdd(p, x, Splat8(0.0308918810f));
+            p = MulAdd(p, x, Splat8(-0.0501743046f));
+            p = MulAdd(p, x, Splat8(0.0889789874f));
+            p = MulAdd(p, x, Splat8(-0.2145988016f));
+            p = MulAdd(p, x, Splat8(1.5707963050f));
+            return Mul(p, root);
+        }
+
+        // angle = quadrant * pi/2 + result, result in [-pi/4, pi/4]. Same rounding and split as Math::Precise
+        inline Float8 ReduceQuadrant(Float8 angle, Int8& quadrant)
+        {
+            Float8 halfWithSign = BitOr(Splat8(0.5f), BitAnd(angle, Splat8(-0.0f)));
+            Float8 q = Truncate(Add(Mul(angle, Splat8(2.0f / Math::PI)), halfWithSign));
+            quadrant = ConvertToInt(q);
+
+            Float8 x = NegMulAdd(q, Splat8(1.5703125f), angle);
+            x = NegMulAdd(q, Splat8(4.837512969970703125e-4f), x);
+            return NegMulAdd(q, Splat8(7.54978995489188216e-8f), x);
+        }
+
+        inline Float8 PreciseSinPolynomial(Float8 x, Float8 x2)
+        {
+            Float8 p = MulAdd(Splat8(-1.9515295891e-4f), x2, Splat8(8.3321608736e-3f));
+            p = MulAdd(p, x2, Splat8(-1.6666654611e-1f));
+            return MulAdd(Mul(p, x2), x, x);
+        }
+
+        inline Float8 PreciseCosPolynomial(Float8 x2)
+        {
+            Float8 p = MulAdd(Splat8(2.443315711809948e-5f), x2, Splat8(-1.388731625493765e-3f));
+            p = MulAdd(p, x2, Splat8(4.166664568298827e-2f));
+            return MulAdd(Mul(p, x2), x2, NegMulAdd(Splat8(0.5f), x2, Splat8(1.0f)));
+        }
+
+        // asin(|value|) with |value| clamped to 1 and large set where |value| > 0.5.
+        // For large lanes this is asin(sqrt((1 - |value|) / 2)), the caller finishes the identity
+        inline Float8 PreciseAsinOfAbs(Float8 value, Float8& large)
+        {
+            Float8 x = Min(Abs(value), Splat8(1.0f));
+            large = CompareGreater(x, Splat8(0.5f));
+
+            Float8 z = Select(large, Mul(Splat8(0.5f), Sub(Splat8(1.0f), x)), Mul(x, x));
+            Float8 s = Select(large, Sqrt(z), x);
+
+            Float8 p = MulAdd(Splat8(4.2163199048e-2f), z, Splat8(2.4181311049e-2f));
+            p = MulAdd(p, z, Splat8(4.5470025998e-2f));
+            p = MulAdd(p, z, Splat8(7.4953002686e-2f));
+            p = MulAdd(p, z, Splat8(1.6666752422e-1f));
+            return MulAdd(Mul(p, z), s, s);
+        }
+    }
+
+    struct FastTrigonometry
+    {
+        static Float8 Sin(Float8 angle)
+        {
+            Float8 cosSign;
+            Float8 y = Detail::ReduceAngle(angle, cosSign);
+            return Detail::SinPolynomial(y, Mul(y, y));
+        }
+
+        static Float8 Cos(Float8 angle)
+        {
+            Float8 cosSign;
+            Float8 y = Detail::ReduceAngle(angle, cosSign);
+            return Mul(cosSign, Detail::CosPolynomial(Mul(y, y)));
+        }
+
+        static void SinCos(Float8& sin, Float8& cos, Float8 angle)
+        {
+            Float8 cosSign;
+            Float8 y = Detail::ReduceAngle(angle, cosSign);
+            Float8 y2 = Mul(y, y);
+            sin = Detail::SinPolynomial(y, y2);
+            cos = Mul(cosSign, Detail::CosPolynomial(y2));
+        }
+
+        static Float8 Asin(Float8 value)
+        {
+            // acos(x) = pi - acos(-x) when x < 0, asin(x) = pi/2 - acos(x)
+            Float8 acos = Detail::AcosOfAbs(value);
+            Float8 halfPi = Splat8(Math::PI / 2.0f);
+            return Select(CompareGreaterEqual(value, Zero8()), Sub(halfPi, acos), Sub(acos, halfPi));
+        }
+
+        static Float8 Acos(Float8 value)
+        {
+            // acos(x) = pi - acos(-x) when x < 0
+            Float8 acos = Detail::AcosOfAbs(value);
+            return Select(CompareGreaterEqual(value, Zero8()), acos, Sub(Splat8(Math::PI), acos));
+        }
+    };
+
+    struct PreciseTrigonometry
+    {
+        static Float8 Sin(Float8 angle)
+        {
+            Int8 quadrant;
+            Float8 x = Detail::ReduceQuadrant(angle, quadrant);
+            Float8 x2 = Mul(x, x);
+
+            // Odd quadrants take the cos polynomial, quadrants 2 and 3 flip the sign
+            Float8 swap = AsFloat(ShiftRightArithmetic<31>(ShiftLeft<31>(quadrant)));
+            Float8 result = Select(swap, Detail::PreciseCosPolynomial(x2), Detail::PreciseSinPolynomial(x, x2));
+            return BitXor(result, AsFloat(BitAnd(ShiftLeft<30>(quadrant), SplatInt8(INT32_MIN))));
+        }
+
+        static Float8 Cos(Float8 angle)
+        {
+            Int8 quadrant;
+            Float8 x = Detail::ReduceQuadrant(angle, quadrant);
+            Float8 x2 = Mul(x, x);
+
+            Float8 swap = AsFloat(ShiftRightArithmetic<31>(ShiftLeft<31>(quadrant)));
+            Float8 result = Select(swap, Detail::PreciseSinPolynomial(x, x2), Detail::PreciseCosPolynomial(x2));
+            return BitXor(result, AsFloat(BitAnd(ShiftLeft<30>(Add(quadrant, SplatInt8(1))), SplatInt8(INT32_MIN))));
+        }
+
+        static void SinCos(Float8& sin, Float8& cos, Float8 angle)
+        {
+            Int8 quadrant;
+            Float8 x = Detail::ReduceQuadrant(angle, quadrant);
+            Float8 x2 = Mul(x, x);
+            Float8 s = Detail::PreciseSinPolynomial(x, x2);
+            Float8 c = Detail::PreciseCosPolynomial(x2);
+
+            Float8 swap = AsFloat(ShiftRightArithmetic<31>(ShiftLeft<31>(quadrant)));
+            sin = BitXor(Select(swap, c, s), AsFloat(BitAnd(ShiftLeft<30>(quadrant), SplatInt8(INT32_MIN))));
+            cos = BitXor(Select(swap, s, c), AsFloat(BitAnd(ShiftLeft<30>(Add(quadrant, SplatInt8(1))), SplatInt8(INT32_MIN))));
+        }
+
+        static Float8 Asin(Float8 value)
+        {
+            Float8 large;
+            Float8 result = Detail::PreciseAsinOfAbs(value, large);
+
+            // asin(x) = pi/2 - 2 * asin(sqrt((1 - x) / 2)) for x > 0.5
+            result = Select(large, NegMulAdd(Splat8(2.0f), result, Splat8(Math::PI / 2.0f)), result);
+            return BitOr(result, BitAnd(value, Splat8(-0.0f)));
+        }
+
+        static Float8 Acos(Float8 value)
+        {
+            Float8 large;
+            Float8 result = Detail::PreciseAsinOfAbs(value, large);
+            Float8 negative = CompareLess(value, Zero8());
+
+            // acos(x) = 2 * asin(sqrt((1 - x) / 2)) for x > 0.5, pi - that for x < -0.5, pi/2 - asin(x) otherwise
+            Float8 small = Select(negative, Add(Splat8(Math::PI / 2.0f), result), Sub(Splat8(Math::PI / 2.0f), result));
+            Float8 twice = Add(result, result);
+            return Select(large, Select(negative, Sub(Splat8(Math::PI), twice), twice), small);
+        }
+    };
+
+#if defined(BYTEENGINE_MATH_TRIG_PRECISE)
+    using Trigonometry = PreciseTrigonometry;
+#else
+    using Trigonometry = FastTrigonometry;
+#endif
+
+    // Variant selected with BYTEENGINE_MATH_TRIG, same as the scalar Math::Sin and friends
+    inline Float8 Sin(Float8 angle) { return Trigonometry::Sin(angle); }
+    inline Float8 Cos(Float8 angle) { return Trigonometry::Cos(angle); }
+    inline void SinCos(Float8& sin, Float8& cos, Float8 angle) { Trigonometry::SinCos(sin, cos, angle); }
+    inline Float8 Asin(Float8 value) { return Trigonometry::Asin(value); }
+    inline Float8 Acos(Float8 value) { return Trigonometry::Acos(value); }
+}
\ No newline at end of file
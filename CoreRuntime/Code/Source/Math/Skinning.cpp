@@ -0,0 +1,218 @@
+﻿#include <algorithm>
+
+#include "ByteEngine/Math/Skinning.h"
+#include "Math/ParallelFor.h"
+#include "Math/Simd/SimdMath.h"
+
+using namespace ByteEngine::Math::Simd;
+
+namespace ByteEngine::Math
+{
+    namespace
+    {
+        static_assert(sizeof(DualQuaternion) == 8 * sizeof(float));
+
+        // Blended 3x4 part of the bone matrices, rows 0-2 hold the linear part and row 3 the translation
+        constexpr int32 AffineElements[12] = { 0, 1, 2, 4, 5, 6, 8, 9, 10, 12, 13, 14 };
+
+        struct SkinningJob
+        {
+            const SkinInfluences& influences;
+            int32 influenceCount;
+            ConstVector3FStream positions;
+            ConstVector3FStream normals;
+            Vector3FStream skinnedPositions;
+            Vector3FStream skinnedNormals;
+        };
+
+        SkinningJob PrepareJob([[maybe_unused]] size_t boneCount, const SkinInfluences& influences, ConstVector3FStream positions, ConstVector3FStream normals,
+            Vector3FStream skinnedPositions, Vector3FStream skinnedNormals)
+        {
+            SkinningJob job { influences, influences.GetInfluenceCount(), positions, normals, skinnedPositions, skinnedNormals };
+
+            assert(skinnedPositions.Size() == positions.Size());
+            assert(normals.Size() == skinnedNormals.Size());
+            assert(normals.IsEmpty() || normals.Size() == positions.Size());
+            assert(boneCount > 0 || job.influenceCount == 0);
+
+            for (int32 k = 0; k < job.influenceCount; k++)
+            {
+                assert(influences.boneIndices[k].size() == positions.Size());
+                assert(influences.weights[k].size() == positions.Size());
+                assert(std::ranges::all_of(influences.boneIndices[k], [&](uint16 bone) { return bone < boneCount; }));
+            }
+
+            return job;
+        }
+
+        // Calls kernel(job, block) for every block of 8 vertices, vertex ranges are split between threads on block boundaries
+        template<typename Kernel>
+        void RunSkinning(const SkinningJob& job, uint32 threadCount, Kernel&& kernel)
+        {
+            ParallelFor(job.positions.Size(), threadCount, BlockWidth, [&](size_t first, size_t last)
+                {
+                    ForEachBlock8(last - first, [&](auto block)
+                        {
+                            block.offset += first;
+                            kernel(block);
+                        });
+                });
+        }
+
+        template<bool Partial>
+        void StoreNormalized(const Block8<Partial>& block, Vector3FStream stream, Float8 x, Float8 y, Float8 z)
+        {
+            Float8 lengthSquared = MulAdd(z, z, MulAdd(y, y, Mul(x, x)));
+            Float8 invLength = Div(Splat8(1.0f), Sqrt(lengthSquared));
+            Float8 scale = Select(CompareGreater(lengthSquared, Splat8(Math::Epsilon)), invLength, Splat8(1.0f));
+
+            block.Store(stream.x.data(), Mul(x, scale));
+            block.Store(stream.y.data(), Mul(y, scale));
+            block.Store(stream.z.data(), Mul(z, scale));
+        }
+    }
+
+    void Skinning::LinearBlend(std::span<const Matrix4x4F> bones, const SkinInfluences& influences, ConstVector3FStream positions, ConstVector3FStream normals,
+        Vector3FStream skinnedPositions, Vector3FStream skinnedNormals, uint32 threadCount)
+    {
+        SkinningJob job = PrepareJob(bones.size(), influences, positions, normals, skinnedPositions, skinnedNormals);
+        const float* palette = bones.empty() ? nullptr : bones[0].elements;
+
+        RunSkinning(job, threadCount, [&](const auto& block)
+            {
+                Float8 m[12];
+
+                for (Float8& element : m)
+                    element = Zero8();
+
+                // Padded tail lanes read bone 0 with weight 0
+                for (int32 k = 0; k < job.influenceCount; k++)
+                {
+                    Int8 offsets = ShiftLeft<4>(block.LoadWords(job.influences.boneIndices[k].data()));
+                    Float8 weight = block.Load(job.influences.weights[k].data());
+
+                    for (int32 i = 0; i < 12; i++)
+                        m[i] = MulAdd(Gather(palette + AffineElements[i], offsets), weight, m[i]);
+                }
+
+                Float8 px = block.Load(job.positions.x.data());
+                Float8 py = block.Load(job.positions.y.data());
+                Float8 pz = block.Load(job.positions.z.data());
+
+                block.Store(job.skinnedPositions.x.data(), MulAdd(pz, m[6], MulAdd(py, m[3], MulAdd(px, m[0], m[9]))));
+                block.Store(job.skinnedPositions.y.data(), MulAdd(pz, m[7], MulAdd(py, m[4], MulAdd(px, m[1], m[10]))));
+                block.Store(job.skinnedPositions.z.data(), MulAdd(pz, m[8], MulAdd(py, m[5], MulAdd(px, m[2], m[11]))));
+
+                if (job.normals.IsEmpty())
+                    return;
+
+                Float8 nx = block.Load(job.normals.x.data());
+                Float8 ny = block.Load(job.normals.y.data());
+                Float8 nz = block.Load(job.normals.z.data());
+
+                StoreNormalized(block, job.skinnedNormals,
+                    MulAdd(nz, m[6], MulAdd(ny, m[3], Mul(nx, m[0]))),
+                    MulAdd(nz, m[7], MulAdd(ny, m[4], Mul(nx, m[1]))),
+                    MulAdd(nz, m[8], MulAdd(ny, m[5], Mul(nx, m[2]))));
+            });
+    }
+
+    void Skinning::DualQuaternionBlend(std::span<const DualQuaternion> bones, const SkinInfluences& influences, ConstVector3FStream positions, ConstVector3FStream normals,
+        Vector3FStream skinnedPositions, Vector3FStream skinnedNormals, uint32 threadCount)
+    {
+        SkinningJob job = PrepareJob(bones.size(), influences, positions, normals, skinnedPositions, skinnedNormals);
+        const float* palette = bones.empty() ? nullptr : &bones[0].real.x;
+
+        RunSkinning(job, threadCount, [&](const auto& block)
+            {
+                // real xyzw followed by dual xyzw
+                Float8 q[8];
+                Float8 pivot[4];
+
+                for (Float8& element : q)
+                    element = Zero8();
+
+                for (int32 k = 0; k < job.influenceCount; k++)
+                {
+                    Int8 offsets = ShiftLeft<3>(block.LoadWords(job.influences.boneIndices[k].data()));
+                    Float8 weight = block.Load(job.influences.weights[k].data());
+                    Float8 bone[8];
+
+                    for (int32 i = 0; i < 8; i++)
+                        bone[i] = Gather(palette + i, offsets);
+
+                    // q and -q are the same rotation, bones on the other side of the first one are flipped so the blend takes the short path
+                    if (k == 0)
+                    {
+                        for (int32 i = 0; i < 4; i++)
+                            pivot[i] = bone[i];
+                    }
+                    else
+                    {
+                        Float8 dot = MulAdd(pivot[3], bone[3], MulAdd(pivot[2], bone[2], MulAdd(pivot[1], bone[1], Mul(pivot[0], bone[0]))));
+                        weight = BitXor(weight, BitAnd(dot, Splat8(-0.0f)));
+                    }
+
+                    for (int32 i = 0; i < 8; i++)
+                        q[i] = MulAdd(bone[i], weight, q[i]);
+                }
+
+                // Normalizing by the length of the real part keeps the dual part orthogonal to it up to blending error
+                Float8 lengthSquared = MulAdd(q[3], q[3], MulAdd(q[2], q[2], MulAdd(q[1], q[1], Mul(q[0], q[0]))));
+                Float8 invLength = Div(Splat8(1.0f), Sqrt(lengthSquared));
+                Float8 scale = Select(CompareGreater(lengthSquared, Splat8(Math::Epsilon)), invLength, Splat8(1.0f));
+
+                for (Float8& element : q)
+                    element = Mul(element, scale);
+
+                Float8 rx = q[0], ry = q[1], rz = q[2], rw = q[3];
+                Float8 dx = q[4], dy = q[5], dz = q[6], dw = q[7];
+                Float8 two = Splat8(2.0f);
+
+                // Translation 2 * (rw * d - dw * r + r x d)
+                Float8 tx = Mul(two, MulAdd(rw, dx, NegMulAdd(dw, rx, NegMulAdd(rz, dy, Mul(ry, dz)))));
+                Float8 ty = Mul(two, MulAdd(rw, dy, NegMulAdd(dw, ry, NegMulAdd(rx, dz, Mul(rz, dx)))));
+                Float8 tz = Mul(two, MulAdd(rw, dz, NegMulAdd(dw, rz, NegMulAdd(ry, dx, Mul(rx, dy)))));
+
+                // Same rotation as Quaternion::operator*(Vector3F): v + 2 * (w * (r x v) + r x (r x v))
+                auto rotate = [&](Float8 vx, Float8 vy, Float8 vz, Float8& ox, Float8& oy, Float8& oz)
+                    {
+                        Float8 ux = NegMulAdd(rz, vy, Mul(ry, vz));
+                        Float8 uy = NegMulAdd(rx, vz, Mul(rz, vx));
+                        Float8 uz = NegMulAdd(ry, vx, Mul(rx, vy));
+
+                        Float8 uux = NegMulAdd(rz, uy, Mul(ry, uz));
+                        Float8 uuy = NegMulAdd(rx, uz, Mul(rz, ux));
+                        Float8 uuz = NegMulAdd(ry, ux, Mul(rx, uy));
+
+                        ox = MulAdd(MulAdd(ux, rw, uux), two, vx);
+                        oy = MulAdd(MulAdd(uy, rw, uuy), two, vy);
+                        oz = MulAdd(MulAdd(uz, rw, uuz), two, vz);
+                    };
+
+                Float8 x, y, z;
+                rotate(block.Load(job.positions.x.data()), block.Load(job.positions.y.data()), block.Load(job.positions.z.data()), x, y, z);
+
+                block.Store(job.skinnedPositions.x.data(), Add(x, tx));
+                block.Store(job.skinnedPositions.y.data(), Add(y, ty));
+                block.Store(job.skinnedPositions.z.data(), Add(z, tz));
+
+                if (job.normals.IsEmpty())
+                    return;
+
+                rotate(block.Load(job.normals.x.data()), block.Load(job.normals.y.data()), block.Load(job.normals.z.data()), x, y, z);
+
+                block.Store(job.skinnedNormals.x.data(), x);
+                block.Store(job.skinnedNormals.y.data(), y);
+                block.Store(job.skinnedNormals.z.data(), z);
+            });
+    }
+
+    void Skinning::ToDualQuaternions(std::span<const Matrix4x4F> matrices, std::span<DualQuaternion> results)
+    {
+        assert(matrices.size() == results.size());
+
+        for (size_t i = 0; i < matrices.size(); i++)
+            results[i] = DualQuaternion::FromMatrix(matrices[i]);
+    }
+}
\ No newline at end of file
@@ -0,0 +1,376 @@
+﻿#include <algorithm>
+#include <type_traits>
+
+#include "ByteEngine/Math/TransformHierarchy.h"
+
+namespace ByteEngine::Math
+{
+    TransformHierarchy::NodeId TransformHierarchy::Create(NodeId parent, Vector3F position, Quaternion rotation, Vector3F scale)
+    {
+        uint32 parentIndex = parent == InvalidNode ? InvalidIndex : GetDenseIndex(parent);
+        uint32 depth = parentIndex == InvalidIndex ? 0 : depths[parentIndex] + 1;
+
+        NodeId id;
+
+        if (!freeIds.empty())
+        {
+            id = freeIds.back();
+            freeIds.pop_back();
+        }
+        else
+        {
+            id = static_cast<NodeId>(denseIndices.size());
+            denseIndices.push_back(InvalidIndex);
+        }
+
+        uint32 index = static_cast<uint32>(nodeIds.size());
+        denseIndices[id] = index;
+
+        localPositions.push_back(position);
+        localRotations.push_back(rotation);
+        localScales.push_back(scale);
+        worldMatrices.push_back(Matrix4x4F::Identity);
+        parents.push_back(InvalidIndex);
+        firstChildren.push_back(InvalidIndex);
+        nextSiblings.push_back(InvalidIndex);
+        depths.push_back(depth);
+        nodeIds.push_back(id);
+        dirtyFlags.push_back(0);
+        updateStamps.push_back(0);
+
+        if (parentIndex != InvalidIndex)
+            LinkChild(parentIndex, index);
+
+        MarkDirty(index);
+        return id;
+    }
+
+    void TransformHierarchy::Destroy(NodeId node)
+    {
+        uint32 root = GetDenseIndex(node);
+        UnlinkChild(root);
+
+        stack.clear();
+        stack.push_back(root);
+
+        while (!stack.empty())
+        {
+            uint32 index = stack.back();
+            stack.pop_back();
+
+            denseIndices[nodeIds[index]] = InvalidIndex;
+            freeIds.push_back(nodeIds[index]);
+            nodeIds[index] = InvalidNode;
+            destroyedCount++;
+
+            for (uint32 child = firstChildren[index]; child != InvalidIndex; child = nextSiblings[child])
+                stack.push_back(child);
+        }
+
+        orderDirty = true;
+    }
+
+    void TransformHierarchy::SetParent(NodeId node, NodeId parent)
+    {
+        uint32 index = GetDenseIndex(node);
+        uint32 parentIndex = parent == InvalidNode ? InvalidIndex : GetDenseIndex(parent);
+
+        if (parents[index] == parentIndex)
+            return;
+
+#ifndef NDEBUG
+        for (uint32 ancestor = parentIndex; ancestor != InvalidIndex; ancestor = parents[ancestor])
+            assert(ancestor != index && "A node cannot become a child of its own subtree");
+#endif
+
+        UnlinkChild(index);
+
+        if (parentIndex != InvalidIndex)
+            LinkChild(parentIndex, index);
+
+        // Depths of the whole subtree follow the new parent
+        depths[index] = parentIndex == InvalidIndex ? 0 : depths[parentIndex] + 1;
+
+        stack.clear();
+        stack.push_back(index);
+
+        while (!stack.empty())
+        {
+            uint32 current = stack.back();
+            stack.pop_back();
+
+            for (uint32 child = firstChildren[current]; child != InvalidIndex; child = nextSiblings[child])
+            {
+                depths[child] = depths[current] + 1;
+                stack.push_back(child);
+            }
+        }
+
+        // Descendants are always after the node, so only a later parent breaks the order
+        if (parentIndex != InvalidIndex && parentIndex > index)
+            orderDirty = true;
+
+        MarkDirty(index);
+    }
+
+    void TransformHierarchy::SetLocalPosition(NodeId node, Vector3F position)
+    {
+        uint32 index = GetDenseIndex(node);
+        localPositions[index] = position;
+        MarkDirty(index);
+    }
+
+    void TransformHierarchy::SetLocalRotation(NodeId node, Quaternion rotation)
+    {
+        uint32 index = GetDenseIndex(node);
+        localRotations[index] = rotation;
+        MarkDirty(index);
+    }
+
+    void TransformHierarchy::SetLocalScale(NodeId node, Vector3F scale)
+    {
+        uint32 index = GetDenseIndex(node);
+        localScales[index] = scale;
+        MarkDirty(index);
+    }
+
+    void TransformHierarchy::SetLocalTransform(NodeId node, Vector3F position, Quaternion rotation, Vector3F scale)
+    {
+        uint32 index = GetDenseIndex(node);
+        localPositions[index] = position;
+        localRotations[index] = rotation;
+        localScales[index] = scale;
+        MarkDirty(index);
+    }
+
+    size_t TransformHierarchy::Update()
+    {
+        if (orderDirty)
+            SortByDepth();
+
+        if (++updateStamp == 0)
+        {
+            std::fill(updateStamps.begin(), updateStamps.end(), 0);
+            updateStamp = 1;
+        }
+
+        size_t updatedCount = 0;
+
+        // With many dirty nodes one pass over the depth sorted arrays beats sorting the dirty list and walking subtrees
+        if (dirtyNodes.size() * SweepThreshold >= nodeIds.size())
+        {
+            // Children are always later in the arrays, so flagging them is enough to have them updated further on
+            for (uint32 index = 0; index < nodeIds.size(); index++)
+            {
+                if (!dirtyFlags[index])
+                    continue;
+
+                UpdateNode(index);
+                updatedCount++;
+
+                for (uint32 child = firstChildren[index]; child != InvalidIndex; child = nextSiblings[child])
+                    dirtyFlags[child] = 1;
+            }
+
+            dirtyNodes.clear();
+            return updatedCount;
+        }
+
+        // Dense indices in place of the ids. Ascending order visits parents before children,
+        // so a dirty node below another dirty node is already done when its turn comes
+        size_t rootCount = 0;
+
+        for (NodeId node : dirtyNodes)
+        {
+            if (IsValid(node))
+                dirtyNodes[rootCount++] = denseIndices[node];
+        }
+
+        dirtyNodes.resize(rootCount);
+        std::sort(dirtyNodes.begin(), dirtyNodes.end());
+
+        for (uint32 index : dirtyNodes)
+        {
+            if (updateStamps[index] != updateStamp)
+                updatedCount += UpdateSubtree(index);
+        }
+
+        dirtyNodes.clear();
+        return updatedCount;
+    }
+
+    void TransformHierarchy::Clear()
+    {
+        localPositions.clear();
+        localRotations.clear();
+        localScales.clear();
+        worldMatrices.clear();
+        parents.clear();
+        firstChildren.clear();
+        nextSiblings.clear();
+        depths.clear();
+        nodeIds.clear();
+        dirtyFlags.clear();
+        updateStamps.clear();
+        denseIndices.clear();
+        freeIds.clear();
+        dirtyNodes.clear();
+
+        destroyedCount = 0;
+        orderDirty = false;
+    }
+
+    TransformHierarchy::NodeId TransformHierarchy::GetParent(NodeId node) const
+    {
+        uint32 parent = parents[GetDenseIndex(node)];
+        return parent == InvalidIndex ? InvalidNode : nodeIds[parent];
+    }
+
+    void TransformHierarchy::MarkDirty(uint32 index)
+    {
+        if (dirtyFlags[index])
+            return;
+
+        dirtyFlags[index] = 1;
+        dirtyNodes.push_back(nodeIds[index]);
+    }
+
+    void TransformHierarchy::LinkChild(uint32 parent, uint32 child)
+    {
+        parents[child] = parent;
+        nextSiblings[child] = firstChildren[parent];
+        firstChildren[parent] = child;
+    }
+
+    void TransformHierarchy::UnlinkChild(uint32 child)
+    {
+        uint32 parent = parents[child];
+
+        if (parent == InvalidIndex)
+            return;
+
+        if (firstChildren[parent] == child)
+        {
+            firstChildren[parent] = nextSiblings[child];
+        }
+        else
+        {
+            uint32 previous = firstChildren[parent];
+
+            while (nextSiblings[previous] != child)
+                previous = nextSiblings[previous];
+
+            nextSiblings[previous] = nextSiblings[child];
+        }
+
+        parents[child] = InvalidIndex;
+        nextSiblings[child] = InvalidIndex;
+    }
+
+    void TransformHierarchy::SortByDepth()
+    {
+        uint32 count = static_cast<uint32>(nodeIds.size());
+        uint32 maxDepth = 0;
+
+        for (uint32 i = 0; i < count; i++)
+        {
+            if (nodeIds[i] != InvalidNode)
+                maxDepth = Math::Max(maxDepth, depths[i]);
+        }
+
+        // Counting sort, order[newIndex] = oldIndex
+        std::vector<uint32> offsets(static_cast<size_t>(maxDepth) + 2, 0);
+
+        for (uint32 i = 0; i < count; i++)
+        {
+            if (nodeIds[i] != InvalidNode)
+                offsets[depths[i] + 1]++;
+        }
+
+        for (size_t depth = 1; depth < offsets.size(); depth++)
+            offsets[depth] += offsets[depth - 1];
+
+        std::vector<uint32> order(count - destroyedCount);
+        std::vector<uint32> newIndices(count, InvalidIndex);
+
+        for (uint32 i = 0; i < count; i++)
+        {
+            if (nodeIds[i] != InvalidNode)
+                order[offsets[depths[i]]++] = i;
+        }
+
+        for (uint32 i = 0; i < order.size(); i++)
+            newIndices[order[i]] = i;
+
+        auto permute = [&](auto& values)
+            {
+                std::remove_reference_t<decltype(values)> sorted;
+                sorted.reserve(order.size());
+
+                for (uint32 oldIndex : order)
+                    sorted.push_back(values[oldIndex]);
+
+                values.swap(sorted);
+            };
+
+        // Destroyed subtrees were unlinked from their parents, so live links never point at them
+        auto remap = [&](std::vector<uint32>& indices)
+            {
+                permute(indices);
+
+                for (uint32& index : indices)
+                    index = index == InvalidIndex ? InvalidIndex : newIndices[index];
+            };
+
+        permute(localPositions);
+        permute(localRotations);
+        permute(localScales);
+        permute(worldMatrices);
+        permute(depths);
+        permute(nodeIds);
+        permute(dirtyFlags);
+        permute(updateStamps);
+
+        remap(parents);
+        remap(firstChildren);
+        remap(nextSiblings);
+
+        for (uint32 i = 0; i < nodeIds.size(); i++)
+            denseIndices[nodeIds[i]] = i;
+
+        destroyedCount = 0;
+        orderDirty = false;
+    }
+
+    size_t TransformHierarchy::UpdateSubtree(uint32 root)
+    {
+        size_t count = 0;
+
+        stack.clear();
+        stack.push_back(root);
+
+        while (!stack.empty())
+        {
+            uint32 index = stack.back();
+            stack.pop_back();
+
+            UpdateNode(index);
+            count++;
+
+            for (uint32 child = firstChildren[index]; child != InvalidIndex; child = nextSiblings[child])
+                stack.push_back(child);
+        }
+
+        return count;
+    }
+
+    void TransformHierarchy::UpdateNode(uint32 index)
+    {
+        Matrix4x4F local = Matrix4x4F::CreateTRS(localPositions[index], localRotations[index], localScales[index]);
+        uint32 parent = parents[index];
+
+        worldMatrices[index] = parent == InvalidIndex ? local : local.MultiplyAffine(worldMatrices[parent]);
+        dirtyFlags[index] = 0;
+        updateStamps[index] = updateStamp;
+    }
+}
\ No newline at end of file
@@ -0,0 +1,113 @@
+﻿#include "ByteEngine/Math/WorldTransform.h"
+#include "Math/Simd/SimdMath.h"
+
+using namespace ByteEngine::Math::Simd;
+
+namespace ByteEngine::Math
+{
+    namespace
+    {
+        // Matrix elements that differ between transforms: the scaled 3x3 rotation and the translation
+        enum MatrixLane : int32
+        {
+            Lane00, Lane01, Lane02,
+            Lane10, Lane11, Lane12,
+            Lane20, Lane21, Lane22,
+            LaneX, LaneY, LaneZ,
+            LaneCount
+        };
+    }
+
+    Matrix4x4F WorldTransform::ToCameraRelativeMatrix(Vector3D cameraPosition) const
+    {
+        return Matrix4x4F::CreateTRS(Math::ToRelative(position, cameraPosition), rotation, scale);
+    }
+
+    void WorldTransform::ToCameraRelativeMatrices(std::span<const WorldTransform> transforms, Vector3D cameraPosition, std::span<Matrix4x4F> results)
+    {
+        assert(transforms.size() == results.size());
+
+        ForEachBlock8(transforms.size(), [&](auto block)
+            {
+                // Transposed through the stack so each component gets its own register
+                float qx[BlockWidth] = { }, qy[BlockWidth] = { }, qz[BlockWidth] = { }, qw[BlockWidth] = { };
+                float sx[BlockWidth] = { }, sy[BlockWidth] = { }, sz[BlockWidth] = { };
+                float lanes[LaneCount][BlockWidth];
+
+                for (size_t i = 0; i < block.count; i++)
+                {
+                    const WorldTransform& transform = transforms[block.offset + i];
+                    Vector3F translation = Math::ToRelative(transform.position, cameraPosition);
+
+                    qx[i] = transform.rotation.x;
+                    qy[i] = transform.rotation.y;
+                    qz[i] = transform.rotation.z;
+                    qw[i] = transform.rotation.w;
+                    sx[i] = transform.scale.x;
+                    sy[i] = transform.scale.y;
+                    sz[i] = transform.scale.z;
+                    lanes[LaneX][i] = translation.x;
+                    lanes[LaneY][i] = translation.y;
+                    lanes[LaneZ][i] = translation.z;
+                }
+
+                Float8 x = Load8(qx);
+                Float8 y = Load8(qy);
+                Float8 z = Load8(qz);
+                Float8 w = Load8(qw);
+
+                // Same terms as Matrix4x4F::CreateRotation
+                Float8 xx = Mul(x, x);
+                Float8 yy = Mul(y, y);
+                Float8 zz = Mul(z, z);
+                Float8 xy = Mul(x, y);
+                Float8 xz = Mul(x, z);
+                Float8 yz = Mul(y, z);
+                Float8 wx = Mul(w, x);
+                Float8 wy = Mul(w, y);
+                Float8 wz = Mul(w, z);
+
+                Float8 one = Splat8(1.0f);
+                Float8 two = Splat8(2.0f);
+                Float8 scaleX = Load8(sx);
+                Float8 scaleY = Load8(sy);
+                Float8 scaleZ = Load8(sz);
+
+                Store8(lanes[Lane00], Mul(NegMulAdd(two, Add(yy, zz), one), scaleX));
+                Store8(lanes[Lane01], Mul(Mul(two, Add(xy, wz)), scaleX));
+                Store8(lanes[Lane02], Mul(Mul(two, Sub(xz, wy)), scaleX));
+                Store8(lanes[Lane10], Mul(Mul(two, Sub(xy, wz)), scaleY));
+                Store8(lanes[Lane11], Mul(NegMulAdd(two, Add(xx, zz), one), scaleY));
+                Store8(lanes[Lane12], Mul(Mul(two, Add(yz, wx)), scaleY));
+                Store8(lanes[Lane20], Mul(Mul(two, Add(xz, wy)), scaleZ));
+                Store8(lanes[Lane21], Mul(Mul(two, Sub(yz, wx)), scaleZ));
+                Store8(lanes[Lane22], Mul(NegMulAdd(two, Add(xx, yy), one), scaleZ));
+
+                for (size_t i = 0; i < block.count; i++)
+                {
+                    float* matrix = results[block.offset + i].elements;
+                    Store4Aligned(matrix, Set(lanes[Lane00][i], lanes[Lane01][i], lanes[Lane02][i], 0.0f));
+                    Store4Aligned(matrix + 4, Set(lanes[Lane10][i], lanes[Lane11][i], lanes[Lane12][i], 0.0f));
+                    Store4Aligned(matrix + 8, Set(lanes[Lane20][i], lanes[Lane21][i], lanes[Lane22][i], 0.0f));
+                    Store4Aligned(matrix + 12, Set(lanes[LaneX][i], lanes[LaneY][i], lanes[LaneZ][i], 1.0f));
+                }
+            });
+    }
+}
+
+namespace ByteEngine::Math::Math
+{
+    void ToRelative(std::span<const Vector3D> positions, Vector3D origin, std::span<Vector3F> results) noexcept
+    {
+        assert(positions.size() == results.size());
+
+        // Plain loop, compilers vectorize the double subtraction and narrowing on their own
+        for (size_t i = 0; i < positions.size(); i++)
+            results[i] = ToRelative(positions[i], origin);
+    }
+
+    Matrix4x4F CreateCameraRelativeLookAt(Vector3D eyePos, Vector3D targetPos, Vector3F worldUp)
+    {
+        return Matrix4x4F::CreateLookAt(Vector3F(0.0f), ToRelative(targetPos, eyePos), worldUp);
+    }
+}
\ No newline at end of file
@@ -12,6 +12,26 @@ set(COMMON_COMPILER_FLAGS $<$<CXX_COMPILER_ID:MSVC>:
     /fp:fast;/arch:AVX2>
 )
 
+set(BYTEENGINE_MATH_SIMD "AVX2" CACHE STRING "Backend used by the math library: AVX2, SSE4, Scalar or DirectXMath")
+set_property(CACHE BYTEENGINE_MATH_SIMD PROPERTY STRINGS AVX2 SSE4 Scalar DirectXMath)
+
+string(TOUPPER ${BYTEENGINE_MATH_SIMD} MATH_SIMD_UPPER)
+set(MATH_SIMD_DEFINES BYTEENGINE_MATH_SIMD_${MATH_SIMD_UPPER})
+
+set(BYTEENGINE_MATH_TRIG "Fast" CACHE STRING "Sin, Cos, SinCos, Asin and Acos variant used by the math library: Fast or Precise")
+set_property(CACHE BYTEENGINE_MATH_TRIG PROPERTY STRINGS Fast Precise)
+
+string(TOUPPER ${BYTEENGINE_MATH_TRIG} MATH_TRIG_UPPER)
+set(MATH_TRIG_DEFINES BYTEENGINE_MATH_TRIG_${MATH_TRIG_UPPER})
+
+option(BYTEENGINE_EVENT_PROFILING "Record delegate invoke counts and subscriber execution times, see EventProfiler.h" OFF)
+
+if(MATH_SIMD_UPPER STREQUAL "AVX2" OR MATH_SIMD_UPPER STREQUAL "DIRECTXMATH")
+    set(MATH_SIMD_COMPILER_FLAGS $<$<NOT:$<CXX_COMPILER_ID:MSVC>>:-mavx2;-mfma>)
+elseif(MATH_SIMD_UPPER STREQUAL "SSE4")
+    set(MATH_SIMD_COMPILER_FLAGS $<$<NOT:$<CXX_COMPILER_ID:MSVC>>:-msse4.1>)
+endif()
+
 set(WINDOWS_DEFINES 
     _WINDOWS
     WIN32
@@ -30,12 +50,14 @@ target_compile_options(project_options INTERFACE
     $<$<CONFIG:Debug>:${DEBUG_COMPILER_FLAGS}>
     $<$<CONFIG:Release>:${RELEASE_COMPILER_FLAGS}>
     ${COMMON_COMPILER_FLAGS}
+    ${MATH_SIMD_COMPILER_FLAGS}
 )
 
 target_compile_definitions(project_options INTERFACE
     $<$<CONFIG:Debug>:_DEBUG>
     $<$<CONFIG:Release>:NDEBUG>
     ${COMMON_DEFINES}
+    ${MATH_SIMD_DEFINES}
 )
 
 target_link_options(project_options INTERFACE
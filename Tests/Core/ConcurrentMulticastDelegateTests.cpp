@@ -0,0 +1,296 @@
+﻿#include <gtest/gtest.h>
+#include <algorithm>
+#include <atomic>
+#include <memory>
+#include <random>
+#include <thread>
+#include <utility>
+#include <vector>
+#include "ByteEngine/Core/EventSystem/ConcurrentMulticastDelegate.h"
+
+using namespace ByteEngine::EventSystem;
+
+// ─────────────────────────────────────────────
+// Helpers
+// ─────────────────────────────────────────────
+
+struct Listener
+{
+    std::atomic<int> calls = 0;
+
+    void OnEvent(int) { calls.fetch_add(1, std::memory_order_relaxed); }
+};
+
+// ─────────────────────────────────────────────
+// Single thread behaviour
+// ─────────────────────────────────────────────
+
+TEST(ConcurrentMulticastDelegateTest, SubscribeInvokeUnsubscribe)
+{
+    ConcurrentMulticastDelegate<int> delegate;
+    Listener listener;
+    auto shared = std::make_shared<Listener>();
+    int lambdaSum = 0;
+
+    SubscriptionHandle lambda = delegate.SubscribeLambda([&](int value) { lambdaSum += value; });
+    delegate.SubscribeRawPointer(&listener, &Listener::OnEvent);
+    delegate.SubscribeSmartPointer(shared, &Listener::OnEvent);
+
+    EXPECT_EQ(delegate.GetSubscriberCount(), 3u);
+    EXPECT_TRUE(delegate.IsObjectSubscribed(&listener));
+
+    delegate.Invoke(5);
+    EXPECT_EQ(lambdaSum, 5);
+    EXPECT_EQ(listener.calls, 1);
+    EXPECT_EQ(shared->calls, 1);
+
+    delegate.Unsubscribe(lambda);
+    delegate.Unsubscribe(lambda);
+    delegate.UnsubscribeObject(&listener);
+    delegate.Invoke(5);
+
+    EXPECT_EQ(lambdaSum, 5);
+    EXPECT_EQ(listener.calls, 1);
+    EXPECT_EQ(shared->calls, 2);
+
+    // Expired subscriptions are skipped and dropped by the next change
+    Listener* raw = shared.get();
+    shared.reset();
+    EXPECT_FALSE(delegate.IsObjectSubscribed(raw));
+
+    delegate.Invoke(5);
+    SubscriptionHandle other = delegate.SubscribeStatic([](int) { });
+    EXPECT_EQ(delegate.GetSubscriberCount(), 1u);
+
+    delegate.Unsubscribe(other);
+    EXPECT_FALSE(delegate.HasSubscribers());
+}
+
+TEST(ConcurrentMulticastDelegateTest, ChangesFromCallbacksApplyToTheNextInvoke)
+{
+    ConcurrentMulticastDelegate<int> delegate;
+    int added = 0, removedCalls = 0;
+    SubscriptionHandle self = 0;
+
+    self = delegate.SubscribeLambda([&](int)
+        {
+            delegate.Unsubscribe(self);
+            delegate.SubscribeLambda([&](int) { ++added; });
+        });
+
+    delegate.SubscribeLambda([&](int) { ++removedCalls; });
+
+    // The running Invoke keeps its snapshot, so the self removal does not skip the second subscriber
+    delegate.Invoke(0);
+    EXPECT_EQ(added, 0);
+    EXPECT_EQ(removedCalls, 1);
+
+    delegate.Invoke(0);
+    EXPECT_EQ(added, 1);
+    EXPECT_EQ(removedCalls, 2);
+    EXPECT_EQ(delegate.GetSubscriberCount(), 2u);
+}
+
+// Unsubscribes another object from the delegate when the subscriber holding it is released
+struct UnsubscribeOnDestroy
+{
+    ConcurrentMulticastDelegate<int>* delegate;
+    const void* object;
+
+    UnsubscribeOnDestroy(ConcurrentMulticastDelegate<int>* delegate, const void* object) : delegate(delegate), object(object) { }
+    UnsubscribeOnDestroy(UnsubscribeOnDestroy&& other) noexcept : delegate(std::exchange(other.delegate, nullptr)), object(other.object) { }
+    UnsubscribeOnDestroy(const UnsubscribeOnDestroy&) = delete;
+
+    ~UnsubscribeOnDestroy()
+    {
+        if (delegate)
+            delegate->UnsubscribeObject(object);
+    }
+};
+
+TEST(ConcurrentMulticastDelegateTest, SubscriberDestructorMayUnsubscribe)
+{
+    ConcurrentMulticastDelegate<int> delegate;
+    Listener listener;
+
+    delegate.SubscribeRawPointer(&listener, &Listener::OnEvent);
+    SubscriptionHandle handle = delegate.SubscribeLambda([token = UnsubscribeOnDestroy(&delegate, &listener)](int) { });
+
+    // No Invoke holds the replaced snapshot, so the lambda is released here and its destructor changes the delegate again
+    delegate.Unsubscribe(handle);
+
+    EXPECT_FALSE(delegate.HasSubscribers());
+    EXPECT_FALSE(delegate.IsObjectSubscribed(&listener));
+}
+
+TEST(ConcurrentMulticastDelegateTest, NestingDeeperThanMaxDepthAborts)
+{
+    ConcurrentMulticastDelegate<int> delegate;
+
+    delegate.SubscribeLambda([&](int depth)
+        {
+            if (depth < Detail::HazardSlot::MaxDepth)
+                delegate.Invoke(depth + 1);
+        });
+
+    // MaxDepth nested invokes fit, the check holds in release builds as well
+    delegate.Invoke(1);
+    EXPECT_DEATH(delegate.Invoke(0), "Too many nested invokes");
+}
+
+// ─────────────────────────────────────────────
+// Stress
+// ─────────────────────────────────────────────
+
+// What one Invoke saw. Each thread invokes with its own record, so the subscribers write to it without synchronization
+struct InvokeRecord
+{
+    int stableCalls = 0;
+    std::vector<int> churnIds;
+};
+
+// Marks its subscriber dead when the last owner destroys it, a call through a freed snapshot would find it dead
+struct ChurnToken
+{
+    std::atomic<bool>* alive;
+
+    explicit ChurnToken(std::atomic<bool>* alive) : alive(alive) { alive->store(true); }
+    ChurnToken(ChurnToken&& other) noexcept : alive(std::exchange(other.alive, nullptr)) { }
+    ChurnToken(const ChurnToken&) = delete;
+
+    ~ChurnToken()
+    {
+        if (alive)
+            alive->store(false);
+    }
+};
+
+TEST(ConcurrentMulticastDelegateTest, ConcurrentInvokeAndChurn)
+{
+    constexpr int InvokerCount = 4;
+    constexpr int WriterCount = 3;
+    constexpr int WriterOperations = 2000;
+    constexpr int StableCount = 16;
+
+    // One flag per churned subscriber, indexed by its id. Declared first, the delegate destroys tokens pointing into it
+    auto alive = std::make_unique<std::atomic<bool>[]>(WriterCount * WriterOperations);
+
+    ConcurrentMulticastDelegate<InvokeRecord&> delegate;
+    std::atomic<bool> writersDone = false;
+    std::atomic<int> nextId = 0;
+    std::atomic<int> deadCalls = 0;
+
+    for (int i = 0; i < StableCount; ++i)
+        delegate.SubscribeLambda([](InvokeRecord& record) { ++record.stableCalls; });
+
+    std::vector<std::thread> threads;
+    std::atomic<int> invokes = 0;
+    std::atomic<int> partialInvokes = 0;
+    std::atomic<int> duplicateCalls = 0;
+    std::atomic<int> callsAfterUnsubscribe = 0;
+
+    // Every snapshot holds all stable subscribers and each churned one at most once
+    auto checkRecord = [&](InvokeRecord& record)
+        {
+            if (record.stableCalls != StableCount)
+                partialInvokes.fetch_add(1);
+
+            std::sort(record.churnIds.begin(), record.churnIds.end());
+
+            if (std::adjacent_find(record.churnIds.begin(), record.churnIds.end()) != record.churnIds.end())
+                duplicateCalls.fetch_add(1);
+        };
+
+    for (int i = 0; i < InvokerCount; ++i)
+    {
+        threads.emplace_back([&]
+            {
+                InvokeRecord record;
+
+                while (!writersDone.load())
+                {
+                    record.stableCalls = 0;
+                    record.churnIds.clear();
+
+                    delegate.Invoke(record);
+                    invokes.fetch_add(1);
+                    checkRecord(record);
+                }
+            });
+    }
+
+    std::atomic<int> writersRunning = WriterCount;
+
+    for (int i = 0; i < WriterCount; ++i)
+    {
+        threads.emplace_back([&, seed = i]
+            {
+                std::mt19937 rng(seed);
+                std::vector<std::pair<SubscriptionHandle, int>> subscriptions;
+                InvokeRecord record;
+
+                for (int op = 0; op < WriterOperations; ++op)
+                {
+                    if (subscriptions.empty() || rng() % 2 == 0)
+                    {
+                        int id = nextId.fetch_add(1);
+
+                        SubscriptionHandle handle = delegate.SubscribeLambda([&, id, token = ChurnToken(&alive[id])](InvokeRecord& record)
+                            {
+                                if (!token.alive->load())
+                                    deadCalls.fetch_add(1);
+
+                                record.churnIds.push_back(id);
+                            });
+
+                        subscriptions.emplace_back(handle, id);
+                    }
+                    else
+                    {
+                        size_t index = rng() % subscriptions.size();
+                        auto [handle, id] = subscriptions[index];
+                        delegate.Unsubscribe(handle);
+                        subscriptions[index] = subscriptions.back();
+                        subscriptions.pop_back();
+
+                        // Unsubscribe has returned, so an Invoke starting now must not see the subscriber
+                        record.stableCalls = 0;
+                        record.churnIds.clear();
+                        delegate.Invoke(record);
+                        checkRecord(record);
+
+                        if (std::binary_search(record.churnIds.begin(), record.churnIds.end(), id))
+                            callsAfterUnsubscribe.fetch_add(1);
+                    }
+                }
+
+                for (auto [handle, id] : subscriptions)
+                    delegate.Unsubscribe(handle);
+
+                if (writersRunning.fetch_sub(1) == 1)
+                    writersDone.store(true);
+            });
+    }
+
+    for (std::thread& thread : threads)
+        thread.join();
+
+    EXPECT_GT(invokes.load(), 0);
+    EXPECT_EQ(partialInvokes.load(), 0);
+    EXPECT_EQ(duplicateCalls.load(), 0);
+    EXPECT_EQ(callsAfterUnsubscribe.load(), 0);
+    EXPECT_EQ(deadCalls.load(), 0);
+    EXPECT_EQ(delegate.GetSubscriberCount(), static_cast<uint32_t>(StableCount));
+
+    // A snapshot an Invoke still held when it was replaced is freed by the next write
+    delegate.Unsubscribe(delegate.SubscribeStatic([](InvokeRecord&) { }));
+
+    // Every churned subscriber was destroyed once the last snapshot holding it was released
+    for (int id = 0; id < nextId.load(); ++id)
+        EXPECT_FALSE(alive[id].load()) << "Subscriber " << id << " was never destroyed";
+
+    InvokeRecord record;
+    delegate.Invoke(record);
+    EXPECT_EQ(record.stableCalls, StableCount);
+    EXPECT_TRUE(record.churnIds.empty());
+}
\ No newline at end of file
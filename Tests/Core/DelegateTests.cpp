@@ -0,0 +1,173 @@
+﻿#include <gtest/gtest.h>
+#include <array>
+#include <memory>
+#include <utility>
+#include "ByteEngine/Core/EventSystem/Delegate.h"
+
+using namespace ByteEngine::EventSystem;
+
+// ─────────────────────────────────────────────
+// Helpers
+// ─────────────────────────────────────────────
+
+static int StaticAdd(int a, int b) { return a + b; }
+
+struct Counter
+{
+    int total = 0;
+
+    int Add(int a, int b)
+    {
+        total += a + b;
+        return total;
+    }
+};
+
+// Counts live copies, so tests can check that stored targets are destroyed exactly once
+struct Tracked
+{
+    static inline int alive = 0;
+
+    Tracked() { ++alive; }
+    Tracked(const Tracked&) { ++alive; }
+    Tracked(Tracked&&) noexcept { ++alive; }
+    ~Tracked() { --alive; }
+};
+
+// ─────────────────────────────────────────────
+// Subscribe and invoke
+// ─────────────────────────────────────────────
+
+TEST(DelegateTest, EmptyDelegateReturnsDefault)
+{
+    Delegate<int, int, int> delegate;
+
+    EXPECT_FALSE(delegate.HasSubscriber());
+    EXPECT_EQ(delegate.Invoke(1, 2), 0);
+
+    DelegateVoid<int> voidDelegate;
+    voidDelegate.Invoke(1);
+}
+
+TEST(DelegateTest, InvokesEveryTargetKind)
+{
+    Delegate<int, int, int> delegate;
+
+    delegate.SubscribeStatic(&StaticAdd);
+    EXPECT_TRUE(delegate.HasSubscriber());
+    EXPECT_EQ(delegate.Invoke(2, 3), 5);
+
+    Counter counter;
+    delegate.SubscribeRawPointer(&counter, &Counter::Add);
+    EXPECT_EQ(delegate.Invoke(2, 3), 5);
+    EXPECT_EQ(delegate.Invoke(1, 1), 7);
+
+    auto shared = std::make_shared<Counter>();
+    delegate.SubscribeSmartPointer(shared, &Counter::Add);
+    EXPECT_EQ(delegate.Invoke(4, 4), 8);
+
+    int offset = 100;
+    delegate.SubscribeLambda([offset](int a, int b) { return a + b + offset; });
+    EXPECT_EQ(delegate.Invoke(1, 2), 103);
+
+    delegate.Unsubscribe();
+    EXPECT_FALSE(delegate.HasSubscriber());
+    EXPECT_EQ(delegate.Invoke(1, 2), 0);
+}
+
+TEST(DelegateTest, SmartPointerTargetExpires)
+{
+    Delegate<int, int, int> delegate;
+    auto shared = std::make_shared<Counter>();
+    delegate.SubscribeSmartPointer(shared, &Counter::Add);
+
+    shared.reset();
+
+    EXPECT_TRUE(delegate.HasSubscriber());
+    EXPECT_EQ(delegate.Invoke(1, 2), 0);
+}
+
+TEST(DelegateTest, MutableLambdaKeepsState)
+{
+    Delegate<int> delegate;
+    delegate.SubscribeLambda([count = 0]() mutable { return ++count; });
+
+    EXPECT_EQ(delegate.Invoke(), 1);
+    EXPECT_EQ(delegate.Invoke(), 2);
+}
+
+TEST(DelegateTest, ForwardsMoveOnlyArguments)
+{
+    DelegateVoid<std::unique_ptr<int>> delegate;
+    int received = 0;
+    delegate.SubscribeLambda([&](std::unique_ptr<int> value) { received = *value; });
+
+    delegate.Invoke(std::make_unique<int>(42));
+    EXPECT_EQ(received, 42);
+}
+
+// ─────────────────────────────────────────────
+// Storage
+// ─────────────────────────────────────────────
+
+TEST(DelegateTest, SmallTargetsAreStoredInline)
+{
+    using Callable = InlineCallable<void, int>;
+
+    auto small = [a = 1, b = 2.0, c = static_cast<void*>(nullptr)](int) { (void)a; (void)b; (void)c; };
+    auto large = [values = std::array<double, 16> { }](int) { (void)values; };
+
+    EXPECT_TRUE(Callable::IsStoredInline<decltype(small)>);
+    EXPECT_TRUE(Callable::IsStoredInline<void(*)(int)>);
+    EXPECT_TRUE((Callable::IsStoredInline<RawPtrTarget<Counter, void, int>>));
+    EXPECT_TRUE((Callable::IsStoredInline<SmartPtrTarget<Counter, void, int>>));
+    EXPECT_FALSE(Callable::IsStoredInline<decltype(large)>);
+}
+
+TEST(DelegateTest, LargeCapturesFallBackToHeap)
+{
+    std::array<int, 64> values { };
+    values[63] = 7;
+
+    Delegate<int> delegate;
+    delegate.SubscribeLambda([values] { return values[63]; });
+
+    Delegate<int> moved = std::move(delegate);
+    EXPECT_FALSE(delegate.HasSubscriber());
+    EXPECT_EQ(moved.Invoke(), 7);
+}
+
+TEST(DelegateTest, TargetsAreDestroyedOnceAcrossMovesAndResubscribes)
+{
+    {
+        // Small capture that is not trivially copyable, moved by its move constructor
+        Delegate<int, int> delegate;
+        delegate.SubscribeLambda([tracked = Tracked(), offset = 64](int value) { return value + offset; });
+        EXPECT_EQ(Tracked::alive, 1);
+
+        Delegate<int, int> moved = std::move(delegate);
+        EXPECT_EQ(Tracked::alive, 1);
+        EXPECT_EQ(moved.Invoke(1), 65);
+
+        delegate = std::move(moved);
+        EXPECT_EQ(Tracked::alive, 1);
+        EXPECT_EQ(delegate.Invoke(2), 66);
+
+        // Large capture, heap storage
+        delegate.SubscribeLambda([tracked = Tracked(), padding = std::array<double, 16> { }](int value) { return value + static_cast<int>(padding.size()); });
+        EXPECT_EQ(Tracked::alive, 1);
+        EXPECT_EQ(delegate.Invoke(1), 17);
+
+        moved = std::move(delegate);
+        EXPECT_EQ(Tracked::alive, 1);
+        EXPECT_EQ(moved.Invoke(1), 17);
+
+        moved.Unsubscribe();
+        EXPECT_EQ(Tracked::alive, 0);
+
+        delegate.SubscribeLambda([tracked = Tracked()](int value) { return value; });
+        EXPECT_EQ(Tracked::alive, 1);
+    }
+
+    EXPECT_EQ(Tracked::alive, 0);
+}
\ No newline at end of file
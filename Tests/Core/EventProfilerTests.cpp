@@ -0,0 +1,227 @@
+﻿#include <gtest/gtest.h>
+#include <chrono>
+#include <string>
+#include <thread>
+#include "ByteEngine/Core/EventSystem/EventProfiler.h"
+#include "ByteEngine/Core/EventSystem/EventQueue.h"
+#include "ByteEngine/Core/EventSystem/MulticastDelegate.h"
+
+using namespace ByteEngine::EventSystem;
+
+// ─────────────────────────────────────────────
+// LatencyHistogram
+// ─────────────────────────────────────────────
+
+TEST(LatencyHistogramTest, RecordsIntoPowerOfTwoBuckets)
+{
+    LatencyHistogram histogram;
+
+    histogram.Record(0);
+    histogram.Record(1);
+    histogram.Record(100);
+    histogram.Record(127);
+    histogram.Record(128);
+
+    EXPECT_EQ(histogram.count, 5u);
+    EXPECT_EQ(histogram.buckets[0], 1u);
+    EXPECT_EQ(histogram.buckets[1], 1u);
+    EXPECT_EQ(histogram.buckets[7], 2u);
+    EXPECT_EQ(histogram.buckets[8], 1u);
+    EXPECT_EQ(histogram.totalNanoseconds, 356u);
+    EXPECT_EQ(histogram.maxNanoseconds, 128u);
+    EXPECT_EQ(histogram.GetMeanNanoseconds(), 71u);
+}
+
+TEST(LatencyHistogramTest, HugeTimesGoToTheLastBucket)
+{
+    LatencyHistogram histogram;
+
+    histogram.Record(UINT64_MAX / 2);
+
+    EXPECT_EQ(histogram.buckets[LatencyHistogram::BucketCount - 1], 1u);
+}
+
+TEST(LatencyHistogramTest, PercentilesAreBucketUpperBoundsCappedByTheMaximum)
+{
+    LatencyHistogram histogram;
+
+    for (int i = 0; i < 99; ++i)
+        histogram.Record(100);
+
+    histogram.Record(5000);
+
+    EXPECT_EQ(histogram.GetPercentileNanoseconds(0.5f), 128u);
+    EXPECT_EQ(histogram.GetPercentileNanoseconds(0.99f), 128u);
+    EXPECT_EQ(histogram.GetPercentileNanoseconds(1.0f), 5000u);
+
+    histogram.Reset();
+
+    EXPECT_EQ(histogram.count, 0u);
+    EXPECT_EQ(histogram.GetPercentileNanoseconds(0.5f), 0u);
+}
+
+// ─────────────────────────────────────────────
+// Delegate profiling
+// ─────────────────────────────────────────────
+
+TEST(EventProfilerTest, CountsInvokesAndSubscribers)
+{
+    MulticastDelegate<int> delegate;
+    delegate.SetProfileName("EventProfilerTest.Counts");
+
+    SubscriptionHandle first = delegate.SubscribeLambda([](int) { });
+    delegate.SubscribeLambda([](int) { });
+    delegate.SubscribeLambda([](int) { });
+
+    for (int i = 0; i < 10; ++i)
+        delegate.Invoke(i);
+
+    delegate.Unsubscribe(first);
+    delegate.Invoke(0);
+
+    const DelegateProfile* profile = EventProfiler::FindProfile("EventProfilerTest.Counts");
+
+    ASSERT_NE(profile, nullptr);
+    EXPECT_EQ(profile->invokeCount, 11u);
+    EXPECT_EQ(profile->subscriberCount, 2u);
+    EXPECT_EQ(profile->peakSubscriberCount, 3u);
+    ASSERT_EQ(profile->subscribers.size(), 3u);
+    EXPECT_EQ(profile->subscribers[1].latency.count, 11u);
+
+    // The unsubscribed entry is folded into the totals and free for reuse
+    EXPECT_EQ(profile->unsubscribedCount, 1u);
+    EXPECT_EQ(profile->unsubscribedLatency.count, 10u);
+    ASSERT_EQ(profile->freeSubscribers.size(), 1u);
+    EXPECT_EQ(profile->freeSubscribers[0], &profile->subscribers[0]);
+    EXPECT_EQ(profile->subscribers[0].handle, 0u);
+    EXPECT_EQ(profile->subscribers[0].latency.count, 0u);
+}
+
+TEST(EventProfilerTest, ChurningSubscribersReuseTheirEntries)
+{
+    MulticastDelegate<> delegate;
+    delegate.SetProfileName("EventProfilerTest.Churn");
+    delegate.SubscribeLambda([] { });
+
+    for (int i = 0; i < 1000; ++i)
+    {
+        SubscriptionHandle handle = delegate.SubscribeLambda([] { });
+        delegate.Invoke();
+        delegate.Unsubscribe(handle);
+    }
+
+    // Unsubscribing itself during Invoke, the call is still timed into the totals
+    SubscriptionHandle self = 0;
+    self = delegate.SubscribeLambda([&] { delegate.Unsubscribe(self); });
+    delegate.Invoke();
+
+    const DelegateProfile* profile = EventProfiler::FindProfile("EventProfilerTest.Churn");
+
+    ASSERT_NE(profile, nullptr);
+    EXPECT_EQ(profile->subscribers.size(), 2u);
+    EXPECT_EQ(profile->unsubscribedCount, 1001u);
+    EXPECT_EQ(profile->unsubscribedLatency.count, 1001u);
+    EXPECT_EQ(profile->subscribers[0].latency.count, 1001u);
+
+    std::string report = EventProfiler::WriteReport();
+
+    EXPECT_NE(report.find("1001 unsubscribed: 1001 calls"), std::string::npos);
+}
+
+TEST(EventProfilerTest, SetProfileNameRenamesTheProfile)
+{
+    MulticastDelegate<> delegate;
+    delegate.SetProfileName("EventProfilerTest.OldName");
+    delegate.SetProfileName("EventProfilerTest.NewName");
+
+    EXPECT_EQ(EventProfiler::FindProfile("EventProfilerTest.OldName"), nullptr);
+    EXPECT_NE(EventProfiler::FindProfile("EventProfilerTest.NewName"), nullptr);
+}
+
+TEST(EventProfilerTest, RecordsSubscriberExecutionTimes)
+{
+    MulticastDelegate<> delegate;
+    delegate.SetProfileName("EventProfilerTest.Times");
+
+    delegate.SubscribeLambda([] { });
+    delegate.SubscribeLambda([] { std::this_thread::sleep_for(std::chrono::milliseconds(2)); });
+    delegate.Invoke();
+
+    const DelegateProfile* profile = EventProfiler::FindProfile("EventProfilerTest.Times");
+
+    ASSERT_NE(profile, nullptr);
+    ASSERT_EQ(profile->subscribers.size(), 2u);
+    EXPECT_GE(profile->subscribers[1].latency.maxNanoseconds, 2'000'000u);
+    EXPECT_LT(profile->subscribers[0].latency.maxNanoseconds, profile->subscribers[1].latency.maxNanoseconds);
+
+    std::string report = EventProfiler::WriteReport();
+
+    EXPECT_NE(report.find("EventProfilerTest.Times: 1 invokes, 2 subscribers"), std::string::npos);
+}
+
+TEST(EventProfilerTest, NothingIsRecordedWhileDisabled)
+{
+    MulticastDelegate<> delegate;
+    delegate.SetProfileName("EventProfilerTest.Disabled");
+    delegate.SubscribeLambda([] { });
+
+    EventProfiler::SetEnabled(false);
+    delegate.Invoke();
+    EventProfiler::SetEnabled(true);
+
+    const DelegateProfile* profile = EventProfiler::FindProfile("EventProfilerTest.Disabled");
+
+    ASSERT_NE(profile, nullptr);
+    EXPECT_EQ(profile->invokeCount, 0u);
+    EXPECT_TRUE(profile->subscribers.empty());
+}
+
+TEST(EventProfilerTest, StatisticsOutliveTheDelegate)
+{
+    {
+        MulticastDelegate<> delegate;
+        delegate.SetProfileName("EventProfilerTest.Outlive");
+        delegate.SubscribeLambda([] { });
+        delegate.Invoke();
+    }
+
+    const DelegateProfile* profile = EventProfiler::FindProfile("EventProfilerTest.Outlive");
+
+    ASSERT_NE(profile, nullptr);
+    EXPECT_EQ(profile->invokeCount, 1u);
+}
+
+TEST(EventProfilerTest, EventQueueListenersAreProfiledPerEventType)
+{
+    struct ProfiledEvent
+    {
+        int value = 0;
+    };
+
+    EventQueue queue;
+    queue.Listeners<ProfiledEvent>().SubscribeLambda([](const ProfiledEvent&) { });
+    queue.Post(ProfiledEvent { 1 });
+    queue.Post(ProfiledEvent { 2 });
+    queue.Dispatch();
+
+    std::string report = EventProfiler::WriteReport();
+
+    EXPECT_NE(report.find("ProfiledEvent"), std::string::npos);
+}
+
+TEST(EventProfilerTest, ResetZeroesStatistics)
+{
+    MulticastDelegate<> delegate;
+    delegate.SetProfileName("EventProfilerTest.Reset");
+    delegate.SubscribeLambda([] { });
+    delegate.Invoke();
+
+    EventProfiler::Reset();
+
+    const DelegateProfile* profile = EventProfiler::FindProfile("EventProfilerTest.Reset");
+
+    ASSERT_NE(profile, nullptr);
+    EXPECT_EQ(profile->invokeCount, 0u);
+    EXPECT_EQ(profile->subscriberCount, 1u);
+    EXPECT_EQ(profile->subscribers[0].latency.count, 0u);
+}
@@ -0,0 +1,330 @@
+﻿#include <gtest/gtest.h>
+#include <memory>
+#include <string>
+#include <vector>
+#include "ByteEngine/Core/EventSystem/EventQueue.h"
+
+using namespace ByteEngine::EventSystem;
+
+// ─────────────────────────────────────────────
+// Helpers
+// ─────────────────────────────────────────────
+
+struct KeyEvent
+{
+    int key = 0;
+};
+
+struct ResizeEvent
+{
+    static constexpr EventCoalescing Coalescing = EventCoalescing::KeepLast;
+
+    int width = 0;
+    int height = 0;
+};
+
+struct MouseDeltaEvent
+{
+    static constexpr EventCoalescing Coalescing = EventCoalescing::Merge;
+
+    int x = 0;
+    int y = 0;
+
+    void Merge(const MouseDeltaEvent& later)
+    {
+        x += later.x;
+        y += later.y;
+    }
+};
+
+struct TextEvent
+{
+    std::string text;
+};
+
+// ─────────────────────────────────────────────
+// Post and dispatch
+// ─────────────────────────────────────────────
+
+TEST(EventQueueTest, NothingIsDeliveredBeforeDispatch)
+{
+    EventQueue queue;
+    int calls = 0;
+
+    queue.Listeners<KeyEvent>().SubscribeLambda([&](const KeyEvent&) { ++calls; });
+    queue.Post(KeyEvent { 1 });
+
+    EXPECT_EQ(calls, 0);
+    EXPECT_EQ(queue.GetPendingCount<KeyEvent>(), 1u);
+
+    queue.Dispatch();
+
+    EXPECT_EQ(calls, 1);
+    EXPECT_EQ(queue.GetPendingCount<KeyEvent>(), 0u);
+}
+
+TEST(EventQueueTest, UncoalescedEventsKeepPostingOrderAcrossGrowth)
+{
+    EventQueue queue;
+    std::vector<int> received;
+
+    queue.Listeners<KeyEvent>().SubscribeLambda([&](const KeyEvent& event) { received.push_back(event.key); });
+
+    // Wrap the ring around before it has to grow
+    for (int i = 0; i < 10; ++i)
+        queue.Post(KeyEvent { i });
+
+    queue.Dispatch();
+    received.clear();
+
+    std::vector<int> expected;
+
+    for (int i = 0; i < 100; ++i)
+    {
+        queue.Post(KeyEvent { i });
+        expected.push_back(i);
+    }
+
+    queue.Dispatch();
+
+    EXPECT_EQ(received, expected);
+}
+
+TEST(EventQueueTest, KeepLastDeliversOnlyTheLastEventOfTheFrame)
+{
+    EventQueue queue;
+    std::vector<int> widths;
+
+    queue.Listeners<ResizeEvent>().SubscribeLambda([&](const ResizeEvent& event) { widths.push_back(event.width); });
+
+    for (int i = 1; i <= 50; ++i)
+        queue.Post(ResizeEvent { i * 10, i });
+
+    EXPECT_EQ(queue.GetPendingCount<ResizeEvent>(), 1u);
+
+    queue.Dispatch();
+    queue.Post(ResizeEvent { 7, 7 });
+    queue.Dispatch();
+
+    EXPECT_EQ(widths, (std::vector<int> { 500, 7 }));
+}
+
+TEST(EventQueueTest, MergeFoldsEventsOfTheFrame)
+{
+    EventQueue queue;
+    std::vector<MouseDeltaEvent> received;
+
+    queue.Listeners<MouseDeltaEvent>().SubscribeLambda([&](const MouseDeltaEvent& event) { received.push_back(event); });
+
+    queue.Post(MouseDeltaEvent { 1, 2 });
+    queue.Post(MouseDeltaEvent { 3, -4 });
+    queue.Post(MouseDeltaEvent { 5, 0 });
+    queue.Dispatch();
+
+    ASSERT_EQ(received.size(), 1u);
+    EXPECT_EQ(received[0].x, 9);
+    EXPECT_EQ(received[0].y, -2);
+}
+
+TEST(EventQueueTest, TypesAreDispatchedInOrderOfFirstUse)
+{
+    EventQueue queue;
+    std::vector<std::string> order;
+
+    queue.Listeners<TextEvent>().SubscribeLambda([&](const TextEvent& event) { order.push_back(event.text); });
+    queue.Listeners<KeyEvent>().SubscribeLambda([&](const KeyEvent& event) { order.push_back(std::to_string(event.key)); });
+
+    queue.Post(KeyEvent { 1 });
+    queue.Post(TextEvent { "a" });
+    queue.Post(KeyEvent { 2 });
+    queue.Dispatch();
+
+    EXPECT_EQ(order, (std::vector<std::string> { "a", "1", "2" }));
+}
+
+TEST(EventQueueTest, EventsWithoutListenersAreDropped)
+{
+    EventQueue queue;
+    int calls = 0;
+
+    queue.Post(KeyEvent { 1 });
+    queue.Dispatch();
+
+    queue.Listeners<KeyEvent>().SubscribeLambda([&](const KeyEvent&) { ++calls; });
+    queue.Dispatch();
+
+    EXPECT_EQ(calls, 0);
+}
+
+TEST(EventQueueTest, ClearDropsPendingEventsAndKeepsListeners)
+{
+    EventQueue queue;
+    int calls = 0;
+
+    queue.Listeners<KeyEvent>().SubscribeLambda([&](const KeyEvent&) { ++calls; });
+    queue.Post(KeyEvent { 1 });
+    queue.Post(ResizeEvent { 1, 1 });
+    queue.Clear();
+
+    EXPECT_EQ(queue.GetPendingCount<KeyEvent>(), 0u);
+    EXPECT_EQ(queue.GetPendingCount<ResizeEvent>(), 0u);
+
+    queue.Post(KeyEvent { 2 });
+    queue.Dispatch();
+
+    EXPECT_EQ(calls, 1);
+}
+
+// ─────────────────────────────────────────────
+// Posting from listeners
+// ─────────────────────────────────────────────
+
+TEST(EventQueueTest, EventsPostedDuringDispatchWaitForTheNextDispatch)
+{
+    EventQueue queue;
+    std::vector<int> received;
+
+    queue.Listeners<KeyEvent>().SubscribeLambda([&](const KeyEvent& event)
+        {
+            received.push_back(event.key);
+
+            // Forces the ring to grow while the event is being delivered
+            if (event.key == 0)
+            {
+                for (int i = 1; i <= 40; ++i)
+                    queue.Post(KeyEvent { i });
+            }
+        });
+
+    queue.Post(KeyEvent { 0 });
+    queue.Dispatch();
+
+    EXPECT_EQ(received, (std::vector<int> { 0 }));
+    EXPECT_EQ(queue.GetPendingCount<KeyEvent>(), 40u);
+
+    queue.Dispatch();
+
+    EXPECT_EQ(received.size(), 41u);
+    EXPECT_EQ(received.back(), 40);
+}
+
+TEST(EventQueueTest, KeepLastPostedDuringDispatchDoesNotOverwriteTheDeliveredEvent)
+{
+    EventQueue queue;
+    std::vector<int> widths;
+
+    queue.Listeners<ResizeEvent>().SubscribeLambda([&](const ResizeEvent& event)
+        {
+            if (event.width == 1)
+                queue.Post(ResizeEvent { 2, 2 });
+
+            widths.push_back(event.width);
+        });
+
+    queue.Post(ResizeEvent { 1, 1 });
+    queue.Dispatch();
+    queue.Dispatch();
+
+    EXPECT_EQ(widths, (std::vector<int> { 1, 2 }));
+}
+
+TEST(EventQueueTest, NewEventTypesPostedDuringDispatchWaitForTheNextDispatch)
+{
+    struct FirstNewEvent { int value = 0; };
+    struct SecondNewEvent { int value = 0; };
+    struct ThirdNewEvent { int value = 0; };
+    struct FourthNewEvent { int value = 0; };
+
+    EventQueue queue;
+    int newEventCalls = 0;
+
+    queue.Listeners<ResizeEvent>().SubscribeLambda([](const ResizeEvent&) { });
+    queue.Listeners<KeyEvent>().SubscribeLambda([&](const KeyEvent&)
+        {
+            // Every new type adds a channel while the channels are being dispatched
+            queue.Post(FirstNewEvent { 1 });
+            queue.Post(SecondNewEvent { 2 });
+            queue.Post(ThirdNewEvent { 3 });
+            queue.Post(FourthNewEvent { 4 });
+        });
+
+    queue.Post(ResizeEvent { 1, 1 });
+    queue.Post(KeyEvent { 1 });
+    queue.Dispatch();
+
+    queue.Listeners<FourthNewEvent>().SubscribeLambda([&](const FourthNewEvent& event) { newEventCalls += event.value; });
+
+    EXPECT_EQ(queue.GetPendingCount<FourthNewEvent>(), 1u);
+
+    queue.Dispatch();
+
+    EXPECT_EQ(newEventCalls, 4);
+}
+
+TEST(EventQueueTest, ClearFromListenerStopsTheDispatch)
+{
+    EventQueue queue;
+    std::vector<int> received;
+
+    queue.Listeners<KeyEvent>().SubscribeLambda([&](const KeyEvent& event)
+        {
+            received.push_back(event.key);
+
+            if (event.key == 1)
+                queue.Clear();
+        });
+
+    for (int i = 0; i < 5; ++i)
+        queue.Post(KeyEvent { i });
+
+    queue.Dispatch();
+
+    EXPECT_EQ(received, (std::vector<int> { 0, 1 }));
+    EXPECT_EQ(queue.GetPendingCount<KeyEvent>(), 0u);
+
+    queue.Post(KeyEvent { 7 });
+    queue.Dispatch();
+
+    EXPECT_EQ(received, (std::vector<int> { 0, 1, 7 }));
+}
+
+TEST(EventQueueTest, ClearDestroysPendingPayloads)
+{
+    struct PayloadEvent
+    {
+        std::shared_ptr<int> payload;
+    };
+
+    EventQueue queue;
+    auto payload = std::make_shared<int>(1);
+
+    queue.Post(PayloadEvent { payload });
+    queue.Post(PayloadEvent { payload });
+
+    EXPECT_EQ(payload.use_count(), 3);
+
+    queue.Clear();
+
+    EXPECT_EQ(payload.use_count(), 1);
+}
+
+TEST(EventQueueTest, QueuesKeepSeparateEvents)
+{
+    EventQueue first;
+    EventQueue second;
+    int firstCalls = 0;
+    int secondCalls = 0;
+
+    first.Listeners<KeyEvent>().SubscribeLambda([&](const KeyEvent&) { ++firstCalls; });
+    second.Listeners<KeyEvent>().SubscribeLambda([&](const KeyEvent&) { ++secondCalls; });
+
+    first.Post(KeyEvent { 1 });
+    first.Post(KeyEvent { 2 });
+    second.Post(KeyEvent { 3 });
+
+    first.Dispatch();
+    second.Dispatch();
+
+    EXPECT_EQ(firstCalls, 2);
+    EXPECT_EQ(secondCalls, 1);
+}
\ No newline at end of file
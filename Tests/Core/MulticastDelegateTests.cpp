@@ -0,0 +1,309 @@
+﻿#include <gtest/gtest.h>
+#include <algorithm>
+#include <cstdint>
+#include <map>
+#include <memory>
+#include <random>
+#include <string>
+#include <vector>
+#include "ByteEngine/Core/EventSystem/MulticastDelegate.h"
+
+using namespace ByteEngine::EventSystem;
+
+// ─────────────────────────────────────────────
+// Helpers
+// ─────────────────────────────────────────────
+
+struct Listener
+{
+    int calls = 0;
+
+    void OnEvent(int) { ++calls; }
+};
+
+static int staticCalls = 0;
+
+static void StaticListener(int) { ++staticCalls; }
+
+// ─────────────────────────────────────────────
+// Subscribe and invoke
+// ─────────────────────────────────────────────
+
+TEST(MulticastDelegateTest, InvokesEverySubscriberInOrder)
+{
+    MulticastDelegate<int> delegate;
+    std::vector<int> order;
+    Listener listener;
+    staticCalls = 0;
+
+    delegate.SubscribeLambda([&](int value) { order.push_back(value); });
+    delegate.SubscribeRawPointer(&listener, &Listener::OnEvent);
+    delegate.SubscribeStatic(&StaticListener);
+    delegate.SubscribeLambda([&](int value) { order.push_back(value * 10); });
+
+    EXPECT_TRUE(delegate.HasSubscribers());
+    EXPECT_EQ(delegate.GetSubscriberCount(), 4u);
+
+    delegate.Invoke(3);
+
+    EXPECT_EQ(order, (std::vector<int> { 3, 30 }));
+    EXPECT_EQ(listener.calls, 1);
+    EXPECT_EQ(staticCalls, 1);
+}
+
+TEST(MulticastDelegateTest, EverySubscriberGetsTheSameArguments)
+{
+    MulticastDelegate<std::string> delegate;
+    std::vector<std::string> received;
+
+    for (int i = 0; i < 3; ++i)
+        delegate.SubscribeLambda([&](std::string text) { received.push_back(std::move(text)); });
+
+    delegate.Invoke(std::string(40, 'a'));
+
+    ASSERT_EQ(received.size(), 3u);
+
+    for (const std::string& text : received)
+        EXPECT_EQ(text, std::string(40, 'a'));
+}
+
+TEST(MulticastDelegateTest, StaleHandlesAreIgnored)
+{
+    MulticastDelegate<int> delegate;
+    int first = 0, second = 0;
+
+    SubscriptionHandle firstHandle = delegate.SubscribeLambda([&](int) { ++first; });
+    delegate.Unsubscribe(firstHandle);
+    delegate.Unsubscribe(firstHandle);
+    EXPECT_FALSE(delegate.HasSubscribers());
+
+    // Reuses the slot with a new generation
+    SubscriptionHandle secondHandle = delegate.SubscribeLambda([&](int) { ++second; });
+    EXPECT_NE(secondHandle, firstHandle);
+    EXPECT_NE(secondHandle, 0u);
+
+    delegate.Unsubscribe(firstHandle);
+    delegate.Invoke(0);
+
+    EXPECT_EQ(first, 0);
+    EXPECT_EQ(second, 1);
+    EXPECT_EQ(delegate.GetSubscriberCount(), 1u);
+}
+
+TEST(MulticastDelegateTest, UnsubscribeKeepsOtherHandlesValid)
+{
+    MulticastDelegate<int> delegate;
+    std::vector<int> calls(8, 0);
+    std::vector<SubscriptionHandle> handles;
+
+    for (int i = 0; i < 8; ++i)
+        handles.push_back(delegate.SubscribeLambda([&calls, i](int) { ++calls[i]; }));
+
+    // Removing from the front swaps later entries into the gaps
+    delegate.Unsubscribe(handles[0]);
+    delegate.Unsubscribe(handles[3]);
+    delegate.Unsubscribe(handles[7]);
+    delegate.Unsubscribe(handles[1]);
+    delegate.Invoke(0);
+
+    EXPECT_EQ(calls, (std::vector<int> { 0, 0, 1, 0, 1, 1, 1, 0 }));
+
+    delegate.Unsubscribe(handles[5]);
+    delegate.Invoke(0);
+
+    EXPECT_EQ(calls, (std::vector<int> { 0, 0, 2, 0, 2, 1, 2, 0 }));
+}
+
+// ─────────────────────────────────────────────
+// Changes during Invoke
+// ─────────────────────────────────────────────
+
+TEST(MulticastDelegateTest, SubscribeDuringInvokeIsCalledFromTheNextInvoke)
+{
+    MulticastDelegate<int> delegate;
+    int added = 0;
+
+    delegate.SubscribeLambda([&](int)
+        {
+            if (delegate.GetSubscriberCount() < 3)
+                delegate.SubscribeLambda([&](int) { ++added; });
+        });
+
+    delegate.Invoke(0);
+    EXPECT_EQ(added, 0);
+    EXPECT_EQ(delegate.GetSubscriberCount(), 2u);
+
+    delegate.Invoke(0);
+    EXPECT_EQ(added, 1);
+    EXPECT_EQ(delegate.GetSubscriberCount(), 3u);
+}
+
+TEST(MulticastDelegateTest, UnsubscribeDuringInvoke)
+{
+    MulticastDelegate<int> delegate;
+    int selfCalls = 0, laterCalls = 0, otherCalls = 0;
+    SubscriptionHandle self = 0, later = 0;
+
+    self = delegate.SubscribeLambda([&](int)
+        {
+            ++selfCalls;
+            delegate.Unsubscribe(self);
+            delegate.Unsubscribe(later);
+        });
+
+    delegate.SubscribeLambda([&](int) { ++otherCalls; });
+    later = delegate.SubscribeLambda([&](int) { ++laterCalls; });
+
+    delegate.Invoke(0);
+    delegate.Invoke(0);
+
+    EXPECT_EQ(selfCalls, 1);
+    EXPECT_EQ(laterCalls, 0);
+    EXPECT_EQ(otherCalls, 2);
+    EXPECT_EQ(delegate.GetSubscriberCount(), 1u);
+}
+
+TEST(MulticastDelegateTest, SubscribeAndUnsubscribeDuringInvoke)
+{
+    MulticastDelegate<int> delegate;
+    int pendingCalls = 0;
+
+    delegate.SubscribeLambda([&](int)
+        {
+            SubscriptionHandle pending = delegate.SubscribeLambda([&](int) { ++pendingCalls; });
+            delegate.Unsubscribe(pending);
+        });
+
+    delegate.Invoke(0);
+    delegate.Invoke(0);
+
+    EXPECT_EQ(pendingCalls, 0);
+    EXPECT_EQ(delegate.GetSubscriberCount(), 1u);
+}
+
+TEST(MulticastDelegateTest, NestedInvokeAndClear)
+{
+    MulticastDelegate<int> delegate;
+    std::vector<int> values;
+
+    delegate.SubscribeLambda([&](int depth)
+        {
+            values.push_back(depth);
+
+            if (depth == 0)
+                delegate.Invoke(1);
+            else
+                delegate.Clear();
+        });
+
+    delegate.SubscribeLambda([&](int depth) { values.push_back(depth + 10); });
+
+    delegate.Invoke(0);
+
+    // The inner Invoke clears, so the outer one skips the second subscriber
+    EXPECT_EQ(values, (std::vector<int> { 0, 1 }));
+    EXPECT_FALSE(delegate.HasSubscribers());
+
+    delegate.Invoke(0);
+    EXPECT_EQ(values.size(), 2u);
+}
+
+// ─────────────────────────────────────────────
+// Owners
+// ─────────────────────────────────────────────
+
+TEST(MulticastDelegateTest, UnsubscribeObject)
+{
+    MulticastDelegate<int> delegate;
+    Listener a, b;
+
+    delegate.SubscribeRawPointer(&a, &Listener::OnEvent);
+    delegate.SubscribeRawPointer(&b, &Listener::OnEvent);
+    delegate.SubscribeRawPointer(&a, &Listener::OnEvent);
+
+    EXPECT_TRUE(delegate.IsObjectSubscribed(&a));
+
+    delegate.UnsubscribeObject(&a);
+    delegate.Invoke(0);
+
+    EXPECT_FALSE(delegate.IsObjectSubscribed(&a));
+    EXPECT_TRUE(delegate.IsObjectSubscribed(&b));
+    EXPECT_EQ(a.calls, 0);
+    EXPECT_EQ(b.calls, 1);
+}
+
+TEST(MulticastDelegateTest, ExpiredSmartPointersAreDropped)
+{
+    MulticastDelegate<int> delegate;
+    auto listener = std::make_shared<Listener>();
+    Listener* raw = listener.get();
+
+    SubscriptionHandle handle = delegate.SubscribeSmartPointer(listener, &Listener::OnEvent);
+    delegate.Invoke(0);
+    EXPECT_EQ(listener->calls, 1);
+    EXPECT_TRUE(delegate.IsObjectSubscribed(raw));
+
+    listener.reset();
+    EXPECT_FALSE(delegate.IsObjectSubscribed(raw));
+
+    delegate.Invoke(0);
+    EXPECT_FALSE(delegate.HasSubscribers());
+
+    // The handle went stale with the expired subscription
+    delegate.Unsubscribe(handle);
+    EXPECT_EQ(delegate.GetSubscriberCount(), 0u);
+}
+
+// ─────────────────────────────────────────────
+// Churn against a reference model
+// ─────────────────────────────────────────────
+
+TEST(MulticastDelegateTest, RandomChurnMatchesModel)
+{
+    MulticastDelegate<int> delegate;
+    std::map<int, SubscriptionHandle> model;
+    std::vector<int> called;
+    std::mt19937 rng(17);
+    int nextId = 0;
+
+    auto subscribe = [&]
+        {
+            int id = nextId++;
+            model[id] = delegate.SubscribeLambda([&called, id](int) { called.push_back(id); });
+        };
+
+    auto unsubscribeRandom = [&]
+        {
+            if (model.empty())
+                return;
+
+            auto it = std::next(model.begin(), std::uniform_int_distribution<size_t>(0, model.size() - 1)(rng));
+            delegate.Unsubscribe(it->second);
+            model.erase(it);
+        };
+
+    for (int round = 0; round < 200; ++round)
+    {
+        int operations = std::uniform_int_distribution<int>(1, 20)(rng);
+
+        for (int i = 0; i < operations; ++i)
+        {
+            if (std::uniform_int_distribution<int>(0, 2)(rng) > 0)
+                subscribe();
+            else
+                unsubscribeRandom();
+        }
+
+        called.clear();
+        delegate.Invoke(round);
+        std::sort(called.begin(), called.end());
+
+        std::vector<int> expected;
+
+        for (const auto& [id, handle] : model)
+            expected.push_back(id);
+
+        ASSERT_EQ(called, expected) << "round " << round;
+        ASSERT_EQ(delegate.GetSubscriberCount(), model.size());
+    }
+}
\ No newline at end of file
@@ -0,0 +1,360 @@
+﻿#include <gtest/gtest.h>
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <random>
+#include <vector>
+#include "ByteEngine/Math/Bounds.h"
+#include "ByteEngine/Math/Bvh.h"
+#include "ByteEngine/Math/Frustum.h"
+#include "ByteEngine/Math/Matrix4x4F.h"
+#include "ByteEngine/Math/Ray.h"
+
+using namespace ByteEngine::Math;
+
+// ─────────────────────────────────────────────
+// Helpers
+// ─────────────────────────────────────────────
+
+// Small boxes scattered in a 200^3 volume, some clustered to give the SAH build something to work with
+static std::vector<Bounds> MakeItems(size_t count, uint32_t seed = 7)
+{
+    std::mt19937 rng(seed);
+    std::uniform_real_distribution<float> position(-100.f, 100.f);
+    std::uniform_real_distribution<float> size(0.05f, 2.f);
+    std::normal_distribution<float> cluster(0.f, 3.f);
+
+    std::vector<Bounds> items;
+    items.reserve(count);
+    for (size_t i = 0; i < count; ++i)
+    {
+        Vector3F center = i % 4 == 0
+            ? Vector3F(20.f + cluster(rng), cluster(rng), -30.f + cluster(rng))
+            : Vector3F(position(rng), position(rng), position(rng));
+        items.push_back(Bounds::FromCenterExtents(center, Vector3F(size(rng), size(rng), size(rng))));
+    }
+    return items;
+}
+
+static void MoveItems(std::vector<Bounds>& items, float time)
+{
+    for (size_t i = 0; i < items.size(); ++i)
+    {
+        Vector3F offset(std::sin(time + i * 0.1f) * 5.f, std::cos(time * 1.3f + i * 0.7f) * 5.f, 0.f);
+        items[i] = Bounds(items[i].min + offset, items[i].max + offset);
+    }
+}
+
+static bool BoundsContain(const Bounds& outer, const Bounds& inner)
+{
+    return outer.min.x <= inner.min.x && outer.min.y <= inner.min.y && outer.min.z <= inner.min.z &&
+        outer.max.x >= inner.max.x && outer.max.y >= inner.max.y && outer.max.z >= inner.max.z;
+}
+
+// Returns the tree height, checks bounds containment and that each item is referenced by exactly one leaf
+static int32_t ValidateNode(const Bvh& bvh, std::span<const Bounds> items, uint32_t nodeIndex, std::vector<int>& seen)
+{
+    const Bvh::Node& node = bvh.GetNodes()[nodeIndex];
+    if (node.IsLeaf())
+    {
+        EXPECT_LE(node.itemCount, Bvh::MaxLeafSize);
+        for (uint32_t i = node.leftFirst; i < node.leftFirst + node.itemCount; ++i)
+        {
+            uint32_t item = bvh.GetItemIndices()[i];
+            seen[item]++;
+            EXPECT_TRUE(BoundsContain(node.GetBounds(), items[item]));
+        }
+        return 0;
+    }
+
+    EXPECT_TRUE(BoundsContain(node.GetBounds(), bvh.GetNodes()[node.leftFirst].GetBounds()));
+    EXPECT_TRUE(BoundsContain(node.GetBounds(), bvh.GetNodes()[node.leftFirst + 1].GetBounds()));
+    return 1 + std::max(ValidateNode(bvh, items, node.leftFirst, seen), ValidateNode(bvh, items, node.leftFirst + 1, seen));
+}
+
+static int32_t ValidateTree(const Bvh& bvh, std::span<const Bounds> items)
+{
+    std::vector<int> seen(items.size(), 0);
+    int32_t height = bvh.IsEmpty() ? 0 : ValidateNode(bvh, items, 0, seen);
+    for (size_t i = 0; i < items.size(); ++i)
+        EXPECT_EQ(seen[i], 1) << "item " << i;
+    return height;
+}
+
+static float RayBoundsDistance(const Ray& ray, const Bounds& bounds)
+{
+    float entry = 0.f;
+    float exit = Math::Infinity;
+    for (int32_t axis = 0; axis < 3; ++axis)
+    {
+        float t0 = (bounds.min[axis] - ray.origin[axis]) / ray.direction[axis];
+        float t1 = (bounds.max[axis] - ray.origin[axis]) / ray.direction[axis];
+        entry = std::max(entry, std::min(t0, t1));
+        exit = std::min(exit, std::max(t0, t1));
+    }
+    return entry <= exit ? entry : Math::Infinity;
+}
+
+static std::vector<Ray> MakeRays(size_t count, uint32_t seed = 11)
+{
+    std::mt19937 rng(seed);
+    std::uniform_real_distribution<float> position(-120.f, 120.f);
+    std::uniform_real_distribution<float> direction(-1.f, 1.f);
+
+    std::vector<Ray> rays;
+    for (size_t i = 0; i < count; ++i)
+        rays.emplace_back(Vector3F(position(rng), position(rng), position(rng)), Vector3F(direction(rng), direction(rng), direction(rng) + 0.01f).Normalized());
+    return rays;
+}
+
+static Frustum MakeFrustum()
+{
+    Matrix4x4F view = Matrix4x4F::CreateLookAt(Vector3F(0.f, 10.f, -120.f), Vector3F(0.f, 0.f, 0.f));
+    return Frustum::FromViewProjection(view * Matrix4x4F::CreatePerspectiveProjection(1.f, 16.f / 9.f, 0.5f, 150.f));
+}
+
+template<typename Query>
+static std::vector<uint32_t> Collect(Query&& query)
+{
+    std::vector<uint32_t> result;
+    query([&](uint32_t item) { result.push_back(item); });
+    std::sort(result.begin(), result.end());
+    return result;
+}
+
+// ─────────────────────────────────────────────
+// Bounds
+// ─────────────────────────────────────────────
+
+TEST(BoundsTest, DefaultIsEmptyAndEncapsulateReplacesIt)
+{
+    Bounds bounds;
+    EXPECT_TRUE(bounds.IsEmpty());
+    bounds.Encapsulate(Vector3F(1.f, 2.f, 3.f));
+    EXPECT_FALSE(bounds.IsEmpty());
+    EXPECT_EQ(bounds.min, Vector3F(1.f, 2.f, 3.f));
+    EXPECT_EQ(bounds.max, Vector3F(1.f, 2.f, 3.f));
+}
+
+TEST(BoundsTest, CenterExtentsAndSurfaceArea)
+{
+    Bounds bounds = Bounds::FromCenterExtents(Vector3F(1.f, 2.f, 3.f), Vector3F(1.f, 2.f, 3.f));
+    EXPECT_EQ(bounds.min, Vector3F(0.f));
+    EXPECT_EQ(bounds.max, Vector3F(2.f, 4.f, 6.f));
+    EXPECT_EQ(bounds.Center(), Vector3F(1.f, 2.f, 3.f));
+    EXPECT_EQ(bounds.Extents(), Vector3F(1.f, 2.f, 3.f));
+    EXPECT_FLOAT_EQ(bounds.SurfaceArea(), 2.f * (8.f + 24.f + 12.f));
+}
+
+TEST(BoundsTest, IntersectsAndContains)
+{
+    Bounds a(Vector3F(0.f), Vector3F(2.f));
+    EXPECT_TRUE(a.Intersects(Bounds(Vector3F(1.f), Vector3F(3.f))));
+    EXPECT_TRUE(a.Intersects(Bounds(Vector3F(2.f), Vector3F(3.f))));  // touching
+    EXPECT_FALSE(a.Intersects(Bounds(Vector3F(2.1f, 0.f, 0.f), Vector3F(3.f))));
+    EXPECT_TRUE(a.Contains(Vector3F(1.f)));
+    EXPECT_FALSE(a.Contains(Vector3F(-0.1f, 1.f, 1.f)));
+    EXPECT_EQ(Bounds::Union(a, Bounds(Vector3F(-1.f), Vector3F(1.f))), Bounds(Vector3F(-1.f), Vector3F(2.f)));
+}
+
+// ─────────────────────────────────────────────
+// Build
+// ─────────────────────────────────────────────
+
+TEST(BvhTest, EmptyBuild)
+{
+    Bvh bvh;
+    bvh.Build({});
+    EXPECT_TRUE(bvh.IsEmpty());
+    EXPECT_TRUE(Collect([&](auto&& cb) { bvh.QueryBounds(Bounds(Vector3F(-1.f), Vector3F(1.f)), cb); }).empty());
+    bvh.QueryRay(Ray(Vector3F(0.f), Vector3F(0.f, 0.f, 1.f)), 100.f, [](uint32_t, float&) { FAIL(); });
+}
+
+TEST(BvhTest, SingleItem)
+{
+    std::vector<Bounds> items = { Bounds(Vector3F(1.f), Vector3F(2.f)) };
+    Bvh bvh;
+    bvh.Build(items);
+    ASSERT_EQ(bvh.GetNodes().size(), 1u);
+    EXPECT_TRUE(bvh.GetNodes()[0].IsLeaf());
+    EXPECT_EQ(bvh.GetBounds(), items[0]);
+}
+
+TEST(BvhTest, BuildProducesValidTree)
+{
+    for (size_t count : { size_t(2), size_t(9), size_t(100), size_t(5000) })
+    {
+        std::vector<Bounds> items = MakeItems(count);
+        Bvh bvh;
+        bvh.Build(items);
+        EXPECT_EQ(bvh.GetItemCount(), count);
+        EXPECT_LE(ValidateTree(bvh, items), Bvh::MaxDepth);
+    }
+}
+
+TEST(BvhTest, CoincidentItemsStillSplit)
+{
+    std::vector<Bounds> items(100, Bounds(Vector3F(0.f), Vector3F(1.f)));
+    Bvh bvh;
+    bvh.Build(items);
+    ValidateTree(bvh, items);
+}
+
+// ─────────────────────────────────────────────
+// Queries
+// ─────────────────────────────────────────────
+
+TEST(BvhQueryTest, BoundsQueryMatchesBruteForce)
+{
+    std::vector<Bounds> items = MakeItems(3000);
+    Bvh bvh;
+    bvh.Build(items);
+
+    for (const Bounds& query : { Bounds(Vector3F(-10.f), Vector3F(10.f)), Bounds(Vector3F(15.f, -5.f, -35.f), Vector3F(25.f, 5.f, -25.f)), Bounds(Vector3F(500.f), Vector3F(501.f)) })
+    {
+        std::vector<uint32_t> expected;
+        for (uint32_t i = 0; i < items.size(); ++i)
+        {
+            if (query.Intersects(items[i]))
+                expected.push_back(i);
+        }
+
+        EXPECT_EQ(Collect([&](auto&& cb) { bvh.QueryBounds(query, cb); }), expected);
+    }
+}
+
+TEST(BvhQueryTest, FrustumQueryMatchesBruteForce)
+{
+    std::vector<Bounds> items = MakeItems(3000);
+    Bvh bvh;
+    bvh.Build(items);
+    Frustum frustum = MakeFrustum();
+
+    std::vector<uint32_t> expected;
+    for (uint32_t i = 0; i < items.size(); ++i)
+    {
+        if (frustum.IntersectsBox(items[i].Center(), items[i].Extents()))
+            expected.push_back(i);
+    }
+
+    EXPECT_FALSE(expected.empty());
+    EXPECT_EQ(Collect([&](auto&& cb) { bvh.QueryFrustum(frustum, cb); }), expected);
+}
+
+TEST(BvhQueryTest, RayQueryMatchesBruteForce)
+{
+    std::vector<Bounds> items = MakeItems(3000);
+    Bvh bvh;
+    bvh.Build(items);
+
+    for (const Ray& ray : MakeRays(50))
+    {
+        std::vector<uint32_t> expected;
+        for (uint32_t i = 0; i < items.size(); ++i)
+        {
+            if (RayBoundsDistance(ray, items[i]) <= 80.f)
+                expected.push_back(i);
+        }
+
+        std::vector<uint32_t> found;
+        bvh.QueryRay(ray, 80.f, [&](uint32_t item, float&) { found.push_back(item); });
+        std::sort(found.begin(), found.end());
+
+        EXPECT_EQ(found, expected);
+    }
+}
+
+TEST(BvhQueryTest, RayQueryClosestHit)
+{
+    std::vector<Bounds> items = MakeItems(3000);
+    Bvh bvh;
+    bvh.Build(items);
+
+    for (const Ray& ray : MakeRays(50, 3))
+    {
+        float expected = Math::Infinity;
+        for (const Bounds& item : items)
+            expected = std::min(expected, RayBoundsDistance(ray, item));
+
+        float closest = Math::Infinity;
+        int visited = 0;
+        bvh.QueryRay(ray, Math::Infinity, [&](uint32_t item, float& maxDistance)
+            {
+                visited++;
+                float distance = RayBoundsDistance(ray, items[item]);
+                if (distance < maxDistance)
+                {
+                    maxDistance = distance;
+                    closest = distance;
+                }
+            });
+
+        EXPECT_EQ(closest, expected);
+        EXPECT_LT(visited, 3000);
+    }
+}
+
+// ─────────────────────────────────────────────
+// Dynamic content
+// ─────────────────────────────────────────────
+
+TEST(BvhDynamicTest, RefitKeepsQueriesCorrect)
+{
+    std::vector<Bounds> items = MakeItems(2000);
+    Bvh bvh;
+    bvh.Build(items);
+    size_t nodeCount = bvh.GetNodes().size();
+
+    MoveItems(items, 1.f);
+    bvh.Refit(items);
+
+    EXPECT_EQ(bvh.GetNodes().size(), nodeCount);
+    ValidateTree(bvh, items);
+
+    Frustum frustum = MakeFrustum();
+    std::vector<uint32_t> expected;
+    for (uint32_t i = 0; i < items.size(); ++i)
+    {
+        if (frustum.IntersectsBox(items[i].Center(), items[i].Extents()))
+            expected.push_back(i);
+    }
+    EXPECT_EQ(Collect([&](auto&& cb) { bvh.QueryFrustum(frustum, cb); }), expected);
+}
+
+TEST(BvhDynamicTest, OptimizeLowersCostWithoutGrowingHeight)
+{
+    std::vector<Bounds> items = MakeItems(5000);
+    Bvh bvh;
+    bvh.Build(items);
+
+    // Large random motion degrades the tree built for the original positions
+    std::mt19937 rng(5);
+    std::uniform_real_distribution<float> offset(-60.f, 60.f);
+    for (Bounds& item : items)
+    {
+        Vector3F delta(offset(rng), offset(rng), offset(rng));
+        item = Bounds(item.min + delta, item.max + delta);
+    }
+
+    bvh.Refit(items);
+    int32_t refitHeight = ValidateTree(bvh, items);
+    float refitCost = bvh.GetCost();
+
+    for (int i = 0; i < 4; ++i)
+        bvh.Optimize();
+
+    int32_t optimizedHeight = ValidateTree(bvh, items);
+    float optimizedCost = bvh.GetCost();
+
+    EXPECT_LT(optimizedCost, refitCost);
+    EXPECT_LE(optimizedHeight, refitHeight);
+
+    Bounds query(Vector3F(-30.f), Vector3F(30.f));
+    std::vector<uint32_t> expected;
+    for (uint32_t i = 0; i < items.size(); ++i)
+    {
+        if (query.Intersects(items[i]))
+            expected.push_back(i);
+    }
+    EXPECT_EQ(Collect([&](auto&& cb) { bvh.QueryBounds(query, cb); }), expected);
+}
\ No newline at end of file
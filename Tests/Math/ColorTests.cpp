@@ -1,9 +1,14 @@
 ﻿#include <gtest/gtest.h>
+#include <algorithm>
 #include <cmath>
 #include <cstdint>
 #include <optional>
+#include <span>
 #include <string>
+#include <string_view>
+#include <vector>
 #include "ByteEngine/Math/Color.h"
+#include "ByteEngine/Math/ColorConversion.h"
 
 using namespace ByteEngine::Math;
 
@@ -1047,4 +1052,297 @@ TYPED_TEST(ColorTRobustnessTest, MinMaxSameColorReturnsSameColor)
         static_cast<TypeParam>(0.5), static_cast<TypeParam>(1.0));
     EXPECT_TRUE(ColorEqual(Color::Min(c, c), c));
     EXPECT_TRUE(ColorEqual(Color::Max(c, c), c));
+}
+
+// ─────────────────────────────────────────────
+// Bulk sRGB / linear conversion
+// ─────────────────────────────────────────────
+
+// Odd count so the tail path is exercised, channels sweep [-0.1, 1.2] to cover both segments and clamping
+static std::vector<ColorF> MakeColorRamp(size_t count)
+{
+    std::vector<ColorF> colors;
+    colors.reserve(count);
+    for (size_t i = 0; i < count; ++i)
+    {
+        float t = static_cast<float>(i) / static_cast<float>(count - 1);
+        colors.emplace_back(-0.1f + 1.3f * t, t, 1.0f - t, 0.25f + 0.5f * t);
+    }
+    return colors;
+}
+
+static constexpr size_t kColorRampCount = 4099;
+
+TEST(ColorBulkConversionTest, LinearToGammaMatchesScalar)
+{
+    std::vector<ColorF> colors = MakeColorRamp(kColorRampCount);
+    std::vector<ColorF> results(colors.size(), ColorF(0.0f));
+    Math::LinearToGammaSpace(colors, results);
+
+    float maxError = 0.0f;
+    for (size_t i = 0; i < colors.size(); ++i)
+    {
+        ColorF expected = colors[i].AsGamma();
+        maxError = std::max({ maxError, std::fabs(results[i].r - expected.r), std::fabs(results[i].g - expected.g), std::fabs(results[i].b - expected.b) });
+        EXPECT_EQ(results[i].a, colors[i].a);
+    }
+
+    RecordProperty("LinearToGammaMaxError", std::to_string(maxError));
+    EXPECT_LT(maxError, 2e-6f);
+}
+
+TEST(ColorBulkConversionTest, GammaToLinearMatchesScalar)
+{
+    std::vector<ColorF> colors = MakeColorRamp(kColorRampCount);
+    std::vector<ColorF> results(colors.size(), ColorF(0.0f));
+    Math::GammaToLinearSpace(colors, results);
+
+    float maxError = 0.0f;
+    for (size_t i = 0; i < colors.size(); ++i)
+    {
+        ColorF expected = colors[i].AsLinear();
+        maxError = std::max({ maxError, std::fabs(results[i].r - expected.r), std::fabs(results[i].g - expected.g), std::fabs(results[i].b - expected.b) });
+        EXPECT_EQ(results[i].a, colors[i].a);
+    }
+
+    RecordProperty("GammaToLinearMaxError", std::to_string(maxError));
+    EXPECT_LT(maxError, 2e-6f);
+}
+
+TEST(ColorBulkConversionTest, RoundTripInPlace)
+{
+    std::vector<ColorF> colors = MakeColorRamp(37);
+    for (ColorF& color : colors)
+        color.Clamp();
+
+    std::vector<ColorF> original = colors;
+    Math::LinearToGammaSpace(colors, colors);
+    Math::GammaToLinearSpace(colors, colors);
+
+    for (size_t i = 0; i < colors.size(); ++i)
+        EXPECT_TRUE(ColorEqual(colors[i], original[i], 1e-5f));
+}
+
+TEST(ColorBulkConversionTest, DecodeRGBA8IsExact)
+{
+    // Every byte value in every channel, 256 pixels plus a partial block
+    std::vector<ColorRGBA8> pixels;
+    for (int i = 0; i < 259; ++i)
+    {
+        uint8_t v = static_cast<uint8_t>(i % 256);
+        pixels.emplace_back(v, static_cast<uint8_t>(255 - v), static_cast<uint8_t>(v / 2), v);
+    }
+
+    std::vector<ColorF> results(pixels.size(), ColorF(0.0f));
+    Math::GammaToLinearSpace(pixels, results);
+
+    for (size_t i = 0; i < pixels.size(); ++i)
+    {
+        ColorF expected = ColorF(pixels[i].r, pixels[i].g, pixels[i].b, pixels[i].a).AsLinear();
+        EXPECT_EQ(results[i], expected) << "pixel " << i;
+    }
+}
+
+TEST(ColorBulkConversionTest, EncodeRGBA8MatchesScalar)
+{
+    std::vector<ColorF> colors = MakeColorRamp(kColorRampCount);
+    std::vector<ColorRGBA8> results(colors.size());
+    Math::LinearToGammaSpace(colors, results);
+
+    auto encode = [](float value) { return static_cast<int>(std::round(std::clamp(value, 0.0f, 1.0f) * 255.0f)); };
+
+    int maxError = 0;
+    for (size_t i = 0; i < colors.size(); ++i)
+    {
+        ColorF expected = colors[i].Clamped().AsGamma();
+        int errors[] = {
+            std::abs(results[i].r - encode(expected.r)),
+            std::abs(results[i].g - encode(expected.g)),
+            std::abs(results[i].b - encode(expected.b)),
+            std::abs(results[i].a - encode(colors[i].a))
+        };
+
+        for (int error : errors)
+            maxError = std::max(maxError, error);
+    }
+
+    EXPECT_LE(maxError, 1);
+}
+
+TEST(ColorBulkConversionTest, EmptySpans)
+{
+    Math::LinearToGammaSpace(std::span<const ColorF>(), std::span<ColorF>());
+    Math::GammaToLinearSpace(std::span<const ColorRGBA8>(), std::span<ColorF>());
+}
+
+// ─────────────────────────────────────────────
+// Allocation-free formatting and bulk parsing (FormatTo / Parse)
+// ─────────────────────────────────────────────
+
+TYPED_TEST(ColorTTest, FormatToMatchesToString)
+{
+    using Color = typename TestFixture::Color;
+    Color colors[] = {
+        Color(static_cast<TypeParam>(1.0), static_cast<TypeParam>(0.5), static_cast<TypeParam>(0.0), static_cast<TypeParam>(0.75)),
+        Color(static_cast<TypeParam>(0.123456), static_cast<TypeParam>(-0.5), static_cast<TypeParam>(2.0), static_cast<TypeParam>(1.0)),
+        Color(static_cast<TypeParam>(0.0))
+    };
+
+    for (const Color& c : colors)
+    {
+        for (std::string_view format : { "F0", "F2", "F2A", "F5A", "F9", "H", "HA" })
+        {
+            char buffer[128];
+            auto written = c.FormatTo(buffer, format);
+            auto expected = c.ToString(format);
+            ASSERT_TRUE(written.has_value()) << format;
+            ASSERT_TRUE(expected.has_value()) << format;
+            EXPECT_EQ(std::string_view(buffer, *written), *expected) << format;
+        }
+    }
+}
+
+TYPED_TEST(ColorTTest, FormatToDefaultFormatMatchesToString)
+{
+    using Color = typename TestFixture::Color;
+    Color c(static_cast<TypeParam>(0.25), static_cast<TypeParam>(0.5), static_cast<TypeParam>(0.75), static_cast<TypeParam>(1.0));
+    char buffer[64];
+    auto written = c.FormatTo(buffer);
+    ASSERT_TRUE(written.has_value());
+    EXPECT_EQ(std::string_view(buffer, *written), *c.ToString());
+}
+
+TYPED_TEST(ColorTTest, FormatToBufferTooSmallReturnsEmpty)
+{
+    using Color = typename TestFixture::Color;
+    Color c(static_cast<TypeParam>(0.5));
+    char buffer[16];
+    EXPECT_FALSE(c.FormatTo(std::span(buffer, 8), "HA").has_value());
+    EXPECT_TRUE(c.FormatTo(std::span(buffer, 9), "HA").has_value());
+    EXPECT_FALSE(c.FormatTo(buffer, "F5A").has_value());
+    EXPECT_FALSE(c.FormatTo(std::span<char>(), "H").has_value());
+}
+
+TYPED_TEST(ColorTTest, FormatToInvalidFormatReturnsEmpty)
+{
+    using Color = typename TestFixture::Color;
+    Color c(static_cast<TypeParam>(0.5));
+    char buffer[64];
+    EXPECT_FALSE(c.FormatTo(buffer, "INVALID_FORMAT").has_value());
+    EXPECT_FALSE(c.FormatTo(buffer, "").has_value());
+    EXPECT_FALSE(c.FormatTo(buffer, "F").has_value());
+    EXPECT_FALSE(c.FormatTo(buffer, "FXA").has_value());
+}
+
+TYPED_TEST(ColorTTest, ParseMixedEntries)
+{
+    using Color = typename TestFixture::Color;
+    std::string_view text = "  #FF0000\n00FF00AA, Color(0.25, 0.5, 0.75);Color(1,0,0,0.5)\r\n#0000ff ";
+    Color results[8] = { Color(static_cast<TypeParam>(0.0)), Color(static_cast<TypeParam>(0.0)), Color(static_cast<TypeParam>(0.0)), Color(static_cast<TypeParam>(0.0)),
+        Color(static_cast<TypeParam>(0.0)), Color(static_cast<TypeParam>(0.0)), Color(static_cast<TypeParam>(0.0)), Color(static_cast<TypeParam>(0.0)) };
+
+    ColorParseResult result = Color::Parse(text, results);
+    EXPECT_TRUE(result.succeeded);
+    EXPECT_EQ(result.count, 5u);
+    EXPECT_EQ(result.consumed, text.size());
+
+    EXPECT_EQ(results[0], *Color::HtmlToRgb("#FF0000"));
+    EXPECT_EQ(results[1], *Color::HtmlToRgb("00FF00AA"));
+    EXPECT_TRUE(ColorEqual(results[2], Color(static_cast<TypeParam>(0.25), static_cast<TypeParam>(0.5), static_cast<TypeParam>(0.75), static_cast<TypeParam>(1.0))));
+    EXPECT_TRUE(ColorEqual(results[3], Color(static_cast<TypeParam>(1.0), static_cast<TypeParam>(0.0), static_cast<TypeParam>(0.0), static_cast<TypeParam>(0.5))));
+    EXPECT_EQ(results[4], *Color::HtmlToRgb("#0000ff"));
+}
+
+TYPED_TEST(ColorTTest, ParseStopsAtInvalidEntry)
+{
+    using Color = typename TestFixture::Color;
+    Color results[4] = { Color(static_cast<TypeParam>(0.0)), Color(static_cast<TypeParam>(0.0)), Color(static_cast<TypeParam>(0.0)), Color(static_cast<TypeParam>(0.0)) };
+
+    for (std::string_view bad : { "#12345", "#123456789", "#12345G", "ZZZZZZ", "Color(1, 2)", "Color(1, 2, 3, 4, 5)", "Color(1, 2, 3", "Color(a, b, c)", "#",
+        "Color(1, 2, 3)#FF0000", "Color(1, 2, 3)x", "Color(inf, 0, 0)", "Color(0, nan, 0)", "Color(0, 0, 0, -inf)", "Color(1e999, 0, 0)" })
+    {
+        std::string text = "#FFFFFF " + std::string(bad) + " #000000";
+        ColorParseResult result = Color::Parse(text, results);
+        EXPECT_FALSE(result.succeeded) << bad;
+        EXPECT_EQ(result.count, 1u) << bad;
+        EXPECT_EQ(result.consumed, 8u) << bad;
+    }
+}
+
+TYPED_TEST(ColorTTest, ParseStopsWhenResultsAreFull)
+{
+    using Color = typename TestFixture::Color;
+    std::string_view text = "#FF0000 #00FF00 #0000FF";
+    Color results[2] = { Color(static_cast<TypeParam>(0.0)), Color(static_cast<TypeParam>(0.0)) };
+
+    ColorParseResult result = Color::Parse(text, results);
+    EXPECT_TRUE(result.succeeded);
+    EXPECT_EQ(result.count, 2u);
+    EXPECT_EQ(text.substr(result.consumed), "#0000FF");
+}
+
+TYPED_TEST(ColorTTest, ParseEmptyText)
+{
+    using Color = typename TestFixture::Color;
+    ColorParseResult result = Color::Parse(" \n\t ", std::span<Color>());
+    EXPECT_TRUE(result.succeeded);
+    EXPECT_EQ(result.count, 0u);
+}
+
+TYPED_TEST(ColorTTest, ParseRoundTripsFormatTo)
+{
+    using Color = typename TestFixture::Color;
+    Color original(static_cast<TypeParam>(0.1), static_cast<TypeParam>(0.2), static_cast<TypeParam>(0.3), static_cast<TypeParam>(0.4));
+
+    char buffer[256];
+    size_t size = *original.FormatTo(buffer, "F6A");
+    buffer[size++] = '\n';
+    size += *original.FormatTo(std::span(buffer + size, sizeof(buffer) - size), "HA");
+
+    Color results[2] = { Color(static_cast<TypeParam>(0.0)), Color(static_cast<TypeParam>(0.0)) };
+    ColorParseResult result = Color::Parse(std::string_view(buffer, size), results);
+    ASSERT_TRUE(result.succeeded);
+    ASSERT_EQ(result.count, 2u);
+    EXPECT_TRUE(ColorEqual(results[0], original, static_cast<TypeParam>(1e-6)));
+    EXPECT_TRUE(ColorEqual(results[1], original, static_cast<TypeParam>(1.0 / 255.0)));
+}
+
+// A theme-file like block: FormatTo into one buffer gives the same text as ToString per color and parses back
+TEST(ColorTextTest, FormatToBlockMatchesToStringAndParses)
+{
+    constexpr size_t colorCount = 500;
+
+    std::vector<ColorF> colors = MakeColorRamp(colorCount);
+    for (ColorF& color : colors)
+        color.Clamp();
+
+    for (std::string_view format : { "HA", "F5A" })
+    {
+        std::string stringText;
+        for (const ColorF& color : colors)
+        {
+            stringText += *color.ToString(format);
+            stringText += '\n';
+        }
+
+        std::vector<char> block(colorCount * 48);
+        size_t blockSize = 0;
+        for (const ColorF& color : colors)
+        {
+            blockSize += *color.FormatTo(std::span(block).subspan(blockSize), format);
+            block[blockSize++] = '\n';
+        }
+
+        ASSERT_EQ(std::string_view(block.data(), blockSize), stringText);
+
+        std::vector<ColorF> parsed(colorCount, ColorF(0.0f));
+        ColorParseResult result = ColorF::Parse(std::string_view(block.data(), blockSize), parsed);
+
+        ASSERT_TRUE(result.succeeded);
+        ASSERT_EQ(result.count, colorCount);
+
+        float tolerance = format[0] == 'H' ? 0.5f / 255.0f + 1e-6f : 1e-5f;
+        for (size_t i = 0; i < colorCount; ++i)
+            EXPECT_TRUE(ColorEqual(parsed[i], colors[i], tolerance)) << format << " color " << i;
+    }
 }
\ No newline at end of file
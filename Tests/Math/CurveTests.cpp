@@ -0,0 +1,288 @@
+﻿#include <gtest/gtest.h>
+#include <cstdint>
+#include <cmath>
+#include <random>
+#include <vector>
+#include "ByteEngine/Math/Curve.h"
+
+using namespace ByteEngine::Math;
+
+// ─────────────────────────────────────────────
+// Helpers
+// ─────────────────────────────────────────────
+
+static constexpr float kEps = 1e-5f;
+
+static void ExpectVectorNear(Vector3F a, Vector3F b, float eps = kEps)
+{
+    EXPECT_NEAR(a.x, b.x, eps);
+    EXPECT_NEAR(a.y, b.y, eps);
+    EXPECT_NEAR(a.z, b.z, eps);
+}
+
+static void ExpectQuaternionNear(Quaternion a, Quaternion b, float eps = kEps)
+{
+    EXPECT_NEAR(a.x, b.x, eps);
+    EXPECT_NEAR(a.y, b.y, eps);
+    EXPECT_NEAR(a.z, b.z, eps);
+    EXPECT_NEAR(a.w, b.w, eps);
+}
+
+static std::vector<float> RandomFloats(size_t count, uint32_t seed, float min = -10.f, float max = 10.f)
+{
+    std::mt19937 rng(seed);
+    std::uniform_real_distribution<float> dist(min, max);
+    std::vector<float> values(count);
+
+    for (float& value : values)
+        value = dist(rng);
+
+    return values;
+}
+
+static Quaternion RandomRotation(std::mt19937& rng)
+{
+    std::normal_distribution<float> component(0.f, 1.f);
+    return Quaternion(component(rng), component(rng), component(rng), component(rng)).Normalized();
+}
+
+// ─────────────────────────────────────────────
+// Scalar evaluation
+// ─────────────────────────────────────────────
+
+TEST(CurveTest, BezierHitsEndPointsAndIsLinearForEvenlySpacedPoints)
+{
+    BezierCurve<float> curve(0.f, 1.f, 2.f, 3.f);
+
+    EXPECT_FLOAT_EQ(curve.Evaluate(0.f), 0.f);
+    EXPECT_FLOAT_EQ(curve.Evaluate(1.f), 3.f);
+    EXPECT_NEAR(curve.Evaluate(0.25f), 0.75f, kEps);
+    EXPECT_NEAR(curve.EvaluateDerivative(0.6f), 3.f, kEps);
+
+    BezierCurve<Vector3F> bent(Vector3F(0.f), Vector3F(0.f, 1.f, 0.f), Vector3F(1.f, 1.f, 0.f), Vector3F(1.f, 0.f, 0.f));
+    ExpectVectorNear(bent.Evaluate(0.5f), Vector3F(0.5f, 0.75f, 0.f));
+    ExpectVectorNear(bent.EvaluateDerivative(0.f), Vector3F(0.f, 3.f, 0.f));
+}
+
+TEST(CurveTest, HermiteMatchesEndPointsAndTangents)
+{
+    HermiteCurve<Vector3F> curve(Vector3F(1.f, 2.f, 3.f), Vector3F(4.f, 0.f, 0.f), Vector3F(-1.f, 0.f, 5.f), Vector3F(0.f, -2.f, 1.f));
+
+    ExpectVectorNear(curve.Evaluate(0.f), Vector3F(1.f, 2.f, 3.f));
+    ExpectVectorNear(curve.Evaluate(1.f), Vector3F(-1.f, 0.f, 5.f));
+    ExpectVectorNear(curve.EvaluateDerivative(0.f), Vector3F(4.f, 0.f, 0.f));
+    ExpectVectorNear(curve.EvaluateDerivative(1.f), Vector3F(0.f, -2.f, 1.f));
+}
+
+TEST(CurveTest, CatmullRomPassesThroughInnerPointsWithCentralTangents)
+{
+    CatmullRomCurve<Vector3F> curve(Vector3F(0.f), Vector3F(1.f, 0.f, 0.f), Vector3F(2.f, 1.f, 0.f), Vector3F(4.f, 1.f, 2.f));
+
+    ExpectVectorNear(curve.Evaluate(0.f), Vector3F(1.f, 0.f, 0.f));
+    ExpectVectorNear(curve.Evaluate(1.f), Vector3F(2.f, 1.f, 0.f));
+    ExpectVectorNear(curve.EvaluateDerivative(0.f), Vector3F(1.f, 0.5f, 0.f));
+    ExpectVectorNear(curve.EvaluateDerivative(1.f), Vector3F(1.5f, 0.5f, 1.f));
+
+    // Weights of every basis sum to one, so constant curves stay constant
+    for (float t : { 0.f, 0.3f, 0.7f, 1.f })
+        EXPECT_NEAR(CatmullRomCurve<float>(2.f, 2.f, 2.f, 2.f).Evaluate(t), 2.f, kEps);
+}
+
+TEST(CurveTest, CatmullRomPathIsContinuousBetweenSegments)
+{
+    std::vector<Vector3F> path = { Vector3F(0.f), Vector3F(1.f, 2.f, 0.f), Vector3F(3.f, 2.f, 1.f), Vector3F(4.f, 0.f, 1.f) };
+
+    for (size_t segment = 0; segment + 1 < path.size(); segment++)
+    {
+        auto curve = CatmullRomCurve<Vector3F>::FromPath(path, segment);
+        ExpectVectorNear(curve.Evaluate(0.f), path[segment]);
+        ExpectVectorNear(curve.Evaluate(1.f), path[segment + 1]);
+
+        if (segment + 2 < path.size())
+        {
+            auto next = CatmullRomCurve<Vector3F>::FromPath(path, segment + 1);
+            ExpectVectorNear(curve.EvaluateDerivative(1.f), next.EvaluateDerivative(0.f));
+        }
+    }
+}
+
+TEST(CurveTest, QuaternionCurvesAreNormalizedAndTakeTheShortWay)
+{
+    Quaternion a = Quaternion::FromEuler(0_df, 0_df, 0_df);
+    Quaternion b = Quaternion::FromEuler(0_df, 30_df, 0_df);
+    Quaternion c = Quaternion::FromEuler(0_df, 60_df, 0_df);
+    Quaternion d = Quaternion::FromEuler(0_df, 90_df, 0_df);
+
+    CatmullRomCurve<Quaternion> curve(a, b, c, d);
+    CatmullRomCurve<Quaternion> flipped(a, -b, c, -d);
+
+    ExpectQuaternionNear(curve.Evaluate(0.f), b);
+    ExpectQuaternionNear(curve.Evaluate(1.f), c);
+
+    for (float t : { 0.f, 0.25f, 0.5f, 0.75f, 1.f })
+    {
+        Quaternion q = curve.Evaluate(t);
+        EXPECT_NEAR(q.LengthSquared(), 1.f, kEps);
+        EXPECT_NEAR(Quaternion::Dot(q, flipped.Evaluate(t)), 1.f, kEps);
+    }
+
+    // Evenly spaced yaw keys: the midpoint is the 45 degree rotation
+    EXPECT_NEAR(Quaternion::Dot(curve.Evaluate(0.5f), Quaternion::FromEuler(0_df, 45_df, 0_df)), 1.f, kEps);
+
+    BezierCurve<Quaternion> bezier(a, b, -c, d);
+    ExpectQuaternionNear(bezier.Evaluate(0.f), a);
+    ExpectQuaternionNear(bezier.Evaluate(1.f), d);
+}
+
+// ─────────────────────────────────────────────
+// Batch evaluation
+// ─────────────────────────────────────────────
+
+TEST(CurveBatchTest, ManyParametersMatchScalar)
+{
+    // Odd count so the tail block is exercised
+    std::vector<float> t = RandomFloats(37, 1, 0.f, 1.f);
+
+    HermiteCurve<float> scalarCurve(1.f, -3.f, 4.f, 2.f);
+    std::vector<float> scalars(t.size());
+    scalarCurve.Evaluate(t, scalars);
+
+    BezierCurve<Vector3F> vectorCurve(Vector3F(0.f), Vector3F(1.f, 5.f, 0.f), Vector3F(4.f, -1.f, 2.f), Vector3F(3.f, 3.f, 3.f));
+    std::vector<Vector3F> vectors(t.size(), Vector3F(0.f));
+    vectorCurve.Evaluate(t, vectors);
+
+    std::mt19937 rng(2);
+    CatmullRomCurve<Quaternion> rotationCurve(RandomRotation(rng), RandomRotation(rng), RandomRotation(rng), RandomRotation(rng));
+    std::vector<Quaternion> rotations(t.size());
+    rotationCurve.Evaluate(t, rotations);
+
+    for (size_t i = 0; i < t.size(); i++)
+    {
+        EXPECT_NEAR(scalars[i], scalarCurve.Evaluate(t[i]), 1e-4f);
+        ExpectVectorNear(vectors[i], vectorCurve.Evaluate(t[i]), 1e-4f);
+        ExpectQuaternionNear(rotations[i], rotationCurve.Evaluate(t[i]), 1e-4f);
+    }
+}
+
+TEST(CurveBatchTest, ManyCurvesMatchScalar)
+{
+    constexpr size_t count = 29;
+
+    std::vector<float> t = RandomFloats(count, 3, 0.f, 1.f);
+    std::vector<float> points[4][4];
+
+    std::mt19937 rng(4);
+    for (size_t k = 0; k < 4; k++)
+    {
+        for (size_t c = 0; c < 4; c++)
+            points[k][c].resize(count);
+
+        for (size_t i = 0; i < count; i++)
+        {
+            Quaternion q = RandomRotation(rng);
+            for (int32_t c = 0; c < 4; c++)
+                points[k][c][i] = q[c];
+        }
+    }
+
+    std::vector<float> result[4];
+    for (std::vector<float>& component : result)
+        component.resize(count);
+
+    // Vector3F curves use the first three components, float curves the first one
+    std::array<ConstVector3FStream, 4> vectorPoints;
+    std::array<ConstQuaternionStream, 4> rotationPoints;
+    std::array<std::span<const float>, 4> floatPoints;
+
+    for (size_t k = 0; k < 4; k++)
+    {
+        vectorPoints[k] = ConstVector3FStream(points[k][0], points[k][1], points[k][2]);
+        rotationPoints[k] = ConstQuaternionStream(points[k][0], points[k][1], points[k][2], points[k][3]);
+        floatPoints[k] = points[k][0];
+    }
+
+    auto vectorCurve = [&](size_t i) { return BezierCurve<Vector3F>(vectorPoints[0].Get(i), vectorPoints[1].Get(i), vectorPoints[2].Get(i), vectorPoints[3].Get(i)); };
+    auto rotationCurve = [&](size_t i) { return CatmullRomCurve<Quaternion>(rotationPoints[0].Get(i), rotationPoints[1].Get(i), rotationPoints[2].Get(i), rotationPoints[3].Get(i)); };
+    auto hermiteRotationCurve = [&](size_t i) { return HermiteCurve<Quaternion>(rotationPoints[0].Get(i), rotationPoints[1].Get(i), rotationPoints[2].Get(i), rotationPoints[3].Get(i)); };
+
+    BezierCurve<Vector3F>::Evaluate(vectorPoints, t, Vector3FStream(result[0], result[1], result[2]));
+    for (size_t i = 0; i < count; i++)
+        ExpectVectorNear(Vector3F(result[0][i], result[1][i], result[2][i]), vectorCurve(i).Evaluate(t[i]), 1e-5f);
+
+    BezierCurve<Vector3F>::Evaluate(vectorPoints, 0.4f, Vector3FStream(result[0], result[1], result[2]));
+    for (size_t i = 0; i < count; i++)
+        ExpectVectorNear(Vector3F(result[0][i], result[1][i], result[2][i]), vectorCurve(i).Evaluate(0.4f), 1e-5f);
+
+    CatmullRomCurve<Quaternion>::Evaluate(rotationPoints, t, QuaternionStream(result[0], result[1], result[2], result[3]));
+    for (size_t i = 0; i < count; i++)
+        ExpectQuaternionNear(Quaternion(result[0][i], result[1][i], result[2][i], result[3][i]), rotationCurve(i).Evaluate(t[i]), 1e-5f);
+
+    HermiteCurve<Quaternion>::Evaluate(rotationPoints, 0.7f, QuaternionStream(result[0], result[1], result[2], result[3]));
+    for (size_t i = 0; i < count; i++)
+        ExpectQuaternionNear(Quaternion(result[0][i], result[1][i], result[2][i], result[3][i]), hermiteRotationCurve(i).Evaluate(0.7f), 1e-5f);
+
+    HermiteCurve<float>::Evaluate(floatPoints, t, result[0]);
+    for (size_t i = 0; i < count; i++)
+    {
+        HermiteCurve<float> curve(points[0][0][i], points[1][0][i], points[2][0][i], points[3][0][i]);
+        EXPECT_NEAR(result[0][i], curve.Evaluate(t[i]), 1e-5f);
+    }
+}
+
+// ─────────────────────────────────────────────
+// Arc length
+// ─────────────────────────────────────────────
+
+TEST(ArcLengthTableTest, StraightLineIsLinear)
+{
+    ArcLengthTable table(BezierCurve<Vector3F>(Vector3F(0.f), Vector3F(1.f, 0.f, 0.f), Vector3F(2.f, 0.f, 0.f), Vector3F(3.f, 0.f, 0.f)));
+
+    EXPECT_EQ(table.GetSampleCount(), ArcLengthTable::DefaultSampleCount + 1);
+    EXPECT_NEAR(table.GetLength(), 3.f, kEps);
+    EXPECT_NEAR(table.GetParameter(1.5f), 0.5f, kEps);
+    EXPECT_FLOAT_EQ(table.GetParameter(-1.f), 0.f);
+    EXPECT_FLOAT_EQ(table.GetParameter(10.f), 1.f);
+
+    EXPECT_FLOAT_EQ(ArcLengthTable().GetParameter(1.f), 0.f);
+}
+
+TEST(ArcLengthTableTest, ConstantSpeedSamplingOfUnevenCurve)
+{
+    // Control points bunched at the start, so equal steps in t give very unequal steps along the curve
+    BezierCurve<Vector3F> curve(Vector3F(0.f), Vector3F(0.f), Vector3F(0.5f, 0.5f, 0.f), Vector3F(4.f, 1.f, 0.f));
+    ArcLengthTable table(curve, 256);
+
+    constexpr size_t stepCount = 32;
+    std::vector<float> distances(stepCount + 1);
+    for (size_t i = 0; i <= stepCount; i++)
+        distances[i] = table.GetLength() * static_cast<float>(i) / stepCount;
+
+    std::vector<float> t(distances.size());
+    table.GetParameters(distances, t);
+
+    float step = table.GetLength() / stepCount;
+    for (size_t i = 1; i <= stepCount; i++)
+    {
+        EXPECT_NEAR((curve.Evaluate(t[i]) - curve.Evaluate(t[i - 1])).Length(), step, step * 0.01f);
+        EXPECT_FLOAT_EQ(t[i], table.GetParameter(distances[i]));
+    }
+
+    // Unsorted distances take the search path
+    std::vector<float> shuffled = { distances[20], distances[3], distances[31], distances[0] };
+    std::vector<float> shuffledT(shuffled.size());
+    table.GetParameters(shuffled, shuffledT);
+
+    for (size_t i = 0; i < shuffled.size(); i++)
+        EXPECT_FLOAT_EQ(shuffledT[i], table.GetParameter(shuffled[i]));
+}
+
+TEST(ArcLengthTableTest, PathFromSamples)
+{
+    std::vector<float> samples = { 0.f, 1.f, 1.f, 3.f };
+    ArcLengthTable table;
+    table.Build(std::span<const float>(samples));
+
+    EXPECT_NEAR(table.GetLength(), 3.f, kEps);
+    EXPECT_NEAR(table.GetParameter(0.5f), 1.f / 6.f, kEps);
+    EXPECT_NEAR(table.GetParameter(2.f), 2.f / 3.f + 1.f / 6.f, kEps);
+}
\ No newline at end of file
@@ -0,0 +1,172 @@
+﻿#include <gtest/gtest.h>
+#include <cstdint>
+#include <cmath>
+#include <random>
+#include <vector>
+#include "ByteEngine/Math/Frustum.h"
+#include "ByteEngine/Math/Matrix4x4F.h"
+#include "ByteEngine/Math/Vector3Stream.h"
+
+using namespace ByteEngine::Math;
+
+// ─────────────────────────────────────────────
+// Helpers
+// ─────────────────────────────────────────────
+
+static constexpr float kEps = 1e-4f;
+
+// Camera at (0, 0, -10) looking down +Z, 90 degree vertical FOV, square aspect
+static Matrix4x4F MakeViewProjection()
+{
+    Matrix4x4F view = Matrix4x4F::CreateLookAt(Vector3F(0.f, 0.f, -10.f), Vector3F(0.f, 0.f, 0.f));
+    Matrix4x4F projection = Matrix4x4F::CreatePerspectiveProjection(Math::PI / 2.f, 1.f, 1.f, 100.f);
+    return view * projection;
+}
+
+struct SoAObjects
+{
+    std::vector<float> x, y, z;
+    std::vector<float> ex, ey, ez;
+    std::vector<float> radii;
+
+    ConstVector3FStream Centers() const { return ConstVector3FStream(x, y, z); }
+    ConstVector3FStream Extents() const { return ConstVector3FStream(ex, ey, ez); }
+};
+
+// Objects scattered around the camera, roughly a third of them visible
+static SoAObjects MakeObjects(size_t count, uint32_t seed = 42)
+{
+    std::mt19937 rng(seed);
+    std::uniform_real_distribution<float> position(-150.f, 150.f);
+    std::uniform_real_distribution<float> size(0.1f, 5.f);
+
+    SoAObjects objects;
+    for (size_t i = 0; i < count; ++i)
+    {
+        objects.x.push_back(position(rng));
+        objects.y.push_back(position(rng) * 0.3f);
+        objects.z.push_back(position(rng) * 0.5f + 50.f);
+        objects.ex.push_back(size(rng));
+        objects.ey.push_back(size(rng));
+        objects.ez.push_back(size(rng));
+        objects.radii.push_back(size(rng));
+    }
+    return objects;
+}
+
+// ─────────────────────────────────────────────
+// Plane extraction and single object tests
+// ─────────────────────────────────────────────
+
+TEST(FrustumTest, PlanesAreNormalized)
+{
+    Frustum frustum = Frustum::FromViewProjection(MakeViewProjection());
+    for (const Vector4F& plane : frustum.planes)
+        EXPECT_NEAR(std::sqrt(plane.x * plane.x + plane.y * plane.y + plane.z * plane.z), 1.f, kEps);
+}
+
+TEST(FrustumTest, NearAndFarPlanesMatchProjection)
+{
+    Frustum frustum = Frustum::FromViewProjection(MakeViewProjection());
+
+    // Camera looks down +Z from z = -10, near at 1 and far at 100
+    EXPECT_NEAR(frustum.planes[Frustum::Near].z, 1.f, kEps);
+    EXPECT_NEAR(frustum.planes[Frustum::Near].w, 9.f, kEps);
+    EXPECT_NEAR(frustum.planes[Frustum::Far].z, -1.f, kEps);
+    EXPECT_NEAR(frustum.planes[Frustum::Far].w, 90.f, 1e-2f);  // col3 - col2 loses a few bits to cancellation
+}
+
+TEST(FrustumTest, SphereInsideAndOutside)
+{
+    Frustum frustum = Frustum::FromViewProjection(MakeViewProjection());
+
+    EXPECT_TRUE(frustum.IntersectsSphere(Vector3F(0.f, 0.f, 0.f), 1.f));
+    EXPECT_FALSE(frustum.IntersectsSphere(Vector3F(0.f, 0.f, -20.f), 1.f));   // behind the camera
+    EXPECT_FALSE(frustum.IntersectsSphere(Vector3F(0.f, 0.f, 95.f), 1.f));    // past the far plane
+    EXPECT_TRUE(frustum.IntersectsSphere(Vector3F(0.f, 0.f, 95.f), 6.f));     // straddles the far plane
+    EXPECT_FALSE(frustum.IntersectsSphere(Vector3F(30.f, 0.f, 10.f), 1.f));   // 45 degrees half FOV, x = 20 is the edge
+    EXPECT_TRUE(frustum.IntersectsSphere(Vector3F(20.5f, 0.f, 10.f), 1.f));
+    EXPECT_FALSE(frustum.IntersectsSphere(Vector3F(0.f, -30.f, 10.f), 1.f));
+}
+
+TEST(FrustumTest, BoxInsideAndOutside)
+{
+    Frustum frustum = Frustum::FromViewProjection(MakeViewProjection());
+
+    EXPECT_TRUE(frustum.IntersectsBox(Vector3F(0.f, 0.f, 0.f), Vector3F(1.f)));
+    EXPECT_FALSE(frustum.IntersectsBox(Vector3F(0.f, 0.f, -20.f), Vector3F(1.f)));
+    EXPECT_FALSE(frustum.IntersectsBox(Vector3F(30.f, 0.f, 10.f), Vector3F(1.f)));
+    EXPECT_TRUE(frustum.IntersectsBox(Vector3F(30.f, 0.f, 10.f), Vector3F(10.5f, 1.f, 1.f)));
+    EXPECT_TRUE(frustum.IntersectsBox(Vector3F(0.f, 0.f, 0.f), Vector3F(500.f)));  // contains the whole frustum
+}
+
+TEST(FrustumTest, OrthographicFrustumIsABox)
+{
+    Frustum frustum = Frustum::FromViewProjection(Matrix4x4F::CreateOrthographicProjection(-5.f, 5.f, 5.f, -5.f, 0.f, 10.f));
+
+    EXPECT_TRUE(frustum.IntersectsSphere(Vector3F(4.9f, -4.9f, 9.9f), 0.f));
+    EXPECT_FALSE(frustum.IntersectsSphere(Vector3F(5.1f, 0.f, 5.f), 0.f));
+    EXPECT_FALSE(frustum.IntersectsSphere(Vector3F(0.f, 5.1f, 5.f), 0.f));
+    EXPECT_FALSE(frustum.IntersectsSphere(Vector3F(0.f, 0.f, -0.1f), 0.f));
+    EXPECT_FALSE(frustum.IntersectsSphere(Vector3F(0.f, 0.f, 10.1f), 0.f));
+}
+
+// ─────────────────────────────────────────────
+// Batch culling
+// ─────────────────────────────────────────────
+
+// Counts around the 8-wide kernel boundary to cover the tail handling
+static constexpr size_t kCullTestCounts[] = { 0, 1, 7, 8, 9, 16, 37, 1000 };
+
+TEST(FrustumCullTest, CullSpheresMatchesSingle)
+{
+    Frustum frustum = Frustum::FromViewProjection(MakeViewProjection());
+    for (size_t count : kCullTestCounts)
+    {
+        SoAObjects objects = MakeObjects(count);
+        std::vector<uint32_t> visible(count);
+        size_t visibleCount = frustum.CullSpheres(objects.Centers(), objects.radii, visible);
+
+        std::vector<uint32_t> expected;
+        for (size_t i = 0; i < count; ++i)
+        {
+            if (frustum.IntersectsSphere(Vector3F(objects.x[i], objects.y[i], objects.z[i]), objects.radii[i]))
+                expected.push_back(static_cast<uint32_t>(i));
+        }
+
+        ASSERT_EQ(visibleCount, expected.size()) << "count " << count;
+        for (size_t i = 0; i < visibleCount; ++i)
+            EXPECT_EQ(visible[i], expected[i]);
+    }
+}
+
+TEST(FrustumCullTest, CullBoxesMatchesSingle)
+{
+    Frustum frustum = Frustum::FromViewProjection(MakeViewProjection());
+    for (size_t count : kCullTestCounts)
+    {
+        SoAObjects objects = MakeObjects(count);
+        std::vector<uint32_t> visible(count);
+        size_t visibleCount = frustum.CullBoxes(objects.Centers(), objects.Extents(), visible);
+
+        std::vector<uint32_t> expected;
+        for (size_t i = 0; i < count; ++i)
+        {
+            if (frustum.IntersectsBox(Vector3F(objects.x[i], objects.y[i], objects.z[i]), Vector3F(objects.ex[i], objects.ey[i], objects.ez[i])))
+                expected.push_back(static_cast<uint32_t>(i));
+        }
+
+        ASSERT_EQ(visibleCount, expected.size()) << "count " << count;
+        for (size_t i = 0; i < visibleCount; ++i)
+            EXPECT_EQ(visible[i], expected[i]);
+    }
+}
+
+TEST(FrustumCullTest, TailPaddingIsNeverVisible)
+{
+    // The zero padded lanes of the tail would be a sphere at the origin, which is inside this frustum
+    Frustum frustum = Frustum::FromViewProjection(MakeViewProjection());
+    std::vector<float> x(3, 1000.f), y(3, 0.f), z(3, 0.f), radii(3, 1.f);
+    std::vector<uint32_t> visible(3);
+    EXPECT_EQ(frustum.CullSpheres(ConstVector3FStream(x, y, z), radii, visible), 0u);
+}
\ No newline at end of file
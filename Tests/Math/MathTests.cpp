@@ -1,5 +1,10 @@
 ﻿#include <gtest/gtest.h>
+#include <bit>
+#include <cmath>
+#include <cstdint>
+#include <vector>
 #include "ByteEngine/Math/Math.h"
+#include "ByteEngine/Math/Quaternion.h"
 
 using namespace ByteEngine::Math;
 
@@ -102,4 +107,250 @@ TEST(MathTest, MinMax)
     EXPECT_EQ(Math::Max(10, 2), 10);
     EXPECT_EQ(Math::Max(10, 2, 100), 100);
     EXPECT_EQ(Math::Max(data), 4);
-}
\ No newline at end of file
+}
+
+// ─────────────────────────────────────────────
+// Batch trigonometry
+// ─────────────────────────────────────────────
+
+// Distance between two floats in units in the last place
+static int64_t UlpDistance(float a, float b)
+{
+    auto ordered = [](float value)
+        {
+            int32_t bits = std::bit_cast<int32_t>(value);
+            return bits < 0 ? static_cast<int64_t>(INT32_MIN) - bits : static_cast<int64_t>(bits);
+        };
+    return std::abs(ordered(a) - ordered(b));
+}
+
+static std::vector<RadianF> MakeAngles(size_t count, float from, float to)
+{
+    std::vector<RadianF> angles(count);
+    for (size_t i = 0; i < count; ++i)
+        angles[i] = RadianF(from + (to - from) * static_cast<float>(i) / static_cast<float>(count - 1));
+    return angles;
+}
+
+// Odd count so the tail path is exercised as well
+static constexpr size_t kTrigCount = 100003;
+
+// Batch and scalar evaluate the same polynomials, but whether their multiply-adds are fused depends on the SIMD backend
+// for the batch kernels and on the optimizer for the scalar code, so they are not compared bit for bit.
+// Both stay within the absolute error documented in Math.h for the selected variant, so they differ by at most twice that.
+// Sin and Cos over [-100, 100]: Precise 1e-7, Fast 3e-6 and twice that for the batch versions without FMA.
+// Asin and Acos: Precise 2 ULP of results below pi, Fast 4e-7
+static constexpr double kSinCosBound = Math::IsPreciseTrigonometry ? 1e-7 : 6e-6;
+static constexpr double kAsinAcosBound = Math::IsPreciseTrigonometry ? 2.0 * 0x1p-22 : 4e-7;
+
+TEST(MathBatchTrigonometryTest, SinCosMatchScalar)
+{
+    std::vector<RadianF> angles = MakeAngles(kTrigCount, -100.0f, 100.0f);
+    std::vector<float> sin(kTrigCount), cos(kTrigCount), sinOnly(kTrigCount), cosOnly(kTrigCount);
+
+    Math::SinCos(sin, cos, angles);
+    Math::Sin(angles, sinOnly);
+    Math::Cos(angles, cosOnly);
+
+    for (size_t i = 0; i < kTrigCount; ++i)
+    {
+        double x = static_cast<double>(angles[i].value);
+        float expectedSin, expectedCos;
+        Math::SinCos(expectedSin, expectedCos, angles[i]);
+
+        EXPECT_LT(std::abs(sin[i] - std::sin(x)), kSinCosBound) << x;
+        EXPECT_LT(std::abs(cos[i] - std::cos(x)), kSinCosBound) << x;
+        EXPECT_LT(std::abs(expectedSin - std::sin(x)), kSinCosBound) << x;
+        EXPECT_LT(std::abs(expectedCos - std::cos(x)), kSinCosBound) << x;
+        EXPECT_LE(std::abs(sin[i] - expectedSin), 2.0 * kSinCosBound) << x;
+        EXPECT_LE(std::abs(cos[i] - expectedCos), 2.0 * kSinCosBound) << x;
+
+        // The single function kernels share the SinCos code path
+        EXPECT_EQ(sinOnly[i], sin[i]);
+        EXPECT_EQ(cosOnly[i], cos[i]);
+    }
+}
+
+TEST(MathBatchTrigonometryTest, AsinAcosMatchScalar)
+{
+    std::vector<float> values(kTrigCount);
+    for (size_t i = 0; i < kTrigCount; ++i)
+        values[i] = -1.0f + 2.0f * static_cast<float>(i) / static_cast<float>(kTrigCount - 1);
+
+    std::vector<RadianF> asin(kTrigCount), acos(kTrigCount);
+    Math::Asin(values, asin);
+    Math::Acos(values, acos);
+
+    for (size_t i = 0; i < kTrigCount; ++i)
+    {
+        double x = static_cast<double>(values[i]);
+        float expectedAsin = Math::Asin(values[i]).value;
+        float expectedAcos = Math::Acos(values[i]).value;
+
+        EXPECT_LT(std::abs(asin[i].value - std::asin(x)), kAsinAcosBound) << x;
+        EXPECT_LT(std::abs(acos[i].value - std::acos(x)), kAsinAcosBound) << x;
+        EXPECT_LT(std::abs(expectedAsin - std::asin(x)), kAsinAcosBound) << x;
+        EXPECT_LT(std::abs(expectedAcos - std::acos(x)), kAsinAcosBound) << x;
+        EXPECT_LE(std::abs(asin[i].value - expectedAsin), 2.0 * kAsinAcosBound) << x;
+        EXPECT_LE(std::abs(acos[i].value - expectedAcos), 2.0 * kAsinAcosBound) << x;
+    }
+}
+
+TEST(MathBatchTrigonometryTest, ShortAndEmptySpans)
+{
+    std::vector<RadianF> angles = { RadianF(0.0f), RadianF(Math::PI / 2.0f), RadianF(Math::PI) };
+    std::vector<float> sin(3), cos(3);
+    Math::SinCos(sin, cos, angles);
+    EXPECT_NEAR(sin[0], 0.0f, 1e-6f);
+    EXPECT_NEAR(sin[1], 1.0f, 1e-6f);
+    EXPECT_NEAR(cos[2], -1.0f, 1e-6f);
+
+    Math::SinCos(std::span<float>(), std::span<float>(), std::span<const RadianF>());
+}
+
+// Accuracy over one period against the double precision standard library, throughput is in the Trigonometry benchmarks
+TEST(MathBatchTrigonometryTest, SinCosMatchesStandardLibraryOverOnePeriod)
+{
+    std::vector<RadianF> angles = MakeAngles(kTrigCount, -Math::PI, Math::PI);
+    std::vector<float> sin(kTrigCount), cos(kTrigCount);
+    Math::SinCos(sin, cos, angles);
+
+    double maxSinError = 0.0, maxCosError = 0.0;
+    for (size_t i = 0; i < kTrigCount; ++i)
+    {
+        float referenceSin = static_cast<float>(std::sin(static_cast<double>(angles[i].value)));
+        float referenceCos = static_cast<float>(std::cos(static_cast<double>(angles[i].value)));
+        maxSinError = std::max(maxSinError, static_cast<double>(std::abs(sin[i] - referenceSin)));
+        maxCosError = std::max(maxCosError, static_cast<double>(std::abs(cos[i] - referenceCos)));
+    }
+
+    EXPECT_LT(maxSinError, 1e-6);
+    EXPECT_LT(maxCosError, 1e-6);
+}
+
+// ─────────────────────────────────────────────
+// Fast and precise trigonometry
+// ─────────────────────────────────────────────
+
+// Bounds documented in Math.h, checked on dense samples. Benchmarks --accuracy sweeps every float
+
+static_assert(Math::Precise::Sin(RadianF(0.0f)) == 0.0f && Math::Precise::Cos(RadianF(0.0f)) == 1.0f, "Precise Sin and Cos must stay constexpr");
+
+static float ReferenceSin(float x) { return static_cast<float>(std::sin(static_cast<double>(x))); }
+static float ReferenceCos(float x) { return static_cast<float>(std::cos(static_cast<double>(x))); }
+
+TEST(MathTrigonometryVariantTest, PreciseSinCosWithinTwoUlp)
+{
+    std::vector<RadianF> angles = MakeAngles(kTrigCount, -100.0f, 100.0f);
+    std::vector<float> sin(kTrigCount), cos(kTrigCount), batchSin(kTrigCount), batchCos(kTrigCount);
+    Math::Precise::SinCos(batchSin, batchCos, angles);
+
+    for (size_t i = 0; i < kTrigCount; ++i)
+    {
+        float x = angles[i].value;
+        Math::Precise::SinCos(sin[i], cos[i], angles[i]);
+
+        EXPECT_LE(UlpDistance(Math::Precise::Sin(angles[i]), ReferenceSin(x)), 2) << x;
+        EXPECT_LE(UlpDistance(Math::Precise::Cos(angles[i]), ReferenceCos(x)), 2) << x;
+        EXPECT_LE(UlpDistance(sin[i], ReferenceSin(x)), 2) << x;
+        EXPECT_LE(UlpDistance(cos[i], ReferenceCos(x)), 2) << x;
+        EXPECT_LE(UlpDistance(batchSin[i], ReferenceSin(x)), 2) << x;
+        EXPECT_LE(UlpDistance(batchCos[i], ReferenceCos(x)), 2) << x;
+    }
+}
+
+TEST(MathTrigonometryVariantTest, PreciseLargeAnglesWithinAbsoluteBound)
+{
+    std::vector<RadianF> angles = MakeAngles(kTrigCount, -8192.0f, 8192.0f);
+    std::vector<float> sin(kTrigCount), cos(kTrigCount);
+    Math::Precise::SinCos(sin, cos, angles);
+
+    for (size_t i = 0; i < kTrigCount; ++i)
+    {
+        double x = static_cast<double>(angles[i].value);
+        EXPECT_LT(std::abs(Math::Precise::Sin(angles[i]) - std::sin(x)), 1e-7) << x;
+        EXPECT_LT(std::abs(Math::Precise::Cos(angles[i]) - std::cos(x)), 1e-7) << x;
+        EXPECT_LT(std::abs(sin[i] - std::sin(x)), 1e-7) << x;
+        EXPECT_LT(std::abs(cos[i] - std::cos(x)), 1e-7) << x;
+    }
+}
+
+TEST(MathTrigonometryVariantTest, PreciseAsinAcosWithinTwoUlp)
+{
+    std::vector<float> values(kTrigCount);
+    for (size_t i = 0; i < kTrigCount; ++i)
+        values[i] = -1.0f + 2.0f * static_cast<float>(i) / static_cast<float>(kTrigCount - 1);
+
+    std::vector<RadianF> asin(kTrigCount), acos(kTrigCount);
+    Math::Precise::Asin(values, asin);
+    Math::Precise::Acos(values, acos);
+
+    for (size_t i = 0; i < kTrigCount; ++i)
+    {
+        float referenceAsin = static_cast<float>(std::asin(static_cast<double>(values[i])));
+        float referenceAcos = static_cast<float>(std::acos(static_cast<double>(values[i])));
+
+        EXPECT_LE(UlpDistance(Math::Precise::Asin(values[i]).value, referenceAsin), 2) << values[i];
+        EXPECT_LE(UlpDistance(Math::Precise::Acos(values[i]).value, referenceAcos), 2) << values[i];
+        EXPECT_LE(UlpDistance(asin[i].value, referenceAsin), 2) << values[i];
+        EXPECT_LE(UlpDistance(acos[i].value, referenceAcos), 2) << values[i];
+    }
+
+    // Out of range inputs are clamped like the fast variant
+    EXPECT_NEAR(Math::Precise::Asin(1.5f).value, Math::PI / 2.0f, 1e-6f);
+    EXPECT_NEAR(Math::Precise::Acos(-1.5f).value, Math::PI, 1e-6f);
+}
+
+TEST(MathTrigonometryVariantTest, FastWithinAbsoluteBounds)
+{
+    auto maxError = [](float range)
+        {
+            std::vector<RadianF> angles = MakeAngles(kTrigCount, -range, range);
+            std::vector<float> sin(kTrigCount), cos(kTrigCount);
+            Math::Fast::SinCos(sin, cos, angles);
+
+            double error = 0.0;
+            for (size_t i = 0; i < kTrigCount; ++i)
+            {
+                double x = static_cast<double>(angles[i].value);
+                error = std::max({ error, std::abs(sin[i] - std::sin(x)), std::abs(cos[i] - std::cos(x)),
+                    std::abs(Math::Fast::Sin(angles[i]) - std::sin(x)), std::abs(Math::Fast::Cos(angles[i]) - std::cos(x)) });
+            }
+            return error;
+        };
+
+    // Batch on targets without FMA rounds the range reduction twice, which roughly doubles the error
+    EXPECT_LT(maxError(Math::PI), 2.5e-7);
+    EXPECT_LT(maxError(100.0f), 6e-6);
+
+    for (float value = -1.0f; value <= 1.0f; value += 1.0f / 4096.0f)
+    {
+        EXPECT_LT(std::abs(Math::Fast::Asin(value).value - std::asin(static_cast<double>(value))), 4e-7) << value;
+        EXPECT_LT(std::abs(Math::Fast::Acos(value).value - std::acos(static_cast<double>(value))), 4e-7) << value;
+    }
+}
+
+// Quaternion::FromAngleAxis calls the inline Math::SinCos from inside the library, so its result shows which variant
+// the library was compiled with. It has to be the one this file sees, the two differ by up to 3e-6 at these angles
+TEST(MathTrigonometryVariantTest, LibraryUsesSelectedVariant)
+{
+    std::vector<RadianF> angles = MakeAngles(1001, -200.0f, 200.0f);
+    double selectedDistance = 0.0, otherDistance = 0.0;
+
+    for (RadianF angle : angles)
+    {
+        Quaternion q = Quaternion::FromAngleAxis(angle, Vector3F(0.0f, 1.0f, 0.0f));
+
+        float fastSin, fastCos, preciseSin, preciseCos;
+        Math::Fast::SinCos(fastSin, fastCos, angle * 0.5f);
+        Math::Precise::SinCos(preciseSin, preciseCos, angle * 0.5f);
+
+        double fastDistance = std::abs(q.y - fastSin) + std::abs(q.w - fastCos);
+        double preciseDistance = std::abs(q.y - preciseSin) + std::abs(q.w - preciseCos);
+
+        selectedDistance += Math::IsPreciseTrigonometry ? preciseDistance : fastDistance;
+        otherDistance += Math::IsPreciseTrigonometry ? fastDistance : preciseDistance;
+    }
+
+    EXPECT_LT(selectedDistance * 10.0, otherDistance);
+}
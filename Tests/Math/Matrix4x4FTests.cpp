@@ -1,9 +1,12 @@
 ﻿#include <gtest/gtest.h>
 #include <cmath>
+#include <vector>
 #include "ByteEngine/Math/Matrix4x4F.h"
 #include "ByteEngine/Math/Vector3.h"
+#include "ByteEngine/Math/Vector3Stream.h"
 #include "ByteEngine/Math/Vector4.h"
 #include "ByteEngine/Math/Quaternion.h"
+#include "ByteEngine/Math/QuaternionStream.h"
 
 using namespace ByteEngine::Math;
 
@@ -504,6 +507,19 @@ TEST(Matrix4x4FInverseTest, InverseModifiesInPlace)
     EXPECT_TRUE(Mat4Equal(product, Matrix4x4F::Identity));
 }
 
+TEST(Matrix4x4FInverseTest, InversedOfGeneralMatrix)
+{
+    // Non-affine matrix, the last column is not (0, 0, 0, 1)
+    Matrix4x4F m(
+        4, 0, 1, 2,
+        1, 3, 0, 1,
+        0, 2, 5, 0,
+        1, 0, 1, 6
+    );
+    EXPECT_TRUE(Mat4Equal(m * m.Inversed(), Matrix4x4F::Identity));
+    EXPECT_TRUE(Mat4Equal(m.Inversed() * m, Matrix4x4F::Identity));
+}
+
 TEST(Matrix4x4FInverseTest, DoubleInverseIsOriginal)
 {
     Matrix4x4F m = Matrix4x4F::CreateTRS(
@@ -864,4 +880,359 @@ TEST(Matrix4x4FRobustnessTest, NegativeScalePreservesAbsoluteGetScale)
     EXPECT_NEAR(extracted.x, std::fabs(s.x), kEps);
     EXPECT_NEAR(extracted.y, std::fabs(s.y), kEps);
     EXPECT_NEAR(extracted.z, std::fabs(s.z), kEps);
+}
+
+// ─────────────────────────────────────────────
+// Batch transforms
+// ─────────────────────────────────────────────
+
+static Matrix4x4F MakeBatchTestMatrix()
+{
+    Matrix4x4F trs = Matrix4x4F::CreateTRS(
+        Vector3F(3.f, -1.f, 12.f),
+        Quaternion::FromAngleAxis(0.6_rf, Vector3F(1.f, 2.f, 3.f).Normalized()),
+        Vector3F(1.5f, 0.5f, 2.f)
+    );
+    return trs * Matrix4x4F::CreatePerspectiveProjection(1.2f, 16.f / 9.f, 0.1f, 100.f);
+}
+
+static std::vector<Vector3F> MakeBatchTestPoints(size_t count)
+{
+    std::vector<Vector3F> points;
+    points.reserve(count);
+    for (size_t i = 0; i < count; ++i)
+    {
+        float t = static_cast<float>(i);
+        points.emplace_back(std::sin(t) * 10.f, std::cos(t * 0.7f) * 10.f, 5.f + std::fmod(t, 13.f));
+    }
+    return points;
+}
+
+// Counts around the 8-wide kernel boundary to cover the tail handling
+static constexpr size_t kBatchTestCounts[] = { 0, 1, 7, 8, 9, 16, 37 };
+
+TEST(Matrix4x4FBatchTest, MultiplyPointsMatchesPerElement)
+{
+    Matrix4x4F m = MakeBatchTestMatrix();
+    for (size_t count : kBatchTestCounts)
+    {
+        std::vector<Vector3F> points = MakeBatchTestPoints(count);
+        std::vector<Vector3F> results(count);
+        m.MultiplyPoints(points, results);
+        for (size_t i = 0; i < count; ++i)
+            EXPECT_TRUE(Vec3Equal(results[i], m.MultiplyPoint(points[i]))) << "count " << count << ", index " << i;
+    }
+}
+
+TEST(Matrix4x4FBatchTest, MultiplyPointsFastMatchesPerElement)
+{
+    Matrix4x4F m = MakeBatchTestMatrix();
+    for (size_t count : kBatchTestCounts)
+    {
+        std::vector<Vector3F> points = MakeBatchTestPoints(count);
+        std::vector<Vector3F> results(count);
+        m.MultiplyPointsFast(points, results);
+        for (size_t i = 0; i < count; ++i)
+            EXPECT_TRUE(Vec3Equal(results[i], m.MultiplyPointFast(points[i]))) << "count " << count << ", index " << i;
+    }
+}
+
+TEST(Matrix4x4FBatchTest, MultiplyVectorsMatchesPerElement)
+{
+    Matrix4x4F m = MakeBatchTestMatrix();
+    for (size_t count : kBatchTestCounts)
+    {
+        std::vector<Vector3F> vectors = MakeBatchTestPoints(count);
+        std::vector<Vector3F> results(count);
+        m.MultiplyVectors(vectors, results);
+        for (size_t i = 0; i < count; ++i)
+            EXPECT_TRUE(Vec3Equal(results[i], m.MultiplyVector(vectors[i]))) << "count " << count << ", index " << i;
+    }
+}
+
+TEST(Matrix4x4FBatchTest, MultiplyPointsInPlace)
+{
+    Matrix4x4F m = MakeBatchTestMatrix();
+    std::vector<Vector3F> points = MakeBatchTestPoints(21);
+    std::vector<Vector3F> original = points;
+    m.MultiplyPoints(points, points);
+    for (size_t i = 0; i < points.size(); ++i)
+        EXPECT_TRUE(Vec3Equal(points[i], m.MultiplyPoint(original[i])));
+}
+
+TEST(Matrix4x4FBatchTest, TailDoesNotWritePastEnd)
+{
+    Matrix4x4F m = MakeBatchTestMatrix();
+    std::vector<Vector3F> points = MakeBatchTestPoints(11);
+    std::vector<Vector3F> results(13, Vector3F(-7.f));
+    m.MultiplyPointsFast(points, std::span<Vector3F>(results).first(11));
+    EXPECT_EQ(results[11], Vector3F(-7.f));
+    EXPECT_EQ(results[12], Vector3F(-7.f));
+}
+
+TEST(Matrix4x4FBatchTest, StreamMatchesPerElement)
+{
+    Matrix4x4F m = MakeBatchTestMatrix();
+    for (size_t count : kBatchTestCounts)
+    {
+        std::vector<Vector3F> points = MakeBatchTestPoints(count);
+        std::vector<float> xs(count), ys(count), zs(count);
+        for (size_t i = 0; i < count; ++i)
+        {
+            xs[i] = points[i].x;
+            ys[i] = points[i].y;
+            zs[i] = points[i].z;
+        }
+
+        Vector3FStream stream(xs, ys, zs);
+        std::vector<float> rx(count), ry(count), rz(count);
+        Vector3FStream results(rx, ry, rz);
+
+        m.MultiplyPoints(stream, results);
+        for (size_t i = 0; i < count; ++i)
+            EXPECT_TRUE(Vec3Equal(results.Get(i), m.MultiplyPoint(points[i])));
+
+        m.MultiplyPointsFast(stream, results);
+        for (size_t i = 0; i < count; ++i)
+            EXPECT_TRUE(Vec3Equal(results.Get(i), m.MultiplyPointFast(points[i])));
+
+        // In place
+        m.MultiplyVectors(stream, stream);
+        for (size_t i = 0; i < count; ++i)
+            EXPECT_TRUE(Vec3Equal(stream.Get(i), m.MultiplyVector(points[i])));
+    }
+}
+
+// ─────────────────────────────────────────────
+// Affine and rigid fast paths
+// ─────────────────────────────────────────────
+
+static Matrix4x4F MakeAffineTestMatrix(float seed, bool withScale = true)
+{
+    return Matrix4x4F::CreateTRS(
+        Vector3F(seed * 3.f, -seed, 12.f - seed),
+        Quaternion::FromAngleAxis(RadianF(0.3f + seed), Vector3F(1.f, 2.f + seed, 3.f).Normalized()),
+        withScale ? Vector3F(1.5f + seed * 0.1f, 0.5f, 2.f) : Vector3F::One()
+    );
+}
+
+static std::vector<Matrix4x4F> MakeAffineTestMatrices(size_t count, bool withScale = true)
+{
+    std::vector<Matrix4x4F> matrices;
+    matrices.reserve(count);
+    for (size_t i = 0; i < count; ++i)
+        matrices.push_back(MakeAffineTestMatrix(static_cast<float>(i % 50) * 0.13f, withScale));
+    return matrices;
+}
+
+TEST(Matrix4x4FAffineTest, IsAffine)
+{
+    EXPECT_TRUE(Matrix4x4F::Identity.IsAffine());
+    EXPECT_TRUE(MakeAffineTestMatrix(1.f).IsAffine());
+    EXPECT_TRUE((MakeAffineTestMatrix(1.f) * MakeAffineTestMatrix(2.f)).IsAffine());
+    EXPECT_FALSE(Matrix4x4F::CreatePerspectiveProjection(1.2f, 16.f / 9.f, 0.1f, 100.f).IsAffine());
+}
+
+TEST(Matrix4x4FAffineTest, AffineInverseMatchesInverse)
+{
+    for (float seed : { 0.f, 0.5f, 1.f, 2.5f })
+    {
+        Matrix4x4F m = MakeAffineTestMatrix(seed);
+        EXPECT_TRUE(Mat4Equal(m.AffineInversed(), m.Inversed())) << "seed " << seed;
+        EXPECT_TRUE(Mat4Equal(m * m.AffineInversed(), Matrix4x4F::Identity)) << "seed " << seed;
+    }
+}
+
+TEST(Matrix4x4FAffineTest, AffineInverseInPlace)
+{
+    Matrix4x4F m = MakeAffineTestMatrix(0.7f);
+    Matrix4x4F expected = m.AffineInversed();
+    m.AffineInverse();
+    EXPECT_EQ(m, expected);
+}
+
+TEST(Matrix4x4FAffineTest, AffineInverseOfScaleAndTranslation)
+{
+    Matrix4x4F m = Matrix4x4F::CreateScale(Vector3F(2.f, 4.f, 0.5f)) * Matrix4x4F::CreateTranslation(Vector3F(1.f, 2.f, 3.f));
+    Matrix4x4F expected = Matrix4x4F::CreateTranslation(Vector3F(-1.f, -2.f, -3.f)) * Matrix4x4F::CreateScale(Vector3F(0.5f, 0.25f, 2.f));
+    EXPECT_TRUE(Mat4Equal(m.AffineInversed(), expected));
+}
+
+TEST(Matrix4x4FAffineTest, RigidInverseMatchesInverse)
+{
+    for (float seed : { 0.f, 0.5f, 1.f, 2.5f })
+    {
+        Matrix4x4F m = MakeAffineTestMatrix(seed, false);
+        EXPECT_TRUE(Mat4Equal(m.RigidInversed(), m.Inversed())) << "seed " << seed;
+    }
+
+    Matrix4x4F view = Matrix4x4F::CreateLookAt(Vector3F(3.f, 4.f, -5.f), Vector3F(0.f, 1.f, 0.f));
+    EXPECT_TRUE(Mat4Equal(view.RigidInversed(), view.Inversed()));
+
+    Matrix4x4F m = MakeAffineTestMatrix(1.5f, false);
+    Matrix4x4F expected = m.RigidInversed();
+    m.RigidInverse();
+    EXPECT_EQ(m, expected);
+}
+
+TEST(Matrix4x4FAffineTest, MultiplyAffineMatchesMultiply)
+{
+    Matrix4x4F a = MakeAffineTestMatrix(0.4f);
+    Matrix4x4F b = MakeAffineTestMatrix(1.9f);
+    Matrix4x4F result = a.MultiplyAffine(b);
+    EXPECT_TRUE(Mat4Equal(result, a * b));
+    EXPECT_TRUE(result.IsAffine());
+}
+
+TEST(Matrix4x4FAffineTest, BatchMatchesSingle)
+{
+    for (size_t count : kBatchTestCounts)
+    {
+        std::vector<Matrix4x4F> matrices = MakeAffineTestMatrices(count);
+        std::vector<Matrix4x4F> rigid = MakeAffineTestMatrices(count, false);
+        std::vector<Matrix4x4F> parents = MakeAffineTestMatrices(count + 3);
+        parents.erase(parents.begin(), parents.begin() + 3);
+        Matrix4x4F parent = MakeAffineTestMatrix(3.1f);
+        std::vector<Matrix4x4F> results(count);
+
+        Matrix4x4F::AffineInverse(matrices, results);
+        for (size_t i = 0; i < count; ++i)
+            EXPECT_EQ(results[i], matrices[i].AffineInversed());
+
+        Matrix4x4F::RigidInverse(rigid, results);
+        for (size_t i = 0; i < count; ++i)
+            EXPECT_EQ(results[i], rigid[i].RigidInversed());
+
+        Matrix4x4F::MultiplyAffine(matrices, parents, results);
+        for (size_t i = 0; i < count; ++i)
+            EXPECT_EQ(results[i], matrices[i].MultiplyAffine(parents[i]));
+
+        Matrix4x4F::MultiplyAffine(matrices, parent, results);
+        for (size_t i = 0; i < count; ++i)
+            EXPECT_EQ(results[i], matrices[i].MultiplyAffine(parent));
+    }
+}
+
+TEST(Matrix4x4FAffineTest, BatchInPlace)
+{
+    std::vector<Matrix4x4F> matrices = MakeAffineTestMatrices(13);
+    std::vector<Matrix4x4F> original = matrices;
+    Matrix4x4F parent = MakeAffineTestMatrix(0.9f);
+
+    Matrix4x4F::MultiplyAffine(matrices, parent, matrices);
+    for (size_t i = 0; i < matrices.size(); ++i)
+        EXPECT_EQ(matrices[i], original[i].MultiplyAffine(parent));
+
+    Matrix4x4F::AffineInverse(matrices, matrices);
+    for (size_t i = 0; i < matrices.size(); ++i)
+        EXPECT_TRUE(Mat4Equal(matrices[i], original[i].MultiplyAffine(parent).Inversed()));
+}
+
+// ─────────────────────────────────────────────
+// Decomposition
+// ─────────────────────────────────────────────
+
+static bool SameRotation(Quaternion a, Quaternion b, float eps = kEps)
+{
+    return std::fabs(std::fabs(Quaternion::Dot(a, b)) - 1.f) < eps;
+}
+
+TEST(Matrix4x4FDecomposeTest, RoundTripsCreateTRS)
+{
+    for (size_t i = 0; i < 50; ++i)
+    {
+        float seed = static_cast<float>(i) * 0.13f;
+        Vector3F translation(seed * 3.f, -seed, 12.f - seed);
+        Quaternion rotation = Quaternion::FromAngleAxis(RadianF(0.3f + seed * 5.f), Vector3F(1.f, 2.f + seed, 3.f).Normalized());
+        Vector3F scale(1.5f + seed * 0.1f, 0.5f, 2.f);
+
+        Vector3F t, s;
+        Quaternion r;
+        Matrix4x4F::CreateTRS(translation, rotation, scale).Decompose(t, r, s);
+
+        EXPECT_TRUE(Vec3Equal(t, translation));
+        EXPECT_TRUE(Vec3Equal(s, scale));
+        EXPECT_TRUE(SameRotation(r, rotation));
+        EXPECT_NEAR(r.LengthSquared(), 1.f, kEps);
+    }
+}
+
+TEST(Matrix4x4FDecomposeTest, MatchesGetters)
+{
+    Matrix4x4F matrix = MakeAffineTestMatrix(1.7f);
+
+    Vector3F t, s;
+    Quaternion r;
+    matrix.Decompose(t, r, s);
+
+    EXPECT_TRUE(Vec3Equal(t, matrix.GetTranslation()));
+    EXPECT_TRUE(Vec3Equal(s, matrix.GetScale()));
+    EXPECT_TRUE(SameRotation(r, matrix.GetRotation()));
+}
+
+TEST(Matrix4x4FDecomposeTest, MirroredMatrixGetsNegativeXScale)
+{
+    Matrix4x4F matrix = Matrix4x4F::CreateTRS(Vector3F(1.f, 2.f, 3.f), Quaternion::FromEuler(10_df, 20_df, 30_df), Vector3F(1.f, -2.f, 3.f));
+
+    Vector3F t, s;
+    Quaternion r;
+    matrix.Decompose(t, r, s);
+
+    EXPECT_LT(s.x, 0.f);
+    EXPECT_NEAR(std::fabs(s.x), 1.f, kEps);
+    EXPECT_NEAR(s.y, 2.f, kEps);
+    EXPECT_NEAR(s.z, 3.f, kEps);
+    EXPECT_TRUE(Mat4Equal(Matrix4x4F::CreateTRS(t, r, s), matrix));
+}
+
+TEST(Matrix4x4FDecomposeTest, ZeroScaleStaysFinite)
+{
+    Matrix4x4F matrix = Matrix4x4F::CreateTRS(Vector3F(1.f), Quaternion::Identity, Vector3F(0.f, 1.f, 1.f));
+
+    Vector3F t, s;
+    Quaternion r;
+    matrix.Decompose(t, r, s);
+
+    EXPECT_EQ(s.x, 0.f);
+    EXPECT_TRUE(std::isfinite(r.x) && std::isfinite(r.y) && std::isfinite(r.z) && std::isfinite(r.w));
+}
+
+TEST(Matrix4x4FDecomposeTest, BatchMatchesSingle)
+{
+    for (size_t count : kBatchTestCounts)
+    {
+        std::vector<Matrix4x4F> matrices = MakeAffineTestMatrices(count);
+        if (count > 2)
+            matrices[2] = Matrix4x4F::CreateTRS(Vector3F(4.f), Quaternion::FromEuler(0_df, 170_df, 45_df), Vector3F(2.f, 3.f, -1.f));
+
+        std::vector<float> tx(count), ty(count), tz(count);
+        std::vector<float> rx(count), ry(count), rz(count), rw(count);
+        std::vector<float> sx(count), sy(count), sz(count);
+
+        Vector3FStream translations(tx, ty, tz);
+        QuaternionStream rotations(rx, ry, rz, rw);
+        Vector3FStream scales(sx, sy, sz);
+
+        Matrix4x4F::DecomposeTRS(matrices, translations, rotations, scales);
+
+        for (size_t i = 0; i < count; ++i)
+        {
+            Vector3F t, s;
+            Quaternion r;
+            matrices[i].Decompose(t, r, s);
+
+            EXPECT_TRUE(Vec3Equal(translations.Get(i), t));
+            EXPECT_TRUE(Vec3Equal(scales.Get(i), s));
+            EXPECT_TRUE(Quaternion::IsEqualApproximetly(rotations.Get(i), r, kEps));
+        }
+
+        std::vector<Matrix4x4F> composed(count);
+        Matrix4x4F::ComposeTRS(translations, rotations, scales, composed);
+
+        for (size_t i = 0; i < count; ++i)
+        {
+            EXPECT_TRUE(Mat4Equal(composed[i], Matrix4x4F::CreateTRS(translations.Get(i), rotations.Get(i), scales.Get(i))));
+            EXPECT_TRUE(Mat4Equal(composed[i], matrices[i]));
+        }
+    }
 }
\ No newline at end of file
@@ -0,0 +1,201 @@
+﻿#include <gtest/gtest.h>
+#include <cmath>
+#include <vector>
+#include "ByteEngine/Math/Noise.h"
+
+using namespace ByteEngine::Math;
+
+// ─────────────────────────────────────────────
+// Helpers
+// ─────────────────────────────────────────────
+
+static constexpr NoiseType kNoiseTypes[] = { NoiseType::Value, NoiseType::Perlin, NoiseType::Simplex };
+static constexpr int32_t kRowSizes[] = { 1, 7, 8, 9, 37 };
+
+static NoiseSettings MakeSettings(NoiseType type, uint32_t seed = 0, int32_t octaves = 1)
+{
+    NoiseSettings settings;
+    settings.type = type;
+    settings.seed = seed;
+    settings.octaves = octaves;
+    return settings;
+}
+
+static std::vector<float> MakeVolume(const NoiseSettings& settings, int32_t size, uint32_t threadCount = 1)
+{
+    std::vector<float> results(static_cast<size_t>(size) * size * size);
+    Noise::FillGrid3D(settings, results, Vector3F(-3.3f, 1.7f, 0.2f), Vector3F(0.173f, 0.219f, 0.097f), size, size, size, threadCount);
+    return results;
+}
+
+// ─────────────────────────────────────────────
+// Grid and single samples
+// ─────────────────────────────────────────────
+
+// Grid coordinates may be computed with a fused multiply-add. With short binary fractions as spacing i * spacing is exact,
+// so fused and separate evaluation give the same position and the samples must match bit for bit
+static void ExpectSamplesMatchGrid(Vector3F origin, Vector3F spacing, float tolerance)
+{
+    for (NoiseType type : kNoiseTypes)
+    {
+        NoiseSettings settings = MakeSettings(type, 3, 3);
+
+        for (int32_t sizeX : kRowSizes)
+        {
+            std::vector<float> grid2(static_cast<size_t>(sizeX) * 3);
+            Noise::FillGrid2D(settings, grid2, Vector2F(origin.x, origin.y), Vector2F(spacing.x, spacing.y), sizeX, 3);
+
+            std::vector<float> grid3(static_cast<size_t>(sizeX) * 3 * 2);
+            Noise::FillGrid3D(settings, grid3, origin, spacing, sizeX, 3, 2);
+
+            std::vector<float> grid4(grid3.size());
+            Noise::FillGrid4D(settings, grid4, Vector4F(origin.x, origin.y, origin.z, 0.6f), spacing, sizeX, 3, 2);
+
+            for (int32_t k = 0; k < 2; ++k)
+            {
+                for (int32_t j = 0; j < 3; ++j)
+                {
+                    for (int32_t i = 0; i < sizeX; ++i)
+                    {
+                        float x = origin.x + static_cast<float>(i) * spacing.x;
+                        float y = origin.y + static_cast<float>(j) * spacing.y;
+                        float z = origin.z + static_cast<float>(k) * spacing.z;
+                        size_t index = (static_cast<size_t>(k) * 3 + j) * sizeX + i;
+
+                        if (k == 0)
+                        {
+                            EXPECT_NEAR(grid2[j * sizeX + i], Noise::Sample(settings, Vector2F(x, y)), tolerance);
+                        }
+
+                        EXPECT_NEAR(grid3[index], Noise::Sample(settings, Vector3F(x, y, z)), tolerance);
+                        EXPECT_NEAR(grid4[index], Noise::Sample(settings, Vector4F(x, y, z, 0.6f)), tolerance);
+                    }
+                }
+            }
+        }
+    }
+}
+
+TEST(NoiseTest, SampleMatchesGridExactly)
+{
+    ExpectSamplesMatchGrid(Vector3F(-3.25f, 1.75f, 0.1875f), Vector3F(0.125f, 0.1875f, 0.09375f), 0.0f);
+}
+
+TEST(NoiseTest, SampleMatchesGridWithinPositionRounding)
+{
+    // A last bit difference in the position moves the sample by far less than this
+    ExpectSamplesMatchGrid(Vector3F(-3.3f, 1.7f, 0.2f), Vector3F(0.173f, 0.219f, 0.097f), 1e-5f);
+}
+
+TEST(NoiseTest, ThreadedGridMatchesSingleThreaded)
+{
+    for (NoiseType type : kNoiseTypes)
+    {
+        NoiseSettings settings = MakeSettings(type, 11, 2);
+        std::vector<float> single = MakeVolume(settings, 19);
+
+        EXPECT_EQ(MakeVolume(settings, 19, 3), single);
+        EXPECT_EQ(MakeVolume(settings, 19, 0), single);
+
+        // More threads than rows
+        std::vector<float> row(50), threadedRow(50);
+        Noise::FillGrid2D(settings, row, Vector2F(0.5f), Vector2F(0.1f), 50, 1);
+        Noise::FillGrid2D(settings, threadedRow, Vector2F(0.5f), Vector2F(0.1f), 50, 1, 8);
+        EXPECT_EQ(row, threadedRow);
+    }
+}
+
+TEST(NoiseTest, EmptyGridIsAllowed)
+{
+    Noise::FillGrid2D(NoiseSettings(), std::span<float>(), Vector2F(0.0f), Vector2F(1.0f), 0, 4, 2);
+    Noise::FillGrid3D(NoiseSettings(), std::span<float>(), Vector3F(0.0f), Vector3F(1.0f), 4, 0, 4, 2);
+}
+
+// ─────────────────────────────────────────────
+// Properties
+// ─────────────────────────────────────────────
+
+TEST(NoiseTest, StaysInRangeAndVaries)
+{
+    for (NoiseType type : kNoiseTypes)
+    {
+        for (int32_t octaves : { 1, 5 })
+        {
+            NoiseSettings settings = MakeSettings(type, 1, octaves);
+            std::vector<float> values = MakeVolume(settings, 32);
+
+            std::vector<float> values4(values.size());
+            Noise::FillGrid4D(settings, values4, Vector4F(0.4f, -2.0f, 7.1f, 3.3f), Vector3F(0.21f), 32, 32, 32);
+            values.insert(values.end(), values4.begin(), values4.end());
+
+            double sum = 0.0, sumSquares = 0.0;
+
+            for (float value : values)
+            {
+                ASSERT_LE(std::fabs(value), 1.f);
+                sum += value;
+                sumSquares += value * value;
+            }
+
+            double mean = sum / values.size();
+            double variance = sumSquares / values.size() - mean * mean;
+
+            EXPECT_NEAR(mean, 0.0, 0.1);
+            EXPECT_GT(variance, 0.005);
+        }
+    }
+}
+
+TEST(NoiseTest, SameSeedIsDeterministicOtherSeedDiffers)
+{
+    for (NoiseType type : kNoiseTypes)
+    {
+        std::vector<float> a = MakeVolume(MakeSettings(type, 5), 8);
+        EXPECT_EQ(a, MakeVolume(MakeSettings(type, 5), 8));
+        EXPECT_NE(a, MakeVolume(MakeSettings(type, 6), 8));
+    }
+}
+
+TEST(NoiseTest, IsContinuous)
+{
+    for (NoiseType type : kNoiseTypes)
+    {
+        NoiseSettings settings = MakeSettings(type, 2);
+
+        // Steps cross lattice and simplex cell borders, a jump there would exceed the bound
+        for (int32_t i = 0; i < 2000; ++i)
+        {
+            float t = static_cast<float>(i) * 0.0037f;
+            float step = 1e-3f;
+
+            EXPECT_LT(std::fabs(Noise::Sample(settings, Vector2F(t, 0.5f * t)) - Noise::Sample(settings, Vector2F(t + step, 0.5f * t))), 0.02f);
+            EXPECT_LT(std::fabs(Noise::Sample(settings, Vector3F(t, -t, 0.3f)) - Noise::Sample(settings, Vector3F(t + step, -t, 0.3f))), 0.02f);
+            EXPECT_LT(std::fabs(Noise::Sample(settings, Vector4F(t, 0.2f, t, 1.1f)) - Noise::Sample(settings, Vector4F(t, 0.2f + step, t, 1.1f))), 0.02f);
+        }
+    }
+}
+
+TEST(NoiseTest, PerlinIsZeroAtLatticePoints)
+{
+    NoiseSettings settings = MakeSettings(NoiseType::Perlin, 9);
+
+    for (int32_t i = -5; i <= 5; ++i)
+    {
+        float x = static_cast<float>(i);
+        EXPECT_EQ(Noise::Sample(settings, Vector2F(x, 2.0f)), 0.f);
+        EXPECT_EQ(Noise::Sample(settings, Vector3F(x, -1.0f, 4.0f)), 0.f);
+        EXPECT_EQ(Noise::Sample(settings, Vector4F(3.0f, x, 0.0f, 7.0f)), 0.f);
+    }
+}
+
+TEST(NoiseTest, FrequencyScalesCoordinates)
+{
+    for (NoiseType type : kNoiseTypes)
+    {
+        NoiseSettings settings = MakeSettings(type, 4);
+        NoiseSettings doubled = settings;
+        doubled.frequency = 2.0f;
+
+        EXPECT_EQ(Noise::Sample(doubled, Vector3F(0.3f, 1.25f, -0.5f)), Noise::Sample(settings, Vector3F(0.6f, 2.5f, -1.0f)));
+    }
+}
\ No newline at end of file
@@ -0,0 +1,387 @@
+﻿#include <gtest/gtest.h>
+#include <cstdint>
+#include <cmath>
+#include <limits>
+#include <random>
+#include <vector>
+#include "ByteEngine/Math/Packing.h"
+#include "ByteEngine/Math/QuaternionStream.h"
+
+using namespace ByteEngine::Math;
+
+// ─────────────────────────────────────────────
+// Helpers
+// ─────────────────────────────────────────────
+
+// Mix of ordinary values, values near the half precision limits and special values
+static std::vector<float> MakeValues(size_t count, float range, uint32_t seed = 7)
+{
+    std::mt19937 rng(seed);
+    std::uniform_real_distribution<float> dist(-range, range);
+    std::vector<float> values(count);
+
+    for (float& value : values)
+        value = dist(rng);
+
+    const float specials[] = {
+        0.f, -0.f, 1.f, -1.f, 65504.f, 65519.f, 65520.f, -70000.f, 6.1035156e-5f, 5.9604645e-8f, 2.9802322e-8f, 1e-10f,
+        std::numeric_limits<float>::infinity(), -std::numeric_limits<float>::infinity(), std::numeric_limits<float>::quiet_NaN()
+    };
+
+    for (size_t i = 0; i < std::size(specials) && i < count; i++)
+        values[i * 3 % count] = specials[i];
+
+    return values;
+}
+
+static std::vector<Quaternion> MakeUnitQuaternions(size_t count, uint32_t seed = 11)
+{
+    std::mt19937 rng(seed);
+    std::normal_distribution<float> dist(0.f, 1.f);
+    std::vector<Quaternion> quaternions(count);
+
+    for (Quaternion& q : quaternions)
+    {
+        q = Quaternion(dist(rng), dist(rng), dist(rng), dist(rng));
+        q.Normalize();
+    }
+
+    return quaternions;
+}
+
+// Angle of the rotation between two unit quaternions, in degrees
+static float RotationAngleDegrees(const Quaternion& a, const Quaternion& b)
+{
+    float dot = std::fabs(a.x * b.x + a.y * b.y + a.z * b.z + a.w * b.w);
+    return 2.f * std::acos(std::fmin(dot, 1.f)) * 180.f / Math::PI;
+}
+
+struct SoAQuaternions
+{
+    std::vector<float> x, y, z, w;
+
+    explicit SoAQuaternions(const std::vector<Quaternion>& quaternions)
+    {
+        for (const Quaternion& q : quaternions)
+        {
+            x.push_back(q.x);
+            y.push_back(q.y);
+            z.push_back(q.z);
+            w.push_back(q.w);
+        }
+    }
+
+    QuaternionStream Stream() { return QuaternionStream(x, y, z, w); }
+};
+
+// ─────────────────────────────────────────────
+// Half
+// ─────────────────────────────────────────────
+
+TEST(HalfTest, KnownValues)
+{
+    EXPECT_EQ(Math::FloatToHalf(0.f), 0x0000);
+    EXPECT_EQ(Math::FloatToHalf(-0.f), 0x8000);
+    EXPECT_EQ(Math::FloatToHalf(1.f), 0x3C00);
+    EXPECT_EQ(Math::FloatToHalf(-2.f), 0xC000);
+    EXPECT_EQ(Math::FloatToHalf(0.5f), 0x3800);
+    EXPECT_EQ(Math::FloatToHalf(65504.f), 0x7BFF);
+    EXPECT_EQ(Math::FloatToHalf(65519.f), 0x7BFF);
+    EXPECT_EQ(Math::FloatToHalf(65520.f), 0x7C00);
+    EXPECT_EQ(Math::FloatToHalf(std::numeric_limits<float>::infinity()), 0x7C00);
+    EXPECT_EQ(Math::FloatToHalf(-std::numeric_limits<float>::infinity()), 0xFC00);
+    EXPECT_EQ(Math::FloatToHalf(std::numeric_limits<float>::quiet_NaN()) & 0x7FFF, 0x7E00);
+
+    // Smallest normal and subnormals
+    EXPECT_EQ(Math::FloatToHalf(6.1035156e-5f), 0x0400);
+    EXPECT_EQ(Math::FloatToHalf(5.9604645e-8f), 0x0001);
+    EXPECT_EQ(Math::FloatToHalf(1e-10f), 0x0000);
+}
+
+TEST(HalfTest, RoundsToNearestEven)
+{
+    // 1 + 2^-11 is halfway between 1 and the next half, 1 + 3 * 2^-11 is halfway between odd and even mantissas
+    EXPECT_EQ(Math::FloatToHalf(1.f + std::ldexp(1.f, -11)), 0x3C00);
+    EXPECT_EQ(Math::FloatToHalf(1.f + 3.f * std::ldexp(1.f, -11)), 0x3C02);
+    EXPECT_EQ(Math::FloatToHalf(1.f + std::ldexp(1.f, -11) + std::ldexp(1.f, -20)), 0x3C01);
+
+    // Same in the subnormal range, 2^-25 ties to zero, 3 * 2^-25 ties to 2
+    EXPECT_EQ(Math::FloatToHalf(std::ldexp(1.f, -25)), 0x0000);
+    EXPECT_EQ(Math::FloatToHalf(3.f * std::ldexp(1.f, -25)), 0x0002);
+}
+
+TEST(HalfTest, AllHalfValuesRoundTrip)
+{
+    for (uint32_t bits = 0; bits <= 0xFFFF; bits++)
+    {
+        float value = Math::HalfToFloat(static_cast<uint16_t>(bits));
+
+        if ((bits & 0x7C00) == 0x7C00 && (bits & 0x03FF) != 0)
+        {
+            EXPECT_TRUE(std::isnan(value)) << bits;
+            continue;
+        }
+
+        ASSERT_EQ(Math::FloatToHalf(value), bits) << value;
+    }
+}
+
+TEST(HalfTest, ErrorBound)
+{
+    std::vector<float> values = MakeValues(100000, 60000.f);
+
+    for (float value : values)
+    {
+        if (!std::isfinite(value) || std::fabs(value) > 65504.f)
+            continue;
+
+        float decoded = Half(value).ToFloat();
+        float bound = std::fabs(value) >= 6.1035156e-5f ? std::fabs(value) * std::ldexp(1.f, -11) : std::ldexp(1.f, -25);
+        EXPECT_LE(std::fabs(decoded - value), bound) << value;
+    }
+}
+
+TEST(HalfTest, BulkMatchesScalar)
+{
+    for (size_t count : { size_t(0), size_t(1), size_t(7), size_t(8), size_t(9), size_t(1000), size_t(1027) })
+    {
+        std::vector<float> values = MakeValues(count, 70000.f);
+        std::vector<Half> packed(count);
+        std::vector<float> decoded(count);
+
+        Math::FloatToHalf(values, packed);
+        Math::HalfToFloat(packed, decoded);
+
+        for (size_t i = 0; i < count; i++)
+        {
+            ASSERT_EQ(packed[i].bits, Half(values[i]).bits) << values[i];
+
+            if (std::isnan(values[i]))
+                EXPECT_TRUE(std::isnan(decoded[i]));
+            else
+                EXPECT_EQ(decoded[i], packed[i].ToFloat());
+        }
+    }
+}
+
+TEST(HalfTest, PackedVectors)
+{
+    static_assert(sizeof(HalfVector2) == 4 && sizeof(HalfVector3) == 6 && sizeof(HalfVector4) == 8);
+
+    HalfVector3 packed(Vector3F(1.f, -0.5f, 1024.f));
+    EXPECT_EQ(packed.x.bits, 0x3C00);
+    EXPECT_EQ(packed.Unpack(), Vector3F(1.f, -0.5f, 1024.f));
+
+    // A vertex stream converted as a flat component span
+    std::vector<Vector3F> positions = { Vector3F(0.25f, 2.f, -3.f), Vector3F(100.f, 0.f, 7.5f), Vector3F(-1.f, 1.f, 0.125f) };
+    std::vector<HalfVector3> packedPositions(positions.size());
+    Math::FloatToHalf(std::span<const float>(positions.data()->data, positions.size() * 3), std::span<Half>(&packedPositions.data()->x, positions.size() * 3));
+
+    for (size_t i = 0; i < positions.size(); i++)
+    {
+        EXPECT_EQ(packedPositions[i], HalfVector3(positions[i]));
+        EXPECT_EQ(packedPositions[i].Unpack(), positions[i]);
+    }
+}
+
+// ─────────────────────────────────────────────
+// SNorm16 / UNorm16
+// ─────────────────────────────────────────────
+
+TEST(NormalizedIntegerTest, KnownValues)
+{
+    EXPECT_EQ(Math::FloatToSNorm16(1.f), 32767);
+    EXPECT_EQ(Math::FloatToSNorm16(-1.f), -32767);
+    EXPECT_EQ(Math::FloatToSNorm16(0.f), 0);
+    EXPECT_EQ(Math::FloatToSNorm16(2.f), 32767);
+    EXPECT_EQ(Math::FloatToSNorm16(-2.f), -32767);
+    EXPECT_EQ(Math::FloatToSNorm16(std::numeric_limits<float>::quiet_NaN()), -32767);
+    EXPECT_EQ(Math::SNorm16ToFloat(-32768), -1.f);
+    EXPECT_EQ(Math::SNorm16ToFloat(32767), 1.f);
+
+    EXPECT_EQ(Math::FloatToUNorm16(1.f), 65535);
+    EXPECT_EQ(Math::FloatToUNorm16(0.f), 0);
+    EXPECT_EQ(Math::FloatToUNorm16(-0.5f), 0);
+    EXPECT_EQ(Math::FloatToUNorm16(std::numeric_limits<float>::quiet_NaN()), 0);
+    EXPECT_EQ(Math::UNorm16ToFloat(65535), 1.f);
+}
+
+TEST(NormalizedIntegerTest, ErrorBound)
+{
+    std::vector<float> values = MakeValues(100000, 1.f);
+
+    for (float value : values)
+    {
+        if (!(std::fabs(value) <= 1.f))
+            continue;
+
+        EXPECT_LE(std::fabs(SNorm16(value).ToFloat() - value), 1.53e-5f) << value;
+
+        float unsignedValue = std::fabs(value);
+        EXPECT_LE(std::fabs(UNorm16(unsignedValue).ToFloat() - unsignedValue), 7.7e-6f) << value;
+    }
+}
+
+TEST(NormalizedIntegerTest, BulkMatchesScalar)
+{
+    for (size_t count : { size_t(0), size_t(3), size_t(8), size_t(13), size_t(4099) })
+    {
+        std::vector<float> values = MakeValues(count, 1.5f);
+        std::vector<SNorm16> snorm(count);
+        std::vector<UNorm16> unorm(count);
+        std::vector<float> decoded(count);
+
+        Math::FloatToSNorm16(values, snorm);
+        Math::FloatToUNorm16(values, unorm);
+
+        for (size_t i = 0; i < count; i++)
+        {
+            ASSERT_EQ(snorm[i], SNorm16(values[i])) << values[i];
+            ASSERT_EQ(unorm[i], UNorm16(values[i])) << values[i];
+        }
+
+        Math::SNorm16ToFloat(snorm, decoded);
+
+        for (size_t i = 0; i < count; i++)
+            EXPECT_EQ(decoded[i], snorm[i].ToFloat());
+
+        Math::UNorm16ToFloat(unorm, decoded);
+
+        for (size_t i = 0; i < count; i++)
+            EXPECT_EQ(decoded[i], unorm[i].ToFloat());
+    }
+}
+
+TEST(NormalizedIntegerTest, SNorm16BulkDecodesFullRange)
+{
+    std::vector<SNorm16> values(65536);
+
+    for (int32_t i = 0; i < 65536; i++)
+        values[i].bits = static_cast<int16_t>(i - 32768);
+
+    std::vector<float> decoded(values.size());
+    Math::SNorm16ToFloat(values, decoded);
+
+    for (size_t i = 0; i < values.size(); i++)
+        ASSERT_EQ(decoded[i], Math::SNorm16ToFloat(values[i].bits)) << values[i].bits;
+}
+
+// ─────────────────────────────────────────────
+// UNorm1010102
+// ─────────────────────────────────────────────
+
+TEST(UNorm1010102Test, Layout)
+{
+    EXPECT_EQ(UNorm1010102(Vector4F(1.f, 0.f, 0.f, 0.f)).bits, 0x000003FFu);
+    EXPECT_EQ(UNorm1010102(Vector4F(0.f, 1.f, 0.f, 0.f)).bits, 0x000FFC00u);
+    EXPECT_EQ(UNorm1010102(Vector4F(0.f, 0.f, 1.f, 0.f)).bits, 0x3FF00000u);
+    EXPECT_EQ(UNorm1010102(Vector4F(0.f, 0.f, 0.f, 1.f)).bits, 0xC0000000u);
+    EXPECT_EQ(UNorm1010102(Vector4F(2.f, -1.f, 0.f, 0.4f)).bits, 0x400003FFu);
+    EXPECT_EQ(UNorm1010102(Vector4F(1.f, 1.f, 1.f, 1.f)).Unpack(), Vector4F(1.f, 1.f, 1.f, 1.f));
+}
+
+TEST(UNorm1010102Test, ErrorBoundAndBulk)
+{
+    std::mt19937 rng(3);
+    std::uniform_real_distribution<float> dist(0.f, 1.f);
+    std::vector<Vector4F> values(1029);
+
+    for (Vector4F& value : values)
+        value = Vector4F(dist(rng), dist(rng), dist(rng), dist(rng));
+
+    std::vector<UNorm1010102> packed(values.size());
+    std::vector<Vector4F> decoded(values.size());
+    Math::Pack(values, packed);
+    Math::Unpack(packed, decoded);
+
+    for (size_t i = 0; i < values.size(); i++)
+    {
+        UNorm1010102 scalar(values[i]);
+        ASSERT_EQ(packed[i], scalar);
+        EXPECT_EQ(decoded[i], scalar.Unpack());
+
+        EXPECT_LE(std::fabs(decoded[i].x - values[i].x), 0.5f / 1023.f + 1e-7f);
+        EXPECT_LE(std::fabs(decoded[i].y - values[i].y), 0.5f / 1023.f + 1e-7f);
+        EXPECT_LE(std::fabs(decoded[i].z - values[i].z), 0.5f / 1023.f + 1e-7f);
+        EXPECT_LE(std::fabs(decoded[i].w - values[i].w), 0.5f / 3.f + 1e-7f);
+    }
+}
+
+// ─────────────────────────────────────────────
+// PackedQuaternion
+// ─────────────────────────────────────────────
+
+TEST(PackedQuaternionTest, SpecialRotations)
+{
+    const Quaternion cases[] = {
+        Quaternion(0.f, 0.f, 0.f, 1.f), Quaternion(0.f, 0.f, 0.f, -1.f), Quaternion(1.f, 0.f, 0.f, 0.f),
+        Quaternion(0.f, -1.f, 0.f, 0.f), Quaternion(0.5f, 0.5f, 0.5f, 0.5f), Quaternion(-0.5f, 0.5f, -0.5f, 0.5f),
+        Quaternion(0.70710678f, 0.f, 0.f, 0.70710678f), Quaternion(0.f, -0.70710678f, 0.70710678f, 0.f)
+    };
+
+    for (const Quaternion& q : cases)
+    {
+        Quaternion decoded = PackedQuaternion(q).Unpack();
+        EXPECT_LT(RotationAngleDegrees(q, decoded), 0.25f) << q.x << " " << q.y << " " << q.z << " " << q.w;
+    }
+
+    // Identity stores its largest component implicitly and the rest exactly at the midpoint
+    EXPECT_EQ(PackedQuaternion(Quaternion(0.f, 0.f, 0.f, -1.f)), PackedQuaternion(Quaternion(0.f, 0.f, 0.f, 1.f)));
+}
+
+TEST(PackedQuaternionTest, ErrorBound)
+{
+    std::vector<Quaternion> quaternions = MakeUnitQuaternions(100000);
+    float maxComponentError = 0.f;
+    float maxAngle = 0.f;
+
+    for (const Quaternion& q : quaternions)
+    {
+        Quaternion decoded = PackedQuaternion(q).Unpack();
+
+        // Decoding may return -q
+        float sign = q.x * decoded.x + q.y * decoded.y + q.z * decoded.z + q.w * decoded.w < 0.f ? -1.f : 1.f;
+
+        for (int32_t i = 0; i < 4; i++)
+            maxComponentError = std::fmax(maxComponentError, std::fabs(q.data[i] - sign * decoded.data[i]));
+
+        maxAngle = std::fmax(maxAngle, RotationAngleDegrees(q, decoded));
+    }
+
+    EXPECT_LT(maxComponentError, 2e-3f);
+    EXPECT_LT(maxAngle, 0.25f);
+}
+
+TEST(PackedQuaternionTest, BulkMatchesScalar)
+{
+    for (size_t count : { size_t(0), size_t(5), size_t(8), size_t(1001) })
+    {
+        std::vector<Quaternion> quaternions = MakeUnitQuaternions(count, 23);
+
+        if (count > 4)
+        {
+            quaternions[0] = Quaternion(0.5f, 0.5f, -0.5f, -0.5f);
+            quaternions[1] = Quaternion(0.f, 0.f, 0.f, -1.f);
+        }
+
+        SoAQuaternions source(quaternions);
+        std::vector<PackedQuaternion> packed(count);
+        Math::Pack(source.Stream(), packed);
+
+        for (size_t i = 0; i < count; i++)
+            ASSERT_EQ(packed[i], PackedQuaternion(quaternions[i])) << i;
+
+        SoAQuaternions decoded { std::vector<Quaternion>(count) };
+        Math::Unpack(packed, decoded.Stream());
+
+        // Not bit-identical, the bulk path fuses multiply-adds. Bound documented in Packing.h
+        for (size_t i = 0; i < count; i++)
+        {
+            Quaternion scalar = packed[i].Unpack();
+            EXPECT_NEAR(decoded.x[i], scalar.x, 5e-7f);
+            EXPECT_NEAR(decoded.y[i], scalar.y, 5e-7f);
+            EXPECT_NEAR(decoded.z[i], scalar.z, 5e-7f);
+            EXPECT_NEAR(decoded.w[i], scalar.w, 5e-7f);
+        }
+    }
+}
\ No newline at end of file
@@ -1,6 +1,9 @@
 ﻿#include <gtest/gtest.h>
 #include <cmath>
+#include <vector>
 #include "ByteEngine/Math/Quaternion.h"
+#include "ByteEngine/Math/Matrix4x4F.h"
+#include "ByteEngine/Math/QuaternionStream.h"
 #include "ByteEngine/Math/Vector3.h"
 #include "ByteEngine/Math/Math.h"
 
@@ -132,6 +135,29 @@ TEST_F(QuaternionTest, GetEuler)
     EXPECT_NEAR(euler.roll.value, 0.0f, EPSILON);
 }
 
+// At pitch +-90 degrees yaw and roll rotate about the same axis, GetEuler folds them into yaw and the
+// angles it returns must still rebuild the same rotation
+TEST_F(QuaternionTest, GetEulerRoundTripsAtGimbalLock)
+{
+    for (float pitch : { -90.0f, 90.0f })
+    {
+        for (float yaw : { -120.0f, -30.0f, 0.0f, 45.0f, 170.0f })
+        {
+            for (float roll : { 0.0f, 25.0f })
+            {
+                const Quaternion q = Quaternion::FromEuler(DegreeF(pitch), DegreeF(yaw), DegreeF(roll));
+                EulerRad euler = q.GetEuler();
+
+                EXPECT_NEAR(euler.pitch.value, DegreeF(pitch).ToRadian().value, EPSILON);
+                EXPECT_EQ(euler.roll.value, 0.0f);
+
+                Quaternion rebuilt = Quaternion::FromEuler(euler.pitch, euler.yaw, euler.roll);
+                EXPECT_NEAR(std::abs(Quaternion::Dot(q, rebuilt)), 1.0f, EPSILON) << pitch << " " << yaw << " " << roll;
+            }
+        }
+    }
+}
+
 TEST_F(QuaternionTest, GetEulerInDegrees)
 {
     Quaternion q = Quaternion::FromEuler(0.0_df, 0.0_df, 0.0_df);
@@ -463,4 +489,218 @@ TEST_F(QuaternionTest, FromToRotationZeroVector)
     EXPECT_EQ(q.y, 0.0f);
     EXPECT_EQ(q.z, 0.0f);
     EXPECT_EQ(q.w, 1.0f);
+}
+
+TEST_F(QuaternionTest, FromRotationMatrixIdentity)
+{
+    Quaternion q = Quaternion::FromRotationMatrix(Matrix4x4F::Identity);
+    EXPECT_NEAR(q.x, 0.0f, EPSILON);
+    EXPECT_NEAR(q.y, 0.0f, EPSILON);
+    EXPECT_NEAR(q.z, 0.0f, EPSILON);
+    EXPECT_NEAR(q.w, 1.0f, EPSILON);
+}
+
+TEST_F(QuaternionTest, FromRotationMatrixRoundTrip)
+{
+    // Angles near pi exercise the branches where w is not the largest component
+    const float angles[] = { 0.3f, 1.7f, 3.1f };
+    const Vector3 axes[] = { Vector3(1.0f, 0.0f, 0.0f), Vector3(0.0f, 1.0f, 0.0f), Vector3(0.0f, 0.0f, 1.0f), Vector3(1.0f, 2.0f, -3.0f).Normalized() };
+
+    for (float angle : angles)
+    {
+        for (const Vector3& axis : axes)
+        {
+            Quaternion expected = Quaternion::FromAngleAxis(RadianF(angle), axis);
+            Quaternion q = Quaternion::FromRotationMatrix(Matrix4x4F::CreateRotation(expected));
+
+            // q and -q describe the same rotation
+            float dot = q.x * expected.x + q.y * expected.y + q.z * expected.z + q.w * expected.w;
+            EXPECT_NEAR(std::abs(dot), 1.0f, 1e-4f);
+        }
+    }
+}
+
+TEST_F(QuaternionTest, NlerpEndpoints)
+{
+    Quaternion q1 = Quaternion::FromAngleAxis(RadianF(0.3f), Vector3(0.0f, 1.0f, 0.0f));
+    Quaternion q2 = Quaternion::FromAngleAxis(RadianF(1.2f), Vector3(1.0f, 0.0f, 0.0f));
+    EXPECT_TRUE(Quaternion::IsEqualApproximetly(Quaternion::Nlerp(q1, q2, 0.0f), q1, EPSILON));
+    EXPECT_TRUE(Quaternion::IsEqualApproximetly(Quaternion::Nlerp(q1, q2, 1.0f), q2, EPSILON));
+    EXPECT_TRUE(Quaternion::Nlerp(q1, q2, 0.4f).IsNormalized());
+}
+
+TEST_F(QuaternionTest, NlerpTakesShortestPath)
+{
+    Quaternion q1 = Quaternion::FromAngleAxis(RadianF(0.2f), Vector3(0.0f, 0.0f, 1.0f));
+    Quaternion q2 = -Quaternion::FromAngleAxis(RadianF(0.4f), Vector3(0.0f, 0.0f, 1.0f));
+    Quaternion result = Quaternion::Nlerp(q1, q2, 0.5f);
+    EXPECT_NEAR(result.GetAngle().value, 0.3f, 1e-3f);
+}
+
+// ─────────────────────────────────────────────
+// Batch operations
+// ─────────────────────────────────────────────
+
+// Owns the storage behind a QuaternionStream
+struct QuaternionStreamStorage
+{
+    std::vector<float> x, y, z, w;
+
+    explicit QuaternionStreamStorage(size_t count)
+        : x(count), y(count), z(count), w(count)
+    { }
+
+    QuaternionStream Stream() { return QuaternionStream(x, y, z, w); }
+};
+
+struct Vector3StreamStorage
+{
+    std::vector<float> x, y, z;
+
+    explicit Vector3StreamStorage(size_t count)
+        : x(count), y(count), z(count)
+    { }
+
+    Vector3FStream Stream() { return Vector3FStream(x, y, z); }
+};
+
+static Quaternion MakeTestRotation(size_t index, float seed)
+{
+    float t = static_cast<float>(index) + seed;
+    Vector3 axis = Vector3(std::sin(t * 1.3f), std::cos(t * 0.7f), std::sin(t * 2.1f) + 0.1f).Normalized();
+    Quaternion q = Quaternion::FromAngleAxis(RadianF(std::fmod(t * 0.9f, 6.0f)), axis);
+    // Mix in negated quaternions so the shortest path correction is exercised
+    return index % 3 == 0 ? -q : q;
+}
+
+static QuaternionStreamStorage MakeTestRotations(size_t count, float seed)
+{
+    QuaternionStreamStorage storage(count);
+    for (size_t i = 0; i < count; ++i)
+        storage.Stream().Set(i, MakeTestRotation(i, seed));
+    return storage;
+}
+
+static constexpr size_t kQuaternionBatchCounts[] = { 0, 1, 7, 8, 9, 29 };
+
+TEST_F(QuaternionTest, BatchSlerpMatchesScalar)
+{
+    for (size_t count : kQuaternionBatchCounts)
+    {
+        QuaternionStreamStorage from = MakeTestRotations(count, 0.0f);
+        QuaternionStreamStorage to = MakeTestRotations(count, 0.37f);
+        QuaternionStreamStorage results(count);
+
+        // Include identical pairs for the linear fallback
+        if (count > 1)
+            to.Stream().Set(1, from.Stream().Get(1));
+
+        std::vector<float> t(count);
+        for (size_t i = 0; i < count; ++i)
+            t[i] = static_cast<float>(i % 5) / 4.0f;
+
+        Quaternion::Slerp(from.Stream(), to.Stream(), t, results.Stream());
+        for (size_t i = 0; i < count; ++i)
+        {
+            Quaternion expected = Quaternion::Slerp(from.Stream().Get(i), to.Stream().Get(i), t[i]);
+            EXPECT_TRUE(Quaternion::IsEqualApproximetly(results.Stream().Get(i), expected, 1e-4f)) << "count " << count << ", index " << i;
+        }
+
+        Quaternion::Slerp(from.Stream(), to.Stream(), 0.3f, results.Stream());
+        for (size_t i = 0; i < count; ++i)
+        {
+            Quaternion expected = Quaternion::Slerp(from.Stream().Get(i), to.Stream().Get(i), 0.3f);
+            EXPECT_TRUE(Quaternion::IsEqualApproximetly(results.Stream().Get(i), expected, 1e-4f)) << "count " << count << ", index " << i;
+        }
+    }
+}
+
+TEST_F(QuaternionTest, BatchNlerpMatchesScalar)
+{
+    for (size_t count : kQuaternionBatchCounts)
+    {
+        QuaternionStreamStorage from = MakeTestRotations(count, 0.0f);
+        QuaternionStreamStorage to = MakeTestRotations(count, 1.1f);
+        QuaternionStreamStorage results(count);
+
+        std::vector<float> t(count);
+        for (size_t i = 0; i < count; ++i)
+            t[i] = static_cast<float>(i % 7) / 6.0f;
+
+        Quaternion::Nlerp(from.Stream(), to.Stream(), t, results.Stream());
+        for (size_t i = 0; i < count; ++i)
+        {
+            Quaternion expected = Quaternion::Nlerp(from.Stream().Get(i), to.Stream().Get(i), t[i]);
+            EXPECT_TRUE(Quaternion::IsEqualApproximetly(results.Stream().Get(i), expected, 1e-5f));
+        }
+
+        Quaternion::Nlerp(from.Stream(), to.Stream(), 0.75f, results.Stream());
+        for (size_t i = 0; i < count; ++i)
+        {
+            Quaternion expected = Quaternion::Nlerp(from.Stream().Get(i), to.Stream().Get(i), 0.75f);
+            EXPECT_TRUE(Quaternion::IsEqualApproximetly(results.Stream().Get(i), expected, 1e-5f));
+        }
+    }
+}
+
+TEST_F(QuaternionTest, BatchMultiplyMatchesScalar)
+{
+    for (size_t count : kQuaternionBatchCounts)
+    {
+        QuaternionStreamStorage a = MakeTestRotations(count, 0.0f);
+        QuaternionStreamStorage b = MakeTestRotations(count, 2.3f);
+        QuaternionStreamStorage results(count);
+
+        Quaternion::Multiply(a.Stream(), b.Stream(), results.Stream());
+        for (size_t i = 0; i < count; ++i)
+            EXPECT_TRUE(Quaternion::IsEqualApproximetly(results.Stream().Get(i), a.Stream().Get(i) * b.Stream().Get(i), 1e-5f));
+
+        Quaternion parent = MakeTestRotation(5, 0.5f);
+        Quaternion::Multiply(parent, b.Stream(), results.Stream());
+        for (size_t i = 0; i < count; ++i)
+            EXPECT_TRUE(Quaternion::IsEqualApproximetly(results.Stream().Get(i), parent * b.Stream().Get(i), 1e-5f));
+
+        // In place
+        Quaternion::Multiply(a.Stream(), b.Stream(), b.Stream());
+        for (size_t i = 0; i < count; ++i)
+            EXPECT_TRUE(Quaternion::IsEqualApproximetly(b.Stream().Get(i), a.Stream().Get(i) * MakeTestRotation(i, 2.3f), 1e-5f));
+    }
+}
+
+TEST_F(QuaternionTest, BatchRotateMatchesScalar)
+{
+    for (size_t count : kQuaternionBatchCounts)
+    {
+        QuaternionStreamStorage rotations = MakeTestRotations(count, 0.0f);
+        Vector3StreamStorage vectors(count);
+        Vector3StreamStorage results(count);
+        for (size_t i = 0; i < count; ++i)
+            vectors.Stream().Set(i, Vector3(static_cast<float>(i), 1.0f - static_cast<float>(i) * 0.5f, 2.0f));
+
+        Quaternion::Rotate(rotations.Stream(), vectors.Stream(), results.Stream());
+        for (size_t i = 0; i < count; ++i)
+        {
+            Vector3 expected = rotations.Stream().Get(i) * vectors.Stream().Get(i);
+            Vector3 actual = results.Stream().Get(i);
+            EXPECT_NEAR(actual.x, expected.x, 1e-4f);
+            EXPECT_NEAR(actual.y, expected.y, 1e-4f);
+            EXPECT_NEAR(actual.z, expected.z, 1e-4f);
+        }
+    }
+}
+
+TEST_F(QuaternionTest, BatchNormalize)
+{
+    QuaternionStreamStorage quaternions(11);
+    for (size_t i = 0; i < 11; ++i)
+        quaternions.Stream().Set(i, Quaternion(1.0f + static_cast<float>(i), 2.0f, -3.0f, 0.5f));
+    quaternions.Stream().Set(10, Quaternion(0.0f));
+
+    Quaternion::Normalize(quaternions.Stream());
+    for (size_t i = 0; i < 10; ++i)
+    {
+        Quaternion expected = Quaternion(1.0f + static_cast<float>(i), 2.0f, -3.0f, 0.5f).Normalized();
+        EXPECT_TRUE(Quaternion::IsEqualApproximetly(quaternions.Stream().Get(i), expected, 1e-6f));
+    }
+    EXPECT_EQ(quaternions.Stream().Get(10), Quaternion(0.0f));
 }
\ No newline at end of file
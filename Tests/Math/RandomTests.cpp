@@ -0,0 +1,291 @@
+﻿#include <gtest/gtest.h>
+#include <cstdint>
+#include <cmath>
+#include <vector>
+#include "ByteEngine/Math/QuaternionStream.h"
+#include "ByteEngine/Math/Random.h"
+
+using namespace ByteEngine::Math;
+
+// ─────────────────────────────────────────────
+// Helpers
+// ─────────────────────────────────────────────
+
+static constexpr size_t kSampleCount = 1 << 16;
+static constexpr size_t kTailTestCounts[] = { 0, 1, 7, 8, 9, 16, 37 };
+
+// Straight port of the reference xoshiro128** with the SplitMix64 seeding used by Random
+struct ReferenceXoshiro
+{
+    uint32_t s[4];
+
+    explicit ReferenceXoshiro(uint64_t seed)
+    {
+        uint64_t low = SplitMix(seed);
+        uint64_t high = SplitMix(seed);
+        s[0] = static_cast<uint32_t>(low);
+        s[1] = static_cast<uint32_t>(low >> 32);
+        s[2] = static_cast<uint32_t>(high);
+        s[3] = static_cast<uint32_t>(high >> 32);
+    }
+
+    static uint64_t SplitMix(uint64_t& x)
+    {
+        uint64_t z = (x += 0x9e3779b97f4a7c15);
+        z = (z ^ (z >> 30)) * 0xbf58476d1ce4e5b9;
+        z = (z ^ (z >> 27)) * 0x94d049bb133111eb;
+        return z ^ (z >> 31);
+    }
+
+    static uint32_t Rotl(uint32_t x, int k) { return (x << k) | (x >> (32 - k)); }
+
+    uint32_t Next()
+    {
+        uint32_t result = Rotl(s[1] * 5, 7) * 9;
+        uint32_t t = s[1] << 9;
+        s[2] ^= s[0];
+        s[3] ^= s[1];
+        s[1] ^= s[2];
+        s[0] ^= s[3];
+        s[2] ^= t;
+        s[3] = Rotl(s[3], 11);
+        return result;
+    }
+};
+
+static float Mean(const std::vector<float>& values)
+{
+    double sum = 0.0;
+
+    for (float value : values)
+        sum += value;
+
+    return static_cast<float>(sum / static_cast<double>(values.size()));
+}
+
+// ─────────────────────────────────────────────
+// Sequence
+// ─────────────────────────────────────────────
+
+TEST(RandomTest, LaneZeroMatchesReference)
+{
+    Random random(12345);
+    ReferenceXoshiro reference(12345);
+
+    for (int i = 0; i < 100; ++i)
+        EXPECT_EQ(random.NextUInt(), reference.Next());
+}
+
+TEST(RandomTest, FillTakesValueIFromLaneIMod8)
+{
+    Random single(7);
+    Random batch(7);
+
+    std::vector<uint32_t> values(8 * 50);
+    batch.Fill(values);
+
+    for (size_t i = 0; i < 50; ++i)
+        EXPECT_EQ(values[i * Random::LaneCount], single.NextUInt());
+}
+
+TEST(RandomTest, SameSeedGivesSameValues)
+{
+    Random a(99), b(99);
+    std::vector<float> va(37), vb(37);
+
+    a.Fill(va);
+    b.Fill(vb);
+
+    EXPECT_EQ(va, vb);
+    EXPECT_EQ(a.NextUInt(), b.NextUInt());
+
+    b.Seed(99);
+    std::vector<float> vc(37);
+    b.Fill(vc);
+    EXPECT_EQ(va, vc);
+}
+
+TEST(RandomTest, SeedsLanesAndJumpsDiffer)
+{
+    Random a(1), b(2);
+    std::vector<uint32_t> va(64), vb(64);
+    a.Fill(va);
+    b.Fill(vb);
+    EXPECT_NE(va, vb);
+
+    // No two lanes start with the same value
+    for (size_t i = 0; i < Random::LaneCount; ++i)
+    {
+        for (size_t j = i + 1; j < Random::LaneCount; ++j)
+            EXPECT_NE(va[i], va[j]);
+    }
+
+    Random jumped(1);
+    jumped.Jump();
+    std::vector<uint32_t> vj(64);
+    jumped.Fill(vj);
+
+    Random original(1);
+    std::vector<uint32_t> vo(64);
+    original.Fill(vo);
+    EXPECT_NE(vj, vo);
+}
+
+// ─────────────────────────────────────────────
+// Distributions
+// ─────────────────────────────────────────────
+
+TEST(RandomTest, FloatsAreUniformInUnitRange)
+{
+    Random random;
+    std::vector<float> values(kSampleCount);
+    random.Fill(values);
+
+    size_t buckets[16] = { };
+
+    for (float value : values)
+    {
+        ASSERT_GE(value, 0.f);
+        ASSERT_LT(value, 1.f);
+        buckets[static_cast<size_t>(value * 16.f)]++;
+    }
+
+    EXPECT_NEAR(Mean(values), 0.5f, 0.01f);
+
+    for (size_t count : buckets)
+        EXPECT_NEAR(static_cast<float>(count), kSampleCount / 16.f, kSampleCount / 16.f * 0.1f);
+
+    for (int i = 0; i < 1000; ++i)
+    {
+        float value = random.NextFloat(-2.f, 3.f);
+        EXPECT_GE(value, -2.f);
+        EXPECT_LT(value, 3.f);
+    }
+}
+
+TEST(RandomTest, IntsStayInRangeAndHitEveryValue)
+{
+    Random random;
+    std::vector<int32_t> values(4096);
+    random.Fill(values, -3, 5);
+
+    bool seen[8] = { };
+
+    for (int32_t value : values)
+    {
+        ASSERT_GE(value, -3);
+        ASSERT_LT(value, 5);
+        seen[value + 3] = true;
+    }
+
+    for (bool s : seen)
+        EXPECT_TRUE(s);
+
+    // Full int32 range must not overflow
+    random.Fill(values, INT32_MIN, INT32_MAX);
+
+    size_t negative = 0;
+
+    for (int32_t value : values)
+        negative += value < 0 ? 1 : 0;
+
+    EXPECT_NEAR(static_cast<float>(negative), 2048.f, 200.f);
+
+    for (int i = 0; i < 1000; ++i)
+    {
+        int32_t value = random.NextInt(10, 13);
+        EXPECT_GE(value, 10);
+        EXPECT_LT(value, 13);
+    }
+}
+
+TEST(RandomTest, UnitVectorsAreUnitAndUnbiased)
+{
+    Random random;
+    std::vector<float> x(kSampleCount), y(kSampleCount), z(kSampleCount);
+    random.FillUnitVectors(Vector3FStream(x, y, z));
+
+    for (size_t i = 0; i < kSampleCount; ++i)
+        ASSERT_NEAR(x[i] * x[i] + y[i] * y[i] + z[i] * z[i], 1.f, 1e-5f);
+
+    EXPECT_NEAR(Mean(x), 0.f, 0.01f);
+    EXPECT_NEAR(Mean(y), 0.f, 0.01f);
+    EXPECT_NEAR(Mean(z), 0.f, 0.01f);
+
+    for (int i = 0; i < 1000; ++i)
+        EXPECT_NEAR(random.NextUnitVector().Length(), 1.f, 1e-5f);
+}
+
+TEST(RandomTest, PointsInSphereFillTheVolume)
+{
+    Random random;
+    Vector3F center(5.f, -1.f, 2.f);
+    float radius = 3.f;
+
+    std::vector<float> x(kSampleCount), y(kSampleCount), z(kSampleCount);
+    random.FillPointsInSphere(Vector3FStream(x, y, z), center, radius);
+
+    size_t innerHalf = 0;
+
+    for (size_t i = 0; i < kSampleCount; ++i)
+    {
+        float distance = (Vector3F(x[i], y[i], z[i]) - center).Length();
+        ASSERT_LE(distance, radius * 1.0001f);
+        innerHalf += distance < radius * 0.5f ? 1 : 0;
+    }
+
+    // The inner ball of half the radius holds 1/8 of the volume
+    EXPECT_NEAR(static_cast<float>(innerHalf) / kSampleCount, 0.125f, 0.01f);
+
+    for (int i = 0; i < 1000; ++i)
+        EXPECT_LE((random.NextPointInSphere(center, radius) - center).Length(), radius * 1.0001f);
+}
+
+TEST(RandomTest, RotationsAreNormalizedAndUniform)
+{
+    Random random;
+    std::vector<float> x(kSampleCount), y(kSampleCount), z(kSampleCount), w(kSampleCount);
+    random.FillRotations(QuaternionStream(x, y, z, w));
+
+    // Every component of a uniform rotation has E[c^2] = 1/4
+    double squares[4] = { };
+
+    for (size_t i = 0; i < kSampleCount; ++i)
+    {
+        ASSERT_NEAR(x[i] * x[i] + y[i] * y[i] + z[i] * z[i] + w[i] * w[i], 1.f, 1e-5f);
+        squares[0] += x[i] * x[i];
+        squares[1] += y[i] * y[i];
+        squares[2] += z[i] * z[i];
+        squares[3] += w[i] * w[i];
+    }
+
+    for (double sum : squares)
+        EXPECT_NEAR(sum / kSampleCount, 0.25, 0.01);
+
+    for (int i = 0; i < 1000; ++i)
+        EXPECT_NEAR(random.NextRotation().Length(), 1.f, 1e-5f);
+}
+
+TEST(RandomTest, FillHandlesPartialBlocks)
+{
+    for (size_t count : kTailTestCounts)
+    {
+        Random random(count);
+
+        // Guard values after the end must stay untouched
+        std::vector<float> values(count + 1, -1.f);
+        random.Fill(std::span<float>(values.data(), count));
+
+        for (size_t i = 0; i < count; ++i)
+            EXPECT_GE(values[i], 0.f);
+
+        EXPECT_EQ(values[count], -1.f);
+
+        std::vector<float> x(count), y(count), z(count), w(count);
+        random.FillRotations(QuaternionStream(x, y, z, w));
+        random.FillPointsInSphere(Vector3FStream(x, y, z));
+
+        for (size_t i = 0; i < count; ++i)
+            EXPECT_LE(Vector3F(x[i], y[i], z[i]).Length(), 1.0001f);
+    }
+}
\ No newline at end of file
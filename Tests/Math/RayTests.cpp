@@ -0,0 +1,211 @@
+﻿#include <gtest/gtest.h>
+#include <cstdint>
+#include <cmath>
+#include <random>
+#include <vector>
+#include "ByteEngine/Math/Ray.h"
+
+using namespace ByteEngine::Math;
+
+// ─────────────────────────────────────────────
+// Helpers
+// ─────────────────────────────────────────────
+
+static constexpr float kEps = 1e-4f;
+
+// Small random triangles scattered through a box, so rays through the box hit some and miss most
+static std::vector<Vector3F> MakeTriangleSoup(size_t triangleCount, uint32_t seed)
+{
+    std::mt19937 rng(seed);
+    std::uniform_real_distribution<float> position(-10.f, 10.f);
+    std::uniform_real_distribution<float> offset(-2.f, 2.f);
+    std::vector<Vector3F> vertices;
+
+    for (size_t i = 0; i < triangleCount; ++i)
+    {
+        Vector3F center(position(rng), position(rng), position(rng));
+
+        for (int corner = 0; corner < 3; ++corner)
+            vertices.push_back(center + Vector3F(offset(rng), offset(rng), offset(rng)));
+    }
+
+    return vertices;
+}
+
+static std::vector<Ray> MakeRays(size_t count, uint32_t seed)
+{
+    std::mt19937 rng(seed);
+    std::uniform_real_distribution<float> position(-8.f, 8.f);
+    std::vector<Ray> rays;
+
+    for (size_t i = 0; i < count; ++i)
+    {
+        Vector3F origin(position(rng), position(rng), -20.f);
+        Vector3F target(position(rng), position(rng), 20.f);
+        rays.push_back(Ray(origin, (target - origin).Normalized()));
+    }
+
+    return rays;
+}
+
+static RayHit BruteForce(const Ray& ray, const std::vector<Vector3F>& vertices)
+{
+    RayHit hit;
+
+    for (size_t i = 0; i < vertices.size() / 3; ++i)
+        (void)ray.IntersectTriangle(vertices[i * 3], vertices[i * 3 + 1], vertices[i * 3 + 2], static_cast<uint32_t>(i), hit);
+
+    return hit;
+}
+
+static void ExpectSameHit(const RayHit& actual, const RayHit& expected)
+{
+    EXPECT_EQ(actual.triangle, expected.triangle);
+
+    if (expected.IsHit())
+    {
+        EXPECT_NEAR(actual.distance, expected.distance, kEps);
+        EXPECT_NEAR(actual.u, expected.u, kEps);
+        EXPECT_NEAR(actual.v, expected.v, kEps);
+    }
+}
+
+// ─────────────────────────────────────────────
+// Single ray
+// ─────────────────────────────────────────────
+
+TEST(RayTest, IntersectBounds)
+{
+    Bounds box(Vector3F(-1.f), Vector3F(1.f));
+
+    EXPECT_NEAR(Ray(Vector3F(-5.f, 0.f, 0.f), Vector3F(1.f, 0.f, 0.f)).IntersectBounds(box), 4.f, kEps);
+    EXPECT_EQ(Ray(Vector3F(0.f), Vector3F(0.f, 1.f, 0.f)).IntersectBounds(box), 0.f);
+    EXPECT_EQ(Ray(Vector3F(-5.f, 3.f, 0.f), Vector3F(1.f, 0.f, 0.f)).IntersectBounds(box), Math::Infinity);
+    EXPECT_EQ(Ray(Vector3F(5.f, 0.f, 0.f), Vector3F(1.f, 0.f, 0.f)).IntersectBounds(box), Math::Infinity);
+    EXPECT_EQ(Ray(Vector3F(-5.f, 0.f, 0.f), Vector3F(1.f, 0.f, 0.f)).IntersectBounds(box, 3.f), Math::Infinity);
+}
+
+TEST(RayTest, IntersectTriangle)
+{
+    Vector3F a(0.f, 0.f, 0.f), b(1.f, 0.f, 0.f), c(0.f, 1.f, 0.f);
+    Ray ray(Vector3F(0.25f, 0.5f, -2.f), Vector3F(0.f, 0.f, 1.f));
+
+    RayHit hit;
+    EXPECT_TRUE(ray.IntersectTriangle(a, b, c, 7, hit));
+    EXPECT_EQ(hit.triangle, 7u);
+    EXPECT_NEAR(hit.distance, 2.f, kEps);
+    EXPECT_NEAR(hit.u, 0.25f, kEps);
+    EXPECT_NEAR(hit.v, 0.5f, kEps);
+
+    // Back side counts too
+    RayHit backHit;
+    EXPECT_TRUE(Ray(Vector3F(0.25f, 0.25f, 2.f), Vector3F(0.f, 0.f, -1.f)).IntersectTriangle(a, b, c, 0, backHit));
+
+    // Only nearer hits replace the current one
+    RayHit nearer { 1.f, 0.f, 0.f, 3 };
+    EXPECT_FALSE(ray.IntersectTriangle(a, b, c, 7, nearer));
+    EXPECT_EQ(nearer.triangle, 3u);
+
+    RayHit miss;
+    EXPECT_FALSE(Ray(Vector3F(0.8f, 0.8f, -2.f), Vector3F(0.f, 0.f, 1.f)).IntersectTriangle(a, b, c, 0, miss));
+    EXPECT_FALSE(Ray(Vector3F(0.2f, 0.2f, 2.f), Vector3F(0.f, 0.f, 1.f)).IntersectTriangle(a, b, c, 0, miss));
+    EXPECT_FALSE(Ray(Vector3F(0.2f, 0.2f, 1.f), Vector3F(1.f, 0.f, 0.f)).IntersectTriangle(a, b, c, 0, miss));
+    EXPECT_FALSE(miss.IsHit());
+}
+
+TEST(RayTest, TriangleBlocksMatchScalar)
+{
+    for (size_t triangleCount : { 0, 1, 7, 8, 9, 37, 500 })
+    {
+        std::vector<Vector3F> vertices = MakeTriangleSoup(triangleCount, 3);
+        std::vector<TriangleBlock> blocks = TriangleBlock::FromTriangles(vertices);
+        EXPECT_EQ(blocks.size(), (triangleCount + 7) / 8);
+
+        size_t hitCount = 0;
+
+        for (const Ray& ray : MakeRays(64, 5))
+        {
+            RayHit expected = BruteForce(ray, vertices);
+            RayHit actual;
+
+            EXPECT_EQ(ray.IntersectTriangles(blocks, actual), expected.IsHit());
+            ExpectSameHit(actual, expected);
+            hitCount += expected.IsHit() ? 1 : 0;
+        }
+
+        if (triangleCount == 500)
+        {
+            EXPECT_GT(hitCount, 10u);
+        }
+    }
+}
+
+// ─────────────────────────────────────────────
+// Packets
+// ─────────────────────────────────────────────
+
+TEST(RayPacketTest, TrianglesMatchScalar)
+{
+    std::vector<Vector3F> vertices = MakeTriangleSoup(300, 9);
+    std::vector<Ray> rays = MakeRays(64, 11);
+
+    for (size_t first = 0; first < rays.size(); first += RayPacket::Width)
+    {
+        RayPacket packet(std::span<const Ray>(rays).subspan(first, RayPacket::Width));
+        RayPacketHit hits;
+        packet.IntersectTriangles(vertices, hits);
+
+        for (int32_t lane = 0; lane < RayPacket::Width; ++lane)
+            ExpectSameHit(hits.Get(lane), BruteForce(rays[first + lane], vertices));
+    }
+}
+
+TEST(RayPacketTest, EmptyLanesNeverHit)
+{
+    std::vector<Ray> rays = MakeRays(3, 2);
+    RayPacket packet(rays);
+
+    for (int32_t lane = 0; lane < 3; ++lane)
+        EXPECT_EQ(packet.Get(lane).origin, rays[lane].origin);
+
+    // A huge triangle and box around the origin, all used lanes hit them
+    RayPacketHit hits;
+    Bounds box(Vector3F(-100.f), Vector3F(100.f));
+    EXPECT_EQ(packet.IntersectBounds(box, hits), 0b111u);
+
+    uint32_t mask = packet.IntersectTriangle(Vector3F(-1000.f, -1000.f, 0.f), Vector3F(1000.f, -1000.f, 0.f), Vector3F(0.f, 1000.f, 0.f), 4, hits);
+    EXPECT_EQ(mask, 0b111u);
+
+    for (int32_t lane = 3; lane < RayPacket::Width; ++lane)
+        EXPECT_FALSE(hits.Get(lane).IsHit());
+}
+
+TEST(RayPacketTest, BoundsMatchScalar)
+{
+    std::vector<Ray> rays = MakeRays(8, 13);
+    RayPacket packet(rays);
+
+    // Limit some lanes to distances shorter than the box entry
+    RayPacketHit hits;
+    hits.distance[1] = 1.f;
+    hits.distance[6] = 1.f;
+
+    std::mt19937 rng(17);
+    std::uniform_real_distribution<float> position(-10.f, 10.f);
+
+    for (int i = 0; i < 200; ++i)
+    {
+        Vector3F center(position(rng), position(rng), position(rng));
+        Bounds box = Bounds::FromCenterExtents(center, Vector3F(1.5f, 0.5f, 2.f));
+
+        uint32_t expected = 0;
+
+        for (int32_t lane = 0; lane < RayPacket::Width; ++lane)
+        {
+            if (rays[lane].IntersectBounds(box, hits.distance[lane]) != Math::Infinity)
+                expected |= 1u << lane;
+        }
+
+        EXPECT_EQ(packet.IntersectBounds(box, hits), expected);
+    }
+}
\ No newline at end of file
@@ -0,0 +1,384 @@
+﻿#include <gtest/gtest.h>
+#include <cstdint>
+#include <cmath>
+#include <random>
+#include <vector>
+#include "ByteEngine/Math/Skinning.h"
+
+using namespace ByteEngine::Math;
+
+// ─────────────────────────────────────────────
+// Helpers
+// ─────────────────────────────────────────────
+
+static constexpr float kEps = 1e-4f;
+
+static void ExpectNear(Vector3F actual, Vector3F expected, float eps = kEps)
+{
+    EXPECT_NEAR(actual.x, expected.x, eps);
+    EXPECT_NEAR(actual.y, expected.y, eps);
+    EXPECT_NEAR(actual.z, expected.z, eps);
+}
+
+static Quaternion RandomRotation(std::mt19937& rng)
+{
+    std::uniform_real_distribution<float> component(-1.f, 1.f);
+    return Quaternion(component(rng), component(rng), component(rng), component(rng)).Normalized();
+}
+
+// SoA mesh with 4 random influences per vertex, weights sum to one
+struct TestMesh
+{
+    std::vector<float> px, py, pz;
+    std::vector<float> nx, ny, nz;
+    std::vector<uint16_t> bones[SkinInfluences::MaxInfluences];
+    std::vector<float> weights[SkinInfluences::MaxInfluences];
+
+    TestMesh(size_t vertexCount, uint16_t boneCount, uint32_t seed)
+    {
+        std::mt19937 rng(seed);
+        std::uniform_real_distribution<float> position(-2.f, 2.f);
+        std::uniform_real_distribution<float> weight(0.05f, 1.f);
+        std::uniform_int_distribution<int> bone(0, boneCount - 1);
+
+        for (size_t i = 0; i < vertexCount; ++i)
+        {
+            px.push_back(position(rng));
+            py.push_back(position(rng));
+            pz.push_back(position(rng));
+
+            Vector3F normal = Vector3F(position(rng), position(rng), position(rng) + 5.f).Normalized();
+            nx.push_back(normal.x);
+            ny.push_back(normal.y);
+            nz.push_back(normal.z);
+
+            float w[SkinInfluences::MaxInfluences];
+            float sum = 0.f;
+
+            for (int k = 0; k < SkinInfluences::MaxInfluences; ++k)
+            {
+                w[k] = weight(rng);
+                sum += w[k];
+            }
+
+            for (int k = 0; k < SkinInfluences::MaxInfluences; ++k)
+            {
+                bones[k].push_back(static_cast<uint16_t>(bone(rng)));
+                weights[k].push_back(w[k] / sum);
+            }
+        }
+    }
+
+    size_t Size() const { return px.size(); }
+
+    ConstVector3FStream Positions() const { return ConstVector3FStream(px, py, pz); }
+    ConstVector3FStream Normals() const { return ConstVector3FStream(nx, ny, nz); }
+
+    SkinInfluences Influences(int count = SkinInfluences::MaxInfluences) const
+    {
+        SkinInfluences influences;
+
+        for (int k = 0; k < count; ++k)
+        {
+            influences.boneIndices[k] = bones[k];
+            influences.weights[k] = weights[k];
+        }
+
+        return influences;
+    }
+};
+
+struct OutputStream
+{
+    std::vector<float> x, y, z;
+
+    explicit OutputStream(size_t count) : x(count), y(count), z(count) { }
+
+    Vector3FStream Stream() { return Vector3FStream(x, y, z); }
+    Vector3F Get(size_t i) const { return Vector3F(x[i], y[i], z[i]); }
+};
+
+static std::vector<Matrix4x4F> MakeBoneMatrices(size_t count, uint32_t seed, bool uniformScale)
+{
+    std::mt19937 rng(seed);
+    std::uniform_real_distribution<float> translation(-3.f, 3.f);
+    std::uniform_real_distribution<float> scale(0.5f, 2.f);
+    std::vector<Matrix4x4F> matrices;
+
+    for (size_t i = 0; i < count; ++i)
+    {
+        float s = uniformScale ? scale(rng) : 1.f;
+        Vector3F t(translation(rng), translation(rng), translation(rng));
+        matrices.push_back(Matrix4x4F::CreateTRS(t, RandomRotation(rng), Vector3F(s, s, s)));
+    }
+
+    return matrices;
+}
+
+// ─────────────────────────────────────────────
+// DualQuaternion
+// ─────────────────────────────────────────────
+
+TEST(DualQuaternionTest, MatchesMatrixTransform)
+{
+    std::mt19937 rng(3);
+    std::uniform_real_distribution<float> value(-3.f, 3.f);
+
+    for (int i = 0; i < 50; ++i)
+    {
+        Quaternion rotation = RandomRotation(rng);
+        Vector3F translation(value(rng), value(rng), value(rng));
+        Vector3F point(value(rng), value(rng), value(rng));
+
+        Matrix4x4F matrix = Matrix4x4F::CreateTRS(translation, rotation, Vector3F(1.f, 1.f, 1.f));
+        DualQuaternion dq = DualQuaternion::FromRotationTranslation(rotation, translation);
+
+        ExpectNear(dq.GetTranslation(), translation);
+        ExpectNear(dq.TransformPoint(point), matrix.MultiplyPoint(point));
+        ExpectNear(dq.TransformVector(point), matrix.MultiplyVector(point));
+        ExpectNear(dq.ToMatrix().MultiplyPoint(point), matrix.MultiplyPoint(point));
+        ExpectNear(DualQuaternion::FromMatrix(matrix).TransformPoint(point), matrix.MultiplyPoint(point));
+    }
+}
+
+TEST(DualQuaternionTest, ProductAppliesRightOperandFirst)
+{
+    std::mt19937 rng(4);
+    std::uniform_real_distribution<float> value(-3.f, 3.f);
+
+    DualQuaternion a = DualQuaternion::FromRotationTranslation(RandomRotation(rng), Vector3F(value(rng), value(rng), value(rng)));
+    DualQuaternion b = DualQuaternion::FromRotationTranslation(RandomRotation(rng), Vector3F(value(rng), value(rng), value(rng)));
+    Vector3F point(value(rng), value(rng), value(rng));
+
+    ExpectNear((a * b).TransformPoint(point), a.TransformPoint(b.TransformPoint(point)));
+    ExpectNear((a * b).TransformPoint(point), (b.ToMatrix() * a.ToMatrix()).MultiplyPoint(point));
+}
+
+TEST(DualQuaternionTest, FromMatrixDropsScale)
+{
+    Quaternion rotation = Quaternion::FromAngleAxis(RadianF(0.7f), Vector3F(0.f, 1.f, 0.f));
+    Vector3F translation(1.f, 2.f, 3.f);
+    Matrix4x4F scaled = Matrix4x4F::CreateTRS(translation, rotation, Vector3F(2.f, 3.f, 4.f));
+
+    DualQuaternion dq = DualQuaternion::FromMatrix(scaled);
+
+    EXPECT_TRUE(Quaternion::IsEqualApproximetly(dq.GetRotation(), rotation, kEps));
+    ExpectNear(dq.GetTranslation(), translation);
+}
+
+// ─────────────────────────────────────────────
+// Linear blend skinning
+// ─────────────────────────────────────────────
+
+TEST(SkinningTest, LinearBlendMatchesScalarReference)
+{
+    // Not a multiple of 8, so the tail goes through a partial block
+    TestMesh mesh(1003, 24, 5);
+    std::vector<Matrix4x4F> bones = MakeBoneMatrices(24, 6, true);
+    OutputStream positions(mesh.Size());
+    OutputStream normals(mesh.Size());
+
+    Skinning::LinearBlend(bones, mesh.Influences(), mesh.Positions(), mesh.Normals(), positions.Stream(), normals.Stream());
+
+    for (size_t i = 0; i < mesh.Size(); ++i)
+    {
+        Vector3F p = mesh.Positions().Get(i);
+        Vector3F n = mesh.Normals().Get(i);
+        Vector3F expectedPosition;
+        Vector3F expectedNormal;
+
+        for (int k = 0; k < SkinInfluences::MaxInfluences; ++k)
+        {
+            const Matrix4x4F& bone = bones[mesh.bones[k][i]];
+            expectedPosition += bone.MultiplyPoint(p) * mesh.weights[k][i];
+            expectedNormal += bone.MultiplyVector(n) * mesh.weights[k][i];
+        }
+
+        ExpectNear(positions.Get(i), expectedPosition, 1e-3f);
+        ExpectNear(normals.Get(i), expectedNormal.Normalized(), 1e-3f);
+    }
+}
+
+TEST(SkinningTest, SingleInfluenceEqualsBoneTransform)
+{
+    TestMesh mesh(100, 8, 7);
+    std::vector<Matrix4x4F> matrices = MakeBoneMatrices(8, 8, false);
+    std::vector<DualQuaternion> dualQuaternions(matrices.size());
+    Skinning::ToDualQuaternions(matrices, dualQuaternions);
+
+    std::vector<float> ones(mesh.Size(), 1.f);
+    SkinInfluences influences;
+    influences.boneIndices[0] = mesh.bones[0];
+    influences.weights[0] = ones;
+
+    OutputStream linearPositions(mesh.Size()), linearNormals(mesh.Size());
+    OutputStream dualPositions(mesh.Size()), dualNormals(mesh.Size());
+
+    Skinning::LinearBlend(matrices, influences, mesh.Positions(), mesh.Normals(), linearPositions.Stream(), linearNormals.Stream());
+    Skinning::DualQuaternionBlend(dualQuaternions, influences, mesh.Positions(), mesh.Normals(), dualPositions.Stream(), dualNormals.Stream());
+
+    for (size_t i = 0; i < mesh.Size(); ++i)
+    {
+        const Matrix4x4F& bone = matrices[mesh.bones[0][i]];
+        Vector3F expectedPosition = bone.MultiplyPoint(mesh.Positions().Get(i));
+        Vector3F expectedNormal = bone.MultiplyVector(mesh.Normals().Get(i));
+
+        ExpectNear(linearPositions.Get(i), expectedPosition);
+        ExpectNear(linearNormals.Get(i), expectedNormal);
+        ExpectNear(dualPositions.Get(i), expectedPosition);
+        ExpectNear(dualNormals.Get(i), expectedNormal);
+    }
+}
+
+// ─────────────────────────────────────────────
+// Dual quaternion skinning
+// ─────────────────────────────────────────────
+
+TEST(SkinningTest, DualQuaternionMatchesScalarReference)
+{
+    TestMesh mesh(1003, 24, 9);
+    std::vector<Matrix4x4F> matrices = MakeBoneMatrices(24, 10, false);
+    std::vector<DualQuaternion> bones(matrices.size());
+    Skinning::ToDualQuaternions(matrices, bones);
+
+    OutputStream positions(mesh.Size());
+    OutputStream normals(mesh.Size());
+
+    Skinning::DualQuaternionBlend(bones, mesh.Influences(), mesh.Positions(), mesh.Normals(), positions.Stream(), normals.Stream());
+
+    for (size_t i = 0; i < mesh.Size(); ++i)
+    {
+        const DualQuaternion& pivot = bones[mesh.bones[0][i]];
+        Quaternion real(0.f);
+        Quaternion dual(0.f);
+
+        for (int k = 0; k < SkinInfluences::MaxInfluences; ++k)
+        {
+            const DualQuaternion& bone = bones[mesh.bones[k][i]];
+            float weight = mesh.weights[k][i];
+
+            if (Quaternion::Dot(pivot.real, bone.real) < 0.f)
+                weight = -weight;
+
+            real += Quaternion(bone.real.x * weight, bone.real.y * weight, bone.real.z * weight, bone.real.w * weight);
+            dual += Quaternion(bone.dual.x * weight, bone.dual.y * weight, bone.dual.z * weight, bone.dual.w * weight);
+        }
+
+        float invLength = 1.f / real.Length();
+        DualQuaternion blended(
+            Quaternion(real.x * invLength, real.y * invLength, real.z * invLength, real.w * invLength),
+            Quaternion(dual.x * invLength, dual.y * invLength, dual.z * invLength, dual.w * invLength));
+
+        ExpectNear(positions.Get(i), blended.TransformPoint(mesh.Positions().Get(i)), 1e-3f);
+        ExpectNear(normals.Get(i), blended.TransformVector(mesh.Normals().Get(i)), 1e-3f);
+    }
+}
+
+TEST(SkinningTest, DualQuaternionKeepsVolumeWhereLinearBlendCollapses)
+{
+    // Half way between identity and a 120 degree twist around x, the candy wrapper case
+    Quaternion twist = Quaternion::FromAngleAxis(RadianF(2.0943951f), Vector3F(1.f, 0.f, 0.f));
+    std::vector<Matrix4x4F> matrices = { Matrix4x4F::Identity, Matrix4x4F::CreateRotation(twist) };
+    std::vector<DualQuaternion> dualQuaternions(matrices.size());
+    Skinning::ToDualQuaternions(matrices, dualQuaternions);
+
+    std::vector<float> x = { 0.f }, y = { 1.f }, z = { 0.f };
+    std::vector<uint16_t> bone0 = { 0 }, bone1 = { 1 };
+    std::vector<float> half = { 0.5f };
+
+    SkinInfluences influences;
+    influences.boneIndices[0] = bone0;
+    influences.boneIndices[1] = bone1;
+    influences.weights[0] = half;
+    influences.weights[1] = half;
+
+    OutputStream linear(1), dual(1);
+    ConstVector3FStream positions(x, y, z);
+
+    Skinning::LinearBlend(matrices, influences, positions, { }, linear.Stream(), { });
+    Skinning::DualQuaternionBlend(dualQuaternions, influences, positions, { }, dual.Stream(), { });
+
+    // Averaging the matrices shrinks the point to cos(60) of its distance, the blended rotation is a 60 degree twist
+    Quaternion halfTwist = Quaternion::FromAngleAxis(RadianF(1.0471976f), Vector3F(1.f, 0.f, 0.f));
+    EXPECT_NEAR(linear.Get(0).Length(), 0.5f, kEps);
+    EXPECT_NEAR(dual.Get(0).Length(), 1.f, kEps);
+    ExpectNear(dual.Get(0), halfTwist * Vector3F(0.f, 1.f, 0.f));
+}
+
+// ─────────────────────────────────────────────
+// Threading and aliasing
+// ─────────────────────────────────────────────
+
+TEST(SkinningTest, ThreadedAndInPlaceMatchSingleThreaded)
+{
+    TestMesh mesh(4099, 32, 11);
+    std::vector<Matrix4x4F> matrices = MakeBoneMatrices(32, 12, true);
+    std::vector<DualQuaternion> dualQuaternions(matrices.size());
+    Skinning::ToDualQuaternions(matrices, dualQuaternions);
+
+    for (bool dual : { false, true })
+    {
+        OutputStream expectedPositions(mesh.Size()), expectedNormals(mesh.Size());
+        OutputStream positions(mesh.Size()), normals(mesh.Size());
+
+        auto skin = [&](ConstVector3FStream p, ConstVector3FStream n, Vector3FStream skinnedP, Vector3FStream skinnedN, uint32_t threads)
+        {
+            if (dual)
+                Skinning::DualQuaternionBlend(dualQuaternions, mesh.Influences(), p, n, skinnedP, skinnedN, threads);
+            else
+                Skinning::LinearBlend(matrices, mesh.Influences(), p, n, skinnedP, skinnedN, threads);
+        };
+
+        skin(mesh.Positions(), mesh.Normals(), expectedPositions.Stream(), expectedNormals.Stream(), 1);
+
+        // In place over a copy of the mesh, split between more threads than the machine may have
+        positions.x = mesh.px; positions.y = mesh.py; positions.z = mesh.pz;
+        normals.x = mesh.nx; normals.y = mesh.ny; normals.z = mesh.nz;
+        skin(positions.Stream(), normals.Stream(), positions.Stream(), normals.Stream(), 7);
+
+        EXPECT_EQ(positions.x, expectedPositions.x);
+        EXPECT_EQ(positions.y, expectedPositions.y);
+        EXPECT_EQ(positions.z, expectedPositions.z);
+        EXPECT_EQ(normals.x, expectedNormals.x);
+        EXPECT_EQ(normals.z, expectedNormals.z);
+
+        // Without normals, all hardware threads
+        OutputStream positionsOnly(mesh.Size());
+        skin(mesh.Positions(), { }, positionsOnly.Stream(), { }, 0);
+        EXPECT_EQ(positionsOnly.x, expectedPositions.x);
+    }
+}
+
+TEST(SkinningTest, FewerInfluencesAndEmptyMesh)
+{
+    TestMesh mesh(64, 4, 13);
+    std::vector<Matrix4x4F> bones = MakeBoneMatrices(4, 14, false);
+
+    // Two leading slots with their weights renormalized
+    std::vector<float> w0(mesh.Size()), w1(mesh.Size());
+
+    for (size_t i = 0; i < mesh.Size(); ++i)
+    {
+        float sum = mesh.weights[0][i] + mesh.weights[1][i];
+        w0[i] = mesh.weights[0][i] / sum;
+        w1[i] = mesh.weights[1][i] / sum;
+    }
+
+    SkinInfluences influences = mesh.Influences(2);
+    influences.weights[0] = w0;
+    influences.weights[1] = w1;
+    EXPECT_EQ(influences.GetInfluenceCount(), 2);
+
+    OutputStream positions(mesh.Size());
+    Skinning::LinearBlend(bones, influences, mesh.Positions(), { }, positions.Stream(), { });
+
+    for (size_t i = 0; i < mesh.Size(); ++i)
+    {
+        Vector3F p = mesh.Positions().Get(i);
+        Vector3F expected = bones[mesh.bones[0][i]].MultiplyPoint(p) * w0[i] + bones[mesh.bones[1][i]].MultiplyPoint(p) * w1[i];
+        ExpectNear(positions.Get(i), expected, 1e-3f);
+    }
+
+    Skinning::LinearBlend(bones, SkinInfluences(), { }, { }, { }, { }, 0);
+    Skinning::DualQuaternionBlend({ }, SkinInfluences(), { }, { }, { }, { }, 0);
+}
\ No newline at end of file
@@ -0,0 +1,212 @@
+﻿#include <gtest/gtest.h>
+#include <cstdint>
+#include <cmath>
+#include <random>
+#include <vector>
+#include "ByteEngine/Math/TransformHierarchy.h"
+
+using namespace ByteEngine::Math;
+
+using NodeId = TransformHierarchy::NodeId;
+
+// ─────────────────────────────────────────────
+// Helpers
+// ─────────────────────────────────────────────
+
+static constexpr float kEps = 1e-4f;
+
+static void ExpectMatrixNear(const Matrix4x4F& a, const Matrix4x4F& b, float eps = kEps)
+{
+    for (int i = 0; i < Matrix4x4F::ElementCount; ++i)
+        EXPECT_NEAR(a.elements[i], b.elements[i], eps) << "element " << i;
+}
+
+// Full chain multiplication, what users did before the hierarchy existed
+static Matrix4x4F ReferenceWorld(const TransformHierarchy& hierarchy, NodeId node)
+{
+    Matrix4x4F local = Matrix4x4F::CreateTRS(hierarchy.GetLocalPosition(node), hierarchy.GetLocalRotation(node), hierarchy.GetLocalScale(node));
+    NodeId parent = hierarchy.GetParent(node);
+    return parent == TransformHierarchy::InvalidNode ? local : local * ReferenceWorld(hierarchy, parent);
+}
+
+static Quaternion RandomRotation(std::mt19937& rng)
+{
+    std::normal_distribution<float> component(0.f, 1.f);
+    Quaternion q(component(rng), component(rng), component(rng), component(rng));
+    q.Normalize();
+    return q;
+}
+
+static Vector3F RandomPosition(std::mt19937& rng)
+{
+    std::uniform_real_distribution<float> coordinate(-5.f, 5.f);
+    return Vector3F(coordinate(rng), coordinate(rng), coordinate(rng));
+}
+
+// ─────────────────────────────────────────────
+// Composition
+// ─────────────────────────────────────────────
+
+TEST(TransformHierarchyTest, RootWorldIsLocalTRS)
+{
+    TransformHierarchy hierarchy;
+    Quaternion rotation = Quaternion::FromEuler(30_df, 45_df, 10_df);
+    NodeId root = hierarchy.Create(TransformHierarchy::InvalidNode, Vector3F(1.f, 2.f, 3.f), rotation, Vector3F(2.f));
+
+    EXPECT_EQ(hierarchy.Update(), 1u);
+    ExpectMatrixNear(hierarchy.GetWorldMatrix(root), Matrix4x4F::CreateTRS(Vector3F(1.f, 2.f, 3.f), rotation, Vector3F(2.f)));
+    EXPECT_EQ(hierarchy.GetDepth(root), 0u);
+    EXPECT_EQ(hierarchy.GetParent(root), TransformHierarchy::InvalidNode);
+}
+
+TEST(TransformHierarchyTest, ChildMovesWithParent)
+{
+    TransformHierarchy hierarchy;
+    NodeId parent = hierarchy.Create(TransformHierarchy::InvalidNode, Vector3F(10.f, 0.f, 0.f), Quaternion::FromEuler(0_df, 90_df, 0_df), Vector3F(2.f));
+    NodeId child = hierarchy.Create(parent, Vector3F(1.f, 0.f, 0.f));
+    hierarchy.Update();
+
+    // Scaled by 2, rotated by the parent's yaw, then offset by the parent's position
+    Vector3F expected = Quaternion::FromEuler(0_df, 90_df, 0_df) * Vector3F(2.f, 0.f, 0.f) + Vector3F(10.f, 0.f, 0.f);
+    Vector3F origin = hierarchy.GetWorldMatrix(child).MultiplyPoint(Vector3F(0.f));
+    EXPECT_NEAR(origin.x, expected.x, kEps);
+    EXPECT_NEAR(origin.y, expected.y, kEps);
+    EXPECT_NEAR(origin.z, expected.z, kEps);
+
+    EXPECT_EQ(hierarchy.GetDepth(child), 1u);
+    EXPECT_EQ(hierarchy.GetParent(child), parent);
+}
+
+// ─────────────────────────────────────────────
+// Dirty propagation
+// ─────────────────────────────────────────────
+
+TEST(TransformHierarchyTest, UpdateOnlyRecomputesChangedSubtrees)
+{
+    TransformHierarchy hierarchy;
+    NodeId rootA = hierarchy.Create();
+    NodeId rootB = hierarchy.Create();
+    NodeId childA = hierarchy.Create(rootA);
+    NodeId grandchildA = hierarchy.Create(childA);
+    hierarchy.Create(rootB);
+
+    EXPECT_EQ(hierarchy.Update(), 5u);
+    EXPECT_EQ(hierarchy.Update(), 0u);
+
+    hierarchy.SetLocalPosition(grandchildA, Vector3F(1.f, 0.f, 0.f));
+    EXPECT_EQ(hierarchy.Update(), 1u);
+
+    // Parent and child both dirty, the child is recomputed once as part of the parent's subtree
+    hierarchy.SetLocalPosition(childA, Vector3F(0.f, 1.f, 0.f));
+    hierarchy.SetLocalScale(grandchildA, Vector3F(3.f));
+    hierarchy.SetLocalRotation(childA, Quaternion::FromEuler(0_df, 0_df, 45_df));
+    EXPECT_EQ(hierarchy.Update(), 2u);
+
+    hierarchy.SetLocalPosition(rootA, Vector3F(0.f, 0.f, 1.f));
+    EXPECT_EQ(hierarchy.Update(), 3u);
+
+    ExpectMatrixNear(hierarchy.GetWorldMatrix(grandchildA), ReferenceWorld(hierarchy, grandchildA));
+    ExpectMatrixNear(hierarchy.GetWorldMatrix(rootB), ReferenceWorld(hierarchy, rootB));
+}
+
+TEST(TransformHierarchyTest, WorldMatricesMatchChainAfterRandomEdits)
+{
+    std::mt19937 rng(3);
+    TransformHierarchy hierarchy;
+    std::vector<NodeId> nodes;
+
+    for (int i = 0; i < 2000; ++i)
+    {
+        NodeId parent = nodes.empty() || rng() % 10 == 0 ? TransformHierarchy::InvalidNode : nodes[rng() % nodes.size()];
+        nodes.push_back(hierarchy.Create(parent, RandomPosition(rng), RandomRotation(rng), Vector3F(0.9f)));
+    }
+
+    for (int frame = 0; frame < 10; ++frame)
+    {
+        for (int i = 0; i < 50; ++i)
+        {
+            NodeId node = nodes[rng() % nodes.size()];
+            hierarchy.SetLocalTransform(node, RandomPosition(rng), RandomRotation(rng), Vector3F(0.9f));
+        }
+
+        hierarchy.Update();
+
+        for (NodeId node : nodes)
+            ExpectMatrixNear(hierarchy.GetWorldMatrix(node), ReferenceWorld(hierarchy, node));
+    }
+}
+
+// ─────────────────────────────────────────────
+// Structure changes
+// ─────────────────────────────────────────────
+
+TEST(TransformHierarchyTest, SetParentKeepsLocalTransformAndSortsByDepth)
+{
+    TransformHierarchy hierarchy;
+    NodeId a = hierarchy.Create(TransformHierarchy::InvalidNode, Vector3F(1.f, 0.f, 0.f));
+    NodeId b = hierarchy.Create(a, Vector3F(0.f, 1.f, 0.f));
+    NodeId c = hierarchy.Create(TransformHierarchy::InvalidNode, Vector3F(0.f, 0.f, 5.f));
+    NodeId d = hierarchy.Create(c, Vector3F(2.f, 0.f, 0.f));
+    hierarchy.Update();
+
+    // a moves below d, which was created after it, so b and a now come after d
+    hierarchy.SetParent(a, d);
+    EXPECT_EQ(hierarchy.Update(), 2u);
+
+    EXPECT_EQ(hierarchy.GetParent(a), d);
+    EXPECT_EQ(hierarchy.GetDepth(a), 2u);
+    EXPECT_EQ(hierarchy.GetDepth(b), 3u);
+    EXPECT_EQ(hierarchy.GetLocalPosition(a), Vector3F(1.f, 0.f, 0.f));
+
+    Vector3F origin = hierarchy.GetWorldMatrix(b).MultiplyPoint(Vector3F(0.f));
+    EXPECT_NEAR(origin.x, 3.f, kEps);
+    EXPECT_NEAR(origin.y, 1.f, kEps);
+    EXPECT_NEAR(origin.z, 5.f, kEps);
+
+    std::span<const NodeId> order = hierarchy.GetNodeIds();
+    ASSERT_EQ(order.size(), 4u);
+    for (size_t i = 1; i < order.size(); ++i)
+        EXPECT_LE(hierarchy.GetDepth(order[i - 1]), hierarchy.GetDepth(order[i]));
+
+    hierarchy.SetParent(a, TransformHierarchy::InvalidNode);
+    hierarchy.Update();
+    ExpectMatrixNear(hierarchy.GetWorldMatrix(b), ReferenceWorld(hierarchy, b));
+    EXPECT_EQ(hierarchy.GetDepth(b), 1u);
+}
+
+TEST(TransformHierarchyTest, DestroyRemovesSubtreeAndReusesIds)
+{
+    TransformHierarchy hierarchy;
+    NodeId root = hierarchy.Create();
+    NodeId child = hierarchy.Create(root, Vector3F(1.f, 0.f, 0.f));
+    NodeId grandchild = hierarchy.Create(child);
+    NodeId sibling = hierarchy.Create(root, Vector3F(0.f, 2.f, 0.f));
+    hierarchy.Update();
+
+    hierarchy.SetLocalPosition(grandchild, Vector3F(5.f, 0.f, 0.f));
+    hierarchy.Destroy(child);
+
+    EXPECT_FALSE(hierarchy.IsValid(child));
+    EXPECT_FALSE(hierarchy.IsValid(grandchild));
+    EXPECT_TRUE(hierarchy.IsValid(sibling));
+    EXPECT_EQ(hierarchy.GetNodeCount(), 2u);
+
+    // The pending change of the destroyed grandchild is dropped
+    EXPECT_EQ(hierarchy.Update(), 0u);
+    EXPECT_EQ(hierarchy.GetWorldMatrices().size(), 2u);
+
+    NodeId reused = hierarchy.Create(sibling, Vector3F(0.f, 0.f, 3.f));
+    EXPECT_TRUE(reused == child || reused == grandchild);
+    EXPECT_EQ(hierarchy.Update(), 1u);
+
+    Vector3F origin = hierarchy.GetWorldMatrix(reused).MultiplyPoint(Vector3F(0.f));
+    EXPECT_NEAR(origin.y, 2.f, kEps);
+    EXPECT_NEAR(origin.z, 3.f, kEps);
+
+    hierarchy.SetLocalPosition(root, Vector3F(1.f));
+    EXPECT_EQ(hierarchy.Update(), 3u);
+
+    hierarchy.Clear();
+    EXPECT_EQ(hierarchy.GetNodeCount(), 0u);
+    EXPECT_EQ(hierarchy.Update(), 0u);
+}
\ No newline at end of file
@@ -0,0 +1,112 @@
+﻿#include <gtest/gtest.h>
+#include <cstdint>
+#include <cmath>
+#include <random>
+#include <vector>
+#include "ByteEngine/Math/WorldTransform.h"
+
+using namespace ByteEngine::Math;
+
+// ─────────────────────────────────────────────
+// Helpers
+// ─────────────────────────────────────────────
+
+static constexpr float kEps = 1e-5f;
+
+static void ExpectMatrixNear(const Matrix4x4F& a, const Matrix4x4F& b, float eps = kEps)
+{
+    for (int i = 0; i < Matrix4x4F::ElementCount; ++i)
+        EXPECT_NEAR(a.elements[i], b.elements[i], eps) << "element " << i;
+}
+
+// Objects spread over a 100 km area around a point far from the origin, camera in the middle
+static std::vector<WorldTransform> MakeTransforms(size_t count, Vector3D center, uint32_t seed = 5)
+{
+    std::mt19937 rng(seed);
+    std::uniform_real_distribution<double> position(-50000.0, 50000.0);
+    std::normal_distribution<float> rotation(0.f, 1.f);
+    std::uniform_real_distribution<float> scale(0.5f, 2.f);
+    std::vector<WorldTransform> transforms(count);
+
+    for (WorldTransform& transform : transforms)
+    {
+        Quaternion q(rotation(rng), rotation(rng), rotation(rng), rotation(rng));
+        q.Normalize();
+        transform = WorldTransform(center + Vector3D(position(rng), position(rng) * 0.01, position(rng)), q, Vector3F(scale(rng), scale(rng), scale(rng)));
+    }
+
+    return transforms;
+}
+
+// ─────────────────────────────────────────────
+// WorldTransform
+// ─────────────────────────────────────────────
+
+TEST(WorldTransformTest, MatchesCreateTRSNearOrigin)
+{
+    Quaternion rotation(0.1f, 0.7f, -0.2f, 0.5f);
+    rotation.Normalize();
+    WorldTransform transform(Vector3D(10.0, -4.0, 2.5), rotation, Vector3F(1.f, 2.f, 3.f));
+
+    Matrix4x4F expected = Matrix4x4F::CreateTRS(Vector3F(9.0f, -6.0f, 2.5f), rotation, Vector3F(1.f, 2.f, 3.f));
+    ExpectMatrixNear(transform.ToCameraRelativeMatrix(Vector3D(1.0, 2.0, 0.0)), expected);
+}
+
+TEST(WorldTransformTest, PrecisionFarFromOrigin)
+{
+    // 10 000 km from the origin floats have a spacing of 1 m, an object 1.25 m in front of the camera
+    // must still land exactly there
+    Vector3D camera(1e7 + 0.3, 2.0, -1e7 + 0.7);
+    WorldTransform transform(camera + Vector3D(0.0, 0.0, 1.25), Quaternion::Identity);
+
+    Matrix4x4F relative = transform.ToCameraRelativeMatrix(camera);
+    EXPECT_FLOAT_EQ(relative.m30, 0.f);
+    EXPECT_FLOAT_EQ(relative.m31, 0.f);
+    EXPECT_FLOAT_EQ(relative.m32, 1.25f);
+
+    // The float path loses the offset entirely
+    Vector3F naive = Vector3F(static_cast<float>(transform.position.x), static_cast<float>(transform.position.y), static_cast<float>(transform.position.z))
+        - Vector3F(static_cast<float>(camera.x), static_cast<float>(camera.y), static_cast<float>(camera.z));
+    EXPECT_GT(std::fabs(naive.z - 1.25f), 0.2f);
+}
+
+TEST(WorldTransformTest, BatchMatchesScalar)
+{
+    Vector3D camera(3.2e6, 120.0, -8.9e6);
+
+    for (size_t count : { size_t(0), size_t(1), size_t(7), size_t(8), size_t(9), size_t(1003) })
+    {
+        std::vector<WorldTransform> transforms = MakeTransforms(count, camera);
+        std::vector<Matrix4x4F> results(count);
+        WorldTransform::ToCameraRelativeMatrices(transforms, camera, results);
+
+        for (size_t i = 0; i < count; ++i)
+            ExpectMatrixNear(results[i], transforms[i].ToCameraRelativeMatrix(camera), 1e-5f);
+    }
+}
+
+TEST(WorldTransformTest, ToRelative)
+{
+    Vector3D origin(-6.4e6, 1e5, 2.5e7);
+    std::vector<Vector3D> positions = { origin, origin + Vector3D(0.001, -0.002, 0.003), origin + Vector3D(1234.5, 0.0, -99.25) };
+    std::vector<Vector3F> results(positions.size());
+    Math::ToRelative(positions, origin, results);
+
+    EXPECT_EQ(results[0], Vector3F(0.f));
+    EXPECT_NEAR(results[1].x, 0.001f, 1e-8f);
+    EXPECT_NEAR(results[1].y, -0.002f, 1e-8f);
+    EXPECT_NEAR(results[1].z, 0.003f, 1e-8f);
+    EXPECT_EQ(results[2], Vector3F(1234.5f, 0.f, -99.25f));
+}
+
+TEST(WorldTransformTest, CameraRelativeLookAt)
+{
+    Vector3D eye(1e7, 50.0, 1e7);
+    Matrix4x4F view = Math::CreateCameraRelativeLookAt(eye, eye + Vector3D(0.0, 0.0, 10.0));
+
+    // The eye is the origin of camera-relative space, so the view has no translation
+    ExpectMatrixNear(view, Matrix4x4F::CreateLookAt(Vector3F(0.f), Vector3F(0.f, 0.f, 10.f)));
+    EXPECT_FLOAT_EQ(view.m30, 0.f);
+    EXPECT_FLOAT_EQ(view.m31, 0.f);
+    EXPECT_FLOAT_EQ(view.m32, 0.f);
+}
\ No newline at end of file
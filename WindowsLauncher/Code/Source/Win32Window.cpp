@@ -103,6 +103,7 @@ namespace ByteEngine::WindowsLauncher
         this->title = std::move(title);
         SetWindowText(static_cast<HWND>(handle), this->title.c_str());
         titleChanged.Invoke(this->title);
+        PostEvent(WindowTitleChangedEvent { this->title });
     }
 
     void Win32Window::SetWindowSize(int32 width, int32 height)
@@ -213,6 +214,7 @@ namespace ByteEngine::WindowsLauncher
                 }
 
                 resized.Invoke(size);
+                PostEvent(WindowResizedEvent { size });
             }
 
             return 0;
@@ -235,6 +237,7 @@ namespace ByteEngine::WindowsLauncher
             }
 
             focusStateChanged.Invoke(hasFocus);
+            PostEvent(WindowFocusChangedEvent { hasFocus });
             return 0;
         case WM_CLOSE:
             closeRequested = true;
@@ -435,5 +438,6 @@ namespace ByteEngine::WindowsLauncher
 
         mode = modeToSet;
         modeChanged.Invoke(modeToSet);
+        PostEvent(WindowModeChangedEvent { modeToSet });
     }
 }
\ No newline at end of file